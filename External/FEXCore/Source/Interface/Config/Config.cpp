@@ -242,12 +242,14 @@ namespace FEXCore::Config {
 
   template bool Value<bool>::GetIfExists(FEXCore::Config::ConfigOption Option, bool Default);
   template uint8_t Value<uint8_t>::GetIfExists(FEXCore::Config::ConfigOption Option, uint8_t Default);
+  template uint32_t Value<uint32_t>::GetIfExists(FEXCore::Config::ConfigOption Option, uint32_t Default);
   template uint64_t Value<uint64_t>::GetIfExists(FEXCore::Config::ConfigOption Option, uint64_t Default);
 
   // Constructor
   template Value<std::string>::Value(FEXCore::Config::ConfigOption _Option, std::string Default);
   template Value<bool>::Value(FEXCore::Config::ConfigOption _Option, bool Default);
   template Value<uint8_t>::Value(FEXCore::Config::ConfigOption _Option, uint8_t Default);
+  template Value<uint32_t>::Value(FEXCore::Config::ConfigOption _Option, uint32_t Default);
   template Value<uint64_t>::Value(FEXCore::Config::ConfigOption _Option, uint64_t Default);
 
   template<typename T>
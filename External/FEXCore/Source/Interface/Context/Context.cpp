@@ -2,6 +2,7 @@
 #include "Interface/Context/Context.h"
 #include "Interface/Core/Core.h"
 #include "Interface/Core/OpcodeDispatcher.h"
+#include "Interface/HLE/Thunks/Thunks.h"
 
 #include <FEXCore/Config/Config.h>
 #include <FEXCore/Core/CoreState.h>
@@ -151,6 +152,30 @@ namespace FEXCore::Context {
     return CTX->CPUID.RunFunction(Function);
   }
 
+  void InvalidateGuestCodeRange(FEXCore::Context::Context *CTX, uint64_t Start, uint64_t Length) {
+    CTX->InvalidateGuestCodeRange(Start, Length);
+  }
+
+  bool UnprotectSMCPages(FEXCore::Context::Context *CTX, FEXCore::Core::InternalThreadState *Thread, uint64_t Start, uint64_t Length) {
+    return CTX->UnprotectSMCPages(Thread, Start, Length);
+  }
+
+  bool UnprotectSMCPages(FEXCore::Context::Context *CTX, FEXCore::Core::InternalThreadState *Thread) {
+    return CTX->UnprotectSMCPages(Thread);
+  }
+
+  void AddReadableGuestRange(FEXCore::Context::Context *CTX, uint64_t Start, uint64_t Length) {
+    CTX->AddReadableGuestRange(Start, Length);
+  }
+
+  void RemoveReadableGuestRange(FEXCore::Context::Context *CTX, uint64_t Start, uint64_t Length) {
+    CTX->RemoveReadableGuestRange(Start, Length);
+  }
+
+  void RegisterHostThunk(FEXCore::Context::Context *CTX, const char *Name, void (*Function)(void *ArgsRv)) {
+    CTX->ThunkHandler->RegisterThunk(Name, Function);
+  }
+
 namespace Debug {
   void CompileRIP(FEXCore::Context::Context *CTX, uint64_t RIP) {
     CTX->CompileRIP(CTX->ParentThread, RIP);
@@ -1,9 +1,13 @@
 #pragma once
 #include "Common/JitSymbols.h"
+#include "Interface/Core/AOTIRCache.h"
+#include "Interface/Core/CodeCache.h"
+#include "Interface/Core/CompileService.h"
 #include "Interface/Core/CPUID.h"
 #include "Interface/Core/Frontend.h"
 #include "Interface/Core/HostFeatures.h"
 #include "Interface/Core/InternalThreadState.h"
+#include "Interface/Core/SharedIRCache.h"
 #include "Interface/Core/X86HelperGen.h"
 #include "Interface/IR/PassManager.h"
 #include <FEXCore/Config/Config.h>
@@ -11,8 +15,14 @@
 #include <FEXCore/Utils/Event.h>
 #include <stdint.h>
 
+#include <atomic>
+#include <deque>
+#include <map>
 #include <memory>
 #include <mutex>
+#include <shared_mutex>
+#include <unordered_map>
+#include <unordered_set>
 
 namespace FEXCore {
 class ThunkHandler;
@@ -21,6 +31,7 @@ class GdbServer;
 class SiganlDelegator;
 
 namespace CPU {
+  class InterpreterCore;
   class JITCore;
 }
 namespace HLE {
@@ -43,6 +54,7 @@ namespace FEXCore::Context {
 
   struct Context {
     friend class FEXCore::HLE::SyscallHandler;
+    friend class FEXCore::CPU::InterpreterCore;
     friend class FEXCore::CPU::JITCore;
     friend class FEXCore::IR::Validation::IRValidation;
 
@@ -62,6 +74,10 @@ namespace FEXCore::Context {
       bool SMCChecks {false};
       bool ABILocalFlags {false};
       bool ABINoPF {false};
+      bool LazyFlags {false};
+      bool LinearScanRA {false};
+      bool X87ReducedPrecision {false};
+      bool StaticRegisterAllocation {false};
 
       std::string DumpIR;
 
@@ -103,6 +119,15 @@ namespace FEXCore::Context {
     SignalDelegator *SignalDelegation{};
     X86GeneratedCode X86CodeGen;
 
+    // IR and RA data shared between all guest threads
+    FEXCore::SharedIRCache SharedIR;
+
+    // Host code and the L2 lookup shared between all guest and compile threads
+    std::unique_ptr<FEXCore::CodeCache> CodeCache;
+
+    // Compile threads shared between all guest threads
+    std::unique_ptr<FEXCore::CompileService> CompileService;
+
     Context();
     ~Context();
 
@@ -125,8 +150,29 @@ namespace FEXCore::Context {
     void HandleCallback(uint64_t RIP);
     void RegisterHostSignalHandler(int Signal, HostSignalDelegatorFunction Func);
     void RegisterFrontendHostSignalHandler(int Signal, HostSignalDelegatorFunction Func);
+    // Drops every block decoded from [Start, Start + Length) in all threads, called after the guest changes its mappings
+    void InvalidateGuestCodeRange(uint64_t Start, uint64_t Length);
+    // Tracks which guest memory can be read, only background compiles rely on it
+    // Ranges have to be removed before they are unmapped or lose PROT_READ, removal waits for background decodes reading them
+    void AddReadableGuestRange(uint64_t Start, uint64_t Length);
+    void RemoveReadableGuestRange(uint64_t Start, uint64_t Length);
+    // ReadableGuestRangesMutex has to be held for as long as the range is read
+    bool IsGuestRangeReadable(uint64_t Start, uint64_t Length);
+    // Returns true if the SIGSEGV was a guest write to code protected for SMC detection
+    // Runs in the signal handler, so it only makes the page writable and queues it for FlushSMCWrites
+    bool HandleSMCWriteFault(FEXCore::Core::InternalThreadState *Thread, void *info);
+    // The kernel doesn't fault in to us when a syscall writes to a protected page, the syscall fails with EFAULT
+    // Makes the pages in [Start, Start + Length) writable as if the guest wrote to them, returns true if any were protected
+    bool UnprotectSMCPages(FEXCore::Core::InternalThreadState *Thread, uint64_t Start, uint64_t Length);
+    // Same for every page we protected
+    bool UnprotectSMCPages(FEXCore::Core::InternalThreadState *Thread);
+    // Invalidates the blocks on pages that were written to since the last flush
+    // Every thread calls this from its dispatcher through LookupCache::SafePoint
+    void FlushSMCWrites();
 
     static void RemoveCodeEntry(FEXCore::Core::InternalThreadState *Thread, uint64_t GuestRIP);
+    // Called from first tier code every TIER_UP_INTERVAL executions of an entry point
+    static void PromoteCodeEntry(FEXCore::Core::InternalThreadState *Thread, uint64_t GuestRIP);
 
     // Debugger interface
     void CompileRIP(FEXCore::Core::InternalThreadState *Thread, uint64_t RIP);
@@ -144,8 +190,15 @@ namespace FEXCore::Context {
 
     std::tuple<FEXCore::IR::IRListView<true> *, FEXCore::IR::RegisterAllocationData *, uint64_t, uint64_t> GenerateIR(FEXCore::Core::InternalThreadState *Thread, uint64_t GuestRIP);
 
-    std::tuple<void *, FEXCore::IR::IRListView<true> *, FEXCore::Core::DebugData *, FEXCore::IR::RegisterAllocationData *, bool> CompileCode(FEXCore::Core::InternalThreadState *Thread, uint64_t GuestRIP);
+    // UseIRCaches false always runs the frontend and passes, for when the cached IR turned out to be stale
+    std::tuple<void *, FEXCore::IR::IRListView<true> *, FEXCore::Core::DebugData *, FEXCore::IR::RegisterAllocationData *, bool> CompileCode(FEXCore::Core::InternalThreadState *Thread, uint64_t GuestRIP, bool UseIRCaches = true);
+    // The dispatchers call this one through a member function pointer, it has to keep this signature
     uintptr_t CompileBlock(FEXCore::Core::InternalThreadState *Thread, uint64_t GuestRIP);
+    uintptr_t CompileBlock(FEXCore::Core::InternalThreadState *Thread, uint64_t GuestRIP, bool UseIRCaches);
+    // Generates IR in to the shared IR cache without running the backend
+    void GenerateSharedIR(FEXCore::Core::InternalThreadState *Thread, uint64_t GuestRIP);
+    // The second tier compile of an entry is over, whether or not it produced anything
+    void FinishTierUp(uint64_t GuestRIP);
 
     // Used for thread creation from syscalls
     void InitializeCompiler(FEXCore::Core::InternalThreadState* State, bool CompileThread);
@@ -163,6 +216,7 @@ namespace FEXCore::Context {
 
   protected:
     void ClearCodeCache(FEXCore::Core::InternalThreadState *Thread, bool AlsoClearIRCache);
+    void ClearIRCache(FEXCore::Core::InternalThreadState *Thread);
 
   private:
     void WaitForIdleWithTimeout();
@@ -170,7 +224,7 @@ namespace FEXCore::Context {
     void ExecutionThread(FEXCore::Core::InternalThreadState *Thread);
     void NotifyPause();
 
-    void AddBlockMapping(FEXCore::Core::InternalThreadState *Thread, uint64_t Address, void *Ptr);
+    uintptr_t AddBlockMapping(FEXCore::Core::InternalThreadState *Thread, uint64_t Address, void *Ptr);
 
     FEXCore::CodeLoader *LocalLoader{};
 
@@ -179,13 +233,98 @@ namespace FEXCore::Context {
     void AddThreadRIPsToEntryList(FEXCore::Core::InternalThreadState *Thread);
     void SaveEntryList();
     std::set<uint64_t> EntryList;
+
+    // Precompile
+    void PrecompileEntryList();
+
+    // Speculative compile
+    // Branch targets of freshly compiled blocks get their IR generated on the compile threads
+    void QueueSpeculativeCompile(FEXCore::Core::InternalThreadState *Thread);
+    bool SpeculativeCompile{};
+
+    // Readable guest memory, start to end
+    // Ranges are page aligned and never overlap or touch, a readable range is always inside a single entry
+    std::shared_mutex ReadableGuestRangesMutex;
+    std::map<uint64_t, uint64_t> ReadableGuestRanges;
+
+    // Tiered compile
+    // Guest threads compile a cheap first tier that counts its executions
+    // Hot entry points get recompiled by the compile threads with the full pipeline and picked up through the shared IR cache
+    constexpr static uint32_t TIER_UP_INTERVAL = 1024; // Must be a power of 2
+    struct TierUpCounter {
+      uint32_t ExecutionCount;
+      bool Queued;
+    };
+    uint32_t *GetTierUpCounter(uint64_t GuestRIP);
+    // The entry's code is gone, its counter goes back to the pool
+    void EraseTierUpCounter(uint64_t GuestRIP);
+    bool TieredCompile{};
+    std::mutex TierUpMutex;
+    std::unordered_map<uint64_t, TierUpCounter*> TierUpCounters;
+    // First tier code holds pointers to the counters and can run for a while after its entry is erased
+    // Counters are never freed, only reused. A stale block bumping a reused counter only moves when its new entry tiers up
+    std::deque<TierUpCounter> TierUpCounterPool;
+    std::vector<TierUpCounter*> FreeTierUpCounters;
+
+    // Guest code tracking
+    // Every guest page code was compiled from knows which entries were decoded from it so they can be invalidated
+    // With SMC page protection writable pages are also made read only, the first write to one makes the page
+    // writable again and its blocks are invalidated in all threads the next time a thread goes through its dispatcher
+    struct CodePage {
+      std::unordered_set<uint64_t> Entries;
+    };
+    // Returns false if IR that came from a cache was decoded from guest code that has changed since
+    bool TrackGuestCode(uint64_t GuestRIP, FEXCore::Core::DebugData *DebugData, bool FromCache);
+    void InvalidateCodeEntries(std::unordered_set<uint64_t> const &Entries);
+    // Bumped with CodePagesMutex held on every invalidation
+    // IR stamped with the current count can't be stale unless the guest wrote to code without SMC detection seeing it
+    std::atomic<uint64_t> CodeInvalidationCount{};
+    bool SMCPageProtect{};
+    std::mutex CodePagesMutex;
+    std::unordered_map<uint64_t, CodePage> CodePages;
+
+    // The SIGSEGV handler can't take CodePagesMutex, so it finds the pages protected for SMC detection in here
+    // Slots are only claimed with CodePagesMutex held and never given back, a page keeps its slot once it has one
+    enum SMCPageState : uint32_t {
+      SMC_PAGE_UNPROTECTED,
+      SMC_PAGE_PROTECTED,
+      SMC_PAGE_PENDING, // Written to and writable again, its blocks are still waiting to be invalidated
+    };
+    struct SMCPage {
+      std::atomic<uint64_t> Address;
+      std::atomic<int> Prot; // Protection of the mapping before we touched it
+      std::atomic<uint32_t> State;
+    };
+    constexpr static size_t SMC_PAGE_TABLE_SIZE = 1 << 16; // Must be a power of 2
+    constexpr static size_t SMC_PAGE_TABLE_MASK = SMC_PAGE_TABLE_SIZE - 1;
+    SMCPage *FindSMCPage(uint64_t Address, bool Claim);
+    void ProtectCodePage(uint64_t Address);
+    // Both lock free, called once the page has gone from protected to pending
+    void QueueSMCWrite(FEXCore::Core::InternalThreadState *Thread, SMCPage *Page, uint64_t Address);
+    bool UnprotectSMCPage(FEXCore::Core::InternalThreadState *Thread, SMCPage *Page, uint64_t Address);
+    void FlushSMCWritesLocked();
+    std::unique_ptr<SMCPage[]> SMCPages;
+    // Pages that went pending, a page is only queued once until it is flushed so this can't overflow
+    std::unique_ptr<std::atomic<uint64_t>[]> SMCPendingQueue;
+    std::atomic<uint64_t> SMCPendingHead{};
+    std::atomic<uint64_t> SMCPendingTail{};
+
+    // AOT IR Cache
+    uint64_t GetAOTIRConfigKey();
+    void LoadAOTIRCache();
+    void SaveAOTIRCache();
+    bool FindAOTIREntry(uint64_t GuestRIP, SharedIRCache::Entry *Entry);
+    void RecordGuestRanges(FEXCore::Core::InternalThreadState *Thread, std::vector<FEXCore::Core::DebugDataGuestRange> *GuestRanges, uint64_t *GuestCodeHash);
+    FEXCore::AOTIRCache AOTIR;
+    std::string AOTIRCachePath;
     std::vector<uint64_t> InitLocations;
     uint64_t StartingRIP;
     std::mutex ExitMutex;
     std::unique_ptr<GdbServer> DebugServer;
 
     bool StartPaused = false;
-    FEXCore::Config::Value<std::string> AppFilename{FEXCore::Config::CONFIG_APP_FILENAME, ""};
+    // Calculated at InitCore time since the application filename is set after the Context is created
+    std::string AppFilenameHash;
   };
 
   uint64_t HandleSyscall(FEXCore::HLE::SyscallHandler *Handler, FEXCore::Core::InternalThreadState *Thread, FEXCore::HLE::SyscallArguments *Args);
@@ -0,0 +1,291 @@
+#include "Common/MathUtils.h"
+#include "Interface/Core/AOTIRCache.h"
+
+#include <FEXCore/Utils/LogManager.h>
+
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <string_view>
+#include <sys/mman.h>
+#include <unistd.h>
+
+namespace FEXCore {
+  // "FEXAOTIR"
+  constexpr uint64_t AOTIR_MAGIC = 0x5249544F41584546ULL;
+  constexpr uint32_t AOTIR_VERSION = 1;
+
+  struct AOTIRFileHeader {
+    uint64_t Magic;
+    uint32_t Version;
+    uint32_t Pad;
+    uint64_t ConfigKey;
+    uint64_t EntryCount;
+  };
+
+  // Followed by the guest ranges, IR data, IR list data and RA data
+  struct AOTIREntryHeader {
+    uint64_t GuestRIP;
+    uint64_t GuestCodeHash;
+    uint64_t GuestCodeSize;
+    uint64_t GuestInstructionCount;
+    uint64_t GuestRangeCount;
+    uint64_t IRDataSize;
+    uint64_t IRListSize;
+    uint64_t RADataSize;
+  };
+
+  static bool ContainsHostPointers(FEXCore::IR::IRListView<true> const *IR) {
+    for (auto [CodeNode, IROp] : IR->GetAllCode()) {
+      // Thunks embed the host function pointer and name, direct syscalls embed the handler
+      if (IROp->Op == FEXCore::IR::OP_THUNK ||
+          IROp->Op == FEXCore::IR::OP_SYSCALLDIRECT) {
+        return true;
+      }
+
+      // First tier code embeds pointers to this run's tier up counters
+      if (IROp->Op == FEXCore::IR::OP_PROMOTECODEENTRY) {
+        return true;
+      }
+    }
+    return false;
+  }
+
+  bool AOTIRCache::IsGuestCodeMapped(std::vector<FEXCore::Core::DebugDataGuestRange> const &GuestRanges) {
+    static const size_t PageSize = sysconf(_SC_PAGESIZE);
+    std::vector<unsigned char> Residency;
+
+    for (auto &Range : GuestRanges) {
+      uint64_t Start = Range.GuestCodeStart & ~(PageSize - 1);
+      uint64_t End = AlignUp(Range.GuestCodeStart + Range.GuestCodeSize, PageSize);
+      Residency.resize((End - Start) / PageSize);
+
+      // mincore fails with ENOMEM if any page in the range isn't mapped
+      if (mincore(reinterpret_cast<void*>(Start), End - Start, Residency.data()) != 0) {
+        return false;
+      }
+    }
+
+    return true;
+  }
+
+  uint64_t AOTIRCache::HashGuestCode(std::vector<FEXCore::Core::DebugDataGuestRange> const &GuestRanges) {
+    uint64_t Hash{};
+    std::hash<std::string_view> string_hash;
+
+    for (auto &Range : GuestRanges) {
+      uint64_t RangeHash = string_hash(std::string_view(reinterpret_cast<char const*>(Range.GuestCodeStart), Range.GuestCodeSize));
+      Hash ^= RangeHash + Range.GuestCodeStart + 0x9E3779B97F4A7C15ULL + (Hash << 6) + (Hash >> 2);
+    }
+
+    return Hash;
+  }
+
+  bool AOTIRCache::LoadFile(std::string const &Filename, uint64_t ConfigKey) {
+    std::ifstream Input (Filename.c_str(), std::ios::in | std::ios::binary | std::ios::ate);
+    if (!Input.is_open()) {
+      return false;
+    }
+
+    std::streampos Size;
+    Size = Input.tellg();
+    if (Size <= 0) {
+      return false;
+    }
+    Input.seekg(0, std::ios::beg);
+    std::string Data;
+    Data.resize(Size);
+    Input.read(&Data.at(0), Size);
+    Input.close();
+
+    size_t Offset{};
+    auto Consume = [&](size_t Bytes) -> char const* {
+      if (Data.size() - Offset < Bytes) {
+        return nullptr;
+      }
+      char const *Ptr = &Data.at(Offset);
+      Offset += Bytes;
+      return Ptr;
+    };
+
+    AOTIRFileHeader Header;
+    auto HeaderData = Consume(sizeof(Header));
+    if (!HeaderData) {
+      return false;
+    }
+    memcpy(&Header, HeaderData, sizeof(Header));
+
+    if (Header.Magic != AOTIR_MAGIC ||
+        Header.Version != AOTIR_VERSION ||
+        Header.ConfigKey != ConfigKey) {
+      LogMan::Msg::D("AOT IR cache '%s' doesn't match the current configuration", Filename.c_str());
+      return false;
+    }
+
+    std::unique_lock lk(CacheMutex);
+    for (uint64_t i = 0; i < Header.EntryCount; ++i) {
+      AOTIREntryHeader EntryHeader;
+      auto EntryHeaderData = Consume(sizeof(EntryHeader));
+      if (!EntryHeaderData) {
+        LogMan::Msg::E("AOT IR cache '%s' is truncated", Filename.c_str());
+        break;
+      }
+      memcpy(&EntryHeader, EntryHeaderData, sizeof(EntryHeader));
+
+      size_t RangeSize = EntryHeader.GuestRangeCount * sizeof(FEXCore::Core::DebugDataGuestRange);
+      size_t IRSize = EntryHeader.IRDataSize + EntryHeader.IRListSize;
+      auto RangeData = Consume(RangeSize);
+      auto IRData = Consume(IRSize);
+      auto RAData = Consume(EntryHeader.RADataSize);
+      if (!RangeData || !IRData || !RAData) {
+        LogMan::Msg::E("AOT IR cache '%s' is truncated", Filename.c_str());
+        break;
+      }
+
+      LoadedEntry Entry{};
+      Entry.GuestCodeHash = EntryHeader.GuestCodeHash;
+      Entry.GuestCodeSize = EntryHeader.GuestCodeSize;
+      Entry.GuestInstructionCount = EntryHeader.GuestInstructionCount;
+      Entry.GuestRanges.resize(EntryHeader.GuestRangeCount);
+      memcpy(Entry.GuestRanges.data(), RangeData, RangeSize);
+      Entry.IRData.assign(IRData, IRData + IRSize);
+      Entry.IRDataSize = EntryHeader.IRDataSize;
+      Entry.RAData.assign(RAData, RAData + EntryHeader.RADataSize);
+
+      Entries.insert_or_assign(EntryHeader.GuestRIP, std::move(Entry));
+    }
+
+    return true;
+  }
+
+  bool AOTIRCache::SaveFile(std::string const &Filename, uint64_t ConfigKey, std::map<uint64_t, SaveEntry> const &NewEntries) {
+    // Write to a temporary file first so a concurrent instance never sees a partial cache
+    std::string TempFilename = Filename + "." + std::to_string(::getpid());
+    std::ofstream Output (TempFilename.c_str(), std::ios::out | std::ios::binary);
+    if (!Output.is_open()) {
+      return false;
+    }
+
+    AOTIRFileHeader Header{};
+    Header.Magic = AOTIR_MAGIC;
+    Header.Version = AOTIR_VERSION;
+    Header.ConfigKey = ConfigKey;
+    Output.write(reinterpret_cast<char const*>(&Header), sizeof(Header));
+
+    for (auto &[GuestRIP, Entry] : NewEntries) {
+      if (Entry.DebugData->GuestRanges.empty() ||
+          ContainsHostPointers(Entry.IR)) {
+        continue;
+      }
+
+      AOTIREntryHeader EntryHeader{};
+      EntryHeader.GuestRIP = GuestRIP;
+      EntryHeader.GuestCodeHash = Entry.DebugData->GuestCodeHash;
+      EntryHeader.GuestCodeSize = Entry.DebugData->GuestCodeSize;
+      EntryHeader.GuestInstructionCount = Entry.DebugData->GuestInstructionCount;
+      EntryHeader.GuestRangeCount = Entry.DebugData->GuestRanges.size();
+      EntryHeader.IRDataSize = Entry.IR->GetDataSize();
+      EntryHeader.IRListSize = Entry.IR->GetListSize();
+      EntryHeader.RADataSize = Entry.RAData ? Entry.RAData->Size() : 0;
+
+      Output.write(reinterpret_cast<char const*>(&EntryHeader), sizeof(EntryHeader));
+      Output.write(reinterpret_cast<char const*>(Entry.DebugData->GuestRanges.data()), EntryHeader.GuestRangeCount * sizeof(FEXCore::Core::DebugDataGuestRange));
+      Output.write(reinterpret_cast<char const*>(Entry.IR->GetData()), EntryHeader.IRDataSize);
+      Output.write(reinterpret_cast<char const*>(Entry.IR->GetListData()), EntryHeader.IRListSize);
+      if (Entry.RAData) {
+        Output.write(reinterpret_cast<char const*>(Entry.RAData), EntryHeader.RADataSize);
+      }
+
+      ++Header.EntryCount;
+    }
+
+    {
+      std::unique_lock lk(CacheMutex);
+      for (auto &[GuestRIP, Entry] : Entries) {
+        if (NewEntries.find(GuestRIP) != NewEntries.end()) {
+          continue;
+        }
+
+        AOTIREntryHeader EntryHeader{};
+        EntryHeader.GuestRIP = GuestRIP;
+        EntryHeader.GuestCodeHash = Entry.GuestCodeHash;
+        EntryHeader.GuestCodeSize = Entry.GuestCodeSize;
+        EntryHeader.GuestInstructionCount = Entry.GuestInstructionCount;
+        EntryHeader.GuestRangeCount = Entry.GuestRanges.size();
+        EntryHeader.IRDataSize = Entry.IRDataSize;
+        EntryHeader.IRListSize = Entry.IRData.size() - Entry.IRDataSize;
+        EntryHeader.RADataSize = Entry.RAData.size();
+
+        Output.write(reinterpret_cast<char const*>(&EntryHeader), sizeof(EntryHeader));
+        Output.write(reinterpret_cast<char const*>(Entry.GuestRanges.data()), EntryHeader.GuestRangeCount * sizeof(FEXCore::Core::DebugDataGuestRange));
+        Output.write(reinterpret_cast<char const*>(Entry.IRData.data()), Entry.IRData.size());
+        Output.write(reinterpret_cast<char const*>(Entry.RAData.data()), Entry.RAData.size());
+
+        ++Header.EntryCount;
+      }
+    }
+
+    // Now that we know how many entries were written, update the header
+    Output.seekp(0, std::ios::beg);
+    Output.write(reinterpret_cast<char const*>(&Header), sizeof(Header));
+    Output.close();
+
+    if (Output.fail() || rename(TempFilename.c_str(), Filename.c_str()) != 0) {
+      unlink(TempFilename.c_str());
+      return false;
+    }
+
+    return true;
+  }
+
+  bool AOTIRCache::Find(uint64_t GuestRIP, SharedIRCache::Entry *Result) {
+    LoadedEntry Entry;
+
+    {
+      std::unique_lock lk(CacheMutex);
+      auto it = Entries.find(GuestRIP);
+      if (it == Entries.end()) {
+        return false;
+      }
+
+      Entry = std::move(it->second);
+      Entries.erase(it);
+    }
+
+    // The code might be from a library that is now mapped elsewhere or has changed
+    if (!IsGuestCodeMapped(Entry.GuestRanges) ||
+        HashGuestCode(Entry.GuestRanges) != Entry.GuestCodeHash) {
+      return false;
+    }
+
+    Result->IR = std::make_shared<FEXCore::IR::IRListView<true>>(
+      Entry.IRData.data(), Entry.IRDataSize,
+      Entry.IRData.data() + Entry.IRDataSize, Entry.IRData.size() - Entry.IRDataSize);
+
+    if (!Entry.RAData.empty()) {
+      auto RAData = reinterpret_cast<FEXCore::IR::RegisterAllocationData*>(malloc(Entry.RAData.size()));
+      memcpy(RAData, Entry.RAData.data(), Entry.RAData.size());
+      Result->RAData = std::shared_ptr<FEXCore::IR::RegisterAllocationData>(RAData, FEXCore::IR::RegisterAllocationDataDeleter{});
+    }
+    else {
+      Result->RAData.reset();
+    }
+
+    Result->GuestCodeSize = Entry.GuestCodeSize;
+    Result->GuestInstructionCount = Entry.GuestInstructionCount;
+    Result->GuestRanges = std::move(Entry.GuestRanges);
+    Result->GuestCodeHash = Entry.GuestCodeHash;
+
+    return true;
+  }
+
+  bool AOTIRCache::Contains(uint64_t GuestRIP) {
+    std::unique_lock lk(CacheMutex);
+    return Entries.find(GuestRIP) != Entries.end();
+  }
+
+  size_t AOTIRCache::Size() {
+    std::unique_lock lk(CacheMutex);
+    return Entries.size();
+  }
+}
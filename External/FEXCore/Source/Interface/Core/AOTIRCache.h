@@ -0,0 +1,65 @@
+#pragma once
+#include "Interface/Core/SharedIRCache.h"
+
+#include <FEXCore/Debug/InternalThreadState.h>
+#include <FEXCore/IR/IntrusiveIRList.h>
+#include <FEXCore/IR/RegisterAllocationData.h>
+
+#include <map>
+#include <mutex>
+#include <stdint.h>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace FEXCore {
+/**
+ * @brief On-disk cache of post-pass IR and register allocation data
+ *
+ * The cache file is keyed by the application's file hash and the FEX build, the header additionally stores the
+ * configuration the IR was generated with.
+ * Entries are loaded up front but only handed out once the guest code they were generated from has been
+ * rehashed and found unchanged, at which point only the backend needs to run.
+ *
+ * Host code isn't stored since the backends emit thread specific dispatcher addresses in to blocks.
+ */
+class AOTIRCache final {
+public:
+  struct SaveEntry {
+    FEXCore::IR::IRListView<true> const *IR;
+    FEXCore::IR::RegisterAllocationData const *RAData;
+    FEXCore::Core::DebugData const *DebugData;
+  };
+
+  bool LoadFile(std::string const &Filename, uint64_t ConfigKey);
+  // Loaded entries that were never used in this run are written back out alongside the new ones
+  bool SaveFile(std::string const &Filename, uint64_t ConfigKey, std::map<uint64_t, SaveEntry> const &NewEntries);
+
+  /**
+   * @brief Hands out a loaded entry if the guest code still matches
+   *
+   * The entry is removed from the cache regardless of the result
+   */
+  bool Find(uint64_t GuestRIP, SharedIRCache::Entry *Result);
+  bool Contains(uint64_t GuestRIP);
+
+  static uint64_t HashGuestCode(std::vector<FEXCore::Core::DebugDataGuestRange> const &GuestRanges);
+  static bool IsGuestCodeMapped(std::vector<FEXCore::Core::DebugDataGuestRange> const &GuestRanges);
+
+  size_t Size();
+
+private:
+  struct LoadedEntry {
+    uint64_t GuestCodeHash;
+    uint64_t GuestCodeSize;
+    uint64_t GuestInstructionCount;
+    std::vector<FEXCore::Core::DebugDataGuestRange> GuestRanges;
+    std::vector<uint8_t> IRData;
+    uint64_t IRDataSize;
+    std::vector<uint8_t> RAData;
+  };
+
+  std::mutex CacheMutex;
+  std::unordered_map<uint64_t, LoadedEntry> Entries;
+};
+}
@@ -0,0 +1,548 @@
+#include "Common/MathUtils.h"
+#include "Interface/Core/CodeCache.h"
+#include "Interface/Core/LookupCache.h"
+
+#include <FEXCore/Utils/LogManager.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <sys/mman.h>
+
+namespace FEXCore {
+CodeRegion::CodeRegion(size_t FirstGenerationSize, size_t MaxGenerationSize, size_t NumGenerations, bool Executable) {
+  size_t GenerationSize = FirstGenerationSize;
+  for (size_t i = 0; i < NumGenerations; ++i) {
+    Generations.emplace_back(Generation{reinterpret_cast<uint8_t*>(Size), GenerationSize});
+    Size += GenerationSize;
+    GenerationSize = std::min(GenerationSize * 2, MaxGenerationSize);
+  }
+
+  // L2 entries are signed 32bit offsets from the base
+  LogMan::Throw::A(Size < (1ULL << 31), "Code region is too large for L2 to encode");
+
+  int Prot = PROT_READ | PROT_WRITE | (Executable ? PROT_EXEC : 0);
+  void *Ptr = mmap(nullptr, Size, Prot, MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0);
+  LogMan::Throw::A(Ptr != MAP_FAILED, "Couldn't reserve code region");
+  Base = reinterpret_cast<uintptr_t>(Ptr);
+
+  for (auto &Gen : Generations) {
+    Gen.Ptr += Base;
+  }
+}
+
+CodeRegion::~CodeRegion() {
+  munmap(reinterpret_cast<void*>(Base), Size);
+}
+
+void CodeRegion::Release(Generation Gen) {
+  madvise(Gen.Ptr, Gen.Size, MADV_DONTNEED);
+}
+
+CodeCache::CodeCache(size_t FirstGenerationSize, size_t MaxGenerationSize, size_t NumGenerations, bool Executable)
+  : Region {FirstGenerationSize, MaxGenerationSize, NumGenerations, Executable}
+  , Overflow {OVERFLOW_GENERATION_SIZE, OVERFLOW_GENERATION_SIZE, OVERFLOW_GENERATIONS, Executable} {
+
+  for (size_t i = 0; i < Region.GetNumGenerations(); ++i) {
+    auto Gen = Region.GetGeneration(i);
+    Generations.emplace_back(GenerationInfo{Gen.Ptr, Gen.Size, 0, GenerationState::Free, 0, 0, false});
+  }
+
+  for (size_t i = 0; i < Overflow.GetNumGenerations(); ++i) {
+    auto Gen = Overflow.GetGeneration(i);
+    Generations.emplace_back(GenerationInfo{Gen.Ptr, Gen.Size, 0, GenerationState::Free, 0, 0, true});
+  }
+
+  // Offset by one so code at the base itself doesn't encode to an empty entry
+  // Overflow code is never cached in L2, only in each thread's L1
+  HostCodeBase = Region.GetBase() - 1;
+
+  // Block cache ends up looking like this
+  // Root[Address >> 36]
+  //       |
+  //       v
+  // Directory[(Address >> 24) & 0xFFF]
+  //       |
+  //       v
+  // Table[(Address >> 12) & 0xFFF]
+  //       |
+  //       v
+  // Page[Address & 0xFFF]
+  //       |
+  //       v
+  // Offset to Code from HostCodeBase
+  //
+  // Only the root is allocated up front, it covers the full 47bit guest address space in 16KB.
+  // Directories, tables and pages are allocated from the page memory as code is cached, so the memory used
+  // scales with the amount of code touched rather than the size of the address space.
+  RootPointer = reinterpret_cast<uintptr_t>(mmap(nullptr, ROOT_SIZE, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0));
+  LogMan::Throw::A(RootPointer != -1ULL, "Failed to allocate root pointer");
+
+  // Allocate our memory backing our pages and the directory levels above them
+  // We need 16KB per guest page (One 4byte offset per byte)
+  // We currently limit to 128MB of real memory for caching for the total cache size.
+  // Can end up being inefficient if we compile a small number of blocks per page
+  PageMemory = reinterpret_cast<uintptr_t>(mmap(nullptr, CODE_SIZE, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0));
+  LogMan::Throw::A(PageMemory != -1ULL, "Failed to allocate page memory");
+
+  for (size_t i = 0; i < L2Halves.size(); ++i) {
+    L2Halves[i] = L2Backing{PageMemory + i * (CODE_SIZE / 2), 0, false, 0};
+  }
+}
+
+CodeCache::~CodeCache() {
+  munmap(reinterpret_cast<void*>(RootPointer), ROOT_SIZE);
+  munmap(reinterpret_cast<void*>(PageMemory), CODE_SIZE);
+}
+
+uintptr_t CodeCache::FindBlock(uint64_t Address) {
+  // L2 can be walked without the lock, writers publish each level before linking it in
+  auto Entry = WalkL2(Address, false);
+  if (Entry) {
+    auto Offset = __atomic_load_n(Entry, __ATOMIC_ACQUIRE);
+    if (Offset) {
+      return HostCodeBase + Offset;
+    }
+  }
+
+  std::scoped_lock<std::recursive_mutex> lk(WriteLock);
+  auto HostCode = BlockList.Find(Address);
+  if (HostCode) {
+    CacheBlockMapping(Address, HostCode);
+  }
+  return HostCode;
+}
+
+uintptr_t CodeCache::AddBlockMapping(uint64_t Address, uintptr_t HostCode) {
+  std::scoped_lock<std::recursive_mutex> lk(WriteLock);
+
+  // Another thread compiled the same block first, everyone uses theirs
+  if (auto Existing = BlockList.Find(Address)) {
+    return Existing;
+  }
+
+  // The generation was retired while this was being compiled, its erasures have already been logged
+  if (!IsLive(HostCode)) {
+    return 0;
+  }
+
+  BlockList.Insert(Address, HostCode);
+
+  // no need to update L1 or L2, they will get updated on first lookup
+  return HostCode;
+}
+
+void CodeCache::Erase(uint64_t Address) {
+  std::scoped_lock<std::recursive_mutex> lk(WriteLock);
+
+  // Sever any links to this block
+  auto Page = BlockLinks.find(Address >> 12);
+  if (Page != BlockLinks.end()) {
+    auto &Links = Page->second;
+    for (size_t i = 0; i < Links.size();) {
+      if (Links[i].GuestDestination == Address) {
+        Links[i].Delinker(Links[i].HostLink, Links[i].LinkerAddress);
+        // Order doesn't matter, fill the hole with the last link
+        Links[i] = Links.back();
+        Links.pop_back();
+      }
+      else {
+        ++i;
+      }
+    }
+
+    if (Links.empty()) {
+      BlockLinks.erase(Page);
+    }
+  }
+
+  // Remove from BlockList
+  BlockList.Erase(Address);
+
+  // Do full map
+  auto Entry = WalkL2(Address, false);
+  if (Entry) {
+    // Page exists, just set the offset to zero
+    __atomic_store_n(Entry, 0, __ATOMIC_RELEASE);
+  }
+
+  // Do L1
+  // Only the guest address is cleared, the owner's dispatcher can be between loading the two fields.
+  // This is best effort, an owner refilling the entry at the same time catches the erase from the log.
+  for (auto Participant : Participants) {
+    auto &L1Entry = reinterpret_cast<LookupCache::LookupCacheEntry*>(Participant->GetL1Pointer())[Address & LookupCache::L1_ENTRIES_MASK];
+    if (L1Entry.GuestCode == Address) {
+      __atomic_store_n(&L1Entry.GuestCode, 0, __ATOMIC_RELAXED);
+    }
+  }
+
+  LogErase(Address);
+}
+
+bool CodeCache::AddBlockLink(uint64_t GuestDestination, uintptr_t HostCode, uintptr_t HostLink, uintptr_t LinkerAddress,
+                             BlockLinkerFunc Linker, BlockDelinkerFunc Delinker) {
+  std::scoped_lock<std::recursive_mutex> lk(WriteLock);
+
+  // The lookup that found HostCode happened without the lock, it may have been erased since
+  if (BlockList.Find(GuestDestination) != HostCode || !IsLive(HostLink)) {
+    return false;
+  }
+
+  BlockLinks[GuestDestination >> 12].emplace_back(BlockLinkEntry{GuestDestination, HostLink, LinkerAddress, Delinker});
+  Linker(HostLink, HostCode);
+  return true;
+}
+
+void CodeCache::Clear() {
+  std::scoped_lock<std::recursive_mutex> lk(WriteLock);
+
+  // Every link is in code that is being retired, nothing needs undoing
+  BlockLinks.clear();
+  BlockList.Clear();
+
+  uint64_t RetireEpoch = BumpEpoch();
+  while (!LiveGenerations.empty()) {
+    auto &Gen = Generations[LiveGenerations.front()];
+    LiveGenerations.pop_front();
+    Gen.State = GenerationState::Retiring;
+    Gen.RetireEpoch = RetireEpoch;
+  }
+
+  RetireL2();
+
+  // Skip the log far enough ahead that every thread clears its whole L1
+  __atomic_store_n(&EraseCount, EraseCount + ERASE_LOG_SIZE + 1, __ATOMIC_RELEASE);
+}
+
+void CodeCache::EraseHostRange(uintptr_t Start, uintptr_t End) {
+  std::scoped_lock<std::recursive_mutex> lk(WriteLock);
+
+  for (auto Page = BlockLinks.begin(); Page != BlockLinks.end();) {
+    auto &Links = Page->second;
+    for (size_t i = 0; i < Links.size();) {
+      if (Links[i].HostLink >= Start && Links[i].HostLink < End) {
+        // Order doesn't matter, fill the hole with the last link
+        Links[i] = Links.back();
+        Links.pop_back();
+      }
+      else {
+        ++i;
+      }
+    }
+
+    if (Links.empty()) {
+      Page = BlockLinks.erase(Page);
+    }
+    else {
+      ++Page;
+    }
+  }
+
+  std::vector<uint64_t> Blocks;
+  BlockList.ForEach([&Blocks, Start, End](uint64_t GuestCode, uintptr_t HostCode) {
+    if (HostCode >= Start && HostCode < End) {
+      Blocks.emplace_back(GuestCode);
+    }
+  });
+
+  // Erasing also undoes links from surviving blocks in to these
+  for (auto Address : Blocks) {
+    Erase(Address);
+  }
+}
+
+CodeCache::CodeChunk CodeCache::ReserveCode(LookupCache *Participant, size_t MinSize, bool CanAcknowledge) {
+  std::scoped_lock<std::recursive_mutex> lk(WriteLock);
+
+  auto Gen = &Generations[Participant->ChunkGeneration];
+  bool Valid = Participant->ChunkPtr &&
+    Gen->State == GenerationState::Live &&
+    Gen->Incarnation == Participant->ChunkIncarnation &&
+    static_cast<size_t>(Participant->ChunkEnd - Participant->ChunkPtr) >= MinSize;
+
+  if (!Valid) {
+    size_t Size = AlignUp(std::max(CHUNK_SIZE, MinSize), 16);
+    if (LiveGenerations.empty() ||
+        Generations[LiveGenerations.back()].Size - Generations[LiveGenerations.back()].Used < Size) {
+      NewGeneration(Participant, Size, CanAcknowledge);
+    }
+
+    size_t Index = LiveGenerations.back();
+    Gen = &Generations[Index];
+    Participant->ChunkPtr = Gen->Ptr + Gen->Used;
+    Participant->ChunkEnd = Participant->ChunkPtr + Size;
+    Participant->ChunkGeneration = Index;
+    Participant->ChunkIncarnation = Gen->Incarnation;
+    Gen->Used += Size;
+  }
+
+  return CodeChunk{Participant->ChunkPtr, static_cast<size_t>(Participant->ChunkEnd - Participant->ChunkPtr)};
+}
+
+void CodeCache::Register(LookupCache *Participant) {
+  std::scoped_lock<std::recursive_mutex> lk(WriteLock);
+  Participants.emplace_back(Participant);
+}
+
+void CodeCache::Unregister(LookupCache *Participant) {
+  std::scoped_lock<std::recursive_mutex> lk(WriteLock);
+  Participants.erase(std::find(Participants.begin(), Participants.end(), Participant));
+  Reclaim();
+  Acknowledged.notify_all();
+}
+
+void CodeCache::SetActive(LookupCache *Participant, bool Active) {
+  std::scoped_lock<std::recursive_mutex> lk(WriteLock);
+  Participant->Active = Active;
+  // Whatever was retired before now can't be referenced from anything this participant runs next
+  Participant->AckedEpoch = Epoch;
+  // The participant's chunk is left alone, ReserveCode notices if its generation gets retired in the meantime
+  Reclaim();
+  Acknowledged.notify_all();
+}
+
+void CodeCache::Acknowledge(LookupCache *Participant, uint64_t AckEpoch) {
+  std::scoped_lock<std::recursive_mutex> lk(WriteLock);
+  Participant->AckedEpoch = AckEpoch;
+  Reclaim();
+  Acknowledged.notify_all();
+}
+
+CodeCache::GenerationInfo *CodeCache::FindGeneration(uintptr_t Address) {
+  for (auto &Gen : Generations) {
+    if ((Address - reinterpret_cast<uintptr_t>(Gen.Ptr)) < Gen.Size) {
+      return &Gen;
+    }
+  }
+  return nullptr;
+}
+
+void CodeCache::NewGeneration(LookupCache *Requester, size_t MinSize, bool CanAcknowledge) {
+  auto Take = [this, MinSize](bool IsOverflow) {
+    for (size_t i = 0; i < Generations.size(); ++i) {
+      auto &Gen = Generations[i];
+      if (Gen.State == GenerationState::Free && Gen.IsOverflow == IsOverflow && Gen.Size >= MinSize) {
+        Gen.State = GenerationState::Live;
+        LiveGenerations.emplace_back(i);
+        return true;
+      }
+    }
+    return false;
+  };
+
+  // Nothing further up the requester's stack can be in retired code, it doesn't have to go back through its dispatcher
+  auto AcknowledgeRequester = [this, Requester, CanAcknowledge]() {
+    if (CanAcknowledge && Requester->Active) {
+      Requester->AckedEpoch = Epoch;
+    }
+  };
+
+  // Prefer memory L2 can encode
+  AcknowledgeRequester();
+  Reclaim();
+  if (Take(false)) {
+    return;
+  }
+
+  // Out of it, retire the oldest code. It is reused once every thread has moved past it
+  if (!LiveGenerations.empty()) {
+    RetireOldestGeneration();
+    AcknowledgeRequester();
+    Reclaim();
+    if (Take(false)) {
+      return;
+    }
+  }
+
+  if (Take(true)) {
+    return;
+  }
+
+  // Retirement sent every running thread back through its dispatcher and threads blocked in syscalls don't hold
+  // anything back, so this only waits on threads that are still busy in a thunk or under a signal handler
+  // Only ReserveCode's lock is held, waiting drops it
+  LogMan::Msg::D("Out of code memory, waiting for retired code to be acknowledged");
+  do {
+    Acknowledged.wait_for(WriteLock, std::chrono::milliseconds(1));
+    AcknowledgeRequester();
+    Reclaim();
+  } while (!Take(false) && !Take(true));
+}
+
+void CodeCache::RetireOldestGeneration() {
+  auto &Gen = Generations[LiveGenerations.front()];
+  LiveGenerations.pop_front();
+  Gen.State = GenerationState::Retiring;
+  // Nothing can be reclaimed until the epoch is bumped below
+  Gen.RetireEpoch = ~0ULL;
+
+  uintptr_t Start = reinterpret_cast<uintptr_t>(Gen.Ptr);
+  EraseHostRange(Start, Start + Gen.Size);
+
+  // Surviving blocks that branch straight in to each other could keep a thread out of its dispatcher
+  // and stop it acknowledging this, send every link back through the linker
+  DelinkAll();
+
+  Gen.RetireEpoch = BumpEpoch();
+}
+
+bool CodeCache::IsHeld(GenerationInfo const &Gen) const {
+  for (auto Participant : Participants) {
+    uintptr_t HeldCode = Participant->GetHeldCode();
+    if (Participant->Active && (HeldCode - reinterpret_cast<uintptr_t>(Gen.Ptr)) < Gen.Size) {
+      return true;
+    }
+  }
+  return false;
+}
+
+void CodeCache::Reclaim() {
+  uint64_t Oldest = Epoch;
+  for (auto Participant : Participants) {
+    // Blocked in a syscall the thread only comes back to its held code, its L1 catches up before it is used again
+    if (Participant->Active && !Participant->GetHeldCode()) {
+      Oldest = std::min(Oldest, Participant->AckedEpoch);
+    }
+  }
+
+  for (size_t i = 0; i < Generations.size(); ++i) {
+    auto &Gen = Generations[i];
+    if (Gen.State == GenerationState::Retiring && Gen.RetireEpoch <= Oldest && !IsHeld(Gen)) {
+      auto &Owner = Gen.IsOverflow ? Overflow : Region;
+      Owner.Release(CodeRegion::Generation{Gen.Ptr, Gen.Size});
+      Gen.State = GenerationState::Free;
+      Gen.Used = 0;
+      ++Gen.Incarnation;
+    }
+  }
+
+  bool Reclaimed{};
+  for (auto &Half : L2Halves) {
+    if (Half.Retiring && Half.RetireEpoch <= Oldest) {
+      madvise(reinterpret_cast<void*>(Half.Ptr), CODE_SIZE / 2, MADV_DONTNEED);
+      Half.Used = 0;
+      Half.Retiring = false;
+      Reclaimed = true;
+    }
+  }
+
+  if (Reclaimed && !L2Enabled) {
+    for (size_t i = 0; i < L2Halves.size(); ++i) {
+      if (!L2Halves[i].Retiring) {
+        CurrentL2Half = i;
+        L2Enabled = true;
+        break;
+      }
+    }
+  }
+}
+
+uint64_t CodeCache::BumpEpoch() {
+  uint64_t NewEpoch = Epoch + 1;
+  __atomic_store_n(&Epoch, NewEpoch, __ATOMIC_RELEASE);
+  LogErase(RETIRE_MARKER);
+  return NewEpoch;
+}
+
+void CodeCache::LogErase(uint64_t Address) {
+  __atomic_store_n(&EraseLog[EraseCount & ERASE_LOG_MASK], Address, __ATOMIC_RELAXED);
+  __atomic_store_n(&EraseCount, EraseCount + 1, __ATOMIC_RELEASE);
+}
+
+void CodeCache::DelinkAll() {
+  for (auto &Page : BlockLinks) {
+    for (auto &Link : Page.second) {
+      Link.Delinker(Link.HostLink, Link.LinkerAddress);
+    }
+  }
+  BlockLinks.clear();
+}
+
+void CodeCache::CacheBlockMapping(uint64_t Address, uintptr_t HostCode) {
+  int64_t Offset = HostCode - HostCodeBase;
+  if ((Address >> GUEST_ADDRESS_BITS) || Offset == 0 || Offset != static_cast<L2Entry>(Offset)) {
+    // L2 can't hold this, the thread looking it up keeps it in its L1
+    return;
+  }
+
+  auto Entry = WalkL2(Address, true);
+  if (!Entry) {
+    // Couldn't allocate, start over in the other half of the page memory and retry
+    RetireL2();
+    Entry = WalkL2(Address, true);
+    if (!Entry) {
+      // The other half is still waiting on threads, leave this to L1 until it is free
+      return;
+    }
+  }
+
+  // This silently replaces existing mappings
+  __atomic_store_n(Entry, static_cast<L2Entry>(Offset), __ATOMIC_RELEASE);
+}
+
+uintptr_t CodeCache::AllocateBacking(size_t Size) {
+  if (!L2Enabled) {
+    return 0;
+  }
+
+  auto &Half = L2Halves[CurrentL2Half];
+  if (Half.Used + Size > CODE_SIZE / 2) {
+    // We ran out of block backing space, the caller needs to retire this half
+    return 0;
+  }
+
+  uintptr_t NewBase = Half.Ptr + Half.Used;
+  Half.Used += Size;
+  return NewBase;
+}
+
+void CodeCache::RetireL2() {
+  // Dispatchers can still be walking the old levels, only unhook them from the root
+  for (size_t i = 0; i < ROOT_ENTRIES; ++i) {
+    __atomic_store_n(&reinterpret_cast<uintptr_t*>(RootPointer)[i], 0, __ATOMIC_RELEASE);
+  }
+
+  if (L2Enabled) {
+    auto &Half = L2Halves[CurrentL2Half];
+    Half.Retiring = true;
+    Half.RetireEpoch = BumpEpoch();
+  }
+
+  // Switch to the other half if every thread has moved off it, otherwise L2 stays off until it has
+  L2Enabled = false;
+  Reclaim();
+}
+
+CodeCache::L2Entry *CodeCache::WalkL2(uint64_t Address, bool Allocate) {
+  if (Address >> GUEST_ADDRESS_BITS) {
+    return nullptr;
+  }
+
+  auto Walk = [this, Allocate](uintptr_t *Level, size_t Index, size_t Size) -> uintptr_t {
+    auto Next = __atomic_load_n(&Level[Index], __ATOMIC_ACQUIRE);
+    if (!Next && Allocate) {
+      // Fresh backing reads as zero so it is fully formed before it is published
+      Next = AllocateBacking(Size);
+      __atomic_store_n(&Level[Index], Next, __ATOMIC_RELEASE);
+    }
+    return Next;
+  };
+
+  auto Directory = Walk(reinterpret_cast<uintptr_t*>(RootPointer), Address >> ROOT_SHIFT, TABLE_SIZE);
+  if (!Directory) {
+    return nullptr;
+  }
+
+  auto Table = Walk(reinterpret_cast<uintptr_t*>(Directory), (Address >> DIRECTORY_SHIFT) & TABLE_MASK, TABLE_SIZE);
+  if (!Table) {
+    return nullptr;
+  }
+
+  auto Page = Walk(reinterpret_cast<uintptr_t*>(Table), (Address >> TABLE_SHIFT) & TABLE_MASK, SIZE_PER_PAGE);
+  if (!Page) {
+    return nullptr;
+  }
+
+  return &reinterpret_cast<L2Entry*>(Page)[Address & PAGE_MASK];
+}
+}
@@ -0,0 +1,422 @@
+#pragma once
+#include <array>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+namespace FEXCore {
+class LookupCache;
+
+/**
+ * @brief A single host reservation that every generation of backend code is carved out of
+ *
+ * L2 lookup entries are 32bit offsets from one base address. Keeping every generation inside one reservation
+ * that never moves lets the base be set once, so blocks in any generation can be cached in L2.
+ * Pages are only committed as they are written.
+ */
+class CodeRegion final {
+public:
+  struct Generation {
+    uint8_t *Ptr;
+    size_t Size;
+  };
+
+  /**
+   * @param FirstGenerationSize Size of generation 0, each one after it is double the last
+   * @param MaxGenerationSize Generations don't grow past this
+   * @param NumGenerations How many generations the region holds
+   * @param Executable Map the region RWX instead of RW
+   */
+  CodeRegion(size_t FirstGenerationSize, size_t MaxGenerationSize, size_t NumGenerations, bool Executable);
+  ~CodeRegion();
+
+  CodeRegion(CodeRegion const&) = delete;
+  CodeRegion &operator=(CodeRegion const&) = delete;
+
+  uintptr_t GetBase() const { return Base; }
+  size_t GetSize() const { return Size; }
+  bool Contains(uintptr_t Address) const { return (Address - Base) < Size; }
+
+  size_t GetNumGenerations() const { return Generations.size(); }
+  Generation GetGeneration(size_t Index) const { return Generations[Index]; }
+
+  /**
+   * @brief Gives a generation's pages back to the kernel
+   *
+   * The range stays reserved and reads back as zero
+   */
+  void Release(Generation Gen);
+
+private:
+  uintptr_t Base{};
+  size_t Size{};
+  std::vector<Generation> Generations;
+};
+
+/**
+ * @brief Open addressing hash of guest RIP to host code
+ *
+ * Linear probing over a flat array of entries with backward shift deletion, so there are no tombstones.
+ * Host code is never null, a zero HostCode marks an empty slot.
+ */
+class BlockListMap final {
+public:
+  BlockListMap() {
+    Entries.resize(INITIAL_SIZE);
+  }
+
+  uintptr_t Find(uint64_t Address) const {
+    size_t Mask = Entries.size() - 1;
+    for (size_t i = Hash(Address) & Mask;; i = (i + 1) & Mask) {
+      auto &Entry = Entries[i];
+      if (Entry.HostCode == 0) {
+        return 0;
+      }
+      if (Entry.GuestCode == Address) {
+        return Entry.HostCode;
+      }
+    }
+  }
+
+  bool Insert(uint64_t Address, uintptr_t HostCode) {
+    // Keep the load factor under a half
+    if ((Count + 1) * 2 > Entries.size()) {
+      Grow();
+    }
+
+    size_t Mask = Entries.size() - 1;
+    for (size_t i = Hash(Address) & Mask;; i = (i + 1) & Mask) {
+      auto &Entry = Entries[i];
+      if (Entry.HostCode == 0) {
+        Entry.GuestCode = Address;
+        Entry.HostCode = HostCode;
+        ++Count;
+        return true;
+      }
+      if (Entry.GuestCode == Address) {
+        return false;
+      }
+    }
+  }
+
+  void Erase(uint64_t Address) {
+    size_t Mask = Entries.size() - 1;
+    size_t i = Hash(Address) & Mask;
+    for (;; i = (i + 1) & Mask) {
+      if (Entries[i].HostCode == 0) {
+        return;
+      }
+      if (Entries[i].GuestCode == Address) {
+        break;
+      }
+    }
+
+    // Shift back any following entries that would no longer be reachable from their home slot
+    size_t Hole = i;
+    for (size_t j = (i + 1) & Mask; Entries[j].HostCode != 0; j = (j + 1) & Mask) {
+      size_t Home = Hash(Entries[j].GuestCode) & Mask;
+      if (((j - Home) & Mask) >= ((j - Hole) & Mask)) {
+        Entries[Hole] = Entries[j];
+        Hole = j;
+      }
+    }
+    Entries[Hole] = {};
+    --Count;
+  }
+
+  // Calls Func(GuestCode, HostCode) for every entry, the map must not be modified while walking it
+  template<typename F>
+  void ForEach(F Func) const {
+    for (auto &Entry : Entries) {
+      if (Entry.HostCode) {
+        Func(Entry.GuestCode, Entry.HostCode);
+      }
+    }
+  }
+
+  void Clear() {
+    Entries.clear();
+    Entries.resize(INITIAL_SIZE);
+    HashShift = INITIAL_HASH_SHIFT;
+    Count = 0;
+  }
+
+  size_t Size() const { return Count; }
+
+private:
+  struct Entry {
+    uint64_t GuestCode;
+    uintptr_t HostCode;
+  };
+
+  constexpr static size_t INITIAL_SIZE = 4096; // Must be a power of 2
+  constexpr static size_t INITIAL_HASH_SHIFT = 64 - 12; // 64 - log2(INITIAL_SIZE)
+  static_assert((1ULL << (64 - INITIAL_HASH_SHIFT)) == INITIAL_SIZE, "Hash shift doesn't match the initial size");
+
+  size_t Hash(uint64_t Address) const {
+    // Fibonacci hashing, the top bits are the best mixed so the index is taken from those
+    return (Address * 0x9E3779B97F4A7C15ULL) >> HashShift;
+  }
+
+  void Grow() {
+    std::vector<Entry> OldEntries(Entries.size() * 2);
+    OldEntries.swap(Entries);
+    --HashShift;
+    Count = 0;
+    for (auto &Entry : OldEntries) {
+      if (Entry.HostCode) {
+        Insert(Entry.GuestCode, Entry.HostCode);
+      }
+    }
+  }
+
+  std::vector<Entry> Entries;
+  size_t Count{};
+  // 64 - log2(Entries.size())
+  size_t HashShift{INITIAL_HASH_SHIFT};
+};
+
+/**
+ * @brief Host code and guest to host lookups shared by every thread
+ *
+ * Backends on every thread, compile threads included, emit in to chunks of the same generations and map their
+ * blocks in to one block list and one L2. A block compiled on one thread is found by all of them.
+ * Each thread only keeps its own L1 in front of this, see LookupCache.
+ *
+ * Erasing a block takes it out of the shared lookups straight away and appends it to an erase log, which
+ * each thread applies to its L1 when its dispatcher notices the log has moved.
+ *
+ * Code memory is retired a generation at a time, oldest first. Retired memory is only reused once every
+ * thread has acknowledged the retirement from a point where it can't be running or returning in to that code.
+ * Until then new code goes in to overflow generations, which sit outside the range L2 can encode.
+ */
+class CodeCache final {
+public:
+  /**
+   * @brief L2 entries only store a signed 32bit offset from the host code base
+   *
+   * The radix tree is indexed by the full guest address so there is nothing to check for aliasing.
+   * Zero is an empty entry.
+   */
+  using L2Entry = int32_t;
+
+  /**
+   * @brief Patches a branch in to a block
+   *
+   * Called with the cache locked so an erase on another thread can't slip in between checking and patching
+   */
+  using BlockLinkerFunc = void(*)(uintptr_t HostLink, uintptr_t HostCode);
+
+  /**
+   * @brief Undoes a patched branch in to a block
+   *
+   * The backend gets back the patch site and the address the branch originally went to
+   */
+  using BlockDelinkerFunc = void(*)(uintptr_t HostLink, uintptr_t LinkerAddress);
+
+  struct CodeChunk {
+    uint8_t *Ptr;
+    size_t Size;
+  };
+
+  /**
+   * @param FirstGenerationSize Size of generation 0, each one after it is double the last
+   * @param MaxGenerationSize Generations don't grow past this
+   * @param NumGenerations How many generations L2 can encode
+   * @param Executable Map the code RWX instead of RW
+   */
+  CodeCache(size_t FirstGenerationSize, size_t MaxGenerationSize, size_t NumGenerations, bool Executable);
+  ~CodeCache();
+
+  CodeCache(CodeCache const&) = delete;
+  CodeCache &operator=(CodeCache const&) = delete;
+
+  /**
+   * @brief Looks up a block in L2 then the block list
+   *
+   * @return The host code or 0 if nothing is mapped
+   */
+  uintptr_t FindBlock(uint64_t Address);
+
+  /**
+   * @brief Maps a newly compiled block
+   *
+   * @return The host code mapped to the address afterwards. This is an existing block if another thread
+   * mapped one first, or 0 if HostCode was emitted in to a generation that has been retired since
+   */
+  uintptr_t AddBlockMapping(uint64_t Address, uintptr_t HostCode);
+
+  void Erase(uint64_t Address);
+
+  /**
+   * @brief Records a branch from HostLink to a block and patches it
+   *
+   * @return false if the link wasn't made, because GuestDestination is no longer mapped to HostCode or
+   * HostLink is in retired code. The branch then keeps going through LinkerAddress.
+   */
+  bool AddBlockLink(uint64_t GuestDestination, uintptr_t HostCode, uintptr_t HostLink, uintptr_t LinkerAddress,
+                    BlockLinkerFunc Linker, BlockDelinkerFunc Delinker);
+
+  /**
+   * @brief Retires every generation and forgets every block
+   */
+  void Clear();
+
+  /**
+   * @brief Erases every block with host code in [Start, End)
+   *
+   * Links patched in to that range are dropped without being undone since the code is going away
+   */
+  void EraseHostRange(uintptr_t Start, uintptr_t End);
+
+  /**
+   * @brief Takes the participant's next chunk of code memory
+   *
+   * The current chunk is kept while it is still live and has MinSize left.
+   * Out of memory this waits for other participants to acknowledge retired code.
+   *
+   * @param CanAcknowledge The participant isn't returning in to any code, it doesn't hold back what it retires itself
+   */
+  CodeChunk ReserveCode(LookupCache *Participant, size_t MinSize, bool CanAcknowledge);
+
+  void Register(LookupCache *Participant);
+  void Unregister(LookupCache *Participant);
+
+  /**
+   * @brief Marks whether a participant can be holding on to code
+   *
+   * Inactive participants don't hold back reuse. Activating one acknowledges everything retired before it.
+   */
+  void SetActive(LookupCache *Participant, bool Active);
+
+  /**
+   * @brief The participant is no longer running or returning in to anything retired up to AckEpoch
+   *
+   * Its L1 must not be used again before it has caught up with every erase logged before AckEpoch was read
+   */
+  void Acknowledge(LookupCache *Participant, uint64_t AckEpoch);
+
+  /**
+   * @brief Safe to call from a signal handler
+   */
+  bool Contains(uintptr_t Address) const { return Region.Contains(Address) || Overflow.Contains(Address); }
+
+  uintptr_t GetRootPointer() const { return RootPointer; }
+  uintptr_t GetHostCodeBase() const { return HostCodeBase; }
+
+  uint64_t GetEraseCount() const { return __atomic_load_n(&EraseCount, __ATOMIC_ACQUIRE); }
+  uint64_t const *GetEraseCountPointer() const { return &EraseCount; }
+  uint64_t GetErasedAddress(uint64_t Index) const { return __atomic_load_n(&EraseLog[Index & ERASE_LOG_MASK], __ATOMIC_RELAXED); }
+  uint64_t GetEpoch() const { return __atomic_load_n(&Epoch, __ATOMIC_ACQUIRE); }
+
+  constexpr static size_t ERASE_LOG_SIZE = 4096; // Must be a power of 2
+  constexpr static size_t ERASE_LOG_MASK = ERASE_LOG_SIZE - 1;
+
+  // Logged when code is retired so every thread's dispatcher comes back through a safe point
+  constexpr static uint64_t RETIRE_MARKER = ~0ULL;
+
+  // L2 is a radix tree over the 47bit guest address space
+  // Root[46:36] -> Directory[35:24] -> Table[23:12] -> Page[11:0] -> L2Entry
+  constexpr static size_t GUEST_ADDRESS_BITS = 47;
+  constexpr static size_t PAGE_BITS = 12;
+  constexpr static size_t TABLE_BITS = 12;
+  constexpr static size_t TABLE_SHIFT = PAGE_BITS;
+  constexpr static size_t DIRECTORY_SHIFT = TABLE_SHIFT + TABLE_BITS;
+  constexpr static size_t ROOT_SHIFT = DIRECTORY_SHIFT + TABLE_BITS;
+  constexpr static size_t ROOT_ENTRIES = 1ULL << (GUEST_ADDRESS_BITS - ROOT_SHIFT);
+  constexpr static size_t TABLE_ENTRIES = 1ULL << TABLE_BITS;
+  constexpr static size_t TABLE_MASK = TABLE_ENTRIES - 1;
+  constexpr static size_t PAGE_ENTRIES = 1ULL << PAGE_BITS;
+  constexpr static size_t PAGE_MASK = PAGE_ENTRIES - 1;
+
+private:
+  enum class GenerationState {
+    Free,
+    Live,
+    Retiring,
+  };
+
+  struct GenerationInfo {
+    uint8_t *Ptr;
+    size_t Size;
+    size_t Used;
+    GenerationState State;
+    uint64_t RetireEpoch;
+    // Bumped every time the memory is reused so stale chunks can be told apart
+    uint64_t Incarnation;
+    bool IsOverflow;
+  };
+
+  struct L2Backing {
+    uintptr_t Ptr;
+    size_t Used;
+    bool Retiring;
+    uint64_t RetireEpoch;
+  };
+
+  struct BlockLinkEntry {
+    uint64_t GuestDestination;
+    uintptr_t HostLink;
+    uintptr_t LinkerAddress;
+    BlockDelinkerFunc Delinker;
+  };
+
+  GenerationInfo *FindGeneration(uintptr_t Address);
+  bool IsLive(uintptr_t Address) { auto Gen = FindGeneration(Address); return Gen && Gen->State == GenerationState::Live; }
+
+  void NewGeneration(LookupCache *Requester, size_t MinSize, bool CanAcknowledge);
+  void RetireOldestGeneration();
+  void Reclaim();
+  bool IsHeld(GenerationInfo const &Gen) const;
+  uint64_t BumpEpoch();
+  void LogErase(uint64_t Address);
+  void DelinkAll();
+
+  void CacheBlockMapping(uint64_t Address, uintptr_t HostCode);
+  uintptr_t AllocateBacking(size_t Size);
+  void RetireL2();
+  L2Entry *WalkL2(uint64_t Address, bool Allocate);
+
+  CodeRegion Region;
+  CodeRegion Overflow;
+  std::vector<GenerationInfo> Generations;
+  // Live generations, oldest first. New chunks are carved from the back one
+  std::deque<size_t> LiveGenerations;
+
+  std::vector<LookupCache*> Participants;
+  uint64_t Epoch{};
+
+  uintptr_t RootPointer{};
+  uintptr_t HostCodeBase{};
+  uintptr_t PageMemory{};
+  // Page memory is split in two so one half can be waiting on acknowledgements while the other is filled
+  std::array<L2Backing, 2> L2Halves{};
+  size_t CurrentL2Half{};
+  bool L2Enabled{true};
+
+  // Links indexed by the guest page they branch in to
+  std::unordered_map<uint64_t, std::vector<BlockLinkEntry>> BlockLinks;
+  BlockListMap BlockList;
+
+  // Written under the lock, read by every thread's dispatcher without it
+  std::array<uint64_t, ERASE_LOG_SIZE> EraseLog{};
+  uint64_t EraseCount{};
+
+  constexpr static size_t OVERFLOW_GENERATION_SIZE = 16 * 1024 * 1024;
+  constexpr static size_t OVERFLOW_GENERATIONS = 64;
+  constexpr static size_t CHUNK_SIZE = 512 * 1024;
+  constexpr static size_t CODE_SIZE = 128 * 1024 * 1024;
+  constexpr static size_t SIZE_PER_PAGE = PAGE_ENTRIES * sizeof(L2Entry);
+  constexpr static size_t TABLE_SIZE = TABLE_ENTRIES * sizeof(uintptr_t);
+  constexpr static size_t ROOT_SIZE = ROOT_ENTRIES * sizeof(uintptr_t);
+
+  // Taken by every writer. Dispatchers only read L2 and the erase log so they never take it
+  std::recursive_mutex WriteLock;
+  // Signalled whenever a participant acknowledges or stops running, NewGeneration waits on it
+  std::condition_variable_any Acknowledged;
+};
+}
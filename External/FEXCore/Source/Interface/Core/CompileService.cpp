@@ -4,160 +4,316 @@
 #include "Interface/Core/InternalThreadState.h"
 #include "Interface/Core/OpcodeDispatcher.h"
 
+#include <FEXCore/Config/Config.h>
+
 namespace FEXCore {
-  CompileService::CompileService(FEXCore::Context::Context *ctx, FEXCore::Core::InternalThreadState *Thread)
-    : CTX {ctx}
-    , ParentThread {Thread} {
+  CompileService::CompileService(FEXCore::Context::Context *ctx)
+    : CTX {ctx} {
+  }
+
+  CompileService::~CompileService() {
+    Shutdown();
+  }
 
-    CompileThreadData = std::make_unique<FEXCore::Core::InternalThreadState>();
-    CompileThreadData->IsCompileService = true;
+  void CompileService::Initialize() {
+    FEXCore::Config::Value<uint32_t> CompileThreads{FEXCore::Config::CONFIG_COMPILE_THREADS, 0};
+    MaxWorkers = CompileThreads() ? CompileThreads() : std::max(std::thread::hardware_concurrency(), 1U);
 
-    // We need a compiler for this work thread
-    CTX->InitializeCompiler(CompileThreadData.get(), true);
-    CompileThreadData->CPUBackend->CopyNecessaryDataForCompileThread(ParentThread->CPUBackend.get());
+    // Nothing is started until there is work
+    Workers.resize(MaxWorkers);
+  }
 
-    WorkerThread = std::thread([this]() {
-      ExecutionThread();
+  void CompileService::StartWorker() {
+    std::scoped_lock<std::mutex> lk(StartWorkerMutex);
+
+    // Someone else might have gotten here first
+    size_t Index = NumWorkers.load();
+    if (Index == MaxWorkers || ShuttingDown.load()) {
+      return;
+    }
+
+    // The compiler is created on the worker, the thread queueing the work doesn't wait on it
+    Workers[Index] = std::make_unique<Worker>();
+    Workers[Index]->WorkerThread = std::thread([this, Index]() {
+      ExecutionThread(Index);
     });
+
+    NumWorkers.store(Index + 1, std::memory_order_release);
   }
 
-  void CompileService::Initialize() {
-    // Share CompileService which = this
-    CompileThreadData->CompileService = ParentThread->CompileService;
+  void CompileService::CreateCompiler(Worker *Self) {
+    Self->CompileThreadData = std::make_unique<FEXCore::Core::InternalThreadState>();
+    Self->CompileThreadData->IsCompileService = true;
+
+    // We need a compiler for each work thread
+    CTX->InitializeCompiler(Self->CompileThreadData.get(), true);
   }
 
   void CompileService::Shutdown() {
-    ShuttingDown = true;
-    // Kick the working thread
-    StartWork.NotifyAll();
-    WorkerThread.join();
-  }
-
-  void CompileService::ClearCache(FEXCore::Core::InternalThreadState *Thread) {
-    // On cache clear we need to spin down the execution thread to ensure it isn't trying to give us more work items
-    if (CompileMutex.try_lock()) {
-      // We can only clear these things if we pulled the compile mutex
-
-      // Grab the work queue and clear it
-      // We don't need to grab the queue mutex since this thread will no longer receive any work events
-      // Threads are bounded 1:1
-      while (WorkQueue.size()) {
-        WorkItem *Item = WorkQueue.front();
-        WorkQueue.pop();
-        delete Item;
+    if (ShuttingDown.exchange(true)) {
+      return;
+    }
+
+    {
+      // Kick the working threads
+      std::scoped_lock<std::mutex> lk(IdleMutex);
+      WorkAvailable.notify_all();
+      WorkDone.notify_all();
+    }
+
+    // No more workers get started once ShuttingDown is set and this lock is taken
+    std::scoped_lock<std::mutex> StartLock(StartWorkerMutex);
+    size_t Count = NumWorkers.load();
+
+    for (size_t i = 0; i < Count; ++i) {
+      if (Workers[i]->WorkerThread.joinable()) {
+        Workers[i]->WorkerThread.join();
       }
+    }
 
-      // Go through the garbage collection array and clear it
-      // It's safe to clear things that aren't marked safe since we are clearing cache
-      if (GCArray.size()) {
-        // Clean up our GC array
-        for (auto it = GCArray.begin(); it != GCArray.end();) {
-          delete *it;
-          it = GCArray.erase(it);
+    // QueueWork checks ShuttingDown under the queue lock, nothing is added once these are drained
+    // The workers themselves stay around, QueueWork can still be looking at one
+    for (size_t i = 0; i < Count; ++i) {
+      std::scoped_lock<std::mutex> QueueLock(Workers[i]->QueueMutex);
+      for (auto &Queue : Workers[i]->WorkQueue) {
+        for (auto Item : Queue) {
+          FailWork(Item);
         }
+        Queue.clear();
       }
+    }
+    QueuedWork.store(0);
 
-      LogMan::Throw::A(CompileThreadData->IRLists.size() == 0, "Compile service must never have IRLists");
-      LogMan::Throw::A(CompileThreadData->RALists.size() == 0, "Compile service must never have RALists");
-      LogMan::Throw::A(CompileThreadData->DebugData.size() == 0, "Compile service must never have DebugData");
+    std::scoped_lock<std::mutex> lk(FreeItemsMutex);
+    for (auto Item : FreeItems) {
+      delete Item;
+    }
+    FreeItems.clear();
+  }
 
-      CompileMutex.unlock();
+  CompileService::WorkItem *CompileService::AllocateWorkItem() {
+    {
+      std::scoped_lock<std::mutex> lk(FreeItemsMutex);
+      if (!FreeItems.empty()) {
+        WorkItem *Item = FreeItems.back();
+        FreeItems.pop_back();
+        return Item;
+      }
     }
 
-    // Clear the inverse cache of what is calling us from the Context ClearCache routine
-    auto SelectedThread = Thread->IsCompileService ? ParentThread : Thread;
-    SelectedThread->LookupCache->ClearCache();
-    SelectedThread->CPUBackend->ClearCache();
+    return new WorkItem{};
   }
 
+  void CompileService::ReleaseWorkItem(WorkItem *Item) {
+    Item->Thread = nullptr;
+    Item->RIP = 0;
+    Item->CodePtr = nullptr;
+    Item->IRList = nullptr;
+    Item->RAData = nullptr;
+    Item->DebugData = nullptr;
 
-  CompileService::WorkItem *CompileService::CompileCode(uint64_t RIP) {
-    // Tell the worker thread to compile code for us
-    WorkItem *Item = new WorkItem{};
-    Item->RIP = RIP;
+    std::scoped_lock<std::mutex> lk(FreeItemsMutex);
+    FreeItems.emplace_back(Item);
+  }
+
+  void CompileService::FailWork(WorkItem *Item) {
+    if (Item->Thread) {
+      // The guest thread is waiting on this, it owns the item and sees that nothing was compiled
+      Item->CodePtr = nullptr;
+      Item->ServiceWorkDone.NotifyAll();
+    }
+    else {
+      delete Item;
+    }
+
+    if (OutstandingWork.fetch_sub(1) == 1) {
+      std::scoped_lock<std::mutex> lk(IdleMutex);
+      WorkDone.notify_all();
+    }
+  }
+
+  void CompileService::QueueWork(WorkItem *Item, WorkPriority Priority) {
+    OutstandingWork.fetch_add(1);
 
+    // Start another worker if every one there is already has something to do
+    if (IdleWorkers.load() == 0 && NumWorkers.load() < MaxWorkers) {
+      StartWorker();
+    }
+
+    // StartWorker declines once the service is shutting down, there might not be any worker at all
+    size_t Count = NumWorkers.load(std::memory_order_acquire);
+    if (Count == 0) {
+      FailWork(Item);
+      return;
+    }
+
+    auto &Target = Workers[NextWorker.fetch_add(1) % Count];
     {
-      // Fill the threads work queue
-      std::scoped_lock<std::mutex> lk(QueueMutex);
-      WorkQueue.emplace(Item);
+      // QueuedWork is only changed with a queue lock held so it never goes below the real count
+      std::scoped_lock<std::mutex> lk(Target->QueueMutex);
+
+      // Workers might have already exited, Shutdown drains the queues under this lock after setting this
+      if (ShuttingDown.load()) {
+        FailWork(Item);
+        return;
+      }
+
+      Target->WorkQueue[Priority].emplace_back(Item);
+      QueuedWork.fetch_add(1);
     }
 
-    // Notify the thread that it has more work
-    StartWork.NotifyAll();
+    // Notify a thread that there is more work
+    std::scoped_lock<std::mutex> lk(IdleMutex);
+    WorkAvailable.notify_one();
+  }
+
+  CompileService::WorkItem *CompileService::CompileCode(FEXCore::Core::InternalThreadState *Thread, uint64_t RIP) {
+    // Tell a worker thread to compile code for us
+    WorkItem *Item = AllocateWorkItem();
+    Item->Thread = Thread;
+    Item->RIP = RIP;
+
+    QueueWork(Item, PRIORITY_HIGH);
 
     return Item;
   }
 
-  void CompileService::ExecutionThread() {
+  void CompileService::GenerateIR(uint64_t RIP, WorkPriority Priority) {
+    if (ShuttingDown.load()) {
+      return;
+    }
+
+    WorkItem *Item = AllocateWorkItem();
+    Item->RIP = RIP;
+
+    QueueWork(Item, Priority);
+  }
+
+  void CompileService::WaitForIdle() {
+    std::unique_lock<std::mutex> lk(IdleMutex);
+    WorkDone.wait(lk, [this]{ return OutstandingWork.load() == 0 || ShuttingDown.load(); });
+  }
+
+  CompileService::WorkItem *CompileService::GetWork(size_t WorkerIndex) {
+    size_t Count = NumWorkers.load(std::memory_order_acquire);
+
+    for (size_t Priority = 0; Priority < PRIORITY_COUNT; ++Priority) {
+      // Check our own queue first
+      {
+        auto &Self = Workers[WorkerIndex];
+        std::scoped_lock<std::mutex> lk(Self->QueueMutex);
+        auto &Queue = Self->WorkQueue[Priority];
+        if (!Queue.empty()) {
+          WorkItem *Item = Queue.front();
+          Queue.pop_front();
+          QueuedWork.fetch_sub(1);
+          return Item;
+        }
+      }
+
+      // Steal from the back of the other workers' queues
+      for (size_t i = 1; i < Count; ++i) {
+        auto &Victim = Workers[(WorkerIndex + i) % Count];
+        std::scoped_lock<std::mutex> lk(Victim->QueueMutex);
+        auto &Queue = Victim->WorkQueue[Priority];
+        if (!Queue.empty()) {
+          WorkItem *Item = Queue.back();
+          Queue.pop_back();
+          QueuedWork.fetch_sub(1);
+          return Item;
+        }
+      }
+    }
+
+    return nullptr;
+  }
+
+  void CompileService::DoWork(Worker *Self, WorkItem *Item) {
+    auto CompileThreadData = Self->CompileThreadData.get();
+
+    // Set our thread state's RIP
+    CompileThreadData->State.State.rip = Item->RIP;
+
+    if (!Item->Thread) {
+      CTX->GenerateSharedIR(CompileThreadData, Item->RIP);
+      // Lets the first tier ask again if this was a tier up that didn't produce anything
+      CTX->FinishTierUp(Item->RIP);
+      ReleaseWorkItem(Item);
+      return;
+    }
+
+    // Code goes in to the shared code cache, any thread can run it
+    auto [CodePtr, IRList, DebugData, RAData, Generated] = CTX->CompileCode(CompileThreadData, Item->RIP);
+
+    LogMan::Throw::A(Generated == true, "Compile Service doesn't have IR Cache");
+
+    if (!CodePtr) {
+      // XXX: We currently have the expectation that compile service code will be significantly smaller than regular thread's code
+      ERROR_AND_DIE("Couldn't compile code for thread at RIP: 0x%lx", Item->RIP);
+    }
+
+    Item->CodePtr = CodePtr;
+    Item->IRList = IRList;
+    Item->DebugData = DebugData;
+    Item->RAData = RAData;
+
+    // The waiting thread takes ownership of the item after this
+    Item->ServiceWorkDone.NotifyAll();
+  }
+
+  void CompileService::ExecutionThread(size_t WorkerIndex) {
     // Ignore signals coming from the guest
     CTX->SignalDelegation->MaskThreadSignals();
 
-    // Set our thread name so we can see its relation
     char ThreadName[16]{};
-    snprintf(ThreadName, 16, "%ld-CS", ParentThread->State.ThreadManager.TID.load());
+    snprintf(ThreadName, 16, "CS-%ld", WorkerIndex);
     pthread_setname_np(pthread_self(), ThreadName);
 
-    while (true) {
-      // Wait for work
-      StartWork.Wait();
-      if (ShuttingDown.load()) {
-        break;
-      }
-      std::scoped_lock<std::mutex> lk(CompileMutex);
-
-      size_t WorkItems{};
-
-      do {
-        // Grab a work item
-        WorkItem *Item{};
-        {
-          std::scoped_lock<std::mutex> lk(QueueMutex);
-          WorkItems = WorkQueue.size();
-          if (WorkItems) {
-            Item = WorkQueue.front();
-            WorkQueue.pop();
-          }
+    auto Self = Workers[WorkerIndex].get();
+    bool Active = false;
+
+    while (!ShuttingDown.load()) {
+      WorkItem *Item = GetWork(WorkerIndex);
+
+      if (!Item) {
+        // Idle workers don't hold back reuse of retired code
+        if (Active) {
+          Self->CompileThreadData->LookupCache->SetActive(false);
+          Active = false;
         }
 
-        // If we had a work item then work on it
-        if (Item) {
-          // Make sure it's not in lookup cache by accident
-          LogMan::Throw::A(CompileThreadData->LookupCache->FindBlock(Item->RIP) == 0, "Compile Service must never have entries in the LookupCache");
-          
-          // Code isn't in cache, compile now
-          // Set our thread state's RIP
-          CompileThreadData->State.State.rip = Item->RIP;
+        // Wait for work
+        std::unique_lock<std::mutex> lk(IdleMutex);
+        IdleWorkers.fetch_add(1);
+        bool HasWork = WorkAvailable.wait_for(lk, IDLE_TIMEOUT, [this]{ return QueuedWork.load() != 0 || ShuttingDown.load(); });
+        IdleWorkers.fetch_sub(1);
+
+        if (!HasWork && Self->CompileThreadData) {
+          // Nothing to do for a while, give back the compiler and everything its buffers grew to
+          lk.unlock();
+          Self->CompileThreadData.reset();
+        }
+        continue;
+      }
 
-          auto [CodePtr, IRList, DebugData, RAData, Generated] = CTX->CompileCode(CompileThreadData.get(), Item->RIP);
+      if (!Self->CompileThreadData) {
+        CreateCompiler(Self);
+      }
 
-          LogMan::Throw::A(Generated == true, "Compile Service doesn't have IR Cache");
+      // Code can't be retired out from under a worker while it is being emitted
+      if (!Active) {
+        Self->CompileThreadData->LookupCache->SetActive(true);
+        Active = true;
+      }
 
-          if (!CodePtr) {
-            // XXX: We currently have the expectation that compile service code will be significantly smaller than regular thread's code
-            ERROR_AND_DIE("Couldn't compile code for thread at RIP: 0x%lx", Item->RIP);
-          }
+      DoWork(Self, Item);
 
-          Item->CodePtr = CodePtr;
-          Item->IRList = IRList;
-          Item->DebugData = DebugData;
-          Item->RAData = RAData;
+      // Nothing is running between items, so anything retired so far can be acknowledged
+      Self->CompileThreadData->LookupCache->SafePoint(true);
 
-          GCArray.emplace_back(Item);
-          Item->ServiceWorkDone.NotifyAll();
-        }
-      } while (WorkItems != 0);
-
-      if (GCArray.size()) {
-        // Clean up our GC array
-        for (auto it = GCArray.begin(); it != GCArray.end();) {
-          if ((*it)->SafeToClear) {
-            delete *it;
-            it = GCArray.erase(it);
-          }
-          else {
-            ++it;
-          }
-        }
+      if (OutstandingWork.fetch_sub(1) == 1) {
+        std::scoped_lock<std::mutex> lk(IdleMutex);
+        WorkDone.notify_all();
       }
     }
   }
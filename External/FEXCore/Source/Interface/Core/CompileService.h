@@ -3,10 +3,14 @@
 #include <FEXCore/Core/CPUBackend.h>
 #include <FEXCore/Utils/Event.h>
 
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
 #include <memory>
+#include <mutex>
 #include <thread>
-#include <unordered_map>
-#include <queue>
+#include <vector>
 
 namespace FEXCore {
 namespace Context {
@@ -19,14 +23,37 @@ namespace Core {
 namespace IR {
   class RegisterAllocationData;
 };
+
+/**
+ * @brief Process wide pool of compile threads
+ *
+ * Each worker has its own compiler and a queue per priority.
+ * Work is handed out round robin and idle workers steal from the back of other workers' queues.
+ * Workers are started when work comes in and none are idle, up to the CompileThreads config. A worker that stays
+ * idle for a while gives its compiler and the buffers it grew back, they are created again with its next work.
+ *
+ * High priority work blocks a guest thread, this is used when CompileBlock is re-entered while the guest thread's own
+ * compiler is busy. The host code is generated on the worker using the guest thread's backend data.
+ * Low priority work only generates IR in to the shared IR cache, guest threads pick it up on first execution.
+ */
 class CompileService final {
   public:
-    CompileService(FEXCore::Context::Context *ctx, FEXCore::Core::InternalThreadState *Thread);
+    enum WorkPriority {
+      PRIORITY_HIGH,
+      PRIORITY_LOW,
+      PRIORITY_COUNT,
+    };
+
+    CompileService(FEXCore::Context::Context *ctx);
+    ~CompileService();
+
     void Initialize();
     void Shutdown();
 
     struct WorkItem {
       // Incoming
+      // Thread is nullptr for IR only work
+      FEXCore::Core::InternalThreadState *Thread{};
       uint64_t RIP{};
 
       // Outgoing
@@ -37,25 +64,77 @@ class CompileService final {
 
       // Communication
       Event ServiceWorkDone{};
-      std::atomic_bool SafeToClear{};
     };
 
-    WorkItem *CompileCode(uint64_t RIP);
-    void ClearCache(FEXCore::Core::InternalThreadState *Thread);
+    /**
+     * @brief Compiles code for a guest thread on a worker
+     *
+     * The caller waits on ServiceWorkDone and then hands the item back with ReleaseWorkItem
+     * CodePtr is left as nullptr if the service shut down before it got to the item
+     */
+    WorkItem *CompileCode(FEXCore::Core::InternalThreadState *Thread, uint64_t RIP);
+    void ReleaseWorkItem(WorkItem *Item);
+
+    /**
+     * @brief Queues up IR generation for the shared IR cache, nothing waits on this
+     */
+    void GenerateIR(uint64_t RIP, WorkPriority Priority = PRIORITY_LOW);
+
+    // Waits until every queued work item has been completed
+    void WaitForIdle();
+
+    // Most workers that can be running
+    size_t GetWorkerCount() const { return MaxWorkers; }
 
   private:
+    struct Worker {
+      std::thread WorkerThread;
+      // Only exists while the worker has had something to do recently
+      std::unique_ptr<FEXCore::Core::InternalThreadState> CompileThreadData;
+
+      std::mutex QueueMutex{};
+      std::deque<WorkItem*> WorkQueue[PRIORITY_COUNT]{};
+    };
+
     FEXCore::Context::Context *CTX;
-    FEXCore::Core::InternalThreadState *ParentThread;
 
-    void ExecutionThread();
-    std::thread WorkerThread;
-    std::unique_ptr<FEXCore::Core::InternalThreadState> CompileThreadData;
+    void ExecutionThread(size_t WorkerIndex);
+    void QueueWork(WorkItem *Item, WorkPriority Priority);
+    // Hands back work that will never be done, a waiting guest thread is woken up
+    void FailWork(WorkItem *Item);
+    WorkItem *GetWork(size_t WorkerIndex);
+    void DoWork(Worker *Self, WorkItem *Item);
+
+    WorkItem *AllocateWorkItem();
+
+    void StartWorker();
+    void CreateCompiler(Worker *Self);
+
+    // Sized to MaxWorkers up front so it never moves, slots below NumWorkers are set and never change
+    size_t MaxWorkers{};
+    std::vector<std::unique_ptr<Worker>> Workers;
+    std::atomic<size_t> NumWorkers{};
+    std::mutex StartWorkerMutex{};
+    std::atomic<size_t> NextWorker{};
+
+    // Workers waiting for work, more are only started while this is zero
+    std::atomic<size_t> IdleWorkers{};
+    // How long a worker waits for work before it gives its compiler back
+    constexpr static auto IDLE_TIMEOUT = std::chrono::seconds(5);
+
+    // Work items are recycled instead of allocated per request
+    std::mutex FreeItemsMutex{};
+    std::vector<WorkItem*> FreeItems{};
+
+    // Number of items sitting in queues, workers sleep while this is zero
+    std::atomic<size_t> QueuedWork{};
+    std::mutex IdleMutex{};
+    std::condition_variable WorkAvailable{};
+
+    // Number of items queued or in flight
+    std::atomic<size_t> OutstandingWork{};
+    std::condition_variable WorkDone{};
 
-    std::mutex QueueMutex{};
-    std::mutex CompileMutex{};
-    std::queue<WorkItem*> WorkQueue{};
-    std::vector<WorkItem*> GCArray{};
-    Event StartWork{};
     std::atomic_bool ShuttingDown{false};
 };
 }
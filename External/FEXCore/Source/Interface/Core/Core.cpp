@@ -22,7 +22,11 @@
 
 #include "Interface/HLE/Thunks/Thunks.h"
 
+#include "git_version.h"
+
 #include <fstream>
+#include <signal.h>
+#include <sys/mman.h>
 #include <unistd.h>
 
 #include "Interface/Core/GdbServer.h"
@@ -161,12 +165,9 @@ namespace FEXCore::Context {
   }
 
   void Context::SaveEntryList() {
-    std::string const &Filename = AppFilename();
-    std::string hash_string;
-
-    if (GetFilenameHash(Filename, hash_string)) {
+    if (!AppFilenameHash.empty()) {
       auto DataPath = FEXCore::Paths::GetEntryCachePath();
-      DataPath += "Entries_" + hash_string;
+      DataPath += "Entries_" + AppFilenameHash;
 
       std::ofstream Output (DataPath.c_str(), std::ios::out | std::ios::binary);
       if (Output.is_open()) {
@@ -179,12 +180,9 @@ namespace FEXCore::Context {
   }
 
   void Context::LoadEntryList() {
-    std::string const &Filename = AppFilename();
-    std::string hash_string;
-
-    if (GetFilenameHash(Filename, hash_string)) {
+    if (!AppFilenameHash.empty()) {
       auto DataPath = FEXCore::Paths::GetEntryCachePath();
-      DataPath += "Entries_" + hash_string;
+      DataPath += "Entries_" + AppFilenameHash;
 
       std::ifstream Input (DataPath.c_str(), std::ios::in | std::ios::binary | std::ios::ate);
       if (Input.is_open()) {
@@ -205,6 +203,167 @@ namespace FEXCore::Context {
     }
   }
 
+  uint64_t Context::GetAOTIRConfigKey() {
+    FEXCore::Config::Value<bool> DisablePasses{FEXCore::Config::CONFIG_DEBUG_DISABLE_OPTIMIZATION_PASSES, false};
+
+    // Anything that changes the IR generated for a block needs to be a part of the key
+    uint64_t Key{};
+    Key |= static_cast<uint64_t>(Config.Core);
+    Key |= static_cast<uint64_t>(Config.Is64BitMode) << 8;
+    Key |= static_cast<uint64_t>(Config.Multiblock) << 9;
+    Key |= static_cast<uint64_t>(Config.SMCChecks) << 10;
+    Key |= static_cast<uint64_t>(Config.TSOEnabled) << 11;
+    Key |= static_cast<uint64_t>(Config.ABILocalFlags) << 12;
+    Key |= static_cast<uint64_t>(Config.ABINoPF) << 13;
+    Key |= static_cast<uint64_t>(DisablePasses()) << 14;
+    Key |= static_cast<uint64_t>(Config.LazyFlags) << 15;
+    Key |= static_cast<uint64_t>(Config.X87ReducedPrecision) << 16;
+    Key |= static_cast<uint64_t>(static_cast<uint32_t>(Config.MaxInstPerBlock)) << 32;
+    return Key;
+  }
+
+  void Context::LoadAOTIRCache() {
+    FEXCore::Config::Value<bool> AOTIRCacheEnabled{FEXCore::Config::CONFIG_AOTIR_CACHE, false};
+
+    if (!AOTIRCacheEnabled() || AppFilenameHash.empty()) {
+      return;
+    }
+
+    // Serialized IR is only valid for the FEX build that generated it
+    AOTIRCachePath = FEXCore::Paths::GetEntryCachePath() + "AOTIR_" + AppFilenameHash + "_" + GIT_SHORT_HASH;
+
+    if (AOTIR.LoadFile(AOTIRCachePath, GetAOTIRConfigKey())) {
+      LogMan::Msg::D("Loaded %ld blocks from the AOT IR cache", AOTIR.Size());
+    }
+  }
+
+  void Context::SaveAOTIRCache() {
+    if (AOTIRCachePath.empty()) {
+      return;
+    }
+
+    std::map<uint64_t, FEXCore::AOTIRCache::SaveEntry> Entries;
+    for (auto &Thread : Threads) {
+      for (auto &[GuestRIP, DebugData] : Thread->DebugData) {
+        if (DebugData->GuestRanges.empty() ||
+            Entries.find(GuestRIP) != Entries.end()) {
+          continue;
+        }
+
+        auto IR = Thread->IRLists.find(GuestRIP);
+        auto RA = Thread->RALists.find(GuestRIP);
+        if (IR == Thread->IRLists.end() || RA == Thread->RALists.end()) {
+          continue;
+        }
+
+        Entries.emplace(GuestRIP, FEXCore::AOTIRCache::SaveEntry{IR->second.get(), RA->second.get(), DebugData.get()});
+      }
+    }
+
+    if (!AOTIR.SaveFile(AOTIRCachePath, GetAOTIRConfigKey(), Entries)) {
+      LogMan::Msg::D("Couldn't write AOT IR cache: '%s'", AOTIRCachePath.c_str());
+    }
+  }
+
+  bool Context::FindAOTIREntry(uint64_t GuestRIP, SharedIRCache::Entry *Entry) {
+    // Find checks the guest code, anything invalidated after that isn't covered by it
+    Entry->InvalidationCount = CodeInvalidationCount.load();
+    if (!AOTIR.Find(GuestRIP, Entry)) {
+      return false;
+    }
+
+    // Guest code hasn't changed since the IR was generated, let other threads use it as well
+    SharedIR.Insert(GuestRIP, *Entry);
+    return true;
+  }
+
+  void Context::RecordGuestRanges(FEXCore::Core::InternalThreadState *Thread, std::vector<FEXCore::Core::DebugDataGuestRange> *GuestRanges, uint64_t *GuestCodeHash) {
+    // Remember which guest code the last decode came from
+    // The AOT IR cache validates against it on load and code invalidation looks blocks up by the pages they cover
+    for (auto &Block : *Thread->FrontendDecoder->GetDecodedBlocks()) {
+      uint64_t BlockSize{};
+      for (size_t i = 0; i < Block.NumInstructions; ++i) {
+        BlockSize += Block.DecodedInstructions[i].InstSize;
+      }
+      GuestRanges->emplace_back(FEXCore::Core::DebugDataGuestRange{Block.Entry, BlockSize});
+    }
+    *GuestCodeHash = FEXCore::AOTIRCache::HashGuestCode(*GuestRanges);
+  }
+
+  void Context::PrecompileEntryList() {
+    FEXCore::Config::Value<bool> BackgroundPrecompile{FEXCore::Config::CONFIG_BACKGROUND_PRECOMPILE, false};
+
+    // Only code that is mapped at this point can be decoded
+    // Entries in libraries that get loaded later are compiled on demand
+    size_t NumEntries{};
+    for (auto Entry : EntryList) {
+      if (FEXCore::AOTIRCache::IsGuestCodeMapped({{Entry, 1}})) {
+        CompileService->GenerateIR(Entry);
+        ++NumEntries;
+      }
+    }
+
+    if (NumEntries == 0) {
+      return;
+    }
+
+    LogMan::Msg::D("Precompiling: %ld blocks on up to %ld threads...", NumEntries, CompileService->GetWorkerCount());
+
+    if (!BackgroundPrecompile()) {
+      CompileService->WaitForIdle();
+      LogMan::Msg::D("Done");
+    }
+  }
+
+  void Context::GenerateSharedIR(FEXCore::Core::InternalThreadState *Thread, uint64_t GuestRIP) {
+    // Only the frontend and passes run here, the results go in to the shared IR cache
+    // Each guest thread's backend then picks them up on first execution
+    SharedIRCache::Entry Existing;
+
+    // Entries from the AOT IR cache get validated and picked up on first execution
+    if (SharedIR.Find(GuestRIP, &Existing) || AOTIR.Contains(GuestRIP)) {
+      return;
+    }
+
+    // Nothing guarantees these addresses hold code, or are even mapped any longer
+    // Decoding only goes as far as the guest memory known to be readable, which can't be unmapped until it is done
+    std::shared_lock lk(ReadableGuestRangesMutex);
+    if (!IsGuestRangeReadable(GuestRIP, FEXCore::Frontend::Decoder::MAX_INST_SIZE)) {
+      return;
+    }
+
+    uint64_t InvalidationCount = CodeInvalidationCount.load();
+    Thread->FrontendDecoder->SetCheckReadable(true);
+    auto [IRList, RAData, TotalInstructions, TotalInstructionsLength] = GenerateIR(Thread, GuestRIP);
+    Thread->FrontendDecoder->SetCheckReadable(false);
+    if (!IRList) {
+      return;
+    }
+
+    SharedIRCache::Entry Entry{};
+    Entry.IR.reset(IRList);
+    Entry.RAData.reset(RAData, FEXCore::IR::RegisterAllocationDataDeleter{});
+    Entry.GuestCodeSize = TotalInstructionsLength;
+    Entry.GuestInstructionCount = TotalInstructions;
+    Entry.InvalidationCount = InvalidationCount;
+    RecordGuestRanges(Thread, &Entry.GuestRanges, &Entry.GuestCodeHash);
+    lk.unlock();
+
+    SharedIR.Insert(GuestRIP, Entry);
+  }
+
+  void Context::QueueSpeculativeCompile(FEXCore::Core::InternalThreadState *Thread) {
+    for (auto Target : *Thread->FrontendDecoder->GetExitTargets()) {
+      // Skip anything this thread already has, the compile threads check the shared caches
+      if (Thread->LookupCache->FindBlock(Target) ||
+          Thread->IRLists.find(Target) != Thread->IRLists.end()) {
+        continue;
+      }
+
+      CompileService->GenerateIR(Target, FEXCore::CompileService::PRIORITY_LOW);
+    }
+  }
+
   Context::~Context() {
     {
       for (auto &Thread : Threads) {
@@ -213,15 +372,19 @@ namespace FEXCore::Context {
         }
       }
 
+      // No guest thread can be waiting on the compile service anymore
+      // Background precompile work that hasn't started gets dropped
+      if (CompileService) {
+        CompileService->Shutdown();
+      }
+
       for (auto &Thread : Threads) {
         AddThreadRIPsToEntryList(Thread);
       }
 
-      for (auto &Thread : Threads) {
+      SaveAOTIRCache();
 
-        if (Thread->CompileService) {
-          Thread->CompileService->Shutdown();
-        }
+      for (auto &Thread : Threads) {
         delete Thread;
       }
       Threads.clear();
@@ -233,6 +396,58 @@ namespace FEXCore::Context {
   bool Context::InitCore(FEXCore::CodeLoader *Loader) {
     ThunkHandler.reset(FEXCore::ThunkHandler::Create());
 
+    {
+      FEXCore::Config::Value<std::string> AppFilename{FEXCore::Config::CONFIG_APP_FILENAME, ""};
+      if (!GetFilenameHash(AppFilename(), AppFilenameHash)) {
+        AppFilenameHash.clear();
+      }
+
+      FEXCore::Config::Value<bool> SpeculativeCompileEnabled{FEXCore::Config::CONFIG_SPECULATIVE_COMPILE, false};
+      SpeculativeCompile = SpeculativeCompileEnabled();
+
+      // The interpreter runs IR directly so there is nothing to gain from a first tier
+      FEXCore::Config::Value<bool> TieredCompileEnabled{FEXCore::Config::CONFIG_TIERED_COMPILE, false};
+      TieredCompile = TieredCompileEnabled() && Config.Core == FEXCore::Config::CONFIG_IRJIT;
+      if (TieredCompile) {
+        // The second tier is the full pipeline including multiblock
+        Config.Multiblock = true;
+      }
+
+      FEXCore::Config::Value<bool> LazyFlagsEnabled{FEXCore::Config::CONFIG_LAZY_FLAGS, false};
+      Config.LazyFlags = LazyFlagsEnabled();
+
+      FEXCore::Config::Value<bool> LinearScanRAEnabled{FEXCore::Config::CONFIG_LINEAR_SCAN_RA, false};
+      Config.LinearScanRA = LinearScanRAEnabled();
+
+      FEXCore::Config::Value<bool> X87ReducedPrecisionEnabled{FEXCore::Config::CONFIG_X87_REDUCED_PRECISION, false};
+      Config.X87ReducedPrecision = X87ReducedPrecisionEnabled();
+
+      FEXCore::Config::Value<bool> StaticRegisterAllocationEnabled{FEXCore::Config::CONFIG_STATIC_REGISTER_ALLOCATION, false};
+      Config.StaticRegisterAllocation = StaticRegisterAllocationEnabled();
+
+      FEXCore::Config::Value<bool> SMCPageProtectEnabled{FEXCore::Config::CONFIG_SMC_PAGE_PROTECT, false};
+      SMCPageProtect = SMCPageProtectEnabled();
+      if (SMCPageProtect) {
+        SMCPages = std::make_unique<SMCPage[]>(SMC_PAGE_TABLE_SIZE);
+        SMCPendingQueue = std::make_unique<std::atomic<uint64_t>[]>(SMC_PAGE_TABLE_SIZE);
+      }
+
+      // The gdb server chains to us from its own SIGSEGV handler
+      if (SMCPageProtect && SignalDelegation && !DebugServer) {
+        SignalDelegation->RegisterHostSignalHandler(SIGSEGV, [this](FEXCore::Core::InternalThreadState *Thread, int Signal, void *info, void *ucontext) -> bool {
+          return HandleSMCWriteFault(Thread, info);
+        });
+      }
+    }
+
+    // Every thread's lookup cache and backend emit in to this, so it has to exist before the first thread
+    if (Config.Core == FEXCore::Config::CONFIG_IRJIT) {
+      CodeCache.reset(FEXCore::CPU::CreateJITCodeCache());
+    }
+    else {
+      CodeCache.reset(FEXCore::CPU::CreateInterpreterCodeCache());
+    }
+
     LocalLoader = Loader;
     using namespace FEXCore::Core;
     FEXCore::Core::CPUState NewThreadState{};
@@ -259,6 +474,14 @@ namespace FEXCore::Context {
 
     Loader->MapMemoryRegion();
 
+    {
+      std::vector<std::pair<uint64_t, uint64_t>> Regions;
+      Loader->GetReadableRegions(&Regions);
+      for (auto [Start, Length] : Regions) {
+        AddReadableGuestRange(Start, Length);
+      }
+    }
+
     Thread->State.State.gregs[X86State::REG_RSP] = Loader->SetupStack();
 
     Loader->LoadMemory();
@@ -266,8 +489,16 @@ namespace FEXCore::Context {
 
     Thread->State.State.rip = StartingRIP = Loader->DefaultRIP();
 
+    LoadAOTIRCache();
+    LoadEntryList();
+
+    CompileService = std::make_unique<FEXCore::CompileService>(this);
+    CompileService->Initialize();
+
     InitializeThreadData(Thread);
 
+    PrecompileEntryList();
+
     return true;
   }
 
@@ -285,6 +516,9 @@ namespace FEXCore::Context {
   void Context::HandleCallback(uint64_t RIP) {
     auto Thread = Core::ThreadData.Thread;
     Thread->CPUBackend->CallbackPtr(Thread, RIP);
+
+    // Retirements couldn't be acknowledged under the callback, go back through the safe point for them
+    Thread->LookupCache->RequestSync();
   }
 
   void Context::RegisterHostSignalHandler(int Signal, HostSignalDelegatorFunction Func) {
@@ -378,8 +612,10 @@ namespace FEXCore::Context {
       std::lock_guard<std::mutex> lk(ThreadCreationMutex);
       // Walk the threads and tell them to clear their caches
       // Useful when our block size is set to a large number and we need to step a single instruction
+      // Host code is shared, clearing it once covers every thread
+      CodeCache->Clear();
       for (auto &Thread : Threads) {
-        ClearCodeCache(Thread, true);
+        ClearIRCache(Thread);
       }
     }
     CoreRunningMode PreviousRunningMode = this->Config.RunningMode;
@@ -468,13 +704,6 @@ namespace FEXCore::Context {
     };
 
     LocalLoader->AddIR(IRHandler);
-
-    // Compile all of our cached entries
-    LogMan::Msg::D("Precompiling: %ld blocks...", EntryList.size());
-    for (auto Entry : EntryList) {
-      CompileRIP(Thread, Entry);
-    }
-    LogMan::Msg::D("Done", EntryList.size());
   }
 
   void Context::InitializeThread(FEXCore::Core::InternalThreadState *Thread) {
@@ -493,22 +722,27 @@ namespace FEXCore::Context {
   }
 
   void Context::InitializeCompiler(FEXCore::Core::InternalThreadState* State, bool CompileThread) {
+    // With tiered compilation the guest threads generate the first tier and compile threads the second
+    State->FirstTierCompiler = TieredCompile && !CompileThread;
+
     State->OpDispatcher = std::make_unique<FEXCore::IR::OpDispatchBuilder>(this);
-    State->OpDispatcher->SetMultiblock(Config.Multiblock);
-    State->LookupCache = std::make_unique<FEXCore::LookupCache>(this);
+    State->OpDispatcher->SetMultiblock(Config.Multiblock && !State->FirstTierCompiler);
+    State->LookupCache = std::make_unique<FEXCore::LookupCache>(CodeCache.get(), State);
     State->FrontendDecoder = std::make_unique<FEXCore::Frontend::Decoder>(this);
+    State->FrontendDecoder->SetMultiblock(Config.Multiblock && !State->FirstTierCompiler);
     State->PassManager = std::make_unique<FEXCore::IR::PassManager>();
     State->PassManager->RegisterExitHandler([this]() {
         Stop(false /* Ignore current thread */);
     });
     
-    #if _M_ARM_64
-    bool DoSRA = true;
-    #else
-    bool DoSRA = false;
-    #endif
+    // The JIT backend decides how many guest registers it keeps in host registers
+    FEXCore::CPU::JITStaticRegisters StaticRegs{};
+    if (Config.Core == FEXCore::Config::CONFIG_IRJIT) {
+      StaticRegs = FEXCore::CPU::GetJITStaticRegisters(this);
+    }
+    bool DoSRA = StaticRegs.GPRs != 0 || StaticRegs.FPRs != 0;
 
-    State->PassManager->AddDefaultPasses(Config.Core == FEXCore::Config::CONFIG_IRJIT, DoSRA);
+    State->PassManager->AddDefaultPasses(Config.Core == FEXCore::Config::CONFIG_IRJIT, StaticRegs.GPRs, StaticRegs.FPRs, State->FirstTierCompiler);
     State->PassManager->AddDefaultValidationPasses();
 
     State->PassManager->RegisterSyscallHandler(SyscallHandler);
@@ -521,7 +755,8 @@ namespace FEXCore::Context {
       State->CPUBackend.reset(FEXCore::CPU::CreateInterpreterCore(this, State, CompileThread));
       break;
     case FEXCore::Config::CONFIG_IRJIT:
-      State->PassManager->InsertRegisterAllocationPass(DoSRA);
+      // The first tier is about compile latency so it always uses the linear scan
+      State->PassManager->InsertRegisterAllocationPass(DoSRA && !State->FirstTierCompiler, Config.LinearScanRA || State->FirstTierCompiler);
       State->CPUBackend.reset(FEXCore::CPU::CreateJITCore(this, State, CompileThread));
       break;
     case FEXCore::Config::CONFIG_CUSTOM:      State->CPUBackend.reset(CustomCPUFactory(this, &State->State)); break;
@@ -550,24 +785,35 @@ namespace FEXCore::Context {
     return Thread;
   }
 
-  void Context::AddBlockMapping(FEXCore::Core::InternalThreadState *Thread, uint64_t Address, void *Ptr) {
-    Thread->LookupCache->AddBlockMapping(Address, Ptr);
+  uintptr_t Context::AddBlockMapping(FEXCore::Core::InternalThreadState *Thread, uint64_t Address, void *Ptr) {
+    return Thread->LookupCache->AddBlockMapping(Address, Ptr);
   }
 
   void Context::ClearCodeCache(FEXCore::Core::InternalThreadState *Thread, bool AlsoClearIRCache) {
-    Thread->LookupCache->ClearCache();
-    Thread->CPUBackend->ClearCache();
-    if (Thread->CompileService) {
-      Thread->CompileService->ClearCache(Thread);
+    // Every thread drops its blocks the next time it goes through its dispatcher
+    CodeCache->Clear();
+
+    {
+      // None of the first tier blocks are left to need their counters
+      std::scoped_lock<std::mutex> lk(TierUpMutex);
+      for (auto &[GuestRIP, Counter] : TierUpCounters) {
+        FreeTierUpCounters.emplace_back(Counter);
+      }
+      TierUpCounters.clear();
     }
 
     if (AlsoClearIRCache) {
-      Thread->IRLists.clear();
-      Thread->RALists.clear();
-      Thread->DebugData.clear();
+      ClearIRCache(Thread);
     }
   }
 
+  void Context::ClearIRCache(FEXCore::Core::InternalThreadState *Thread) {
+    Thread->IRLists.clear();
+    Thread->RALists.clear();
+    Thread->DebugData.clear();
+    SharedIR.Clear();
+  }
+
   std::tuple<FEXCore::IR::IRListView<true> *, FEXCore::IR::RegisterAllocationData *, uint64_t, uint64_t> Context::GenerateIR(FEXCore::Core::InternalThreadState *Thread, uint64_t GuestRIP) {
     uint8_t const *GuestCode{};
     GuestCode = reinterpret_cast<uint8_t const*>(GuestRIP);
@@ -602,6 +848,32 @@ namespace FEXCore::Context {
 
       uint64_t InstsInBlock = Block.NumInstructions;
 
+      if (Thread->FirstTierCompiler && Block.Entry == GuestRIP) {
+        // Count how often the entry point runs, every TIER_UP_INTERVAL executions ask for it to be promoted
+        // Other threads can update the same counter, losing the odd increment doesn't matter
+        auto CounterPtr = Thread->OpDispatcher->_Constant(64, reinterpret_cast<uintptr_t>(GetTierUpCounter(GuestRIP)));
+        FEXCore::IR::OrderedNode *ExecutionCount = Thread->OpDispatcher->_LoadMem(FEXCore::IR::GPRClass, 4, CounterPtr, 4);
+        ExecutionCount = Thread->OpDispatcher->_Add(ExecutionCount, Thread->OpDispatcher->_Constant(32, 1));
+        Thread->OpDispatcher->_StoreMem(FEXCore::IR::GPRClass, 4, CounterPtr, ExecutionCount, 4);
+
+        auto IntervalCount = Thread->OpDispatcher->_And(ExecutionCount, Thread->OpDispatcher->_Constant(32, TIER_UP_INTERVAL - 1));
+        auto TierUpCond = Thread->OpDispatcher->_CondJump(IntervalCount);
+
+        auto CurrentBlock = Thread->OpDispatcher->GetCurrentBlock();
+        auto TierUpBlock = Thread->OpDispatcher->CreateNewCodeBlockAtEnd();
+        Thread->OpDispatcher->SetFalseJumpTarget(TierUpCond, TierUpBlock);
+
+        // Nothing from the guest has run yet, if the second tier is ready then coming back in through the dispatcher picks it up
+        Thread->OpDispatcher->SetCurrentCodeBlock(TierUpBlock);
+        Thread->OpDispatcher->_PromoteCodeEntry(GuestRIP);
+        Thread->OpDispatcher->_ExitFunction(Thread->OpDispatcher->_Constant(GuestRIP));
+
+        auto NextOpBlock = Thread->OpDispatcher->CreateNewCodeBlockAfter(CurrentBlock);
+
+        Thread->OpDispatcher->SetTrueJumpTarget(TierUpCond, NextOpBlock);
+        Thread->OpDispatcher->SetCurrentCodeBlock(NextOpBlock);
+      }
+
       if (Block.HasInvalidInstruction) {
         uint8_t GPRSize = Config.Is64BitMode ? 8 : 4;
         Thread->OpDispatcher->_ExitFunction(Thread->OpDispatcher->_Constant(GPRSize * 8, Block.Entry));
@@ -760,7 +1032,7 @@ namespace FEXCore::Context {
     return {IRList, RAData.release(), TotalInstructions, TotalInstructionsLength};
   }
 
-  std::tuple<void *, FEXCore::IR::IRListView<true> *, FEXCore::Core::DebugData *, FEXCore::IR::RegisterAllocationData *, bool> Context::CompileCode(FEXCore::Core::InternalThreadState *Thread, uint64_t GuestRIP) {
+  std::tuple<void *, FEXCore::IR::IRListView<true> *, FEXCore::Core::DebugData *, FEXCore::IR::RegisterAllocationData *, bool> Context::CompileCode(FEXCore::Core::InternalThreadState *Thread, uint64_t GuestRIP, bool UseIRCaches) {
     FEXCore::IR::IRListView<true> *IRList {};
     FEXCore::Core::DebugData *DebugData {};
     FEXCore::IR::RegisterAllocationData *RAData {};
@@ -768,16 +1040,38 @@ namespace FEXCore::Context {
 
     // Do we already have this in the IR cache?
     auto IR = Thread->IRLists.find(GuestRIP);
+    SharedIRCache::Entry SharedEntry{};
 
-    if (IR != Thread->IRLists.end()) {
+    if (UseIRCaches && IR != Thread->IRLists.end()) {
       // Entry already exists
       // pull in the data
       IRList = IR->second.get();
       DebugData = Thread->DebugData.find(GuestRIP)->second.get();
       RAData = Thread->RALists.find(GuestRIP)->second.get();
 
+      GeneratedIR = false;
+    } else if (UseIRCaches && !Thread->IsCompileService &&
+               (SharedIR.Find(GuestRIP, &SharedEntry) || FindAOTIREntry(GuestRIP, &SharedEntry))) {
+      // Another thread or a previous run has already generated IR for this RIP
+      // Only the backend needs to run, share the IR and RA data
+      IRList = SharedEntry.IR.get();
+      RAData = SharedEntry.RAData.get();
+      DebugData = new FEXCore::Core::DebugData();
+
+      DebugData->GuestCodeSize = SharedEntry.GuestCodeSize;
+      DebugData->GuestInstructionCount = SharedEntry.GuestInstructionCount;
+      DebugData->GuestRanges = std::move(SharedEntry.GuestRanges);
+      DebugData->GuestCodeHash = SharedEntry.GuestCodeHash;
+      DebugData->InvalidationCount = SharedEntry.InvalidationCount;
+
+      Thread->IRLists.emplace(GuestRIP, std::move(SharedEntry.IR));
+      Thread->RALists.emplace(GuestRIP, std::move(SharedEntry.RAData));
+      Thread->DebugData.emplace(GuestRIP, DebugData);
+
       GeneratedIR = false;
     } else {
+      // Anything invalidated while decoding has to be caught the next time this IR is used
+      uint64_t InvalidationCount = CodeInvalidationCount.load();
 
       // Generate IR + Meta Info
       auto [IRCopy, RACopy, TotalInstructions, TotalInstructionsLength] = GenerateIR(Thread, GuestRIP);
@@ -790,10 +1084,16 @@ namespace FEXCore::Context {
       // Initialize metadata
       DebugData->GuestCodeSize = TotalInstructionsLength;
       DebugData->GuestInstructionCount = TotalInstructions;
+      DebugData->InvalidationCount = InvalidationCount;
 
       // Increment stats
       Thread->Stats.BlocksCompiled.fetch_add(1);
 
+      // First tier code embeds pointers to this run's counters, the AOT IR cache skips it
+      if (IRList) {
+        RecordGuestRanges(Thread, &DebugData->GuestRanges, &DebugData->GuestCodeHash);
+      }
+
       // These blocks aren't already in the cache
       GeneratedIR = true;
     }
@@ -803,6 +1103,10 @@ namespace FEXCore::Context {
   }
 
   uintptr_t Context::CompileBlock(FEXCore::Core::InternalThreadState *Thread, uint64_t GuestRIP) {
+    return CompileBlock(Thread, GuestRIP, true);
+  }
+
+  uintptr_t Context::CompileBlock(FEXCore::Core::InternalThreadState *Thread, uint64_t GuestRIP, bool UseIRCaches) {
     
     // Is the code in the cache?
     // The backends only check L1 and L2, not L3
@@ -817,21 +1121,23 @@ namespace FEXCore::Context {
 
     bool DecrementRefCount = false;
     bool GeneratedIR {};
+    bool FirstTier {};
 
     if (Thread->CompileBlockReentrantRefCount != 0) {
-      if (!Thread->CompileService) {
-        Thread->CompileService = std::make_shared<FEXCore::CompileService>(this, Thread);
-        Thread->CompileService->Initialize();
-      }
-
-      auto WorkItem = Thread->CompileService->CompileCode(GuestRIP);
+      // Our own compiler is busy, hand the block to a compile thread
+      auto WorkItem = CompileService->CompileCode(Thread, GuestRIP);
       WorkItem->ServiceWorkDone.Wait();
       // Return here with the data in place
       CodePtr = WorkItem->CodePtr;
       IRList = WorkItem->IRList;
       DebugData = WorkItem->DebugData;
       RAData = WorkItem->RAData;
-      WorkItem->SafeToClear = true;
+      CompileService->ReleaseWorkItem(WorkItem);
+
+      if (!CodePtr) {
+        // The service has shut down, the backend treats this like any other block that couldn't be compiled
+        return 0;
+      }
 
       // The compile service will always generate IR + DebugData + RAData
       // Remove the entries here to make sure we don't fail to insert later on
@@ -840,12 +1146,13 @@ namespace FEXCore::Context {
     } else {
       ++Thread->CompileBlockReentrantRefCount;
       DecrementRefCount = true;
-      auto [Code, IR, Data, RA, Generated] = CompileCode(Thread, GuestRIP);
+      auto [Code, IR, Data, RA, Generated] = CompileCode(Thread, GuestRIP, UseIRCaches);
       CodePtr = Code;
       IRList = IR;
       DebugData = Data;
       RAData = RA;
       GeneratedIR = Generated;
+      FirstTier = Generated && Thread->FirstTierCompiler;
     }
 
     LogMan::Throw::A(CodePtr != nullptr, "Failed to compile code %lX", GuestRIP);
@@ -865,18 +1172,41 @@ namespace FEXCore::Context {
 
     // Insert to caches if we generated IR
     if (GeneratedIR) {
-      Thread->IRLists.emplace(GuestRIP, IRList);
+      auto IRIt = Thread->IRLists.emplace(GuestRIP, IRList).first;
+      auto RAIt = Thread->RALists.emplace(GuestRIP, std::shared_ptr<FEXCore::IR::RegisterAllocationData>(RAData, FEXCore::IR::RegisterAllocationDataDeleter{})).first;
       Thread->DebugData.emplace(GuestRIP, DebugData);
-      Thread->RALists.emplace(GuestRIP, RAData);
+
+      // Let other threads pick up this IR without running the frontend and passes again
+      // First tier IR stays local, other threads are better off waiting for the second tier
+      if (!FirstTier) {
+        SharedIR.Insert(GuestRIP, SharedIRCache::Entry{IRIt->second, RAIt->second, DebugData->GuestCodeSize, DebugData->GuestInstructionCount, DebugData->GuestRanges, DebugData->GuestCodeHash, DebugData->InvalidationCount});
+      }
     }
 
     if (DecrementRefCount)
       --Thread->CompileBlockReentrantRefCount;
 
+    if (DebugData && !TrackGuestCode(GuestRIP, DebugData, !GeneratedIR)) {
+      // The cached IR is from older guest code, drop it everywhere and decode what is there now
+      // Freshly generated IR isn't checked, so this can only go around once
+      RemoveCodeEntry(Thread, GuestRIP);
+      return CompileBlock(Thread, GuestRIP, false);
+    }
+
     // Insert to lookup cache
-    AddBlockMapping(Thread, GuestRIP, CodePtr);
+    // If another thread mapped the block first everyone runs that one, ours is left unused
+    auto HostCode = AddBlockMapping(Thread, GuestRIP, CodePtr);
+    if (!HostCode) {
+      // The code was retired before it got mapped, the IR is cached so it is cheap to emit again
+      return CompileBlock(Thread, GuestRIP);
+    }
 
-    return (uintptr_t)CodePtr;
+    // The frontend only has this block's exits if it ran on this thread
+    if (SpeculativeCompile && GeneratedIR && DecrementRefCount && IRList) {
+      QueueSpeculativeCompile(Thread);
+    }
+
+    return HostCode;
 
     if (DecrementRefCount)
       --Thread->CompileBlockReentrantRefCount;
@@ -912,7 +1242,10 @@ namespace FEXCore::Context {
 
     Thread->State.RunningEvents.Running = true;
 
+    // Code retired from here on waits for this thread to acknowledge it
+    Thread->LookupCache->SetActive(true);
     Thread->CPUBackend->ExecuteDispatch(Thread);
+    Thread->LookupCache->SetActive(false);
 
     Thread->State.RunningEvents.WaitingToStart = false;
     Thread->State.RunningEvents.Running = false;
@@ -939,6 +1272,444 @@ namespace FEXCore::Context {
     Thread->RALists.erase(GuestRIP);
     Thread->DebugData.erase(GuestRIP);
     Thread->LookupCache->Erase(GuestRIP);
+    Thread->CTX->SharedIR.Erase(GuestRIP);
+    Thread->CTX->EraseTierUpCounter(GuestRIP);
+  }
+
+  void Context::PromoteCodeEntry(FEXCore::Core::InternalThreadState *Thread, uint64_t GuestRIP) {
+    auto CTX = Thread->CTX;
+
+    SharedIRCache::Entry Entry;
+    if (CTX->SharedIR.Find(GuestRIP, &Entry)) {
+      // The second tier is ready, drop the first tier block
+      // CompileBlock picks up the shared IR when the dispatcher misses on the way back in
+      Thread->IRLists.erase(GuestRIP);
+      Thread->RALists.erase(GuestRIP);
+      Thread->DebugData.erase(GuestRIP);
+      Thread->LookupCache->Erase(GuestRIP);
+      CTX->EraseTierUpCounter(GuestRIP);
+      return;
+    }
+
+    {
+      std::scoped_lock<std::mutex> lk(CTX->TierUpMutex);
+      auto Counter = CTX->TierUpCounters.find(GuestRIP);
+      if (Counter == CTX->TierUpCounters.end() || Counter->second->Queued) {
+        // Still being compiled, we'll check again after another interval
+        // Without a counter the block is already erased and this is a stale run of it
+        return;
+      }
+      Counter->second->Queued = true;
+    }
+
+    // Hot code goes ahead of precompile and speculative work
+    CTX->CompileService->GenerateIR(GuestRIP, FEXCore::CompileService::PRIORITY_HIGH);
+  }
+
+  uint32_t *Context::GetTierUpCounter(uint64_t GuestRIP) {
+    std::scoped_lock<std::mutex> lk(TierUpMutex);
+    auto &Counter = TierUpCounters[GuestRIP];
+    if (!Counter) {
+      if (FreeTierUpCounters.empty()) {
+        Counter = &TierUpCounterPool.emplace_back();
+      }
+      else {
+        Counter = FreeTierUpCounters.back();
+        FreeTierUpCounters.pop_back();
+      }
+      *Counter = {};
+    }
+    return &Counter->ExecutionCount;
+  }
+
+  void Context::FinishTierUp(uint64_t GuestRIP) {
+    std::scoped_lock<std::mutex> lk(TierUpMutex);
+    auto Counter = TierUpCounters.find(GuestRIP);
+    if (Counter != TierUpCounters.end()) {
+      // If nothing made it in to the shared IR cache then the first tier asks again after another interval
+      Counter->second->Queued = false;
+    }
+  }
+
+  void Context::EraseTierUpCounter(uint64_t GuestRIP) {
+    std::scoped_lock<std::mutex> lk(TierUpMutex);
+    auto Counter = TierUpCounters.find(GuestRIP);
+    if (Counter != TierUpCounters.end()) {
+      FreeTierUpCounters.emplace_back(Counter->second);
+      TierUpCounters.erase(Counter);
+    }
+  }
+
+  static int GetMappingProtection(uint64_t Address) {
+    std::ifstream Maps("/proc/self/maps");
+    std::string Line;
+    while (std::getline(Maps, Line)) {
+      uint64_t Start, End;
+      char Perms[5]{};
+      if (sscanf(Line.c_str(), "%lx-%lx %4s", &Start, &End, Perms) != 3) {
+        continue;
+      }
+
+      if (Address >= Start && Address < End) {
+        int Prot = PROT_NONE;
+        Prot |= Perms[0] == 'r' ? PROT_READ : 0;
+        Prot |= Perms[1] == 'w' ? PROT_WRITE : 0;
+        Prot |= Perms[2] == 'x' ? PROT_EXEC : 0;
+        return Prot;
+      }
+    }
+
+    return -1;
+  }
+
+  bool Context::TrackGuestCode(uint64_t GuestRIP, FEXCore::Core::DebugData *DebugData, bool FromCache) {
+    static const size_t PageSize = sysconf(_SC_PAGESIZE);
+
+    std::scoped_lock<std::mutex> lk(CodePagesMutex);
+
+    // Pages that were written to have to lose their old entries before they can be protected again
+    if (SMCPageProtect) {
+      FlushSMCWritesLocked();
+    }
+
+    for (auto &Range : DebugData->GuestRanges) {
+      uint64_t Start = Range.GuestCodeStart & ~(PageSize - 1);
+      uint64_t End = AlignUp(Range.GuestCodeStart + Range.GuestCodeSize, PageSize);
+
+      for (uint64_t Address = Start; Address < End; Address += PageSize) {
+        auto Page = CodePages.find(Address);
+        if (Page != CodePages.end()) {
+          Page->second.Entries.insert(GuestRIP);
+          continue;
+        }
+
+        // Read only pages are remembered too so we only go through the maps once per page
+        if (SMCPageProtect) {
+          ProtectCodePage(Address);
+        }
+
+        CodePages[Address].Entries.insert(GuestRIP);
+      }
+    }
+
+    // Freshly decoded IR is as current as the guest code it was just read from
+    // Cached IR is stale if an invalidation hit it since it was last checked, invalidation leaves thread IR caches alone
+    // With SMC detection writes can also have gone to pages that weren't protected yet when the IR was generated
+    if (!FromCache ||
+        (!SMCPageProtect && DebugData->InvalidationCount == CodeInvalidationCount.load())) {
+      return true;
+    }
+
+    // Multiblock ranges can have been unmapped since, only the entry is known to be there
+    // Anything that can't be read gets decoded again, which goes as far as the guest code still goes
+    std::shared_lock ReadableLock(ReadableGuestRangesMutex);
+    for (auto &Range : DebugData->GuestRanges) {
+      if (!IsGuestRangeReadable(Range.GuestCodeStart, Range.GuestCodeSize)) {
+        return false;
+      }
+    }
+
+    if (FEXCore::AOTIRCache::HashGuestCode(DebugData->GuestRanges) != DebugData->GuestCodeHash) {
+      return false;
+    }
+
+    DebugData->InvalidationCount = CodeInvalidationCount.load();
+    return true;
+  }
+
+  void Context::InvalidateCodeEntries(std::unordered_set<uint64_t> const &Entries) {
+    // Only the code cache is touched here, stale IR left in a thread's IR cache fails the guest code hash
+    // check in TrackGuestCode the next time the block is compiled
+    // Each thread's L1 catches up through the erase log
+    for (auto Entry : Entries) {
+      CodeCache->Erase(Entry);
+      SharedIR.Erase(Entry);
+      EraseTierUpCounter(Entry);
+    }
+
+    CodeInvalidationCount.fetch_add(1);
+  }
+
+  void Context::InvalidateGuestCodeRange(uint64_t Start, uint64_t Length) {
+    static const size_t PageSize = sysconf(_SC_PAGESIZE);
+    uint64_t PageStart = Start & ~(PageSize - 1);
+    uint64_t PageEnd = AlignUp(Start + Length, PageSize);
+
+    std::unordered_set<uint64_t> Entries;
+    std::scoped_lock<std::mutex> lk(CodePagesMutex);
+
+    // Any protection we added is gone after the syscall, the pages are looked at again when code is compiled from them
+    // Pending pages are left to the flush, they are still in its queue
+    auto DropPage = [this, &Entries](std::unordered_map<uint64_t, CodePage>::iterator Page) {
+      Entries.merge(Page->second.Entries);
+      if (SMCPageProtect) {
+        if (auto SMC = FindSMCPage(Page->first, false)) {
+          uint32_t Expected = SMC_PAGE_PROTECTED;
+          SMC->State.compare_exchange_strong(Expected, SMC_PAGE_UNPROTECTED);
+        }
+      }
+      return CodePages.erase(Page);
+    };
+
+    // Large unmaps are cheaper to handle by walking the pages with code on them
+    if ((PageEnd - PageStart) / PageSize < CodePages.size()) {
+      for (uint64_t Address = PageStart; Address < PageEnd; Address += PageSize) {
+        auto Page = CodePages.find(Address);
+        if (Page != CodePages.end()) {
+          DropPage(Page);
+        }
+      }
+    }
+    else {
+      for (auto Page = CodePages.begin(); Page != CodePages.end();) {
+        if (Page->first >= PageStart && Page->first < PageEnd) {
+          Page = DropPage(Page);
+        }
+        else {
+          ++Page;
+        }
+      }
+    }
+
+    if (!Entries.empty()) {
+      InvalidateCodeEntries(Entries);
+    }
+  }
+
+  void Context::AddReadableGuestRange(uint64_t Start, uint64_t Length) {
+    static const size_t PageSize = sysconf(_SC_PAGESIZE);
+    uint64_t PageStart = Start & ~(PageSize - 1);
+    uint64_t PageEnd = AlignUp(Start + Length, PageSize);
+
+    std::unique_lock lk(ReadableGuestRangesMutex);
+
+    // Merge with everything it overlaps or touches
+    auto Range = ReadableGuestRanges.upper_bound(PageStart);
+    if (Range != ReadableGuestRanges.begin()) {
+      auto Prev = std::prev(Range);
+      if (Prev->second >= PageStart) {
+        PageStart = Prev->first;
+        PageEnd = std::max(PageEnd, Prev->second);
+        Range = ReadableGuestRanges.erase(Prev);
+      }
+    }
+
+    while (Range != ReadableGuestRanges.end() && Range->first <= PageEnd) {
+      PageEnd = std::max(PageEnd, Range->second);
+      Range = ReadableGuestRanges.erase(Range);
+    }
+
+    ReadableGuestRanges.emplace(PageStart, PageEnd);
+  }
+
+  void Context::RemoveReadableGuestRange(uint64_t Start, uint64_t Length) {
+    static const size_t PageSize = sysconf(_SC_PAGESIZE);
+    uint64_t PageStart = Start & ~(PageSize - 1);
+    uint64_t PageEnd = AlignUp(Start + Length, PageSize);
+
+    // Waits for background decodes that are reading guest memory
+    std::unique_lock lk(ReadableGuestRangesMutex);
+
+    // Trim a range that starts below and runs in to it, keeping whatever is past the end
+    auto Range = ReadableGuestRanges.lower_bound(PageStart);
+    if (Range != ReadableGuestRanges.begin()) {
+      auto Prev = std::prev(Range);
+      if (Prev->second > PageStart) {
+        uint64_t PrevEnd = Prev->second;
+        Prev->second = PageStart;
+        if (PrevEnd > PageEnd) {
+          ReadableGuestRanges.emplace(PageEnd, PrevEnd);
+          return;
+        }
+      }
+    }
+
+    while (Range != ReadableGuestRanges.end() && Range->first < PageEnd) {
+      uint64_t RangeEnd = Range->second;
+      Range = ReadableGuestRanges.erase(Range);
+      if (RangeEnd > PageEnd) {
+        ReadableGuestRanges.emplace(PageEnd, RangeEnd);
+        break;
+      }
+    }
+  }
+
+  bool Context::IsGuestRangeReadable(uint64_t Start, uint64_t Length) {
+    auto Range = ReadableGuestRanges.upper_bound(Start);
+    if (Range == ReadableGuestRanges.begin()) {
+      return false;
+    }
+
+    --Range;
+    return Start + Length <= Range->second;
+  }
+
+  Context::SMCPage *Context::FindSMCPage(uint64_t Address, bool Claim) {
+    // Open addressing with linear probing, lookups don't take any locks so they are safe in a signal handler
+    size_t Index = Address / FEXCore::Core::PAGE_SIZE;
+    for (size_t i = 0; i < SMC_PAGE_TABLE_SIZE; ++i) {
+      auto &Page = SMCPages[(Index + i) & SMC_PAGE_TABLE_MASK];
+      uint64_t PageAddress = Page.Address.load(std::memory_order_acquire);
+      if (PageAddress == Address) {
+        return &Page;
+      }
+
+      if (PageAddress == 0) {
+        if (!Claim) {
+          return nullptr;
+        }
+
+        // Claims happen with CodePagesMutex held, the handler only sees the page once it is set up
+        Page.State.store(SMC_PAGE_UNPROTECTED, std::memory_order_relaxed);
+        Page.Address.store(Address, std::memory_order_release);
+        return &Page;
+      }
+    }
+
+    return nullptr;
+  }
+
+  void Context::ProtectCodePage(uint64_t Address) {
+    auto Page = FindSMCPage(Address, true);
+    if (!Page) {
+      LogMan::Msg::E("SMC page table is full, guest code page 0x%lx isn't write protected", Address);
+      return;
+    }
+
+    if (Page->State.load() != SMC_PAGE_UNPROTECTED) {
+      return;
+    }
+
+    int Prot = GetMappingProtection(Address);
+    if (Prot == -1 || !(Prot & PROT_WRITE)) {
+      return;
+    }
+
+    // Visible to the handler before the first write can fault
+    Page->Prot.store(Prot);
+    Page->State.store(SMC_PAGE_PROTECTED);
+    if (mprotect(reinterpret_cast<void*>(Address), FEXCore::Core::PAGE_SIZE, Prot & ~PROT_WRITE) != 0) {
+      Page->State.store(SMC_PAGE_UNPROTECTED);
+      LogMan::Msg::E("Couldn't write protect guest code page 0x%lx", Address);
+    }
+  }
+
+  void Context::FlushSMCWrites() {
+    if (!SMCPageProtect ||
+        SMCPendingHead.load(std::memory_order_relaxed) == SMCPendingTail.load(std::memory_order_acquire)) {
+      return;
+    }
+
+    std::scoped_lock<std::mutex> lk(CodePagesMutex);
+    FlushSMCWritesLocked();
+  }
+
+  void Context::FlushSMCWritesLocked() {
+    std::unordered_set<uint64_t> Entries;
+
+    uint64_t Head = SMCPendingHead.load(std::memory_order_relaxed);
+    uint64_t Tail = SMCPendingTail.load(std::memory_order_acquire);
+    for (; Head != Tail; ++Head) {
+      uint64_t Address = SMCPendingQueue[Head & SMC_PAGE_TABLE_MASK].exchange(0, std::memory_order_acquire);
+      if (!Address) {
+        // The handler has taken the slot but not filled it yet, the thread it runs on flushes it once it is back
+        break;
+      }
+
+      auto Page = CodePages.find(Address);
+      if (Page != CodePages.end()) {
+        Entries.merge(Page->second.Entries);
+        CodePages.erase(Page);
+      }
+
+      // The next block compiled from the page protects it again
+      FindSMCPage(Address, false)->State.store(SMC_PAGE_UNPROTECTED);
+    }
+    SMCPendingHead.store(Head, std::memory_order_relaxed);
+
+    if (!Entries.empty()) {
+      InvalidateCodeEntries(Entries);
+    }
+  }
+
+  bool Context::HandleSMCWriteFault(FEXCore::Core::InternalThreadState *Thread, void *info) {
+    auto SigInfo = static_cast<siginfo_t*>(info);
+
+    if (!SMCPageProtect || SigInfo->si_code != SEGV_ACCERR) {
+      return false;
+    }
+
+    uint64_t Address = reinterpret_cast<uint64_t>(SigInfo->si_addr) & ~(FEXCore::Core::PAGE_SIZE - 1);
+
+    // Nothing in here takes a lock, the fault can land while this thread holds any of them
+    auto Page = FindSMCPage(Address, false);
+    if (!Page) {
+      // Not ours, let the guest see it
+      return false;
+    }
+
+    uint32_t Expected = SMC_PAGE_PROTECTED;
+    if (!Page->State.compare_exchange_strong(Expected, SMC_PAGE_PENDING)) {
+      // Another thread's write got here first and is making the page writable, the write faults until it has
+      return Expected == SMC_PAGE_PENDING;
+    }
+
+    QueueSMCWrite(Thread, Page, Address);
+    return true;
+  }
+
+  void Context::QueueSMCWrite(FEXCore::Core::InternalThreadState *Thread, SMCPage *Page, uint64_t Address) {
+    mprotect(reinterpret_cast<void*>(Address), FEXCore::Core::PAGE_SIZE, Page->Prot.load());
+
+    uint64_t Slot = SMCPendingTail.fetch_add(1, std::memory_order_acq_rel);
+    SMCPendingQueue[Slot & SMC_PAGE_TABLE_MASK].store(Address, std::memory_order_release);
+
+    // The blocks stay valid until the flush, a block that is running right now and blocks directly linked from it
+    // keep running the old code until this thread is back in its dispatcher
+    Thread->LookupCache->RequestSync();
+  }
+
+  bool Context::UnprotectSMCPage(FEXCore::Core::InternalThreadState *Thread, SMCPage *Page, uint64_t Address) {
+    uint32_t Expected = SMC_PAGE_PROTECTED;
+    if (!Page->State.compare_exchange_strong(Expected, SMC_PAGE_PENDING)) {
+      return false;
+    }
+
+    QueueSMCWrite(Thread, Page, Address);
+    return true;
+  }
+
+  bool Context::UnprotectSMCPages(FEXCore::Core::InternalThreadState *Thread, uint64_t Start, uint64_t Length) {
+    if (!SMCPageProtect || Length == 0) {
+      return false;
+    }
+
+    bool Unprotected = false;
+    uint64_t PageStart = Start & ~(FEXCore::Core::PAGE_SIZE - 1);
+    uint64_t PageEnd = AlignUp(Start + Length, FEXCore::Core::PAGE_SIZE);
+    for (uint64_t Address = PageStart; Address < PageEnd; Address += FEXCore::Core::PAGE_SIZE) {
+      if (auto Page = FindSMCPage(Address, false)) {
+        Unprotected |= UnprotectSMCPage(Thread, Page, Address);
+      }
+    }
+
+    return Unprotected;
+  }
+
+  bool Context::UnprotectSMCPages(FEXCore::Core::InternalThreadState *Thread) {
+    if (!SMCPageProtect) {
+      return false;
+    }
+
+    bool Unprotected = false;
+    for (size_t i = 0; i < SMC_PAGE_TABLE_SIZE; ++i) {
+      uint64_t Address = SMCPages[i].Address.load(std::memory_order_acquire);
+      if (Address != 0) {
+        Unprotected |= UnprotectSMCPage(Thread, &SMCPages[i], Address);
+      }
+    }
+
+    return Unprotected;
   }
 
   // Debug interface
@@ -947,9 +1718,7 @@ namespace FEXCore::Context {
     Thread->State.State.rip = RIP;
 
     // Erase the RIP from all the storage backings if it exists
-    Thread->IRLists.erase(RIP);
-    Thread->DebugData.erase(RIP);
-    Thread->LookupCache->Erase(RIP);
+    RemoveCodeEntry(Thread, RIP);
 
     // We don't care if compilation passes or not
     CompileBlock(Thread, RIP);
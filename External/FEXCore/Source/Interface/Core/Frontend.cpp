@@ -5,6 +5,7 @@
 #include <array>
 #include <algorithm>
 #include <cstring>
+#include <FEXCore/Core/CoreState.h>
 #include <FEXCore/Core/X86Enums.h>
 #include <FEXCore/Debug/X86Tables.h>
 #include <FEXCore/Utils/LogManager.h>
@@ -111,7 +112,8 @@ static uint32_t MapModRMToReg(uint8_t REX, uint8_t bits, bool HighBits, bool Has
 }
 
 Decoder::Decoder(FEXCore::Context::Context *ctx)
-  : CTX {ctx} {
+  : CTX {ctx}
+  , Multiblock {ctx->Config.Multiblock} {
   DecodedBuffer.resize(DefaultDecodedBufferSize);
 }
 
@@ -914,7 +916,7 @@ bool Decoder::DecodeInstruction(uint64_t PC) {
 }
 
 void Decoder::BranchTargetInMultiblockRange() {
-  if (!CTX->Config.Multiblock)
+  if (!Multiblock)
     return;
 
   // If the RIP setting is conditional AND within our symbol range then it can be considered for multiblock
@@ -956,22 +958,62 @@ void Decoder::BranchTargetInMultiblockRange() {
       // If we are conditional then a target can be the instruction past the conditional instruction
       uint64_t FallthroughRIP = DecodeInst->PC + DecodeInst->InstSize;
       if (HasBlocks.find(FallthroughRIP) == HasBlocks.end() &&
-          BlocksToDecode.find(FallthroughRIP) == BlocksToDecode.end()) {
+          BlocksToDecode.find(FallthroughRIP) == BlocksToDecode.end() &&
+          (!CheckReadable || IsInstructionReadable(FallthroughRIP))) {
         BlocksToDecode.emplace(FallthroughRIP);
       }
     }
 
     if (HasBlocks.find(TargetRIP) == HasBlocks.end() &&
-        BlocksToDecode.find(TargetRIP) == BlocksToDecode.end()) {
+        BlocksToDecode.find(TargetRIP) == BlocksToDecode.end() &&
+        (!CheckReadable || IsInstructionReadable(TargetRIP))) {
       BlocksToDecode.emplace(TargetRIP);
     }
   }
 }
 
+void Decoder::RecordExitTargets() {
+  uint64_t NextRIP = DecodeInst->PC + DecodeInst->InstSize;
+
+  switch (DecodeInst->OP) {
+    case 0x70 ... 0x7F: // Conditional JUMP
+    case 0x80 ... 0x8F: // More conditional
+    case 0xE8: // Call - Returns to the next instruction
+      ExitTargets.emplace_back(NextRIP);
+      [[fallthrough]];
+    case 0xE9:
+    case 0xEB: // Both are unconditional JMP instructions
+      if (DecodeInst->Src[0].TypeNone.Type == DecodedOperand::TYPE_LITERAL) {
+        ExitTargets.emplace_back(NextRIP + DecodeInst->Src[0].TypeLiteral.Literal);
+      }
+    break;
+    default:
+    break;
+  }
+}
+
+bool Decoder::IsInstructionReadable(uint64_t PC) {
+  // Checks for the longest possible instruction, most of them are covered by the pages checked last
+  uint64_t End = PC + MAX_INST_SIZE;
+  if (PC >= ReadableStart && End <= ReadableEnd) {
+    return true;
+  }
+
+  if (!CTX->IsGuestRangeReadable(PC, MAX_INST_SIZE)) {
+    return false;
+  }
+
+  ReadableStart = PC & ~(FEXCore::Core::PAGE_SIZE - 1);
+  ReadableEnd = (End + FEXCore::Core::PAGE_SIZE - 1) & ~(FEXCore::Core::PAGE_SIZE - 1);
+  return true;
+}
+
 bool Decoder::DecodeInstructionsAtEntry(uint8_t const* _InstStream, uint64_t PC) {
   Blocks.clear();
   BlocksToDecode.clear();
   HasBlocks.clear();
+  ExitTargets.clear();
+  ReadableStart = ReadableEnd = 0;
   // Reset internal state management
   DecodedSize = 0;
   MaxCondBranchForward = 0;
@@ -1011,6 +1053,12 @@ bool Decoder::DecodeInstructionsAtEntry(uint8_t const* _InstStream, uint64_t PC)
     InstStream = _InstStream - EntryPoint + RIPToDecode;
 
     while (1) {
+      if (CheckReadable && !IsInstructionReadable(RIPToDecode + PCOffset)) {
+        // The first instruction of a block is always checked before it gets here
+        // Otherwise the block ends like it hit the instruction limit and exits to this one
+        break;
+      }
+
       ErrorDuringDecoding = !DecodeInstruction(RIPToDecode + PCOffset);
 
       if (ErrorDuringDecoding) {
@@ -1040,6 +1088,7 @@ bool Decoder::DecodeInstructionsAtEntry(uint8_t const* _InstStream, uint64_t PC)
         // If the branch target is within our multiblock range then we can keep going on
         // We don't want to short circuit this since we want to calculate our ranges still
         BranchTargetInMultiblockRange();
+        RecordExitTargets();
       }
 
       if (!CanContinue) {
@@ -1068,6 +1117,11 @@ bool Decoder::DecodeInstructionsAtEntry(uint8_t const* _InstStream, uint64_t PC)
   }
 
 
+  // Targets that multiblock pulled in to this compile aren't exits
+  ExitTargets.erase(std::remove_if(ExitTargets.begin(), ExitTargets.end(), [this](uint64_t Target) {
+    return HasBlocks.find(Target) != HasBlocks.end();
+  }), ExitTargets.end());
+
   // sort for better branching
   std::sort(Blocks.begin(), Blocks.end(), [](const FEXCore::Frontend::Decoder::DecodedBlocks& a, const FEXCore::Frontend::Decoder::DecodedBlocks& b) {
     return a.Entry < b.Entry;
@@ -26,16 +26,31 @@ public:
   Decoder(FEXCore::Context::Context *ctx);
   bool DecodeInstructionsAtEntry(uint8_t const* InstStream, uint64_t PC);
 
+  void SetMultiblock(bool _Multiblock) { Multiblock = _Multiblock; }
+
   std::vector<DecodedBlocks> const *GetDecodedBlocks() {
     return &Blocks;
   }
 
+  // Direct branch and fallthrough targets that leave the decoded blocks
+  std::vector<uint64_t> const *GetExitTargets() {
+    return &ExitTargets;
+  }
+
+  static constexpr size_t MAX_INST_SIZE = 15;
+
+  // Only decode instructions that lie in guest memory the Context knows to be readable
+  // Blocks stop at the first one that doesn't and exit to it, branch targets outside of it aren't pulled in
+  void SetCheckReadable(bool Check) { CheckReadable = Check; }
+
 private:
   FEXCore::Context::Context *CTX;
 
   bool DecodeInstruction(uint64_t PC);
 
   void BranchTargetInMultiblockRange();
+  void RecordExitTargets();
+  bool IsInstructionReadable(uint64_t PC);
 
   uint8_t ReadByte();
   uint8_t PeekByte(uint8_t Offset);
@@ -50,12 +65,12 @@ private:
 
   uint8_t const *InstStream;
 
-  static constexpr size_t MAX_INST_SIZE = 15;
   uint8_t InstructionSize;
   std::array<uint8_t, MAX_INST_SIZE> Instruction;
   FEXCore::X86Tables::DecodedInst *DecodeInst;
 
   // This is for multiblock data tracking
+  bool Multiblock {false};
   bool SymbolAvailable {false};
   uint64_t EntryPoint {};
   uint64_t MaxCondBranchForward {};
@@ -66,6 +81,12 @@ private:
   std::vector<DecodedBlocks> Blocks;
   std::set<uint64_t> BlocksToDecode;
   std::set<uint64_t> HasBlocks;
+  std::vector<uint64_t> ExitTargets;
+
+  bool CheckReadable {false};
+  // Pages the last readable check covered
+  uint64_t ReadableStart {};
+  uint64_t ReadableEnd {};
 
   // ModRM rm decoding
   using DecodeModRMPtr = void (FEXCore::Frontend::Decoder::*)(X86Tables::DecodedOperand *Operand, X86Tables::ModRMDecoded ModRM);
@@ -45,6 +45,11 @@ GdbServer::GdbServer(FEXCore::Context::Context *ctx) : CTX(ctx) {
     // This is a total hack as there is currently no way to resume once hitting a segfault
     // But it's semi-useful for debugging.
     ctx->SignalDelegation->RegisterHostSignalHandler(SIGSEGV, [this] (FEXCore::Core::InternalThreadState *Thread, int Signal, void *info, void *ucontext) {
+        // Writes to code pages protected for SMC detection aren't real faults
+        if (this->CTX->HandleSMCWriteFault(Thread, info)) {
+          return true;
+        }
+
         this->Break(SIGSEGV);
 
         this->CTX->Config.RunningMode = FEXCore::Context::CoreRunningMode::MODE_SINGLESTEP;
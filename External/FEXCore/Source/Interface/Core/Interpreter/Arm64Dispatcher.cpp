@@ -188,6 +188,7 @@ DispatchGenerator::DispatchGenerator(FEXCore::Context::Context *ctx, FEXCore::Co
 
   Label Exit;
   Label LoopTop;
+  Label RunBlock;
   Label NoBlock;
   Label ThreadPauseHandler;
   bind(&LoopTop);
@@ -198,44 +199,60 @@ DispatchGenerator::DispatchGenerator(FEXCore::Context::Context *ctx, FEXCore::Co
   ldr(x2, MemOperand(STATE, offsetof(FEXCore::Core::ThreadState, State.rip)));
   auto RipReg = x2;
 
-  // Mask the address by the virtual address size so we can check for aliases
-  LoadConstant(x3, Thread->LookupCache->GetVirtualMemorySize() - 1);
-  and_(x3, RipReg, x3);
-
   {
+    // L1 Cache
+    // Programs too far from the host code base for L2 are only cached here
+    LoadConstant(x0, Thread->LookupCache->GetL1Pointer());
+
+    and_(x3, RipReg, LookupCache::L1_ENTRIES_MASK);
+    add(x0, x0, Operand(x3, Shift::LSL, 4));
+    ldp(x1, x0, MemOperand(x0));
+    cmp(x0, RipReg);
+    b(&RunBlock, Condition::eq);
+
     // This is the block cache lookup routine
-    // It matches what is going on it LookupCache.h::FindBlock
-    LoadConstant(x0, Thread->LookupCache->GetPagePointer());
+    // It matches what is going on it CodeCache.cpp::WalkL2
+    LoadConstant(x0, Thread->LookupCache->GetRootPointer());
 
-    // Offset the address and add to our page pointer
-    lsr(x1, x3, 12);
+    // Addresses outside of the guest address space never have an entry
+    lsr(x1, RipReg, CodeCache::ROOT_SHIFT);
+    cmp(x1, CodeCache::ROOT_ENTRIES);
+    b(&NoBlock, Condition::hs);
 
-    // Load the pointer from the offset
+    // Load the directory pointer
     ldr(x0, MemOperand(x0, x1, Shift::LSL, 3));
+    cbz(x0, &NoBlock);
 
-    // If page pointer is zero then we have no block
+    // Load the table pointer
+    ubfx(x1, RipReg, CodeCache::DIRECTORY_SHIFT, CodeCache::TABLE_BITS);
+    ldr(x0, MemOperand(x0, x1, Shift::LSL, 3));
     cbz(x0, &NoBlock);
 
-    // Steal the page offset
-    and_(x1, x3, 0x0FFF);
+    // Load the page pointer
+    ubfx(x1, RipReg, CodeCache::TABLE_SHIFT, CodeCache::TABLE_BITS);
+    ldr(x0, MemOperand(x0, x1, Shift::LSL, 3));
 
-    // Shift the offset by the size of the block cache entry
-    add(x0, x0, Operand(x1, Shift::LSL, (int)log2(sizeof(FEXCore::LookupCache::LookupCacheEntry))));
+    // If page pointer is zero then we have no block
+    cbz(x0, &NoBlock);
 
-    // Load the guest address first to ensure it maps to the address we are currently at
-    // This fixes aliasing problems
-    ldr(x1, MemOperand(x0, offsetof(FEXCore::LookupCache::LookupCacheEntry, GuestCode)));
-    cmp(x1, RipReg);
-    b(&NoBlock, Condition::ne);
+    // Steal the page offset
+    and_(x1, RipReg, CodeCache::PAGE_MASK);
 
-    // Now load the actual host block to execute if we can
-    ldr(x1, MemOperand(x0, offsetof(FEXCore::LookupCache::LookupCacheEntry, HostCode)));
+    // Load the offset of the block from the host code base
+    static_assert(sizeof(FEXCore::CodeCache::L2Entry) == 4, "This is expected to be size of 4");
+    ldrsw(x1, MemOperand(x0, x1, Shift::LSL, 2));
     cbz(x1, &NoBlock);
 
-    // If we've made it here then we have a real compiled block
+    // Turn it back in to the host block to execute
+    LoadConstant(x0, Thread->LookupCache->GetHostCodeBase());
+    add(x1, x1, x0);
+
+    // If we've made it here then we have a real compiled block, x1 holds its program
     {
+      bind(&RunBlock);
       mov(x0, STATE);
-      blr(x1);
+      LoadConstant(x3, reinterpret_cast<uint64_t>(InterpreterExecution));
+      blr(x3);
     }
 
     if (CTX->GetGdbServerStatus()) {
@@ -287,7 +304,10 @@ DispatchGenerator::DispatchGenerator(FEXCore::Context::Context *ctx, FEXCore::Co
     // X2 contains our guest RIP
     blr(x3); // { CTX, ThreadState, RIP}
 
-    b(&LoopTop);
+    // Run the program it hands back, a block it just compiled isn't in L1 or L2 yet and would miss again
+    cbz(x0, &LoopTop);
+    mov(x1, x0);
+    b(&RunBlock);
   }
 
   {
@@ -1,14 +1,25 @@
 #pragma once
 
 #include "Interface/Core/LookupCache.h"
+#include "Interface/Core/CodeCache.h"
 #include "Interface/Core/InternalThreadState.h"
 
 #include <FEXCore/Core/CPUBackend.h>
 #include <FEXCore/IR/IR.h>
 #include <FEXCore/IR/IntrusiveIRList.h>
 
+#include <memory>
+
 namespace FEXCore::CPU {
 class DispatchGenerator;
+struct InterpreterProgram;
+
+/**
+ * @brief Runs a block's program along with any blocks linked after it
+ *
+ * The dispatcher calls this with the program it found in the lookup cache
+ */
+void InterpreterExecution(FEXCore::Core::InternalThreadState *Thread, InterpreterProgram *Program);
 
 #define DESTMAP_AS_MAP 0
 #if DESTMAP_AS_MAP
@@ -33,9 +44,33 @@ public:
 
   bool HandleSIGBUS(int Signal, void *info, void *ucontext);
 
+  /**
+   * @brief Returns Size bytes of 16 byte aligned memory for a program
+   *
+   * Size must be a multiple of 16. The memory comes from the shared code cache and stays valid until its generation
+   * is retired and every thread has acknowledged that.
+   */
+  void *AllocateProgram(size_t Size);
+
+  static constexpr size_t INITIAL_PROGRAM_SIZE = 1024 * 1024 * 16;
+  static constexpr size_t MAX_PROGRAM_SIZE = 1024 * 1024 * 64;
+  // Number of generations the shared code cache fills before it starts retiring the oldest one
+  static constexpr size_t MAX_PROGRAM_GENERATIONS = 4;
+
+  // Programs this thread is part way through running
+  // A signal or a callback can run more code while one is suspended, retired programs can't be acknowledged then
+  uint32_t ExecutionDepth{};
+
+  static constexpr size_t SSA_STACK_SIZE = 1024 * 1024 * 64;
+  // Each running program takes its SSA slots from the top of this, suspended programs keep theirs below it
+  // Reserved up front and only committed as it is touched, so a program only pays for the slots it uses
+  uint8_t *SSAStack{};
+  size_t SSAStackTop{};
+
 private:
   FEXCore::Context::Context *CTX;
   FEXCore::Core::InternalThreadState *State;
+  bool IsCompileThread{};
 
   uint32_t AllocateTmpSpace(size_t Size);
   bool HandleSignalPause(int Signal, void *info, void *ucontext);
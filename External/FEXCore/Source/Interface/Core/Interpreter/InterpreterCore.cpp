@@ -20,6 +20,7 @@
 
 #include <atomic>
 #include <cmath>
+#include <sys/mman.h>
 #include <limits>
 #include <vector>
 #ifdef _M_X86_64
@@ -30,17 +31,35 @@
 
 namespace FEXCore::CPU {
 
-static void InterpreterExecution(FEXCore::Core::InternalThreadState *Thread) {
-  auto IR = Thread->IRLists.find(Thread->State.State.rip)->second.get();
-  
-  FEXCore::Core::DebugData *DebugData = nullptr;
-  
-  // DebugData is only used in debug builds
-  #ifndef NDEBUG
-  DebugData = Thread->DebugData.find(Thread->State.State.rip)->second.get();
-  #endif
-
-  InterpreterOps::InterpretIR(Thread, IR, DebugData);
+void InterpreterExecution(FEXCore::Core::InternalThreadState *Thread, InterpreterProgram *Program) {
+  auto Core = static_cast<InterpreterCore*>(Thread->CPUBackend.get());
+  auto LookupCache = Thread->LookupCache.get();
+
+  if (LookupCache->NeedsSync()) {
+    // The dispatcher may have found the program in a stale L1, look it up again once L1 has caught up
+    // Retired programs can only be acknowledged when none are suspended further up the stack
+    LookupCache->SafePoint(Core->ExecutionDepth == 0);
+    Program = reinterpret_cast<InterpreterProgram*>(LookupCache->FindBlock(Thread->State.State.rip));
+    if (!Program) {
+      // Back to the dispatcher to compile it
+      return;
+    }
+  }
+
+  ++Core->ExecutionDepth;
+
+  // Linked exits hand back the next block, which then runs without going back through the dispatcher
+  // Unless something was erased, the block could be one of them
+  do {
+    Program = InterpreterOps::InterpretIR(Thread, Program);
+  } while (Program && !LookupCache->NeedsSync());
+
+  --Core->ExecutionDepth;
+
+  if (Core->ExecutionDepth != 0) {
+    // Back in the suspended program, retirements couldn't be acknowledged while this one ran
+    LookupCache->RequestSync();
+  }
 }
 
 
@@ -78,11 +97,13 @@ bool InterpreterCore::HandleSIGBUS(int Signal, void *info, void *ucontext) {
 
 InterpreterCore::InterpreterCore(FEXCore::Context::Context *ctx, FEXCore::Core::InternalThreadState *Thread, bool CompileThread)
   : CTX {ctx}
-  , State {Thread} {
-  // Grab our space for temporary data
-
+  , State {Thread}
+  , IsCompileThread {CompileThread} {
   if (!CompileThread &&
       CTX->Config.Core == FEXCore::Config::CONFIG_INTERPRETER) {
+    SSAStack = static_cast<uint8_t*>(mmap(nullptr, SSA_STACK_SIZE, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0));
+    LogMan::Throw::A(SSAStack != MAP_FAILED, "Couldn't reserve the interpreter SSA stack");
+
     CreateAsmDispatch(ctx, Thread);
     CTX->SignalDelegation->RegisterHostSignalHandler(SignalDelegator::SIGNAL_FOR_PAUSE, [](FEXCore::Core::InternalThreadState *Thread, int Signal, void *info, void *ucontext) -> bool {
       InterpreterCore *Core = reinterpret_cast<InterpreterCore*>(Thread->CPUBackend.get());
@@ -108,15 +129,29 @@ InterpreterCore::InterpreterCore(FEXCore::Context::Context *ctx, FEXCore::Core::
 
 InterpreterCore::~InterpreterCore() {
   DeleteAsmDispatch();
+
+  if (SSAStack) {
+    munmap(SSAStack, SSA_STACK_SIZE);
+  }
 }
 
+void *InterpreterCore::CompileCode(FEXCore::IR::IRListView<true> const *IR, FEXCore::Core::DebugData *DebugData, FEXCore::IR::RegisterAllocationData *RAData) {
+  // The dispatcher hands this to InterpreterExecution
+  return InterpreterOps::LowerIR(IR, DebugData, this);
+}
 
-void *InterpreterCore::CompileCode([[maybe_unused]] FEXCore::IR::IRListView<true> const *IR, [[maybe_unused]] FEXCore::Core::DebugData *DebugData, FEXCore::IR::RegisterAllocationData *RAData) {
-  return reinterpret_cast<void*>(InterpreterExecution);
+void *InterpreterCore::AllocateProgram(size_t Size) {
+  auto Chunk = State->LookupCache->ReserveCode(Size, ExecutionDepth == 0);
+  State->LookupCache->CommitCode(Size);
+  return Chunk.Ptr;
 }
 
 FEXCore::CPU::CPUBackend *CreateInterpreterCore(FEXCore::Context::Context *ctx, FEXCore::Core::InternalThreadState *Thread, bool CompileThread) {
   return new InterpreterCore(ctx, Thread, CompileThread);
 }
 
+FEXCore::CodeCache *CreateInterpreterCodeCache() {
+  return new FEXCore::CodeCache(InterpreterCore::INITIAL_PROGRAM_SIZE, InterpreterCore::MAX_PROGRAM_SIZE, InterpreterCore::MAX_PROGRAM_GENERATIONS, false);
+}
+
 }
@@ -8,9 +8,18 @@ namespace FEXCore::Core {
   struct InternalThreadState;
 }
 
+namespace FEXCore {
+class CodeCache;
+}
+
 namespace FEXCore::CPU {
 class CPUBackend;
 
 FEXCore::CPU::CPUBackend *CreateInterpreterCore(FEXCore::Context::Context *ctx, FEXCore::Core::InternalThreadState *Thread, bool CompileThread);
 
+/**
+ * @brief Creates the code cache every thread's interpreter programs are allocated from
+ */
+FEXCore::CodeCache *CreateInterpreterCodeCache();
+
 }
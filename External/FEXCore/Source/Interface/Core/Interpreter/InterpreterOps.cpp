@@ -19,9 +19,12 @@
 
 #include "Interface/HLE/Thunks/Thunks.h"
 
+#include <algorithm>
+#include <array>
 #include <atomic>
 #include <cmath>
 #include <limits>
+#include <memory>
 #include <vector>
 #ifdef _M_X86_64
 #include <xmmintrin.h>
@@ -383,12 +386,7 @@ bool IsConditionTrue(uint8_t Cond, uint64_t Src1, uint64_t Src2) {
   return CompResult;
 }
 
-template<typename Res>
-Res GetDest(void* SSAData, IR::OrderedNodeWrapper Op) {
-  auto DstPtr = &reinterpret_cast<__uint128_t*>(SSAData)[Op.ID()];
-  return reinterpret_cast<Res>(DstPtr);
-}
-
+// Arguments in a program's IR have been rewritten to the slot of the op that produced them
 template<typename Res>
 Res GetSrc(void* SSAData, IR::OrderedNodeWrapper Src) {
   auto DstPtr = &reinterpret_cast<__uint128_t*>(SSAData)[Src.ID()];
@@ -409,6 +407,14 @@ static void SignalReturn(FEXCore::Core::InternalThreadState *Thread) {
   LogMan::Msg::A("unreachable");
 }
 
+// Blocked in a syscall only the running program is needed, unless others are suspended under it
+static void HoldProgram(FEXCore::Core::InternalThreadState *Thread, void const *IROp) {
+  auto Core = static_cast<InterpreterCore*>(Thread->CPUBackend.get());
+  if (Core->ExecutionDepth == 1) {
+    Thread->LookupCache->SetHeldCode(reinterpret_cast<uintptr_t>(IROp));
+  }
+}
+
 template<IR::IROps Op>
 struct OpHandlers {
 
@@ -922,4234 +928,4624 @@ bool InterpreterOps::GetFallbackHandler(IR::IROp_Header *IROp, FallbackInfo *Inf
   return false;
 }
 
-void InterpreterOps::InterpretIR(FEXCore::Core::InternalThreadState *Thread, FEXCore::IR::IRListView<true> *CurrentIR, FEXCore::Core::DebugData *DebugData) {
+InterpreterProgram *InterpreterOps::LowerIR(FEXCore::IR::IRListView<true> const *IR, FEXCore::Core::DebugData *DebugData, InterpreterCore *Core) {
+  using namespace FEXCore::IR;
+  std::vector<InterpreterProgram::Op> Ops;
+  uint32_t NumLinks{};
+
+  // Op index each block starts at, indexed by the block's ID
+  std::vector<uint32_t> BlockStart(IR->GetSSACount());
+  // Slot each node's result lives in, indexed by the node's ID. Zero for nodes that aren't in the program
+  std::vector<uint32_t> NodeSlot(IR->GetSSACount());
+
+  // Blocks that can erase themselves are about to be replaced, so they don't bother linking
+  bool CanLink = true;
+
+  for (auto [BlockNode, BlockHeader] : IR->GetBlocks()) {
+    LogMan::Throw::A(BlockHeader->Op == OP_CODEBLOCK, "IR type failed to be a code block");
+    BlockStart[IR->GetID(BlockNode)] = Ops.size();
+
+    for (auto [CodeNode, IROp] : IR->GetCode(BlockNode)) {
+      switch (IROp->Op) {
+        // Nothing to do at runtime
+        case OP_DUMMY:
+        case OP_BEGINBLOCK:
+        case OP_ENDBLOCK:
+        case OP_INVALIDATEFLAGS:
+          break;
+        case OP_REMOVECODEENTRY:
+        case OP_PROMOTECODEENTRY:
+          CanLink = false;
+          [[fallthrough]];
+        default: {
+          uint32_t Slot = Ops.size() + 1;
+          NodeSlot[IR->GetID(CodeNode)] = Slot;
+
+          uint8_t ArgSize{};
+          if (IROp->NumArgs && !IROp->Args[0].IsInvalid()) {
+            ArgSize = IR->GetOp<IROp_Header>(IROp->Args[0])->Size;
+          }
+          Ops.emplace_back(InterpreterProgram::Op{IROp, Slot, IROp->Op, IROp->Size, ArgSize, {}});
+          break;
+        }
+      }
+    }
+  }
+
+  for (auto &Op : Ops) {
+    if (Op.OpCode == OP_JUMP) {
+      Op.Targets[0] = BlockStart[Op.IROp->Args[0].ID()];
+    }
+    else if (Op.OpCode == OP_CONDJUMP) {
+      auto CondJump = Op.IROp->C<IROp_CondJump>();
+      Op.Targets[0] = BlockStart[CondJump->TrueBlock.ID()];
+      Op.Targets[1] = BlockStart[CondJump->FalseBlock.ID()];
+    }
+    else if (Op.OpCode == OP_EXITFUNCTION) {
+      // Only exits to a constant RIP always continue in the same block
+      if (CanLink && IR->GetOp<IROp_Header>(Op.IROp->Args[0])->Op == OP_CONSTANT) {
+        Op.Targets[0] = NumLinks++;
+      }
+      else {
+        Op.Targets[0] = InterpreterProgram::NO_LINK;
+      }
+    }
+  }
+
+  // Falling through the last block leaves the interpreter
+  Ops.emplace_back(InterpreterProgram::Op{nullptr, 0, OP_LAST, 0, 0, {}});
+
+  // Lay the program out in one allocation, the IR ops stay 16 byte aligned like they are in the IR's own allocation
+  size_t OpsOffset = AlignUp(sizeof(InterpreterProgram), 16);
+  size_t LinksOffset = AlignUp(OpsOffset + Ops.size() * sizeof(InterpreterProgram::Op), 16);
+  size_t DataOffset = AlignUp(LinksOffset + NumLinks * sizeof(InterpreterProgram*), 16);
+  size_t Size = AlignUp(DataOffset + IR->GetDataSize(), 16);
+
+  uint8_t *Memory = static_cast<uint8_t*>(Core->AllocateProgram(Size));
+  auto Program = new (Memory) InterpreterProgram{};
+  Program->Ops = reinterpret_cast<InterpreterProgram::Op*>(Memory + OpsOffset);
+  Program->Links = reinterpret_cast<InterpreterProgram**>(Memory + LinksOffset);
+  Program->NumLinks = NumLinks;
+  // Slot 0 plus one for each op
+  Program->NumSlots = Ops.size();
+  Program->GuestInstructionCount = DebugData->GuestInstructionCount;
+
+  uint8_t *IRData = Memory + DataOffset;
+  memcpy(IRData, reinterpret_cast<void*>(IR->GetData()), IR->GetDataSize());
+
+  for (size_t i = 0; i < Ops.size(); ++i) {
+    auto &Op = Ops[i];
+    if (Op.IROp) {
+      // Ops point in to the program's copy of the IR
+      Op.IROp = reinterpret_cast<IROp_Header*>(IRData + (reinterpret_cast<uintptr_t>(Op.IROp) - IR->GetData()));
+
+      // Arguments read the slot of the op that produced them
+      // Block arguments aren't in the program, they are left alone and only resolved through Targets
+      for (uint8_t Arg = 0; Arg < Op.IROp->NumArgs; ++Arg) {
+        auto &Wrapper = Op.IROp->Args[Arg];
+        if (!Wrapper.IsInvalid() && NodeSlot[Wrapper.ID()]) {
+          Wrapper = OrderedNodeWrapper::WrapOffset(NodeSlot[Wrapper.ID()] * sizeof(OrderedNode));
+        }
+      }
+    }
+    Program->Ops[i] = Op;
+  }
+  std::fill(Program->Links, Program->Links + NumLinks, nullptr);
+
+  return Program;
+}
+
+InterpreterProgram *InterpreterOps::LinkExit(FEXCore::Core::InternalThreadState *Thread, InterpreterProgram *Program, uint32_t Link) {
+  auto &Target = Program->Links[Link];
+  auto Linked = __atomic_load_n(&Target, __ATOMIC_ACQUIRE);
+  if (Linked) {
+    return Linked;
+  }
+
+  // gdb needs the dispatcher to see every block boundary so it can single step
+  if (Thread->CTX->GetGdbServerStatus()) {
+    return nullptr;
+  }
+
+  uint64_t GuestRIP = Thread->State.State.rip;
+  auto LookupCache = Thread->LookupCache.get();
+
+  // Don't link to anything that has been erased
+  LookupCache->Sync();
+  auto HostCode = LookupCache->FindBlock(GuestRIP);
+  if (!HostCode) {
+    // The dispatcher compiles it and the exit gets linked the next time through
+    return nullptr;
+  }
+
+  // This fails if either program was erased in the meantime, the exit then keeps going through the dispatcher
+  LookupCache->AddBlockLink(GuestRIP, HostCode, reinterpret_cast<uintptr_t>(&Target), 0,
+    [](uintptr_t HostLink, uintptr_t HostCode) {
+      __atomic_store_n(reinterpret_cast<uintptr_t*>(HostLink), HostCode, __ATOMIC_RELEASE);
+    },
+    [](uintptr_t HostLink, uintptr_t) {
+      // Back to exiting through the dispatcher
+      __atomic_store_n(reinterpret_cast<uintptr_t*>(HostLink), 0, __ATOMIC_RELEASE);
+    });
+
+  return reinterpret_cast<InterpreterProgram*>(HostCode);
+}
+
+InterpreterProgram *InterpreterOps::InterpretIR(FEXCore::Core::InternalThreadState *Thread, InterpreterProgram *Program) {
+  using namespace FEXCore::IR;
   volatile void* stack = alloca(0);
 
-  // Debug data is only passed in debug builds
   #ifndef NDEBUG
   // TODO: should be moved to an IR Op
-  Thread->Stats.InstructionsExecuted.fetch_add(DebugData->GuestInstructionCount);
+  Thread->Stats.InstructionsExecuted.fetch_add(Program->GuestInstructionCount);
   #endif
 
-  uintptr_t ListSize = CurrentIR->GetSSACount();
+  static_assert(sizeof(FEXCore::IR::IROp_Header) == 4);
+  static_assert(sizeof(__uint128_t) == InterpreterProgram::SLOT_SIZE);
+
+  // Take this program's slots from the top of the thread's SSA stack
+  // Anything that runs while this is suspended takes its slots from above them
+  auto Core = static_cast<InterpreterCore*>(Thread->CPUBackend.get());
+  size_t SSABase = Core->SSAStackTop;
+  size_t SSASize = Program->NumSlots * InterpreterProgram::SLOT_SIZE;
+  LogMan::Throw::A((SSABase + SSASize) <= InterpreterCore::SSA_STACK_SIZE, "Interpreter SSA stack overflow");
+  Core->SSAStackTop = SSABase + SSASize;
+  // A signal handler that interrupts us has to see the slots as taken before any of them are written
+  std::atomic_signal_fence(std::memory_order_seq_cst);
+  void *SSAData = Core->SSAStack + SSABase;
+
+#define GD *reinterpret_cast<uint64_t*>(Dest)
+#define GDP reinterpret_cast<void*>(Dest)
+
+#define DEF_OP(x) Op_##x
+#define REGISTER_OP(x) Table[IR::OP_##x] = &&DEF_OP(x)
+  // Label addresses only exist inside this function, so the table is filled here on the first run
+  static std::array<void*, IR::OP_LAST + 1> const DispatchTable = ({
+    std::array<void*, IR::OP_LAST + 1> Table;
+    Table.fill(&&DEF_OP(Unknown));
+    REGISTER_OP(VALIDATECODE);
+    REGISTER_OP(REMOVECODEENTRY);
+    REGISTER_OP(PROMOTECODEENTRY);
+    REGISTER_OP(DUMMY);
+    REGISTER_OP(BEGINBLOCK);
+    REGISTER_OP(ENDBLOCK);
+    REGISTER_OP(INVALIDATEFLAGS);
+    REGISTER_OP(FENCE);
+    REGISTER_OP(EXITFUNCTION);
+    REGISTER_OP(CONDJUMP);
+    REGISTER_OP(JUMP);
+    REGISTER_OP(BREAK);
+    REGISTER_OP(SIGNALRETURN);
+    REGISTER_OP(CALLBACKRETURN);
+    REGISTER_OP(SYSCALL);
+    REGISTER_OP(SYSCALLDIRECT);
+    REGISTER_OP(THUNK);
+    REGISTER_OP(CPUID);
+    REGISTER_OP(PRINT);
+    REGISTER_OP(CYCLECOUNTER);
+    REGISTER_OP(MOV);
+    REGISTER_OP(VBITCAST);
+    REGISTER_OP(VCASTFROMGPR);
+    REGISTER_OP(VEXTRACTTOGPR);
+    REGISTER_OP(VEXTRACTELEMENT);
+    REGISTER_OP(CONSTANT);
+    REGISTER_OP(VECTORZERO);
+    REGISTER_OP(LOADCONTEXT);
+    REGISTER_OP(LOADCONTEXTINDEXED);
+    REGISTER_OP(STORECONTEXT);
+    REGISTER_OP(STORECONTEXTINDEXED);
+    REGISTER_OP(CREATEELEMENTPAIR);
+    REGISTER_OP(EXTRACTELEMENTPAIR);
+    REGISTER_OP(CASPAIR);
+    REGISTER_OP(TRUNCELEMENTPAIR);
+    REGISTER_OP(LOADFLAG);
+    REGISTER_OP(STOREFLAG);
+    REGISTER_OP(LOADMEM);
+    REGISTER_OP(LOADMEMTSO);
+    REGISTER_OP(VLOADMEMELEMENT);
+    REGISTER_OP(STOREMEM);
+    REGISTER_OP(STOREMEMTSO);
+    REGISTER_OP(VSTOREMEMELEMENT);
+    REGISTER_OP(ADD);
+    REGISTER_OP(SUB);
+    REGISTER_OP(NEG);
+    REGISTER_OP(OR);
+    REGISTER_OP(AND);
+    REGISTER_OP(XOR);
+    REGISTER_OP(LSHL);
+    REGISTER_OP(LSHR);
+    REGISTER_OP(ASHR);
+    REGISTER_OP(ROR);
+    REGISTER_OP(EXTR);
+    REGISTER_OP(NOT);
+    REGISTER_OP(MUL);
+    REGISTER_OP(MULH);
+    REGISTER_OP(UMUL);
+    REGISTER_OP(UMULH);
+    REGISTER_OP(DIV);
+    REGISTER_OP(UDIV);
+    REGISTER_OP(REM);
+    REGISTER_OP(UREM);
+    REGISTER_OP(POPCOUNT);
+    REGISTER_OP(FINDLSB);
+    REGISTER_OP(FINDMSB);
+    REGISTER_OP(REV);
+    REGISTER_OP(FINDTRAILINGZEROS);
+    REGISTER_OP(COUNTLEADINGZEROES);
+    REGISTER_OP(BFI);
+    REGISTER_OP(SBFE);
+    REGISTER_OP(BFE);
+    REGISTER_OP(SELECT);
+    REGISTER_OP(CAS);
+    REGISTER_OP(ATOMICADD);
+    REGISTER_OP(ATOMICSUB);
+    REGISTER_OP(ATOMICAND);
+    REGISTER_OP(ATOMICOR);
+    REGISTER_OP(ATOMICXOR);
+    REGISTER_OP(ATOMICSWAP);
+    REGISTER_OP(ATOMICFETCHADD);
+    REGISTER_OP(ATOMICFETCHSUB);
+    REGISTER_OP(ATOMICFETCHAND);
+    REGISTER_OP(ATOMICFETCHOR);
+    REGISTER_OP(ATOMICFETCHXOR);
+    REGISTER_OP(CREATEVECTOR2);
+    REGISTER_OP(SPLATVECTOR4);
+    REGISTER_OP(SPLATVECTOR2);
+    REGISTER_OP(VMOV);
+    REGISTER_OP(VOR);
+    REGISTER_OP(VAND);
+    REGISTER_OP(VXOR);
+    REGISTER_OP(VSLI);
+    REGISTER_OP(VSRI);
+    REGISTER_OP(VNOT);
+    REGISTER_OP(VECTORIMM);
+    REGISTER_OP(VNEG);
+    REGISTER_OP(VFNEG);
+    REGISTER_OP(VUSHRI);
+    REGISTER_OP(VSSHRI);
+    REGISTER_OP(VSHLI);
+    REGISTER_OP(VADD);
+    REGISTER_OP(VSUB);
+    REGISTER_OP(VUQADD);
+    REGISTER_OP(VUQSUB);
+    REGISTER_OP(VSQADD);
+    REGISTER_OP(VSQSUB);
+    REGISTER_OP(VFADD);
+    REGISTER_OP(VFADDP);
+    REGISTER_OP(VFSUB);
+    REGISTER_OP(VADDP);
+    REGISTER_OP(VADDV);
+    REGISTER_OP(VURAVG);
+    REGISTER_OP(VABS);
+    REGISTER_OP(VFMUL);
+    REGISTER_OP(VFDIV);
+    REGISTER_OP(VFMIN);
+    REGISTER_OP(VFMAX);
+    REGISTER_OP(VFRECP);
+    REGISTER_OP(VFSQRT);
+    REGISTER_OP(VFRSQRT);
+    REGISTER_OP(VUSHRNI);
+    REGISTER_OP(VUSHRNI2);
+    REGISTER_OP(VSQXTN);
+    REGISTER_OP(VSQXTN2);
+    REGISTER_OP(VSQXTUN);
+    REGISTER_OP(VSQXTUN2);
+    REGISTER_OP(VECTOR_UTOF);
+    REGISTER_OP(VECTOR_STOF);
+    REGISTER_OP(VECTOR_FTOZU);
+    REGISTER_OP(VECTOR_FTOZS);
+    REGISTER_OP(VECTOR_FTOU);
+    REGISTER_OP(VECTOR_FTOS);
+    REGISTER_OP(VUMUL);
+    REGISTER_OP(VSMUL);
+    REGISTER_OP(VUMULL);
+    REGISTER_OP(VSMULL);
+    REGISTER_OP(VUMULL2);
+    REGISTER_OP(VSMULL2);
+    REGISTER_OP(VSXTL);
+    REGISTER_OP(VSXTL2);
+    REGISTER_OP(VUXTL);
+    REGISTER_OP(VUXTL2);
+    REGISTER_OP(VUMIN);
+    REGISTER_OP(VSMIN);
+    REGISTER_OP(VUMAX);
+    REGISTER_OP(VSMAX);
+    REGISTER_OP(VUSHL);
+    REGISTER_OP(VSSHR);
+    REGISTER_OP(VUSHLS);
+    REGISTER_OP(VUSHRS);
+    REGISTER_OP(VSSHRS);
+    REGISTER_OP(VUSHR);
+    REGISTER_OP(VZIP2);
+    REGISTER_OP(VZIP);
+    REGISTER_OP(VINSELEMENT);
+    REGISTER_OP(VINSSCALARELEMENT);
+    REGISTER_OP(VBSL);
+    REGISTER_OP(VCMPEQ);
+    REGISTER_OP(VCMPEQZ);
+    REGISTER_OP(VCMPGT);
+    REGISTER_OP(VCMPGTZ);
+    REGISTER_OP(VCMPLTZ);
+    REGISTER_OP(LUDIV);
+    REGISTER_OP(LDIV);
+    REGISTER_OP(LUREM);
+    REGISTER_OP(LREM);
+    REGISTER_OP(VEXTR);
+    REGISTER_OP(VINSGPR);
+    REGISTER_OP(FLOAT_FROMGPR_S);
+    REGISTER_OP(FLOAT_FROMGPR_U);
+    REGISTER_OP(FLOAT_TOGPR_ZS);
+    REGISTER_OP(FLOAT_TOGPR_ZU);
+    REGISTER_OP(FLOAT_TOGPR_S);
+    REGISTER_OP(FLOAT_TOGPR_U);
+    REGISTER_OP(FLOAT_FTOF);
+    REGISTER_OP(VECTOR_FTOF);
+    REGISTER_OP(FCMP);
+    REGISTER_OP(VTBL1);
+    REGISTER_OP(GETHOSTFLAG);
+    REGISTER_OP(VFCMPEQ);
+    REGISTER_OP(VFCMPNEQ);
+    REGISTER_OP(VFCMPLT);
+    REGISTER_OP(VFCMPLE);
+    REGISTER_OP(VFCMPUNO);
+    REGISTER_OP(VFCMPORD);
+    REGISTER_OP(VAESIMC);
+    REGISTER_OP(VAESENC);
+    REGISTER_OP(VAESENCLAST);
+    REGISTER_OP(VAESDEC);
+    REGISTER_OP(VAESDECLAST);
+    REGISTER_OP(VAESKEYGENASSIST);
+    REGISTER_OP(F80LOADFCW);
+    REGISTER_OP(F80ADD);
+    REGISTER_OP(F80SUB);
+    REGISTER_OP(F80MUL);
+    REGISTER_OP(F80DIV);
+    REGISTER_OP(F80FYL2X);
+    REGISTER_OP(F80ATAN);
+    REGISTER_OP(F80FPREM1);
+    REGISTER_OP(F80FPREM);
+    REGISTER_OP(F80SCALE);
+    REGISTER_OP(F80CVT);
+    REGISTER_OP(F80CVTINT);
+    REGISTER_OP(F80CVTTO);
+    REGISTER_OP(F80CVTTOINT);
+    REGISTER_OP(F80ROUND);
+    REGISTER_OP(F80F2XM1);
+    REGISTER_OP(F80TAN);
+    REGISTER_OP(F80SQRT);
+    REGISTER_OP(F80SIN);
+    REGISTER_OP(F80COS);
+    REGISTER_OP(F80XTRACT_EXP);
+    REGISTER_OP(F80XTRACT_SIG);
+    REGISTER_OP(F80CMP);
+    REGISTER_OP(GETROUNDINGMODE);
+    REGISTER_OP(SETROUNDINGMODE);
+    REGISTER_OP(F80BCDLOAD);
+    REGISTER_OP(F80BCDSTORE);
+    Table[IR::OP_LAST] = &&BlockEnd;
+    Table;
+  });
+#undef REGISTER_OP
+
+  InterpreterProgram::Op const *CurrentOp = Program->Ops;
+  IR::IROp_Header *IROp;
+  __uint128_t *Dest;
+  uint8_t OpSize;
+
+  // Every handler jumps straight to the handler of the op after it
+  // The slot is cleared before the op writes it, results narrower than the slot are zero extended
+#define DISPATCH() \
+  do { \
+    IROp = CurrentOp->IROp; \
+    Dest = &reinterpret_cast<__uint128_t*>(SSAData)[CurrentOp->Slot]; \
+    *Dest = 0; \
+    OpSize = CurrentOp->Size; \
+    goto *DispatchTable[CurrentOp->OpCode]; \
+  } while (0)
+#define NEXT_OP() do { ++CurrentOp; DISPATCH(); } while (0)
+#define JUMP_OP(Target) do { CurrentOp = &Program->Ops[Target]; DISPATCH(); } while (0)
+
+  DISPATCH();
+
+  DEF_OP(VALIDATECODE): {
+    auto Op = IROp->C<IR::IROp_ValidateCode>();
+
+    if (memcmp((void*)Op->CodePtr, &Op->CodeOriginalLow, Op->CodeLength) != 0) {
+      GD = 1;
+    } else {
+      GD = 0;
+    }
+    NEXT_OP();
+  }
 
-  uintptr_t ListBegin = CurrentIR->GetListData();
-  uintptr_t DataBegin = CurrentIR->GetData();
+  DEF_OP(REMOVECODEENTRY): {
+    auto Op = IROp->C<IR::IROp_RemoveCodeEntry>();
+    Thread->CTX->RemoveCodeEntry(Thread, Op->RIP);
+    NEXT_OP();
+  }
 
-  static_assert(sizeof(FEXCore::IR::IROp_Header) == 4);
-  static_assert(sizeof(FEXCore::IR::OrderedNode) == 16);
-
-  auto BlockIterator = CurrentIR->GetBlocks().begin();
-  auto BlockEnd = CurrentIR->GetBlocks().end();
-
-  // Allocate 16 bytes per SSA
-  void *SSAData = alloca(ListSize * 16);
-
-  // Clear them all to zero. Required for Zero-extend semantics
-  memset(SSAData, 0, ListSize * 16);
-
-#define GD *GetDest<uint64_t*>(SSAData, WrapperOp)
-#define GDP GetDest<void*>(SSAData, WrapperOp)
-  auto GetOpSize = [&](IR::OrderedNodeWrapper Node) {
-    auto IROp = CurrentIR->GetOp<FEXCore::IR::IROp_Header>(Node);
-    return IROp->Size;
-  };
-
-  while (1) {
-    using namespace FEXCore::IR;
-    auto [BlockNode, BlockHeader] = BlockIterator();
-    auto BlockIROp = BlockHeader->CW<IROp_CodeBlock>();
-    LogMan::Throw::A(BlockIROp->Header.Op == IR::OP_CODEBLOCK, "IR type failed to be a code block");
-
-    // We grab these nodes this way so we can iterate easily
-    auto CodeBegin = CurrentIR->at(BlockIROp->Begin);
-    auto CodeLast = CurrentIR->at(BlockIROp->Last);
-    struct {
-      bool Quit;
-      bool Redo;
-    } BlockResults{};
-
-    auto HandleBlock = [&](OrderedNode *BlockNode) {
-      for (auto [CodeNode, IROp] : CurrentIR->GetCode(BlockNode)) {
-        OrderedNodeWrapper WrapperOp = CodeNode->Wrapped(ListBegin);
-        uint8_t OpSize = IROp->Size;
-
-        switch (IROp->Op) {
-          case IR::OP_VALIDATECODE: {
-            auto Op = IROp->C<IR::IROp_ValidateCode>();
-
-            if (memcmp((void*)Op->CodePtr, &Op->CodeOriginalLow, Op->CodeLength) != 0) {
-              GD = 1;
-            } else {
-              GD = 0;
-            }
-            break;
-          }
+  DEF_OP(PROMOTECODEENTRY): {
+    auto Op = IROp->C<IR::IROp_PromoteCodeEntry>();
+    Thread->CTX->PromoteCodeEntry(Thread, Op->RIP);
+    NEXT_OP();
+  }
 
-          case IR::OP_REMOVECODEENTRY: {
-            auto Op = IROp->C<IR::IROp_RemoveCodeEntry>();
-            Thread->CTX->RemoveCodeEntry(Thread, Op->RIP);
-            break;
-          }
+  DEF_OP(DUMMY):
+  DEF_OP(BEGINBLOCK):
+  DEF_OP(ENDBLOCK):
+  DEF_OP(INVALIDATEFLAGS):
+    NEXT_OP();
+  DEF_OP(FENCE): {
+    auto Op = IROp->C<IR::IROp_Fence>();
+    switch (Op->Fence) {
+      case IR::Fence_Load.Val:
+        std::atomic_thread_fence(std::memory_order_acquire);
+        break;
+      case IR::Fence_LoadStore.Val:
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        break;
+      case IR::Fence_Store.Val:
+        std::atomic_thread_fence(std::memory_order_release);
+        break;
+      default: LogMan::Msg::A("Unknown Fence: %d", Op->Fence); break;
+    }
+    NEXT_OP();
+  }
+  DEF_OP(EXITFUNCTION): {
+    auto Op = IROp->C<IR::IROp_ExitFunction>();
+    uintptr_t* ContextPtr = reinterpret_cast<uintptr_t*>(&Thread->State.State.rip);
 
-          case IR::OP_DUMMY:
-          case IR::OP_BEGINBLOCK:
-          case IR::OP_ENDBLOCK:
-          case IR::OP_INVALIDATEFLAGS:
-            break;
-          case IR::OP_FENCE: {
-            auto Op = IROp->C<IR::IROp_Fence>();
-            switch (Op->Fence) {
-              case IR::Fence_Load.Val:
-                std::atomic_thread_fence(std::memory_order_acquire);
-                break;
-              case IR::Fence_LoadStore.Val:
-                std::atomic_thread_fence(std::memory_order_seq_cst);
-                break;
-              case IR::Fence_Store.Val:
-                std::atomic_thread_fence(std::memory_order_release);
-                break;
-              default: LogMan::Msg::A("Unknown Fence: %d", Op->Fence); break;
-            }
-            break;
-          }
-          case IR::OP_EXITFUNCTION: {
-            auto Op = IROp->C<IR::IROp_ExitFunction>();
-            uintptr_t* ContextPtr = reinterpret_cast<uintptr_t*>(&Thread->State.State.rip);
+    void *Data = reinterpret_cast<void*>(ContextPtr);
+    void *Src = GetSrc<void*>(SSAData, Op->Header.Args[0]);
 
-            void *Data = reinterpret_cast<void*>(ContextPtr);
-            void *Src = GetSrc<void*>(SSAData, Op->Header.Args[0]);
+    memcpy(Data, Src, OpSize);
 
-            memcpy(Data, Src, OpSize);
+    Core->SSAStackTop = SSABase;
+    if (CurrentOp->Targets[0] != InterpreterProgram::NO_LINK) {
+      return LinkExit(Thread, Program, CurrentOp->Targets[0]);
+    }
+    return nullptr;
+  }
+  DEF_OP(CONDJUMP): {
+    auto Op = IROp->C<IR::IROp_CondJump>();
+    bool CompResult;
 
-            BlockResults.Quit = true;
-            return;
-            break;
-          }
-          case IR::OP_CONDJUMP: {
-            auto Op = IROp->C<IR::IROp_CondJump>();
-            bool CompResult;
-
-            uint64_t Src1 = *GetSrc<uint64_t*>(SSAData, Op->Cmp1);
-            uint64_t Src2 = *GetSrc<uint64_t*>(SSAData, Op->Cmp2);
-
-            if (Op->CompareSize == 4)
-              CompResult = IsConditionTrue<uint32_t, int32_t, float>(Op->Cond.Val, Src1, Src2);
-            else
-              CompResult = IsConditionTrue<uint64_t, int64_t, double>(Op->Cond.Val, Src1, Src2);
-
-            if (CompResult) {
-              BlockIterator = NodeIterator(ListBegin, DataBegin, Op->TrueBlock);
-            }
-            else  {
-              BlockIterator = NodeIterator(ListBegin, DataBegin, Op->FalseBlock);
-            }
-            BlockResults.Redo = true;
-            return;
-            break;
-          }
-          case IR::OP_JUMP: {
-            auto Op = IROp->C<IR::IROp_Jump>();
-            BlockIterator = NodeIterator(ListBegin, DataBegin, Op->Header.Args[0]);
-            BlockResults.Redo = true;
-            return;
-            break;
-          }
-          case IR::OP_BREAK: {
-            auto Op = IROp->C<IR::IROp_Break>();
-            switch (Op->Reason) {
-              case 4: // HLT
-                StopThread(Thread);
-              break;
-            default: LogMan::Msg::A("Unknown Break Reason: %d", Op->Reason); break;
-            }
-            break;
-          }
-          case IR::OP_SIGNALRETURN: {
-            SignalReturn(Thread);
-            break;
-          }
-          case IR::OP_CALLBACKRETURN: {
-            Thread->CTX->InterpreterCallbackReturn(Thread, stack);
-            break;
-          }
-          case IR::OP_SYSCALL: {
-            auto Op = IROp->C<IR::IROp_Syscall>();
-
-            FEXCore::HLE::SyscallArguments Args;
-            for (size_t j = 0; j < FEXCore::HLE::SyscallArguments::MAX_ARGS; ++j) {
-              if (Op->Header.Args[j].IsInvalid()) break;
-              Args.Argument[j] = *GetSrc<uint64_t*>(SSAData, Op->Header.Args[j]);
-            }
-
-            uint64_t Res = FEXCore::Context::HandleSyscall(Thread->CTX->SyscallHandler, Thread, &Args);
-            GD = Res;
-            break;
-          }
-          case IR::OP_THUNK: {
-            auto Op = IROp->C<IR::IROp_Thunk>();
+    uint64_t Src1 = *GetSrc<uint64_t*>(SSAData, Op->Cmp1);
+    uint64_t Src2 = *GetSrc<uint64_t*>(SSAData, Op->Cmp2);
 
-            //LogMan::Msg::D("Thunk function: %s, %p, %p\n", Op->ThunkName, Op->ThunkFnPtr, *GetSrc<void**>(Op->Header.Args[0]));
+    if (Op->CompareSize == 4)
+      CompResult = IsConditionTrue<uint32_t, int32_t, float>(Op->Cond.Val, Src1, Src2);
+    else
+      CompResult = IsConditionTrue<uint64_t, int64_t, double>(Op->Cond.Val, Src1, Src2);
 
-            reinterpret_cast<ThunkedFunction*>(Op->ThunkFnPtr)(*GetSrc<void**>(SSAData, Op->Header.Args[0]));
+    JUMP_OP(CurrentOp->Targets[CompResult ? 0 : 1]);
+  }
+  DEF_OP(JUMP): {
+    JUMP_OP(CurrentOp->Targets[0]);
+  }
+  DEF_OP(BREAK): {
+    auto Op = IROp->C<IR::IROp_Break>();
+    switch (Op->Reason) {
+      case 4: // HLT
+        StopThread(Thread);
+      break;
+    default: LogMan::Msg::A("Unknown Break Reason: %d", Op->Reason); break;
+    }
+    NEXT_OP();
+  }
+  DEF_OP(SIGNALRETURN): {
+    // Neither of these come back, InterpreterExecution doesn't get to leave this level
+    --Core->ExecutionDepth;
+    Core->SSAStackTop = SSABase;
+    SignalReturn(Thread);
+    NEXT_OP();
+  }
+  DEF_OP(CALLBACKRETURN): {
+    --Core->ExecutionDepth;
+    Core->SSAStackTop = SSABase;
+    Thread->CTX->InterpreterCallbackReturn(Thread, stack);
+    NEXT_OP();
+  }
+  DEF_OP(SYSCALL): {
+    auto Op = IROp->C<IR::IROp_Syscall>();
 
-            break;
-          }
-          case IR::OP_CPUID: {
-            auto Op = IROp->C<IR::IROp_CPUID>();
-            uint64_t *DstPtr = GetDest<uint64_t*>(SSAData, WrapperOp);
-            uint64_t Arg = *GetSrc<uint64_t*>(SSAData, Op->Header.Args[0]);
-
-            auto Results = Thread->CTX->CPUID.RunFunction(Arg);
-            memcpy(DstPtr, &Results, sizeof(uint32_t) * 4);
-            break;
-          }
-          case IR::OP_PRINT: {
-            auto Op = IROp->C<IR::IROp_Print>();
-
-            if (OpSize <= 8) {
-              uint64_t Src = *GetSrc<uint64_t*>(SSAData, Op->Header.Args[0]);
-              LogMan::Msg::I(">>>> Value in Arg: 0x%lx, %ld", Src, Src);
-            }
-            else if (OpSize == 16) {
-              __uint128_t Src = *GetSrc<__uint128_t*>(SSAData, Op->Header.Args[0]);
-              uint64_t Src0 = Src;
-              uint64_t Src1 = Src >> 64;
-              LogMan::Msg::I(">>>> Value[0] in Arg: 0x%lx, %ld", Src0, Src0);
-              LogMan::Msg::I("     Value[1] in Arg: 0x%lx, %ld", Src1, Src1);
-            }
-            else
-              LogMan::Msg::A("Unknown value size: %d", OpSize);
-            break;
-          }
-          case IR::OP_CYCLECOUNTER: {
-            #ifdef DEBUG_CYCLES
-              GD = 0;
-            #else
-              timespec time;
-              clock_gettime(CLOCK_REALTIME, &time);
-              GD = time.tv_nsec + time.tv_sec * 1000000000;
-            #endif
-            break;
-          }
-          case IR::OP_MOV: {
-            auto Op = IROp->C<IR::IROp_Mov>();
-            memcpy(GDP, GetSrc<void*>(SSAData, Op->Header.Args[0]), OpSize);
-            break;
-          }
-          case IR::OP_VBITCAST: {
-            auto Op = IROp->C<IR::IROp_VBitcast>();
-            memcpy(GDP, GetSrc<void*>(SSAData, Op->Header.Args[0]), 16);
-            break;
-          }
-          case IR::OP_VCASTFROMGPR: {
-            auto Op = IROp->C<IR::IROp_VCastFromGPR>();
-            memcpy(GDP, GetSrc<void*>(SSAData, Op->Header.Args[0]), Op->Header.ElementSize);
-            break;
-          }
-          case IR::OP_VEXTRACTTOGPR: {
-            auto Op = IROp->C<IR::IROp_VExtractToGPR>();
-            uint32_t SourceSize = GetOpSize(Op->Header.Args[0]);
-
-            LogMan::Throw::A(OpSize <= 16, "OpSize is too large for VExtractToGPR: %d", OpSize);
-
-            if (SourceSize == 16) {
-              __uint128_t SourceMask = (1ULL << (Op->Header.ElementSize * 8)) - 1;
-              uint64_t Shift = Op->Header.ElementSize * Op->Idx * 8;
-              if (Op->Header.ElementSize == 8)
-                SourceMask = ~0ULL;
-
-              __uint128_t Src = *GetSrc<__uint128_t*>(SSAData, Op->Header.Args[0]);
-              Src >>= Shift;
-              Src &= SourceMask;
-              memcpy(GDP, &Src, Op->Header.ElementSize);
-            }
-            else {
-              uint64_t SourceMask = (1ULL << (Op->Header.ElementSize * 8)) - 1;
-              uint64_t Shift = Op->Header.ElementSize * Op->Idx * 8;
-              if (Op->Header.ElementSize == 8)
-                SourceMask = ~0ULL;
-
-              uint64_t Src = *GetSrc<uint64_t*>(SSAData, Op->Header.Args[0]);
-              Src >>= Shift;
-              Src &= SourceMask;
-              GD = Src;
-            }
-            break;
-          }
-          case IR::OP_VEXTRACTELEMENT: {
-            auto Op = IROp->C<IR::IROp_VExtractElement>();
-            uint32_t SourceSize = GetOpSize(Op->Header.Args[0]);
-            LogMan::Throw::A(OpSize <= 16, "OpSize is too large for VExtractToGPR: %d", OpSize);
-            if (SourceSize == 16) {
-              __uint128_t SourceMask = (1ULL << (Op->Header.ElementSize * 8)) - 1;
-              uint64_t Shift = Op->Header.ElementSize * Op->Index * 8;
-              if (Op->Header.ElementSize == 8)
-                SourceMask = ~0ULL;
-
-              __uint128_t Src = *GetSrc<__uint128_t*>(SSAData, Op->Header.Args[0]);
-              Src >>= Shift;
-              Src &= SourceMask;
-              memcpy(GDP, &Src, Op->Header.ElementSize);
-            }
-            else {
-              uint64_t SourceMask = (1ULL << (Op->Header.ElementSize * 8)) - 1;
-              uint64_t Shift = Op->Header.ElementSize * Op->Index * 8;
-              if (Op->Header.ElementSize == 8)
-                SourceMask = ~0ULL;
-
-              uint64_t Src = *GetSrc<uint64_t*>(SSAData, Op->Header.Args[0]);
-              Src >>= Shift;
-              Src &= SourceMask;
-              GD = Src;
-            }
-            break;
-          }
-          case IR::OP_CONSTANT: {
-            auto Op = IROp->C<IR::IROp_Constant>();
-            GD = Op->Constant;
-            break;
-          }
-          case IR::OP_VECTORZERO: {
-            memset(GDP, 0, OpSize);
-            break;
-          }
-          case IR::OP_LOADCONTEXT: {
-            auto Op = IROp->C<IR::IROp_LoadContext>();
-
-            uintptr_t ContextPtr = reinterpret_cast<uintptr_t>(&Thread->State.State);
-            ContextPtr += Op->Offset;
-            #define LOAD_CTX(x, y) \
-              case x: { \
-                y const *Data = reinterpret_cast<y const*>(ContextPtr); \
-                GD = *Data; \
-                break; \
-              }
-            switch (OpSize) {
-              LOAD_CTX(1, uint8_t)
-              LOAD_CTX(2, uint16_t)
-              LOAD_CTX(4, uint32_t)
-              LOAD_CTX(8, uint64_t)
-              case 16: {
-                void const *Data = reinterpret_cast<void const*>(ContextPtr);
-                memcpy(GDP, Data, OpSize);
-                break;
-              }
-              default:  LogMan::Msg::A("Unhandled LoadContext size: %d", OpSize);
-            }
-            #undef LOAD_CTX
-            break;
-          }
-          case IR::OP_LOADCONTEXTINDEXED: {
-            auto Op = IROp->C<IR::IROp_LoadContextIndexed>();
-            uint64_t Index = *GetSrc<uint64_t*>(SSAData, Op->Header.Args[0]);
-
-            uintptr_t ContextPtr = reinterpret_cast<uintptr_t>(&Thread->State.State);
-            ContextPtr += Op->BaseOffset;
-            ContextPtr += Index * Op->Stride;
-
-            #define LOAD_CTX(x, y) \
-              case x: { \
-                y const *Data = reinterpret_cast<y const*>(ContextPtr); \
-                GD = *Data; \
-                break; \
-              }
-            switch (Op->Size) {
-              LOAD_CTX(1, uint8_t)
-              LOAD_CTX(2, uint16_t)
-              LOAD_CTX(4, uint32_t)
-              LOAD_CTX(8, uint64_t)
-              case 16: {
-                void const *Data = reinterpret_cast<void const*>(ContextPtr);
-                memcpy(GDP, Data, Op->Size);
-                break;
-              }
-              default:  LogMan::Msg::A("Unhandled LoadContextIndexed size: %d", Op->Size);
-            }
-            #undef LOAD_CTX
-            break;
-          }
-          case IR::OP_STORECONTEXT: {
-            auto Op = IROp->C<IR::IROp_StoreContext>();
+    FEXCore::HLE::SyscallArguments Args;
+    for (size_t j = 0; j < FEXCore::HLE::SyscallArguments::MAX_ARGS; ++j) {
+      if (Op->Header.Args[j].IsInvalid()) break;
+      Args.Argument[j] = *GetSrc<uint64_t*>(SSAData, Op->Header.Args[j]);
+    }
 
-            uintptr_t ContextPtr = reinterpret_cast<uintptr_t>(&Thread->State.State);
-            ContextPtr += Op->Offset;
+    HoldProgram(Thread, IROp);
+    uint64_t Res = FEXCore::Context::HandleSyscall(Thread->CTX->SyscallHandler, Thread, &Args);
+    Thread->LookupCache->SetHeldCode(0);
+    GD = Res;
+    NEXT_OP();
+  }
+  DEF_OP(SYSCALLDIRECT): {
+    auto Op = IROp->C<IR::IROp_SyscallDirect>();
+    using HandlerArg0 = uint64_t(*)(FEXCore::Core::InternalThreadState *Thread);
+    using HandlerArg1 = uint64_t(*)(FEXCore::Core::InternalThreadState *Thread, uint64_t);
+    using HandlerArg2 = uint64_t(*)(FEXCore::Core::InternalThreadState *Thread, uint64_t, uint64_t);
+    using HandlerArg3 = uint64_t(*)(FEXCore::Core::InternalThreadState *Thread, uint64_t, uint64_t, uint64_t);
+    using HandlerArg4 = uint64_t(*)(FEXCore::Core::InternalThreadState *Thread, uint64_t, uint64_t, uint64_t, uint64_t);
+    using HandlerArg5 = uint64_t(*)(FEXCore::Core::InternalThreadState *Thread, uint64_t, uint64_t, uint64_t, uint64_t, uint64_t);
+    using HandlerArg6 = uint64_t(*)(FEXCore::Core::InternalThreadState *Thread, uint64_t, uint64_t, uint64_t, uint64_t, uint64_t, uint64_t);
+
+    uint64_t Args[6]{};
+    size_t NumArgs = 0;
+    for (; NumArgs < 6; ++NumArgs) {
+      if (Op->Header.Args[NumArgs].IsInvalid()) break;
+      Args[NumArgs] = *GetSrc<uint64_t*>(SSAData, Op->Header.Args[NumArgs]);
+    }
 
-            void *Data = reinterpret_cast<void*>(ContextPtr);
-            void *Src = GetSrc<void*>(SSAData, Op->Header.Args[0]);
-            memcpy(Data, Src, OpSize);
-            break;
-          }
-          case IR::OP_STORECONTEXTINDEXED: {
-            auto Op = IROp->C<IR::IROp_StoreContextIndexed>();
-            uint64_t Index = *GetSrc<uint64_t*>(SSAData, Op->Header.Args[1]);
-
-            uintptr_t ContextPtr = reinterpret_cast<uintptr_t>(&Thread->State.State);
-            ContextPtr += Op->BaseOffset;
-            ContextPtr += Index * Op->Stride;
-
-            void *Data = reinterpret_cast<void*>(ContextPtr);
-            void *Src = GetSrc<void*>(SSAData, Op->Header.Args[0]);
-            memcpy(Data, Src, Op->Size);
-            break;
-          }
-          case IR::OP_CREATEELEMENTPAIR: {
-            auto Op = IROp->C<IR::IROp_CreateElementPair>();
-            void *Src_Lower = GetSrc<void*>(SSAData, Op->Header.Args[0]);
-            void *Src_Upper = GetSrc<void*>(SSAData, Op->Header.Args[1]);
+    uint64_t Res{};
+    HoldProgram(Thread, IROp);
+    switch (NumArgs) {
+      case 0: Res = reinterpret_cast<HandlerArg0>(Op->HostHandler)(Thread); break;
+      case 1: Res = reinterpret_cast<HandlerArg1>(Op->HostHandler)(Thread, Args[0]); break;
+      case 2: Res = reinterpret_cast<HandlerArg2>(Op->HostHandler)(Thread, Args[0], Args[1]); break;
+      case 3: Res = reinterpret_cast<HandlerArg3>(Op->HostHandler)(Thread, Args[0], Args[1], Args[2]); break;
+      case 4: Res = reinterpret_cast<HandlerArg4>(Op->HostHandler)(Thread, Args[0], Args[1], Args[2], Args[3]); break;
+      case 5: Res = reinterpret_cast<HandlerArg5>(Op->HostHandler)(Thread, Args[0], Args[1], Args[2], Args[3], Args[4]); break;
+      case 6: Res = reinterpret_cast<HandlerArg6>(Op->HostHandler)(Thread, Args[0], Args[1], Args[2], Args[3], Args[4], Args[5]); break;
+    }
+    Thread->LookupCache->SetHeldCode(0);
+    GD = Res;
+    NEXT_OP();
+  }
+  DEF_OP(THUNK): {
+    auto Op = IROp->C<IR::IROp_Thunk>();
 
-            uint8_t *Dst = GetDest<uint8_t*>(SSAData, WrapperOp);
+    //LogMan::Msg::D("Thunk function: %s, %p, %p\n", Op->ThunkName, Op->ThunkFnPtr, *GetSrc<void**>(Op->Header.Args[0]));
 
-            memcpy(Dst, Src_Lower, Op->Header.Size);
-            memcpy(Dst + Op->Header.Size, Src_Upper, Op->Header.Size);
-            break;
-          }
-          case IR::OP_EXTRACTELEMENTPAIR: {
-            auto Op = IROp->C<IR::IROp_ExtractElementPair>();
-            uintptr_t Src = GetSrc<uintptr_t>(SSAData, Op->Header.Args[0]);
-            memcpy(GDP,
-              reinterpret_cast<void*>(Src + Op->Header.Size * Op->Element), Op->Header.Size);
-            break;
-          }
-          case IR::OP_CASPAIR: {
-            auto Op = IROp->C<IR::IROp_CASPair>();
-            auto Size = OpSize;
-            // Size is the size of each pair element
-            switch (Size) {
-              case 4: {
-                std::atomic<uint64_t> *Data = *GetSrc<std::atomic<uint64_t> **>(SSAData, Op->Header.Args[2]);
-
-                uint64_t Src1 = *GetSrc<uint64_t*>(SSAData, Op->Header.Args[0]);
-                uint64_t Src2 = *GetSrc<uint64_t*>(SSAData, Op->Header.Args[1]);
-
-                uint64_t Expected = Src1;
-                bool Result = Data->compare_exchange_strong(Expected, Src2);
-                GD = Result ? Src1 : Expected;
-                break;
-              }
-              case 8: {
-                std::atomic<__uint128_t> *Data = *GetSrc<std::atomic<__uint128_t> **>(SSAData, Op->Header.Args[2]);
-
-                __uint128_t Src1 = *GetSrc<__uint128_t*>(SSAData, Op->Header.Args[0]);
-                __uint128_t Src2 = *GetSrc<__uint128_t*>(SSAData, Op->Header.Args[1]);
-
-                __uint128_t Expected = Src1;
-                bool Result = Data->compare_exchange_strong(Expected, Src2);
-                memcpy(GDP, Result ? &Src1 : &Expected, 16);
-                break;
-              }
-              default: LogMan::Msg::A("Unknown CAS size: %d", Size); break;
-            }
-            break;
-          }
-          case IR::OP_TRUNCELEMENTPAIR: {
-            auto Op = IROp->C<IR::IROp_TruncElementPair>();
-
-            switch (Op->Size) {
-              case 4: {
-                uint64_t *Src = GetSrc<uint64_t*>(SSAData, Op->Header.Args[0]);
-                uint64_t Result{};
-                Result = Src[0] & ~0U;
-                Result |= Src[1] << 32;
-                GD = Result;
-                break;
-              }
-              default: LogMan::Msg::A("Unhandled Truncation size: %d", Op->Size); break;
-            }
-            break;
-          }
-          case IR::OP_LOADFLAG: {
-            auto Op = IROp->C<IR::IROp_LoadFlag>();
-
-            uintptr_t ContextPtr = reinterpret_cast<uintptr_t>(&Thread->State.State);
-            ContextPtr += offsetof(FEXCore::Core::CPUState, flags[0]);
-            ContextPtr += Op->Flag;
-            uint8_t const *Data = reinterpret_cast<uint8_t const*>(ContextPtr);
-            GD = *Data;
-            break;
-          }
-          case IR::OP_STOREFLAG: {
-            auto Op = IROp->C<IR::IROp_StoreFlag>();
-            uint8_t Arg = *GetSrc<uint8_t*>(SSAData, Op->Header.Args[0]);
-
-            uintptr_t ContextPtr = reinterpret_cast<uintptr_t>(&Thread->State.State);
-            ContextPtr += offsetof(FEXCore::Core::CPUState, flags[0]);
-            ContextPtr += Op->Flag;
-            uint8_t *Data = reinterpret_cast<uint8_t*>(ContextPtr);
-            *Data = Arg;
-            break;
-          }
-          case IR::OP_LOADMEM:
-          case IR::OP_LOADMEMTSO: {
-            auto Op = IROp->C<IR::IROp_LoadMem>();
-            uint8_t const *Data = *GetSrc<uint8_t const**>(SSAData, Op->Addr);
-
-            if (!Op->Offset.IsInvalid()) {
-              auto Offset = *GetSrc<uintptr_t const*>(SSAData, Op->Offset) * Op->OffsetScale;
-
-              switch(Op->OffsetType.Val) {
-                case MEM_OFFSET_SXTX.Val: Data +=  Offset; break;
-                case MEM_OFFSET_UXTW.Val: Data += (uint32_t)Offset; break;
-                case MEM_OFFSET_SXTW.Val: Data += (int32_t)Offset; break;
-              }
-            }
-            memset(GDP, 0, 16);
-            memcpy(GDP, Data, Op->Size);
-            break;
-          }
-          case IR::OP_VLOADMEMELEMENT: {
-            auto Op = IROp->C<IR::IROp_VLoadMemElement>();
-            void const *Data = *GetSrc<void const**>(SSAData, Op->Header.Args[0]);
-
-            memcpy(GDP, GetSrc<void*>(SSAData, Op->Header.Args[1]), 16);
-            memcpy(reinterpret_cast<void*>(reinterpret_cast<uintptr_t>(GDP) + (Op->Header.ElementSize * Op->Index)),
-              Data, Op->Header.ElementSize);
-            break;
-          }
-          case IR::OP_STOREMEM:
-          case IR::OP_STOREMEMTSO: {
-            auto Op = IROp->C<IR::IROp_StoreMem>();
-
-            uint8_t *Data = *GetSrc<uint8_t **>(SSAData, Op->Addr);
-
-            if (!Op->Offset.IsInvalid()) {
-              auto Offset = *GetSrc<uintptr_t const*>(SSAData, Op->Offset) * Op->OffsetScale;
-
-              switch(Op->OffsetType.Val) {
-                case MEM_OFFSET_SXTX.Val: Data +=  Offset; break;
-                case MEM_OFFSET_UXTW.Val: Data += (uint32_t)Offset; break;
-                case MEM_OFFSET_SXTW.Val: Data += (int32_t)Offset; break;
-              }
-            }
-            memcpy(Data, GetSrc<void*>(SSAData, Op->Value), Op->Size);
-            break;
-          }
-          case IR::OP_VSTOREMEMELEMENT: {
-            #define STORE_DATA(x, y) \
-              case x: { \
-                y *Data = *GetSrc<y**>(SSAData, Op->Header.Args[0]); \
-                memcpy(Data, &GetSrc<y*>(SSAData, Op->Header.Args[1])[Op->Index], sizeof(y)); \
-                break; \
-              }
-
-            auto Op = IROp->C<IR::IROp_VStoreMemElement>();
-
-            switch (OpSize) {
-              STORE_DATA(1, uint8_t)
-              STORE_DATA(2, uint16_t)
-              STORE_DATA(4, uint32_t)
-              STORE_DATA(8, uint64_t)
-              default: LogMan::Msg::A("Unhandled StoreMem size"); break;
-            }
-            #undef STORE_DATA
-            break;
-          }
-          #define DO_OP(size, type, func)              \
-            case size: {                                      \
-            auto *Dst_d  = reinterpret_cast<type*>(GDP);  \
-            auto *Src1_d = reinterpret_cast<type*>(Src1); \
-            auto *Src2_d = reinterpret_cast<type*>(Src2); \
-            *Dst_d = func(*Src1_d, *Src2_d);          \
-            break;                                            \
-            }
-
-          case IR::OP_ADD: {
-            auto Op = IROp->C<IR::IROp_Add>();
-            void *Src1 = GetSrc<void*>(SSAData, Op->Header.Args[0]);
-            void *Src2 = GetSrc<void*>(SSAData, Op->Header.Args[1]);
-            auto Func = [](auto a, auto b) { return a + b; };
-
-            switch (OpSize) {
-              DO_OP(4, uint32_t, Func)
-              DO_OP(8, uint64_t, Func)
-              default: LogMan::Msg::A("Unknown Size: %d", OpSize); break;
-            }
-            break;
-          }
-          case IR::OP_SUB: {
-            auto Op = IROp->C<IR::IROp_Sub>();
-            void *Src1 = GetSrc<void*>(SSAData, Op->Header.Args[0]);
-            void *Src2 = GetSrc<void*>(SSAData, Op->Header.Args[1]);
-            auto Func = [](auto a, auto b) { return a - b; };
-
-            switch (OpSize) {
-              DO_OP(4, uint32_t, Func)
-              DO_OP(8, uint64_t, Func)
-              default: LogMan::Msg::A("Unknown Size: %d", OpSize); break;
-            }
-            break;
-          }
-          case IR::OP_NEG: {
-            auto Op = IROp->C<IR::IROp_Neg>();
-            uint64_t Src = *GetSrc<int64_t*>(SSAData, Op->Header.Args[0]);
-            switch (OpSize) {
-              case 4:
-                GD = -static_cast<int32_t>(Src);
-                break;
-              case 8:
-                GD = -static_cast<int64_t>(Src);
-                break;
-              default: LogMan::Msg::A("Unknown NEG Size: %d\n", OpSize); break;
-            };
-            break;
-          }
-          case IR::OP_OR: {
-            auto Op = IROp->C<IR::IROp_Or>();
-            void *Src1 = GetSrc<void*>(SSAData, Op->Header.Args[0]);
-            void *Src2 = GetSrc<void*>(SSAData, Op->Header.Args[1]);
-            auto Func = [](auto a, auto b) { return a | b; };
-
-            switch (OpSize) {
-              DO_OP(1, uint8_t,  Func)
-              DO_OP(2, uint16_t, Func)
-              DO_OP(4, uint32_t, Func)
-              DO_OP(8, uint64_t, Func)
-              DO_OP(16, __uint128_t, Func)
-              default: LogMan::Msg::A("Unknown Size: %d", OpSize); break;
-            }
-            break;
-          }
-          case IR::OP_AND: {
-            auto Op = IROp->C<IR::IROp_And>();
-            void *Src1 = GetSrc<void*>(SSAData, Op->Header.Args[0]);
-            void *Src2 = GetSrc<void*>(SSAData, Op->Header.Args[1]);
-            auto Func = [](auto a, auto b) { return a & b; };
-
-            switch (OpSize) {
-              DO_OP(1, uint8_t,  Func)
-              DO_OP(2, uint16_t, Func)
-              DO_OP(4, uint32_t, Func)
-              DO_OP(8, uint64_t, Func)
-              default: LogMan::Msg::A("Unknown Size: %d", OpSize); break;
-            }
-            break;
-          }
-          case IR::OP_XOR: {
-            auto Op = IROp->C<IR::IROp_Xor>();
-            void *Src1 = GetSrc<void*>(SSAData, Op->Header.Args[0]);
-            void *Src2 = GetSrc<void*>(SSAData, Op->Header.Args[1]);
-            auto Func = [](auto a, auto b) { return a ^ b; };
-
-            switch (OpSize) {
-              DO_OP(1, uint8_t,  Func)
-              DO_OP(2, uint16_t, Func)
-              DO_OP(4, uint32_t, Func)
-              DO_OP(8, uint64_t, Func)
-              default: LogMan::Msg::A("Unknown Size: %d", OpSize); break;
-            }
-            break;
-          }
-          case IR::OP_LSHL: {
-            auto Op = IROp->C<IR::IROp_Lshl>();
-            uint64_t Src1 = *GetSrc<uint64_t*>(SSAData, Op->Header.Args[0]);
-            uint64_t Src2 = *GetSrc<uint64_t*>(SSAData, Op->Header.Args[1]);
-            uint8_t Mask = OpSize * 8 - 1;
-            switch (OpSize) {
-              case 4:
-                GD = static_cast<int32_t>(Src1) << (Src2 & Mask);
-                break;
-              case 8:
-                GD = static_cast<int64_t>(Src1) << (Src2 & Mask);
-                break;
-              default: LogMan::Msg::A("Unknown LSHL Size: %d\n", OpSize); break;
-            };
-            break;
-          }
-          case IR::OP_LSHR: {
-            auto Op = IROp->C<IR::IROp_Lshr>();
-            uint64_t Src1 = *GetSrc<uint64_t*>(SSAData, Op->Header.Args[0]);
-            uint64_t Src2 = *GetSrc<uint64_t*>(SSAData, Op->Header.Args[1]);
-            uint8_t Mask = OpSize * 8 - 1;
-            switch (OpSize) {
-              case 4:
-                GD = static_cast<uint32_t>(Src1) >> (Src2 & Mask);
-                break;
-              case 8:
-                GD = static_cast<uint64_t>(Src1) >> (Src2 & Mask);
-                break;
-              default: LogMan::Msg::A("Unknown LSHR Size: %d\n", OpSize); break;
-            };
-            break;
-          }
-          case IR::OP_ASHR: {
-            auto Op = IROp->C<IR::IROp_Ashr>();
-            uint64_t Src1 = *GetSrc<uint64_t*>(SSAData, Op->Header.Args[0]);
-            uint64_t Src2 = *GetSrc<uint64_t*>(SSAData, Op->Header.Args[1]);
-            uint8_t Mask = OpSize * 8 - 1;
-            switch (OpSize) {
-              case 4:
-                GD = (uint32_t)(static_cast<int32_t>(Src1) >> (Src2 & Mask));
-                break;
-              case 8:
-                GD = (uint64_t)(static_cast<int64_t>(Src1) >> (Src2 & Mask));
-                break;
-              default: LogMan::Msg::A("Unknown ASHR Size: %d\n", OpSize); break;
-            };
-            break;
-          }
-          case IR::OP_ROR: {
-            auto Op = IROp->C<IR::IROp_Ror>();
-            uint64_t Src1 = *GetSrc<uint64_t*>(SSAData, Op->Header.Args[0]);
-            uint64_t Src2 = *GetSrc<uint64_t*>(SSAData, Op->Header.Args[1]);
-            auto Ror = [] (auto In, auto R) {
-            auto RotateMask = sizeof(In) * 8 - 1;
-              R &= RotateMask;
-              return (In >> R) | (In << (sizeof(In) * 8 - R));
-            };
-
-            switch (OpSize) {
-              case 4:
-                GD = Ror(static_cast<uint32_t>(Src1), static_cast<uint32_t>(Src2));
-                break;
-              case 8: {
-                GD = Ror(static_cast<uint64_t>(Src1), static_cast<uint64_t>(Src2));
-                break;
-              }
-              default: LogMan::Msg::A("Unknown ROR Size: %d\n", OpSize); break;
-            }
-            break;
-          }
-          case IR::OP_EXTR: {
-            auto Op = IROp->C<IR::IROp_Extr>();
-            uint64_t Src1 = *GetSrc<uint64_t*>(SSAData, Op->Header.Args[0]);
-            uint64_t Src2 = *GetSrc<uint64_t*>(SSAData, Op->Header.Args[1]);
-            auto Extr = [] (auto Src1, auto Src2, uint8_t lsb) -> decltype(Src1) {
-              __uint128_t Result{};
-              Result = Src1;
-              Result <<= sizeof(Src1) * 8;
-              Result |= Src2;
-              Result >>= lsb;
-              return Result;
-            };
-
-            switch (OpSize) {
-              case 4:
-                GD = Extr(static_cast<uint32_t>(Src1), static_cast<uint32_t>(Src2), Op->LSB);
-                break;
-              case 8: {
-                GD = Extr(static_cast<uint64_t>(Src1), static_cast<uint64_t>(Src2), Op->LSB);
-                break;
-              }
-              default: LogMan::Msg::A("Unknown EXTR Size: %d\n", OpSize); break;
-            }
-            break;
-          }
-          case IR::OP_NOT: {
-            auto Op = IROp->C<IR::IROp_Not>();
-            uint64_t Src = *GetSrc<uint64_t*>(SSAData, Op->Header.Args[0]);
-            const uint64_t mask[9]= { 0, 0xFF, 0xFFFF, 0, 0xFFFFFFFF, 0, 0, 0, 0xFFFFFFFFFFFFFFFFULL };
-            uint64_t Mask = mask[OpSize];
-            GD = (~Src) & Mask;
-            break;
-          }
-          case IR::OP_MUL: {
-            auto Op = IROp->C<IR::IROp_Mul>();
-            uint64_t Src1 = *GetSrc<uint64_t*>(SSAData, Op->Header.Args[0]);
-            uint64_t Src2 = *GetSrc<uint64_t*>(SSAData, Op->Header.Args[1]);
-
-            switch (OpSize) {
-              case 4:
-                GD = static_cast<int64_t>(static_cast<int32_t>(Src1)) * static_cast<int64_t>(static_cast<int32_t>(Src2));
-                break;
-              case 8:
-                GD = static_cast<int64_t>(Src1) * static_cast<int64_t>(Src2);
-                break;
-              case 16: {
-                __int128_t Tmp = static_cast<__int128_t>(static_cast<int64_t>(Src1)) * static_cast<__int128_t>(static_cast<int64_t>(Src2));
-                memcpy(GDP, &Tmp, 16);
-                break;
-              }
-              default: LogMan::Msg::A("Unknown Mul Size: %d\n", OpSize); break;
-            }
-            break;
-          }
-          case IR::OP_MULH: {
-            auto Op = IROp->C<IR::IROp_MulH>();
-            uint64_t Src1 = *GetSrc<uint64_t*>(SSAData, Op->Header.Args[0]);
-            uint64_t Src2 = *GetSrc<uint64_t*>(SSAData, Op->Header.Args[1]);
-
-            switch (OpSize) {
-              case 4: {
-                int64_t Tmp = static_cast<int64_t>(static_cast<int32_t>(Src1)) * static_cast<int64_t>(static_cast<int32_t>(Src2));
-                GD = Tmp >> 32;
-                break;
-              }
-              case 8: {
-                __int128_t Tmp = static_cast<__int128_t>(static_cast<int64_t>(Src1)) * static_cast<__int128_t>(static_cast<int64_t>(Src2));
-                GD = Tmp >> 64;
-              }
-              break;
-              default: LogMan::Msg::A("Unknown MulH Size: %d\n", OpSize); break;
-            }
-            break;
-          }
-          case IR::OP_UMUL: {
-            auto Op = IROp->C<IR::IROp_UMul>();
-            uint64_t Src1 = *GetSrc<uint64_t*>(SSAData, Op->Header.Args[0]);
-            uint64_t Src2 = *GetSrc<uint64_t*>(SSAData, Op->Header.Args[1]);
-
-            switch (OpSize) {
-              case 4:
-                GD = static_cast<uint32_t>(Src1) * static_cast<uint32_t>(Src2);
-                break;
-              case 8:
-                GD = static_cast<uint64_t>(Src1) * static_cast<uint64_t>(Src2);
-                break;
-              case 16: {
-                __uint128_t Tmp = static_cast<__uint128_t>(static_cast<uint64_t>(Src1)) * static_cast<__uint128_t>(static_cast<uint64_t>(Src2));
-                memcpy(GDP, &Tmp, 16);
-                break;
-              }
-              default: LogMan::Msg::A("Unknown UMul Size: %d\n", OpSize); break;
-            }
-            break;
-          }
-          case IR::OP_UMULH: {
-            auto Op = IROp->C<IR::IROp_UMulH>();
-            uint64_t Src1 = *GetSrc<uint64_t*>(SSAData, Op->Header.Args[0]);
-            uint64_t Src2 = *GetSrc<uint64_t*>(SSAData, Op->Header.Args[1]);
-            switch (OpSize) {
-              case 4:
-                GD = static_cast<uint64_t>(Src1) * static_cast<uint64_t>(Src2);
-                GD >>= 32;
-                break;
-              case 8: {
-                __uint128_t Tmp = static_cast<__uint128_t>(Src1) * static_cast<__uint128_t>(Src2);
-                GD = Tmp >> 64;
-                break;
-              }
-              case 16: {
-                // XXX: This is incorrect
-                __uint128_t Tmp = static_cast<__uint128_t>(Src1) * static_cast<__uint128_t>(Src2);
-                GD = Tmp >> 64;
-                break;
-              }
-              default: LogMan::Msg::A("Unknown UMulH Size: %d\n", OpSize); break;
-            }
-            break;
-          }
-          case IR::OP_DIV: {
-            auto Op = IROp->C<IR::IROp_Div>();
-            uint64_t Src1 = *GetSrc<uint64_t*>(SSAData, Op->Header.Args[0]);
-            uint64_t Src2 = *GetSrc<uint64_t*>(SSAData, Op->Header.Args[1]);
-
-            switch (OpSize) {
-              case 1:
-                GD = static_cast<int64_t>(static_cast<int8_t>(Src1)) / static_cast<int64_t>(static_cast<int8_t>(Src2));
-                break;
-              case 2:
-                GD = static_cast<int64_t>(static_cast<int16_t>(Src1)) / static_cast<int64_t>(static_cast<int16_t>(Src2));
-                break;
-              case 4:
-                GD = static_cast<int64_t>(static_cast<int32_t>(Src1)) / static_cast<int64_t>(static_cast<int32_t>(Src2));
-                break;
-              case 8:
-                GD = static_cast<int64_t>(Src1) / static_cast<int64_t>(Src2);
-                break;
-              case 16: {
-                __int128_t Tmp = *GetSrc<__int128_t*>(SSAData, Op->Header.Args[0]) / *GetSrc<__int128_t*>(SSAData, Op->Header.Args[1]);
-                memcpy(GDP, &Tmp, 16);
-                break;
-              }
-              default: LogMan::Msg::A("Unknown Mul Size: %d\n", OpSize); break;
-            }
-            break;
-          }
-          case IR::OP_UDIV: {
-            auto Op = IROp->C<IR::IROp_UDiv>();
-            uint64_t Src1 = *GetSrc<uint64_t*>(SSAData, Op->Header.Args[0]);
-            uint64_t Src2 = *GetSrc<uint64_t*>(SSAData, Op->Header.Args[1]);
-
-            switch (OpSize) {
-              case 1:
-                GD = static_cast<uint64_t>(static_cast<uint8_t>(Src1)) / static_cast<uint64_t>(static_cast<uint8_t>(Src2));
-                break;
-              case 2:
-                GD = static_cast<uint64_t>(static_cast<uint16_t>(Src1)) / static_cast<uint64_t>(static_cast<uint16_t>(Src2));
-                break;
-              case 4:
-                GD = static_cast<uint64_t>(static_cast<uint32_t>(Src1)) / static_cast<uint64_t>(static_cast<uint32_t>(Src2));
-                break;
-              case 8:
-                GD = static_cast<uint64_t>(Src1) / static_cast<uint64_t>(Src2);
-                break;
-              case 16: {
-                __uint128_t Tmp = *GetSrc<__uint128_t*>(SSAData, Op->Header.Args[0]) / *GetSrc<__uint128_t*>(SSAData, Op->Header.Args[1]);
-                memcpy(GDP, &Tmp, 16);
-                break;
-              }
-              default: LogMan::Msg::A("Unknown Mul Size: %d\n", OpSize); break;
-            }
-            break;
-          }
-          case IR::OP_REM: {
-            auto Op = IROp->C<IR::IROp_Rem>();
-            uint64_t Src1 = *GetSrc<uint64_t*>(SSAData, Op->Header.Args[0]);
-            uint64_t Src2 = *GetSrc<uint64_t*>(SSAData, Op->Header.Args[1]);
-
-            switch (OpSize) {
-              case 1:
-                GD = static_cast<int64_t>(static_cast<int8_t>(Src1)) % static_cast<int64_t>(static_cast<int8_t>(Src2));
-                break;
-              case 2:
-                GD = static_cast<int64_t>(static_cast<int16_t>(Src1)) % static_cast<int64_t>(static_cast<int16_t>(Src2));
-                break;
-              case 4:
-                GD = static_cast<int64_t>(static_cast<int32_t>(Src1)) % static_cast<int64_t>(static_cast<int32_t>(Src2));
-                break;
-              case 8:
-                GD = static_cast<int64_t>(Src1) % static_cast<int64_t>(Src2);
-                break;
-              case 16: {
-                __int128_t Tmp = *GetSrc<__int128_t*>(SSAData, Op->Header.Args[0]) % *GetSrc<__int128_t*>(SSAData, Op->Header.Args[1]);
-                memcpy(GDP, &Tmp, 16);
-                break;
-              }
-              default: LogMan::Msg::A("Unknown Mul Size: %d\n", OpSize); break;
-            }
-            break;
-          }
-          case IR::OP_UREM: {
-            auto Op = IROp->C<IR::IROp_URem>();
-            uint64_t Src1 = *GetSrc<uint64_t*>(SSAData, Op->Header.Args[0]);
-            uint64_t Src2 = *GetSrc<uint64_t*>(SSAData, Op->Header.Args[1]);
-
-            switch (OpSize) {
-              case 1:
-                GD = static_cast<uint64_t>(static_cast<uint8_t>(Src1)) % static_cast<uint64_t>(static_cast<uint8_t>(Src2));
-                break;
-              case 2:
-                GD = static_cast<uint64_t>(static_cast<uint16_t>(Src1)) % static_cast<uint64_t>(static_cast<uint16_t>(Src2));
-                break;
-              case 4:
-                GD = static_cast<uint64_t>(static_cast<uint32_t>(Src1)) % static_cast<uint64_t>(static_cast<uint32_t>(Src2));
-                break;
-              case 8:
-                GD = static_cast<uint64_t>(Src1) % static_cast<uint64_t>(Src2);
-                break;
-              case 16: {
-                __uint128_t Tmp = *GetSrc<__uint128_t*>(SSAData, Op->Header.Args[0]) % *GetSrc<__uint128_t*>(SSAData, Op->Header.Args[1]);
-                memcpy(GDP, &Tmp, 16);
-                break;
-              }
-              default: LogMan::Msg::A("Unknown Mul Size: %d\n", OpSize); break;
-            }
-            break;
-          }
-          case IR::OP_POPCOUNT: {
-            auto Op = IROp->C<IR::IROp_Popcount>();
-            uint64_t Src = *GetSrc<uint64_t*>(SSAData, Op->Header.Args[0]);
-            GD = __builtin_popcountl(Src);
-            break;
-          }
-          case IR::OP_FINDLSB: {
-            auto Op = IROp->C<IR::IROp_FindLSB>();
-            uint64_t Src = *GetSrc<uint64_t*>(SSAData, Op->Header.Args[0]);
-            uint64_t Result = __builtin_ffsll(Src);
-            GD = Result - 1;
-            break;
-          }
-          case IR::OP_FINDMSB: {
-            auto Op = IROp->C<IR::IROp_FindMSB>();
-            switch (OpSize) {
-              case 1: GD = ((24 + OpSize * 8) - __builtin_clz(*GetSrc<uint8_t*>(SSAData, Op->Header.Args[0]))) - 1; break;
-              case 2: GD = ((16 + OpSize * 8) - __builtin_clz(*GetSrc<uint16_t*>(SSAData, Op->Header.Args[0]))) - 1; break;
-              case 4: GD = (OpSize * 8 - __builtin_clz(*GetSrc<uint32_t*>(SSAData, Op->Header.Args[0]))) - 1; break;
-              case 8: GD = (OpSize * 8 - __builtin_clzll(*GetSrc<uint64_t*>(SSAData, Op->Header.Args[0]))) - 1; break;
-              default: LogMan::Msg::A("Unknown REV size: %d", OpSize); break;
-            }
-            break;
-          }
-          case IR::OP_REV: {
-            auto Op = IROp->C<IR::IROp_Rev>();
-            switch (OpSize) {
-              case 2: GD = __builtin_bswap16(*GetSrc<uint16_t*>(SSAData, Op->Header.Args[0])); break;
-              case 4: GD = __builtin_bswap32(*GetSrc<uint32_t*>(SSAData, Op->Header.Args[0])); break;
-              case 8: GD = __builtin_bswap64(*GetSrc<uint64_t*>(SSAData, Op->Header.Args[0])); break;
-              default: LogMan::Msg::A("Unknown REV size: %d", OpSize); break;
-            }
-            break;
-          }
-          case IR::OP_FINDTRAILINGZEROS: {
-            auto Op = IROp->C<IR::IROp_FindTrailingZeros>();
-            switch (OpSize) {
-              case 1: {
-                auto Src = *GetSrc<uint8_t*>(SSAData, Op->Header.Args[0]);
-                if (Src)
-                  GD = __builtin_ctz(Src);
-                else
-                  GD = sizeof(Src) * 8;
-                break;
-              }
-              case 2: {
-                auto Src = *GetSrc<uint16_t*>(SSAData, Op->Header.Args[0]);
-                if (Src)
-                  GD = __builtin_ctz(Src);
-                else
-                  GD = sizeof(Src) * 8;
-                break;
-              }
-              case 4: {
-                auto Src = *GetSrc<uint32_t*>(SSAData, Op->Header.Args[0]);
-                if (Src)
-                  GD = __builtin_ctz(Src);
-                else
-                  GD = sizeof(Src) * 8;
-                break;
-              }
-              case 8: {
-                auto Src = *GetSrc<uint64_t*>(SSAData, Op->Header.Args[0]);
-                if (Src)
-                  GD = __builtin_ctzll(Src);
-                else
-                  GD = sizeof(Src) * 8;
-                break;
-              }
-              default: LogMan::Msg::A("Unknown size: %d", OpSize); break;
-            }
-            break;
-          }
-          case IR::OP_COUNTLEADINGZEROES: {
-            auto Op = IROp->C<IR::IROp_CountLeadingZeroes>();
-            switch (OpSize) {
-              case 1: {
-                uint32_t Src = *GetSrc<uint8_t*>(SSAData, Op->Header.Args[0]);
-                Src <<= 24;
-                if (Src)
-                  GD = __builtin_clz(Src);
-                else
-                  GD = 8;
-                break;
-              }
-              case 2: {
-                uint32_t Src = *GetSrc<uint16_t*>(SSAData, Op->Header.Args[0]);
-                Src <<= 16;
-                if (Src)
-                  GD = __builtin_clz(Src);
-                else
-                  GD = 16;
-                break;
-              }
-              case 4: {
-                auto Src = *GetSrc<uint32_t*>(SSAData, Op->Header.Args[0]);
-                if (Src)
-                  GD = __builtin_clz(Src);
-                else
-                  GD = sizeof(Src) * 8;
-                break;
-              }
-              case 8: {
-                auto Src = *GetSrc<uint64_t*>(SSAData, Op->Header.Args[0]);
-                if (Src)
-                  GD = __builtin_clzll(Src);
-                else
-                  GD = sizeof(Src) * 8;
-                break;
-              }
-              default: LogMan::Msg::A("Unknown size: %d", OpSize); break;
-            }
-            break;
-          }
-          case IR::OP_BFI: {
-            auto Op = IROp->C<IR::IROp_Bfi>();
-            uint64_t SourceMask = (1ULL << Op->Width) - 1;
-            if (Op->Width == 64)
-              SourceMask = ~0ULL;
-            uint64_t DestMask = ~(SourceMask << Op->lsb);
-            uint64_t Src1 = *GetSrc<uint64_t*>(SSAData, Op->Header.Args[0]);
-            uint64_t Src2 = *GetSrc<uint64_t*>(SSAData, Op->Header.Args[1]);
-            uint64_t Res = (Src1 & DestMask) | ((Src2 & SourceMask) << Op->lsb);
-            GD = Res;
-            break;
-          }
-          case IR::OP_SBFE: {
-            auto Op = IROp->C<IR::IROp_Sbfe>();
-            LogMan::Throw::A(OpSize < 16, "OpSize is too large for BFE: %d", OpSize);
-            int64_t Src = *GetSrc<int64_t*>(SSAData, Op->Header.Args[0]);
-            uint64_t ShiftLeftAmount = (64 - (Op->Width + Op->lsb));
-            uint64_t ShiftRightAmount = ShiftLeftAmount + Op->lsb;
-            Src <<= ShiftLeftAmount;
-            Src >>= ShiftRightAmount;
-            GD = Src;
-            break;
-          }
-          case IR::OP_BFE: {
-            auto Op = IROp->C<IR::IROp_Bfe>();
-            LogMan::Throw::A(OpSize <= 8, "OpSize is too large for BFE: %d", OpSize);
-            uint64_t SourceMask = (1ULL << Op->Width) - 1;
-            if (Op->Width == 64)
-              SourceMask = ~0ULL;
-            SourceMask <<= Op->lsb;
-            uint64_t Src = *GetSrc<uint64_t*>(SSAData, Op->Header.Args[0]);
-            GD = (Src & SourceMask) >> Op->lsb;
-            break;
-          }
-          case IR::OP_SELECT: {
-            auto Op = IROp->C<IR::IROp_Select>();
+    reinterpret_cast<ThunkedFunction*>(Op->ThunkFnPtr)(*GetSrc<void**>(SSAData, Op->Header.Args[0]));
 
-            uint64_t Src1 = *GetSrc<uint64_t*>(SSAData, Op->Header.Args[0]);
-            uint64_t Src2 = *GetSrc<uint64_t*>(SSAData, Op->Header.Args[1]);
+    NEXT_OP();
+  }
+  DEF_OP(CPUID): {
+    auto Op = IROp->C<IR::IROp_CPUID>();
+    uint64_t *DstPtr = reinterpret_cast<uint64_t*>(Dest);
+    uint64_t Arg = *GetSrc<uint64_t*>(SSAData, Op->Header.Args[0]);
+
+    auto Results = Thread->CTX->CPUID.RunFunction(Arg);
+    memcpy(DstPtr, &Results, sizeof(uint32_t) * 4);
+    NEXT_OP();
+  }
+  DEF_OP(PRINT): {
+    auto Op = IROp->C<IR::IROp_Print>();
 
-            uint64_t ArgTrue;
-            uint64_t ArgFalse;
+    if (OpSize <= 8) {
+      uint64_t Src = *GetSrc<uint64_t*>(SSAData, Op->Header.Args[0]);
+      LogMan::Msg::I(">>>> Value in Arg: 0x%lx, %ld", Src, Src);
+    }
+    else if (OpSize == 16) {
+      __uint128_t Src = *GetSrc<__uint128_t*>(SSAData, Op->Header.Args[0]);
+      uint64_t Src0 = Src;
+      uint64_t Src1 = Src >> 64;
+      LogMan::Msg::I(">>>> Value[0] in Arg: 0x%lx, %ld", Src0, Src0);
+      LogMan::Msg::I("     Value[1] in Arg: 0x%lx, %ld", Src1, Src1);
+    }
+    else
+      LogMan::Msg::A("Unknown value size: %d", OpSize);
+    NEXT_OP();
+  }
+  DEF_OP(CYCLECOUNTER): {
+    #ifdef DEBUG_CYCLES
+      GD = 0;
+    #else
+      timespec time;
+      clock_gettime(CLOCK_REALTIME, &time);
+      GD = time.tv_nsec + time.tv_sec * 1000000000;
+    #endif
+    NEXT_OP();
+  }
+  DEF_OP(MOV): {
+    auto Op = IROp->C<IR::IROp_Mov>();
+    memcpy(GDP, GetSrc<void*>(SSAData, Op->Header.Args[0]), OpSize);
+    NEXT_OP();
+  }
+  DEF_OP(VBITCAST): {
+    auto Op = IROp->C<IR::IROp_VBitcast>();
+    memcpy(GDP, GetSrc<void*>(SSAData, Op->Header.Args[0]), 16);
+    NEXT_OP();
+  }
+  DEF_OP(VCASTFROMGPR): {
+    auto Op = IROp->C<IR::IROp_VCastFromGPR>();
+    memcpy(GDP, GetSrc<void*>(SSAData, Op->Header.Args[0]), Op->Header.ElementSize);
+    NEXT_OP();
+  }
+  DEF_OP(VEXTRACTTOGPR): {
+    auto Op = IROp->C<IR::IROp_VExtractToGPR>();
+    uint32_t SourceSize = CurrentOp->ArgSize;
+
+    LogMan::Throw::A(OpSize <= 16, "OpSize is too large for VExtractToGPR: %d", OpSize);
+
+    if (SourceSize == 16) {
+      __uint128_t SourceMask = (1ULL << (Op->Header.ElementSize * 8)) - 1;
+      uint64_t Shift = Op->Header.ElementSize * Op->Idx * 8;
+      if (Op->Header.ElementSize == 8)
+        SourceMask = ~0ULL;
+
+      __uint128_t Src = *GetSrc<__uint128_t*>(SSAData, Op->Header.Args[0]);
+      Src >>= Shift;
+      Src &= SourceMask;
+      memcpy(GDP, &Src, Op->Header.ElementSize);
+    }
+    else {
+      uint64_t SourceMask = (1ULL << (Op->Header.ElementSize * 8)) - 1;
+      uint64_t Shift = Op->Header.ElementSize * Op->Idx * 8;
+      if (Op->Header.ElementSize == 8)
+        SourceMask = ~0ULL;
+
+      uint64_t Src = *GetSrc<uint64_t*>(SSAData, Op->Header.Args[0]);
+      Src >>= Shift;
+      Src &= SourceMask;
+      GD = Src;
+    }
+    NEXT_OP();
+  }
+  DEF_OP(VEXTRACTELEMENT): {
+    auto Op = IROp->C<IR::IROp_VExtractElement>();
+    uint32_t SourceSize = CurrentOp->ArgSize;
+    LogMan::Throw::A(OpSize <= 16, "OpSize is too large for VExtractToGPR: %d", OpSize);
+    if (SourceSize == 16) {
+      __uint128_t SourceMask = (1ULL << (Op->Header.ElementSize * 8)) - 1;
+      uint64_t Shift = Op->Header.ElementSize * Op->Index * 8;
+      if (Op->Header.ElementSize == 8)
+        SourceMask = ~0ULL;
+
+      __uint128_t Src = *GetSrc<__uint128_t*>(SSAData, Op->Header.Args[0]);
+      Src >>= Shift;
+      Src &= SourceMask;
+      memcpy(GDP, &Src, Op->Header.ElementSize);
+    }
+    else {
+      uint64_t SourceMask = (1ULL << (Op->Header.ElementSize * 8)) - 1;
+      uint64_t Shift = Op->Header.ElementSize * Op->Index * 8;
+      if (Op->Header.ElementSize == 8)
+        SourceMask = ~0ULL;
+
+      uint64_t Src = *GetSrc<uint64_t*>(SSAData, Op->Header.Args[0]);
+      Src >>= Shift;
+      Src &= SourceMask;
+      GD = Src;
+    }
+    NEXT_OP();
+  }
+  DEF_OP(CONSTANT): {
+    auto Op = IROp->C<IR::IROp_Constant>();
+    GD = Op->Constant;
+    NEXT_OP();
+  }
+  DEF_OP(VECTORZERO): {
+    memset(GDP, 0, OpSize);
+    NEXT_OP();
+  }
+  DEF_OP(LOADCONTEXT): {
+    auto Op = IROp->C<IR::IROp_LoadContext>();
+
+    uintptr_t ContextPtr = reinterpret_cast<uintptr_t>(&Thread->State.State);
+    ContextPtr += Op->Offset;
+    #define LOAD_CTX(x, y) \
+      case x: { \
+        y const *Data = reinterpret_cast<y const*>(ContextPtr); \
+        GD = *Data; \
+        break; \
+      }
+    switch (OpSize) {
+      LOAD_CTX(1, uint8_t)
+      LOAD_CTX(2, uint16_t)
+      LOAD_CTX(4, uint32_t)
+      LOAD_CTX(8, uint64_t)
+      case 16: {
+        void const *Data = reinterpret_cast<void const*>(ContextPtr);
+        memcpy(GDP, Data, OpSize);
+        break;
+      }
+      default:  LogMan::Msg::A("Unhandled LoadContext size: %d", OpSize);
+    }
+    #undef LOAD_CTX
+    NEXT_OP();
+  }
+  DEF_OP(LOADCONTEXTINDEXED): {
+    auto Op = IROp->C<IR::IROp_LoadContextIndexed>();
+    uint64_t Index = *GetSrc<uint64_t*>(SSAData, Op->Header.Args[0]);
+
+    uintptr_t ContextPtr = reinterpret_cast<uintptr_t>(&Thread->State.State);
+    ContextPtr += Op->BaseOffset;
+    ContextPtr += Index * Op->Stride;
+
+    #define LOAD_CTX(x, y) \
+      case x: { \
+        y const *Data = reinterpret_cast<y const*>(ContextPtr); \
+        GD = *Data; \
+        break; \
+      }
+    switch (Op->Size) {
+      LOAD_CTX(1, uint8_t)
+      LOAD_CTX(2, uint16_t)
+      LOAD_CTX(4, uint32_t)
+      LOAD_CTX(8, uint64_t)
+      case 16: {
+        void const *Data = reinterpret_cast<void const*>(ContextPtr);
+        memcpy(GDP, Data, Op->Size);
+        break;
+      }
+      default:  LogMan::Msg::A("Unhandled LoadContextIndexed size: %d", Op->Size);
+    }
+    #undef LOAD_CTX
+    NEXT_OP();
+  }
+  DEF_OP(STORECONTEXT): {
+    auto Op = IROp->C<IR::IROp_StoreContext>();
 
-            if (OpSize == 4) {
-              ArgTrue = *GetSrc<uint32_t*>(SSAData, Op->Header.Args[2]);
-              ArgFalse = *GetSrc<uint32_t*>(SSAData, Op->Header.Args[3]);
-            } else {
-              ArgTrue = *GetSrc<uint64_t*>(SSAData, Op->Header.Args[2]);
-              ArgFalse = *GetSrc<uint64_t*>(SSAData, Op->Header.Args[3]);
-            }
+    uintptr_t ContextPtr = reinterpret_cast<uintptr_t>(&Thread->State.State);
+    ContextPtr += Op->Offset;
 
-            bool CompResult;
+    void *Data = reinterpret_cast<void*>(ContextPtr);
+    void *Src = GetSrc<void*>(SSAData, Op->Header.Args[0]);
+    memcpy(Data, Src, OpSize);
+    NEXT_OP();
+  }
+  DEF_OP(STORECONTEXTINDEXED): {
+    auto Op = IROp->C<IR::IROp_StoreContextIndexed>();
+    uint64_t Index = *GetSrc<uint64_t*>(SSAData, Op->Header.Args[1]);
+
+    uintptr_t ContextPtr = reinterpret_cast<uintptr_t>(&Thread->State.State);
+    ContextPtr += Op->BaseOffset;
+    ContextPtr += Index * Op->Stride;
+
+    void *Data = reinterpret_cast<void*>(ContextPtr);
+    void *Src = GetSrc<void*>(SSAData, Op->Header.Args[0]);
+    memcpy(Data, Src, Op->Size);
+    NEXT_OP();
+  }
+  DEF_OP(CREATEELEMENTPAIR): {
+    auto Op = IROp->C<IR::IROp_CreateElementPair>();
+    void *Src_Lower = GetSrc<void*>(SSAData, Op->Header.Args[0]);
+    void *Src_Upper = GetSrc<void*>(SSAData, Op->Header.Args[1]);
 
-            if (Op->CompareSize == 4)
-              CompResult = IsConditionTrue<uint32_t, int32_t, float>(Op->Cond.Val, Src1, Src2);
-            else
-              CompResult = IsConditionTrue<uint64_t, int64_t, double>(Op->Cond.Val, Src1, Src2);
+    uint8_t *Dst = reinterpret_cast<uint8_t*>(Dest);
 
-            GD = CompResult ? ArgTrue : ArgFalse;
-            break;
-          }
-          case IR::OP_CAS: {
-            auto Op = IROp->C<IR::IROp_CAS>();
-            auto Size = OpSize;
-            switch (Size) {
-              case 1: {
-                std::atomic<uint8_t> *Data = *GetSrc<std::atomic<uint8_t> **>(SSAData, Op->Header.Args[2]);
-
-                uint8_t Src1 = *GetSrc<uint8_t*>(SSAData, Op->Header.Args[0]);
-                uint8_t Src2 = *GetSrc<uint8_t*>(SSAData, Op->Header.Args[1]);
-
-                uint8_t Expected = Src1;
-                bool Result = Data->compare_exchange_strong(Expected, Src2);
-                GD = Result ? Src1 : Expected;
-                break;
-              }
-              case 2: {
-                std::atomic<uint16_t> *Data = *GetSrc<std::atomic<uint16_t> **>(SSAData, Op->Header.Args[2]);
-                uint16_t Src1 = *GetSrc<uint16_t*>(SSAData, Op->Header.Args[0]);
-                uint16_t Src2 = *GetSrc<uint16_t*>(SSAData, Op->Header.Args[1]);
-
-                uint16_t Expected = Src1;
-                bool Result = Data->compare_exchange_strong(Expected, Src2);
-                GD = Result ? Src1 : Expected;
-                break;
-              }
-              case 4: {
-                std::atomic<uint32_t> *Data = *GetSrc<std::atomic<uint32_t> **>(SSAData, Op->Header.Args[2]);
-
-                uint32_t Src1 = *GetSrc<uint32_t*>(SSAData, Op->Header.Args[0]);
-                uint32_t Src2 = *GetSrc<uint32_t*>(SSAData, Op->Header.Args[1]);
-
-                uint32_t Expected = Src1;
-                bool Result = Data->compare_exchange_strong(Expected, Src2);
-                GD = Result ? Src1 : Expected;
-                break;
-              }
-              case 8: {
-                std::atomic<uint64_t> *Data = *GetSrc<std::atomic<uint64_t> **>(SSAData, Op->Header.Args[2]);
-
-                uint64_t Src1 = *GetSrc<uint64_t*>(SSAData, Op->Header.Args[0]);
-                uint64_t Src2 = *GetSrc<uint64_t*>(SSAData, Op->Header.Args[1]);
-
-                uint64_t Expected = Src1;
-                bool Result = Data->compare_exchange_strong(Expected, Src2);
-                GD = Result ? Src1 : Expected;
-                break;
-              }
-              default: LogMan::Msg::A("Unknown CAS size: %d", Size); break;
-            }
-            break;
-          }
-          case IR::OP_ATOMICADD: {
-            auto Op = IROp->C<IR::IROp_AtomicAdd>();
-            switch (Op->Size) {
-              case 1: {
-                std::atomic<uint8_t> *Data = *GetSrc<std::atomic<uint8_t> **>(SSAData, Op->Header.Args[0]);
-                uint8_t Src = *GetSrc<uint8_t*>(SSAData, Op->Header.Args[1]);
-                *Data += Src;
-                break;
-              }
-              case 2: {
-                std::atomic<uint16_t> *Data = *GetSrc<std::atomic<uint16_t> **>(SSAData, Op->Header.Args[0]);
-                uint16_t Src = *GetSrc<uint16_t*>(SSAData, Op->Header.Args[1]);
-                *Data += Src;
-                break;
-              }
-              case 4: {
-                std::atomic<uint32_t> *Data = *GetSrc<std::atomic<uint32_t> **>(SSAData, Op->Header.Args[0]);
-                uint32_t Src = *GetSrc<uint32_t*>(SSAData, Op->Header.Args[1]);
-                *Data += Src;
-                break;
-              }
-              case 8: {
-                std::atomic<uint64_t> *Data = *GetSrc<std::atomic<uint64_t> **>(SSAData, Op->Header.Args[0]);
-                uint64_t Src = *GetSrc<uint64_t*>(SSAData, Op->Header.Args[1]);
-                *Data += Src;
-                break;
-              }
-              default:  LogMan::Msg::A("Unhandled Atomic size: %d", Op->Size);
-            }
-            break;
-          }
-          case IR::OP_ATOMICSUB: {
-            auto Op = IROp->C<IR::IROp_AtomicSub>();
-            switch (Op->Size) {
-              case 1: {
-                std::atomic<uint8_t> *Data = *GetSrc<std::atomic<uint8_t> **>(SSAData, Op->Header.Args[0]);
-                uint8_t Src = *GetSrc<uint8_t*>(SSAData, Op->Header.Args[1]);
-                *Data -= Src;
-                break;
-              }
-              case 2: {
-                std::atomic<uint16_t> *Data = *GetSrc<std::atomic<uint16_t> **>(SSAData, Op->Header.Args[0]);
-                uint16_t Src = *GetSrc<uint16_t*>(SSAData, Op->Header.Args[1]);
-                *Data -= Src;
-                break;
-              }
-              case 4: {
-                std::atomic<uint32_t> *Data = *GetSrc<std::atomic<uint32_t> **>(SSAData, Op->Header.Args[0]);
-                uint32_t Src = *GetSrc<uint32_t*>(SSAData, Op->Header.Args[1]);
-                *Data -= Src;
-                break;
-              }
-              case 8: {
-                std::atomic<uint64_t> *Data = *GetSrc<std::atomic<uint64_t> **>(SSAData, Op->Header.Args[0]);
-                uint64_t Src = *GetSrc<uint64_t*>(SSAData, Op->Header.Args[1]);
-                *Data -= Src;
-                break;
-              }
-              default:  LogMan::Msg::A("Unhandled Atomic size: %d", Op->Size);
-            }
-            break;
-          }
-          case IR::OP_ATOMICAND: {
-            auto Op = IROp->C<IR::IROp_AtomicAnd>();
-            switch (Op->Size) {
-              case 1: {
-                std::atomic<uint8_t> *Data = *GetSrc<std::atomic<uint8_t> **>(SSAData, Op->Header.Args[0]);
-                uint8_t Src = *GetSrc<uint8_t*>(SSAData, Op->Header.Args[1]);
-                *Data &= Src;
-                break;
-              }
-              case 2: {
-                std::atomic<uint16_t> *Data = *GetSrc<std::atomic<uint16_t> **>(SSAData, Op->Header.Args[0]);
-                uint16_t Src = *GetSrc<uint16_t*>(SSAData, Op->Header.Args[1]);
-                *Data &= Src;
-                break;
-              }
-              case 4: {
-                std::atomic<uint32_t> *Data = *GetSrc<std::atomic<uint32_t> **>(SSAData, Op->Header.Args[0]);
-                uint32_t Src = *GetSrc<uint32_t*>(SSAData, Op->Header.Args[1]);
-                *Data &= Src;
-                break;
-              }
-              case 8: {
-                std::atomic<uint64_t> *Data = *GetSrc<std::atomic<uint64_t> **>(SSAData, Op->Header.Args[0]);
-                uint64_t Src = *GetSrc<uint64_t*>(SSAData, Op->Header.Args[1]);
-                *Data &= Src;
-                break;
-              }
-              default:  LogMan::Msg::A("Unhandled Atomic size: %d", Op->Size);
-            }
-            break;
-          }
-          case IR::OP_ATOMICOR: {
-            auto Op = IROp->C<IR::IROp_AtomicOr>();
-            switch (Op->Size) {
-              case 1: {
-                std::atomic<uint8_t> *Data = *GetSrc<std::atomic<uint8_t> **>(SSAData, Op->Header.Args[0]);
-                uint8_t Src = *GetSrc<uint8_t*>(SSAData, Op->Header.Args[1]);
-                *Data |= Src;
-                break;
-              }
-              case 2: {
-                std::atomic<uint16_t> *Data = *GetSrc<std::atomic<uint16_t> **>(SSAData, Op->Header.Args[0]);
-                uint16_t Src = *GetSrc<uint16_t*>(SSAData, Op->Header.Args[1]);
-                *Data |= Src;
-                break;
-              }
-              case 4: {
-                std::atomic<uint32_t> *Data = *GetSrc<std::atomic<uint32_t> **>(SSAData, Op->Header.Args[0]);
-                uint32_t Src = *GetSrc<uint32_t*>(SSAData, Op->Header.Args[1]);
-                *Data |= Src;
-                break;
-              }
-              case 8: {
-                std::atomic<uint64_t> *Data = *GetSrc<std::atomic<uint64_t> **>(SSAData, Op->Header.Args[0]);
-                uint64_t Src = *GetSrc<uint64_t*>(SSAData, Op->Header.Args[1]);
-                *Data |= Src;
-                break;
-              }
-              default:  LogMan::Msg::A("Unhandled Atomic size: %d", Op->Size);
-            }
-            break;
-          }
-          case IR::OP_ATOMICXOR: {
-            auto Op = IROp->C<IR::IROp_AtomicXor>();
-            switch (Op->Size) {
-              case 1: {
-                std::atomic<uint8_t> *Data = *GetSrc<std::atomic<uint8_t> **>(SSAData, Op->Header.Args[0]);
-                uint8_t Src = *GetSrc<uint8_t*>(SSAData, Op->Header.Args[1]);
-                *Data ^= Src;
-                break;
-              }
-              case 2: {
-                std::atomic<uint16_t> *Data = *GetSrc<std::atomic<uint16_t> **>(SSAData, Op->Header.Args[0]);
-                uint16_t Src = *GetSrc<uint16_t*>(SSAData, Op->Header.Args[1]);
-                *Data ^= Src;
-                break;
-              }
-              case 4: {
-                std::atomic<uint32_t> *Data = *GetSrc<std::atomic<uint32_t> **>(SSAData, Op->Header.Args[0]);
-                uint32_t Src = *GetSrc<uint32_t*>(SSAData, Op->Header.Args[1]);
-                *Data ^= Src;
-                break;
-              }
-              case 8: {
-                std::atomic<uint64_t> *Data = *GetSrc<std::atomic<uint64_t> **>(SSAData, Op->Header.Args[0]);
-                uint64_t Src = *GetSrc<uint64_t*>(SSAData, Op->Header.Args[1]);
-                *Data ^= Src;
-                break;
-              }
-              default:  LogMan::Msg::A("Unhandled Atomic size: %d", Op->Size);
-            }
-            break;
-          }
-          case IR::OP_ATOMICSWAP: {
-            auto Op = IROp->C<IR::IROp_AtomicSwap>();
-            switch (Op->Size) {
-              case 1: {
-                std::atomic<uint8_t> *Data = *GetSrc<std::atomic<uint8_t> **>(SSAData, Op->Header.Args[0]);
-                uint8_t Src = *GetSrc<uint8_t*>(SSAData, Op->Header.Args[1]);
-                uint8_t Previous = Data->exchange(Src);
-                GD = Previous;
-                break;
-              }
-              case 2: {
-                std::atomic<uint16_t> *Data = *GetSrc<std::atomic<uint16_t> **>(SSAData, Op->Header.Args[0]);
-                uint16_t Src = *GetSrc<uint16_t*>(SSAData, Op->Header.Args[1]);
-                uint16_t Previous = Data->exchange(Src);
-                GD = Previous;
-                break;
-              }
-              case 4: {
-                std::atomic<uint32_t> *Data = *GetSrc<std::atomic<uint32_t> **>(SSAData, Op->Header.Args[0]);
-                uint32_t Src = *GetSrc<uint32_t*>(SSAData, Op->Header.Args[1]);
-                uint32_t Previous = Data->exchange(Src);
-                GD = Previous;
-                break;
-              }
-              case 8: {
-                std::atomic<uint64_t> *Data = *GetSrc<std::atomic<uint64_t> **>(SSAData, Op->Header.Args[0]);
-                uint64_t Src = *GetSrc<uint64_t*>(SSAData, Op->Header.Args[1]);
-                uint64_t Previous = Data->exchange(Src);
-                GD = Previous;
-                break;
-              }
-              default:  LogMan::Msg::A("Unhandled Atomic size: %d", Op->Size);
-            }
-            break;
-          }
-          case IR::OP_ATOMICFETCHADD: {
-            auto Op = IROp->C<IR::IROp_AtomicFetchAdd>();
-            switch (Op->Size) {
-              case 1: {
-                std::atomic<uint8_t> *Data = *GetSrc<std::atomic<uint8_t> **>(SSAData, Op->Header.Args[0]);
-                uint8_t Src = *GetSrc<uint8_t*>(SSAData, Op->Header.Args[1]);
-                uint8_t Previous = Data->fetch_add(Src);
-                GD = Previous;
-                break;
-              }
-              case 2: {
-                std::atomic<uint16_t> *Data = *GetSrc<std::atomic<uint16_t> **>(SSAData, Op->Header.Args[0]);
-                uint16_t Src = *GetSrc<uint16_t*>(SSAData, Op->Header.Args[1]);
-                uint16_t Previous = Data->fetch_add(Src);
-                GD = Previous;
-                break;
-              }
-              case 4: {
-                std::atomic<uint32_t> *Data = *GetSrc<std::atomic<uint32_t> **>(SSAData, Op->Header.Args[0]);
-                uint32_t Src = *GetSrc<uint32_t*>(SSAData, Op->Header.Args[1]);
-                uint32_t Previous = Data->fetch_add(Src);
-                GD = Previous;
-                break;
-              }
-              case 8: {
-                std::atomic<uint64_t> *Data = *GetSrc<std::atomic<uint64_t> **>(SSAData, Op->Header.Args[0]);
-                uint64_t Src = *GetSrc<uint64_t*>(SSAData, Op->Header.Args[1]);
-                uint64_t Previous = Data->fetch_add(Src);
-                GD = Previous;
-                break;
-              }
-              default:  LogMan::Msg::A("Unhandled Atomic size: %d", Op->Size);
-            }
-            break;
-          }
-          case IR::OP_ATOMICFETCHSUB: {
-            auto Op = IROp->C<IR::IROp_AtomicFetchSub>();
-            switch (Op->Size) {
-              case 1: {
-                std::atomic<uint8_t> *Data = *GetSrc<std::atomic<uint8_t> **>(SSAData, Op->Header.Args[0]);
-                uint8_t Src = *GetSrc<uint8_t*>(SSAData, Op->Header.Args[1]);
-                uint8_t Previous = Data->fetch_sub(Src);
-                GD = Previous;
-                break;
-              }
-              case 2: {
-                std::atomic<uint16_t> *Data = *GetSrc<std::atomic<uint16_t> **>(SSAData, Op->Header.Args[0]);
-                uint16_t Src = *GetSrc<uint16_t*>(SSAData, Op->Header.Args[1]);
-                uint16_t Previous = Data->fetch_sub(Src);
-                GD = Previous;
-                break;
-              }
-              case 4: {
-                std::atomic<uint32_t> *Data = *GetSrc<std::atomic<uint32_t> **>(SSAData, Op->Header.Args[0]);
-                uint32_t Src = *GetSrc<uint32_t*>(SSAData, Op->Header.Args[1]);
-                uint32_t Previous = Data->fetch_sub(Src);
-                GD = Previous;
-                break;
-              }
-              case 8: {
-                std::atomic<uint64_t> *Data = *GetSrc<std::atomic<uint64_t> **>(SSAData, Op->Header.Args[0]);
-                uint64_t Src = *GetSrc<uint64_t*>(SSAData, Op->Header.Args[1]);
-                uint64_t Previous = Data->fetch_sub(Src);
-                GD = Previous;
-                break;
-              }
-              default:  LogMan::Msg::A("Unhandled Atomic size: %d", Op->Size);
-            }
-            break;
-          }
-          case IR::OP_ATOMICFETCHAND: {
-            auto Op = IROp->C<IR::IROp_AtomicFetchAnd>();
-            switch (Op->Size) {
-              case 1: {
-                std::atomic<uint8_t> *Data = *GetSrc<std::atomic<uint8_t> **>(SSAData, Op->Header.Args[0]);
-                uint8_t Src = *GetSrc<uint8_t*>(SSAData, Op->Header.Args[1]);
-                uint8_t Previous = Data->fetch_and(Src);
-                GD = Previous;
-                break;
-              }
-              case 2: {
-                std::atomic<uint16_t> *Data = *GetSrc<std::atomic<uint16_t> **>(SSAData, Op->Header.Args[0]);
-                uint16_t Src = *GetSrc<uint16_t*>(SSAData, Op->Header.Args[1]);
-                uint16_t Previous = Data->fetch_and(Src);
-                GD = Previous;
-                break;
-              }
-              case 4: {
-                std::atomic<uint32_t> *Data = *GetSrc<std::atomic<uint32_t> **>(SSAData, Op->Header.Args[0]);
-                uint32_t Src = *GetSrc<uint32_t*>(SSAData, Op->Header.Args[1]);
-                uint32_t Previous = Data->fetch_and(Src);
-                GD = Previous;
-                break;
-              }
-              case 8: {
-                std::atomic<uint64_t> *Data = *GetSrc<std::atomic<uint64_t> **>(SSAData, Op->Header.Args[0]);
-                uint64_t Src = *GetSrc<uint64_t*>(SSAData, Op->Header.Args[1]);
-                uint64_t Previous = Data->fetch_and(Src);
-                GD = Previous;
-                break;
-              }
-              default:  LogMan::Msg::A("Unhandled Atomic size: %d", Op->Size);
-            }
-            break;
-          }
-          case IR::OP_ATOMICFETCHOR: {
-            auto Op = IROp->C<IR::IROp_AtomicFetchOr>();
-            switch (Op->Size) {
-              case 1: {
-                std::atomic<uint8_t> *Data = *GetSrc<std::atomic<uint8_t> **>(SSAData, Op->Header.Args[0]);
-                uint8_t Src = *GetSrc<uint8_t*>(SSAData, Op->Header.Args[1]);
-                uint8_t Previous = Data->fetch_or(Src);
-                GD = Previous;
-                break;
-              }
-              case 2: {
-                std::atomic<uint16_t> *Data = *GetSrc<std::atomic<uint16_t> **>(SSAData, Op->Header.Args[0]);
-                uint16_t Src = *GetSrc<uint16_t*>(SSAData, Op->Header.Args[1]);
-                uint16_t Previous = Data->fetch_or(Src);
-                GD = Previous;
-                break;
-              }
-              case 4: {
-                std::atomic<uint32_t> *Data = *GetSrc<std::atomic<uint32_t> **>(SSAData, Op->Header.Args[0]);
-                uint32_t Src = *GetSrc<uint32_t*>(SSAData, Op->Header.Args[1]);
-                uint32_t Previous = Data->fetch_or(Src);
-                GD = Previous;
-                break;
-              }
-              case 8: {
-                std::atomic<uint64_t> *Data = *GetSrc<std::atomic<uint64_t> **>(SSAData, Op->Header.Args[0]);
-                uint64_t Src = *GetSrc<uint64_t*>(SSAData, Op->Header.Args[1]);
-                uint64_t Previous = Data->fetch_or(Src);
-                GD = Previous;
-                break;
-              }
-              default:  LogMan::Msg::A("Unhandled Atomic size: %d", Op->Size);
-            }
-            break;
-          }
-          case IR::OP_ATOMICFETCHXOR: {
-            auto Op = IROp->C<IR::IROp_AtomicFetchXor>();
-            switch (Op->Size) {
-              case 1: {
-                std::atomic<uint8_t> *Data = *GetSrc<std::atomic<uint8_t> **>(SSAData, Op->Header.Args[0]);
-                uint8_t Src = *GetSrc<uint8_t*>(SSAData, Op->Header.Args[1]);
-                uint8_t Previous = Data->fetch_xor(Src);
-                GD = Previous;
-                break;
-              }
-              case 2: {
-                std::atomic<uint16_t> *Data = *GetSrc<std::atomic<uint16_t> **>(SSAData, Op->Header.Args[0]);
-                uint16_t Src = *GetSrc<uint16_t*>(SSAData, Op->Header.Args[1]);
-                uint16_t Previous = Data->fetch_xor(Src);
-                GD = Previous;
-                break;
-              }
-              case 4: {
-                std::atomic<uint32_t> *Data = *GetSrc<std::atomic<uint32_t> **>(SSAData, Op->Header.Args[0]);
-                uint32_t Src = *GetSrc<uint32_t*>(SSAData, Op->Header.Args[1]);
-                uint32_t Previous = Data->fetch_xor(Src);
-                GD = Previous;
-                break;
-              }
-              case 8: {
-                std::atomic<uint64_t> *Data = *GetSrc<std::atomic<uint64_t> **>(SSAData, Op->Header.Args[0]);
-                uint64_t Src = *GetSrc<uint64_t*>(SSAData, Op->Header.Args[1]);
-                uint64_t Previous = Data->fetch_xor(Src);
-                GD = Previous;
-                break;
-              }
-              default:  LogMan::Msg::A("Unhandled Atomic size: %d", Op->Size);
-            }
-            break;
-          }
-          // Vector ops
-          case IR::OP_CREATEVECTOR2: {
-            auto Op = IROp->C<IR::IROp_CreateVector2>();
-            LogMan::Throw::A(OpSize <= 16, "Can't handle a vector of size: %d", OpSize);
-            void *Src1 = GetSrc<void*>(SSAData, Op->Header.Args[0]);
-            void *Src2 = GetSrc<void*>(SSAData, Op->Header.Args[1]);
-            uint8_t Tmp[16];
-            uint8_t ElementSize = OpSize / 2;
-            #define CREATE_VECTOR(elementsize, type) \
-              case elementsize: { \
-                auto *Dst_d = reinterpret_cast<type*>(Tmp); \
-                auto *Src1_d = reinterpret_cast<type*>(Src1); \
-                auto *Src2_d = reinterpret_cast<type*>(Src2); \
-                Dst_d[0] = *Src1_d; \
-                Dst_d[1] = *Src2_d; \
-                break; \
-              }
-            switch (ElementSize) {
-              CREATE_VECTOR(1, uint8_t)
-              CREATE_VECTOR(2, uint16_t)
-              CREATE_VECTOR(4, uint32_t)
-              CREATE_VECTOR(8, uint64_t)
-              default: LogMan::Msg::A("Unknown Element Size: %d", ElementSize); break;
-            }
-            #undef CREATE_VECTOR
-            memcpy(GDP, Tmp, OpSize);
-
-            break;
-          }
-          case IR::OP_SPLATVECTOR4:
-          case IR::OP_SPLATVECTOR2: {
-            auto Op = IROp->C<IR::IROp_SplatVector2>();
-            LogMan::Throw::A(OpSize <= 16, "Can't handle a vector of size: %d", OpSize);
-            void *Src = GetSrc<void*>(SSAData, Op->Header.Args[0]);
-            uint8_t Tmp[16];
-            uint8_t Elements = 0;
-
-            switch (Op->Header.Op) {
-              case IR::OP_SPLATVECTOR4: Elements = 4; break;
-              case IR::OP_SPLATVECTOR2: Elements = 2; break;
-              default: LogMan::Msg::A("Uknown Splat size"); break;
-            }
-
-            #define CREATE_VECTOR(elementsize, type) \
-              case elementsize: { \
-                auto *Dst_d = reinterpret_cast<type*>(Tmp); \
-                auto *Src_d = reinterpret_cast<type*>(Src); \
-                for (uint8_t i = 0; i < Elements; ++i) \
-                  Dst_d[i] = *Src_d;\
-                break; \
-              }
-            uint8_t ElementSize = OpSize / Elements;
-            switch (ElementSize) {
-              CREATE_VECTOR(1, uint8_t)
-              CREATE_VECTOR(2, uint16_t)
-              CREATE_VECTOR(4, uint32_t)
-              CREATE_VECTOR(8, uint64_t)
-              default: LogMan::Msg::A("Unknown Element Size: %d", Op->Header.Size); break;
-            }
-            #undef CREATE_VECTOR
-            memcpy(GDP, Tmp, OpSize);
-
-            break;
-          }
-          case IR::OP_VMOV: {
-            auto Op = IROp->C<IR::IROp_VMov>();
-            __uint128_t Src = *GetSrc<__uint128_t*>(SSAData, Op->Header.Args[0]);
+    memcpy(Dst, Src_Lower, Op->Header.Size);
+    memcpy(Dst + Op->Header.Size, Src_Upper, Op->Header.Size);
+    NEXT_OP();
+  }
+  DEF_OP(EXTRACTELEMENTPAIR): {
+    auto Op = IROp->C<IR::IROp_ExtractElementPair>();
+    uintptr_t Src = GetSrc<uintptr_t>(SSAData, Op->Header.Args[0]);
+    memcpy(GDP,
+      reinterpret_cast<void*>(Src + Op->Header.Size * Op->Element), Op->Header.Size);
+    NEXT_OP();
+  }
+  DEF_OP(CASPAIR): {
+    auto Op = IROp->C<IR::IROp_CASPair>();
+    auto Size = OpSize;
+    // Size is the size of each pair element
+    switch (Size) {
+      case 4: {
+        std::atomic<uint64_t> *Data = *GetSrc<std::atomic<uint64_t> **>(SSAData, Op->Header.Args[2]);
+
+        uint64_t Src1 = *GetSrc<uint64_t*>(SSAData, Op->Header.Args[0]);
+        uint64_t Src2 = *GetSrc<uint64_t*>(SSAData, Op->Header.Args[1]);
+
+        uint64_t Expected = Src1;
+        bool Result = Data->compare_exchange_strong(Expected, Src2);
+        GD = Result ? Src1 : Expected;
+        break;
+      }
+      case 8: {
+        std::atomic<__uint128_t> *Data = *GetSrc<std::atomic<__uint128_t> **>(SSAData, Op->Header.Args[2]);
 
-            memcpy(GDP, &Src, OpSize);
-            break;
-          }
-          case IR::OP_VOR: {
-            auto Op = IROp->C<IR::IROp_VOr>();
-            __uint128_t Src1 = *GetSrc<__uint128_t*>(SSAData, Op->Header.Args[0]);
-            __uint128_t Src2 = *GetSrc<__uint128_t*>(SSAData, Op->Header.Args[1]);
-
-            __uint128_t Dst = Src1 | Src2;
-            memcpy(GDP, &Dst, 16);
-            break;
-          }
-          case IR::OP_VAND: {
-            auto Op = IROp->C<IR::IROp_VAnd>();
-            __uint128_t Src1 = *GetSrc<__uint128_t*>(SSAData, Op->Header.Args[0]);
-            __uint128_t Src2 = *GetSrc<__uint128_t*>(SSAData, Op->Header.Args[1]);
-
-            __uint128_t Dst = Src1 & Src2;
-            memcpy(GDP, &Dst, 16);
-            break;
-          }
-          case IR::OP_VXOR: {
-            auto Op = IROp->C<IR::IROp_VXor>();
-            __uint128_t Src1 = *GetSrc<__uint128_t*>(SSAData, Op->Header.Args[0]);
-            __uint128_t Src2 = *GetSrc<__uint128_t*>(SSAData, Op->Header.Args[1]);
-
-            __uint128_t Dst = Src1 ^ Src2;
-            memcpy(GDP, &Dst, 16);
-            break;
-          }
-          case IR::OP_VSLI: {
-            auto Op = IROp->C<IR::IROp_VSLI>();
-            __uint128_t Src1 = *GetSrc<__uint128_t*>(SSAData, Op->Header.Args[0]);
-            __uint128_t Src2 = Op->ByteShift * 8;
-
-            __uint128_t Dst = Op->ByteShift >= sizeof(__uint128_t) ? 0 : Src1 << Src2;
-            memcpy(GDP, &Dst, 16);
-            break;
-          }
-          case IR::OP_VSRI: {
-            auto Op = IROp->C<IR::IROp_VSRI>();
-            __uint128_t Src1 = *GetSrc<__uint128_t*>(SSAData, Op->Header.Args[0]);
-            __uint128_t Src2 = Op->ByteShift * 8;
-
-            __uint128_t Dst = Op->ByteShift >= sizeof(__uint128_t) ? 0 : Src1 >> Src2;
-            memcpy(GDP, &Dst, 16);
-            break;
-          }
-          case IR::OP_VNOT: {
-            auto Op = IROp->C<IR::IROp_VNot>();
-            __uint128_t Src1 = *GetSrc<__uint128_t*>(SSAData, Op->Header.Args[0]);
+        __uint128_t Src1 = *GetSrc<__uint128_t*>(SSAData, Op->Header.Args[0]);
+        __uint128_t Src2 = *GetSrc<__uint128_t*>(SSAData, Op->Header.Args[1]);
 
-            __uint128_t Dst = ~Src1;
-            memcpy(GDP, &Dst, 16);
-            break;
-          }
-          #define DO_VECTOR_OP(size, type, func)              \
-            case size: {                                      \
-            auto *Dst_d  = reinterpret_cast<type*>(Tmp);  \
-            auto *Src1_d = reinterpret_cast<type*>(Src1); \
-            auto *Src2_d = reinterpret_cast<type*>(Src2); \
-            for (uint8_t i = 0; i < Elements; ++i) {          \
-              Dst_d[i] = func(Src1_d[i], Src2_d[i]);          \
-            }                                                 \
-            break;                                            \
-            }
-          #define DO_VECTOR_PAIR_OP(size, type, func)              \
-            case size: {                                      \
-            auto *Dst_d  = reinterpret_cast<type*>(Tmp);  \
-            auto *Src1_d = reinterpret_cast<type*>(Src1); \
-            auto *Src2_d = reinterpret_cast<type*>(Src2); \
-            for (uint8_t i = 0; i < Elements; ++i) {          \
-              Dst_d[i] = func(Src1_d[i*2], Src1_d[i*2 + 1]);          \
-              Dst_d[i+Elements] = func(Src2_d[i*2], Src2_d[i*2 + 1]);          \
-            }                                                 \
-            break;                                            \
-            }
-          #define DO_VECTOR_SCALAR_OP(size, type, func)\
-            case size: {                                      \
-            auto *Dst_d  = reinterpret_cast<type*>(Tmp);  \
-            auto *Src1_d = reinterpret_cast<type*>(Src1); \
-            auto *Src2_d = reinterpret_cast<type*>(Src2); \
-            for (uint8_t i = 0; i < Elements; ++i) {          \
-              Dst_d[i] = func(Src1_d[i], *Src2_d);          \
-            }                                                 \
-            break;                                            \
-            }
-          #define DO_VECTOR_0SRC_OP(size, type, func)              \
-            case size: {                                      \
-            auto *Dst_d  = reinterpret_cast<type*>(Tmp);  \
-            for (uint8_t i = 0; i < Elements; ++i) {          \
-              Dst_d[i] = func();          \
-            }                                                 \
-            break;                                            \
-            }
-          #define DO_VECTOR_1SRC_OP(size, type, func)              \
-            case size: {                                      \
-            auto *Dst_d  = reinterpret_cast<type*>(Tmp);  \
-            auto *Src_d = reinterpret_cast<type*>(Src); \
-            for (uint8_t i = 0; i < Elements; ++i) {          \
-              Dst_d[i] = func(Src_d[i]);          \
-            }                                                 \
-            break;                                            \
-            }
-          #define DO_VECTOR_REDUCE_1SRC_OP(size, type, func, start_val)              \
-            case size: {                                      \
-            auto *Dst_d  = reinterpret_cast<type*>(Tmp);  \
-            auto *Src_d = reinterpret_cast<type*>(Src); \
-            type begin = start_val;                           \
-            for (uint8_t i = 0; i < Elements; ++i) {          \
-              begin = func(begin, Src_d[i]);          \
-            }                                                 \
-            Dst_d[0] = begin;                                 \
-            break;                                            \
-            }
-          #define DO_VECTOR_SAT_OP(size, type, func, min, max)              \
-            case size: {                                      \
-            auto *Dst_d  = reinterpret_cast<type*>(Tmp);  \
-            auto *Src1_d = reinterpret_cast<type*>(Src1); \
-            auto *Src2_d = reinterpret_cast<type*>(Src2); \
-            for (uint8_t i = 0; i < Elements; ++i) {          \
-              Dst_d[i] = func(Src1_d[i], Src2_d[i], min, max);          \
-            }                                                 \
-            break;                                            \
-            }
-          case IR::OP_VECTORIMM: {
-            auto Op = IROp->C<IR::IROp_VectorImm>();
-            uint8_t Tmp[16];
-
-            uint8_t Elements = OpSize / Op->Header.ElementSize;
-            uint8_t Imm = Op->Immediate;
-
-            auto Func = [Imm]() { return Imm; };
-            switch (Op->Header.ElementSize) {
-              DO_VECTOR_0SRC_OP(1, int8_t, Func)
-              DO_VECTOR_0SRC_OP(2, int16_t, Func)
-              DO_VECTOR_0SRC_OP(4, int32_t, Func)
-              DO_VECTOR_0SRC_OP(8, int64_t, Func)
-              default: LogMan::Msg::A("Unknown Element Size: %d", Op->Header.ElementSize); break;
-            }
-            memcpy(GDP, Tmp, OpSize);
-            break;
-          }
-          case IR::OP_VNEG: {
-            auto Op = IROp->C<IR::IROp_VNeg>();
-            void *Src = GetSrc<void*>(SSAData, Op->Header.Args[0]);
-            uint8_t Tmp[16];
-
-            uint8_t Elements = OpSize / Op->Header.ElementSize;
-
-            auto Func = [](auto a) { return -a; };
-            switch (Op->Header.ElementSize) {
-              DO_VECTOR_1SRC_OP(1, int8_t, Func)
-              DO_VECTOR_1SRC_OP(2, int16_t, Func)
-              DO_VECTOR_1SRC_OP(4, int32_t, Func)
-              DO_VECTOR_1SRC_OP(8, int64_t, Func)
-              default: LogMan::Msg::A("Unknown Element Size: %d", Op->Header.ElementSize); break;
-            }
-            memcpy(GDP, Tmp, OpSize);
-            break;
-          }
-          case IR::OP_VFNEG: {
-            auto Op = IROp->C<IR::IROp_VFNeg>();
-            void *Src = GetSrc<void*>(SSAData, Op->Header.Args[0]);
-            uint8_t Tmp[16];
-
-            uint8_t Elements = OpSize / Op->Header.ElementSize;
-
-            auto Func = [](auto a) { return -a; };
-            switch (Op->Header.ElementSize) {
-              DO_VECTOR_1SRC_OP(4, float, Func)
-              DO_VECTOR_1SRC_OP(8, double, Func)
-              default: LogMan::Msg::A("Unknown Element Size: %d", Op->Header.ElementSize); break;
-            }
-            memcpy(GDP, Tmp, OpSize);
-            break;
-          }
-          case IR::OP_VUSHRI: {
-            auto Op = IROp->C<IR::IROp_VUShrI>();
-            void *Src = GetSrc<void*>(SSAData, Op->Header.Args[0]);
-            uint8_t BitShift = Op->BitShift;
-            uint8_t Tmp[16];
-
-            uint8_t Elements = OpSize / Op->Header.ElementSize;
-
-            auto Func = [BitShift](auto a) { return BitShift >= (sizeof(a) * 8) ? 0 : a >> BitShift; };
-            switch (Op->Header.ElementSize) {
-              DO_VECTOR_1SRC_OP(1, uint8_t, Func)
-              DO_VECTOR_1SRC_OP(2, uint16_t, Func)
-              DO_VECTOR_1SRC_OP(4, uint32_t, Func)
-              DO_VECTOR_1SRC_OP(8, uint64_t, Func)
-              default: LogMan::Msg::A("Unknown Element Size: %d", Op->Header.ElementSize); break;
-            }
-            memcpy(GDP, Tmp, OpSize);
-            break;
-          }
-          case IR::OP_VSSHRI: {
-            auto Op = IROp->C<IR::IROp_VSShrI>();
-            void *Src = GetSrc<void*>(SSAData, Op->Header.Args[0]);
-            uint8_t BitShift = Op->BitShift;
-            uint8_t Tmp[16];
-
-            uint8_t Elements = OpSize / Op->Header.ElementSize;
-
-            auto Func = [BitShift](auto a) { return BitShift >= (sizeof(a) * 8) ? (a >> (sizeof(a) * 8 - 1)) : a >> BitShift; };
-            switch (Op->Header.ElementSize) {
-              DO_VECTOR_1SRC_OP(1, int8_t, Func)
-              DO_VECTOR_1SRC_OP(2, int16_t, Func)
-              DO_VECTOR_1SRC_OP(4, int32_t, Func)
-              DO_VECTOR_1SRC_OP(8, int64_t, Func)
-              default: LogMan::Msg::A("Unknown Element Size: %d", Op->Header.ElementSize); break;
-            }
-            memcpy(GDP, Tmp, OpSize);
-            break;
-          }
-          case IR::OP_VSHLI: {
-            auto Op = IROp->C<IR::IROp_VShlI>();
-            void *Src = GetSrc<void*>(SSAData, Op->Header.Args[0]);
-            uint8_t BitShift = Op->BitShift;
-            uint8_t Tmp[16];
-
-            uint8_t Elements = OpSize / Op->Header.ElementSize;
-
-            auto Func = [BitShift](auto a) { return BitShift >= (sizeof(a) * 8) ? 0 : (a << BitShift); };
-            switch (Op->Header.ElementSize) {
-              DO_VECTOR_1SRC_OP(1, uint8_t, Func)
-              DO_VECTOR_1SRC_OP(2, uint16_t, Func)
-              DO_VECTOR_1SRC_OP(4, uint32_t, Func)
-              DO_VECTOR_1SRC_OP(8, uint64_t, Func)
-              default: LogMan::Msg::A("Unknown Element Size: %d", Op->Header.ElementSize); break;
-            }
-            memcpy(GDP, Tmp, OpSize);
-            break;
-          }
+        __uint128_t Expected = Src1;
+        bool Result = Data->compare_exchange_strong(Expected, Src2);
+        memcpy(GDP, Result ? &Src1 : &Expected, 16);
+        break;
+      }
+      default: LogMan::Msg::A("Unknown CAS size: %d", Size); break;
+    }
+    NEXT_OP();
+  }
+  DEF_OP(TRUNCELEMENTPAIR): {
+    auto Op = IROp->C<IR::IROp_TruncElementPair>();
+
+    switch (Op->Size) {
+      case 4: {
+        uint64_t *Src = GetSrc<uint64_t*>(SSAData, Op->Header.Args[0]);
+        uint64_t Result{};
+        Result = Src[0] & ~0U;
+        Result |= Src[1] << 32;
+        GD = Result;
+        break;
+      }
+      default: LogMan::Msg::A("Unhandled Truncation size: %d", Op->Size); break;
+    }
+    NEXT_OP();
+  }
+  DEF_OP(LOADFLAG): {
+    auto Op = IROp->C<IR::IROp_LoadFlag>();
+
+    uintptr_t ContextPtr = reinterpret_cast<uintptr_t>(&Thread->State.State);
+    ContextPtr += offsetof(FEXCore::Core::CPUState, flags[0]);
+    ContextPtr += Op->Flag;
+    uint8_t const *Data = reinterpret_cast<uint8_t const*>(ContextPtr);
+    GD = *Data;
+    NEXT_OP();
+  }
+  DEF_OP(STOREFLAG): {
+    auto Op = IROp->C<IR::IROp_StoreFlag>();
+    uint8_t Arg = *GetSrc<uint8_t*>(SSAData, Op->Header.Args[0]);
+
+    uintptr_t ContextPtr = reinterpret_cast<uintptr_t>(&Thread->State.State);
+    ContextPtr += offsetof(FEXCore::Core::CPUState, flags[0]);
+    ContextPtr += Op->Flag;
+    uint8_t *Data = reinterpret_cast<uint8_t*>(ContextPtr);
+    *Data = Arg;
+    NEXT_OP();
+  }
+  DEF_OP(LOADMEM):
+  DEF_OP(LOADMEMTSO): {
+    auto Op = IROp->C<IR::IROp_LoadMem>();
+    uint8_t const *Data = *GetSrc<uint8_t const**>(SSAData, Op->Addr);
+
+    if (!Op->Offset.IsInvalid()) {
+      auto Offset = *GetSrc<uintptr_t const*>(SSAData, Op->Offset) * Op->OffsetScale;
+
+      switch(Op->OffsetType.Val) {
+        case MEM_OFFSET_SXTX.Val: Data +=  Offset; break;
+        case MEM_OFFSET_UXTW.Val: Data += (uint32_t)Offset; break;
+        case MEM_OFFSET_SXTW.Val: Data += (int32_t)Offset; break;
+      }
+    }
+    memset(GDP, 0, 16);
+    memcpy(GDP, Data, Op->Size);
+    NEXT_OP();
+  }
+  DEF_OP(VLOADMEMELEMENT): {
+    auto Op = IROp->C<IR::IROp_VLoadMemElement>();
+    void const *Data = *GetSrc<void const**>(SSAData, Op->Header.Args[0]);
+
+    memcpy(GDP, GetSrc<void*>(SSAData, Op->Header.Args[1]), 16);
+    memcpy(reinterpret_cast<void*>(reinterpret_cast<uintptr_t>(GDP) + (Op->Header.ElementSize * Op->Index)),
+      Data, Op->Header.ElementSize);
+    NEXT_OP();
+  }
+  DEF_OP(STOREMEM):
+  DEF_OP(STOREMEMTSO): {
+    auto Op = IROp->C<IR::IROp_StoreMem>();
 
-          case IR::OP_VADD: {
-            auto Op = IROp->C<IR::IROp_VAdd>();
-            void *Src1 = GetSrc<void*>(SSAData, Op->Header.Args[0]);
-            void *Src2 = GetSrc<void*>(SSAData, Op->Header.Args[1]);
-            uint8_t Tmp[16];
-
-            uint8_t Elements = OpSize / Op->Header.ElementSize;
-
-            auto Func = [](auto a, auto b) { return a + b; };
-            switch (Op->Header.ElementSize) {
-              DO_VECTOR_OP(1, uint8_t,  Func)
-              DO_VECTOR_OP(2, uint16_t, Func)
-              DO_VECTOR_OP(4, uint32_t, Func)
-              DO_VECTOR_OP(8, uint64_t, Func)
-              default: LogMan::Msg::A("Unknown Element Size: %d", Op->Header.ElementSize); break;
-            }
-            memcpy(GDP, Tmp, OpSize);
-            break;
-          }
-          case IR::OP_VSUB: {
-            auto Op = IROp->C<IR::IROp_VSub>();
-            void *Src1 = GetSrc<void*>(SSAData, Op->Header.Args[0]);
-            void *Src2 = GetSrc<void*>(SSAData, Op->Header.Args[1]);
-            uint8_t Tmp[16];
-
-            uint8_t Elements = OpSize / Op->Header.ElementSize;
-
-            auto Func = [](auto a, auto b) { return a - b; };
-            switch (Op->Header.ElementSize) {
-              DO_VECTOR_OP(1, uint8_t,  Func)
-              DO_VECTOR_OP(2, uint16_t, Func)
-              DO_VECTOR_OP(4, uint32_t, Func)
-              DO_VECTOR_OP(8, uint64_t, Func)
-              default: LogMan::Msg::A("Unknown Element Size: %d", Op->Header.ElementSize); break;
-            }
-            memcpy(GDP, Tmp, OpSize);
-            break;
-          }
-          case IR::OP_VUQADD: {
-            auto Op = IROp->C<IR::IROp_VUQAdd>();
-            void *Src1 = GetSrc<void*>(SSAData, Op->Header.Args[0]);
-            void *Src2 = GetSrc<void*>(SSAData, Op->Header.Args[1]);
-            uint8_t Tmp[16];
-
-            uint8_t Elements = OpSize / Op->Header.ElementSize;
-
-            auto Func = [](auto a, auto b) {
-              decltype(a) res = a + b;
-              return res < a ? ~0U : res;
-            };
-            switch (Op->Header.ElementSize) {
-              DO_VECTOR_OP(1, uint8_t,  Func)
-              DO_VECTOR_OP(2, uint16_t, Func)
-              DO_VECTOR_OP(4, uint32_t, Func)
-              DO_VECTOR_OP(8, uint64_t, Func)
-              default: LogMan::Msg::A("Unknown Element Size: %d", Op->Header.ElementSize); break;
-            }
-            memcpy(GDP, Tmp, OpSize);
-            break;
-          }
-          case IR::OP_VUQSUB: {
-            auto Op = IROp->C<IR::IROp_VUQSub>();
-            void *Src1 = GetSrc<void*>(SSAData, Op->Header.Args[0]);
-            void *Src2 = GetSrc<void*>(SSAData, Op->Header.Args[1]);
-            uint8_t Tmp[16];
-
-            uint8_t Elements = OpSize / Op->Header.ElementSize;
-
-            auto Func = [](auto a, auto b) {
-              decltype(a) res = a - b;
-              return res > a ? 0U : res;
-            };
-            switch (Op->Header.ElementSize) {
-              DO_VECTOR_OP(1, uint8_t,  Func)
-              DO_VECTOR_OP(2, uint16_t, Func)
-              DO_VECTOR_OP(4, uint32_t, Func)
-              DO_VECTOR_OP(8, uint64_t, Func)
-              default: LogMan::Msg::A("Unknown Element Size: %d", Op->Header.ElementSize); break;
-            }
-            memcpy(GDP, Tmp, OpSize);
-            break;
-          }
-          case IR::OP_VSQADD: {
-            auto Op = IROp->C<IR::IROp_VSQAdd>();
-            void *Src1 = GetSrc<void*>(SSAData, Op->Header.Args[0]);
-            void *Src2 = GetSrc<void*>(SSAData, Op->Header.Args[1]);
-            uint8_t Tmp[16];
-
-            uint8_t Elements = OpSize / Op->Header.ElementSize;
-
-            auto Func = [](auto a, auto b) {
-              decltype(a) res = a + b;
-
-              if (a > 0) {
-                if (b > (std::numeric_limits<decltype(a)>::max() - a)) {
-                  return std::numeric_limits<decltype(a)>::max();
-                }
-              }
-              else if (b < (std::numeric_limits<decltype(a)>::min() - a)) {
-                return std::numeric_limits<decltype(a)>::min();
-              }
-
-              return res;
-            };
-            switch (Op->Header.ElementSize) {
-              DO_VECTOR_OP(1, int8_t,  Func)
-              DO_VECTOR_OP(2, int16_t, Func)
-              DO_VECTOR_OP(4, int32_t, Func)
-              DO_VECTOR_OP(8, int64_t, Func)
-              default: LogMan::Msg::A("Unknown Element Size: %d", Op->Header.ElementSize); break;
-            }
-            memcpy(GDP, Tmp, OpSize);
-            break;
-          }
-          case IR::OP_VSQSUB: {
-            auto Op = IROp->C<IR::IROp_VSQSub>();
-            void *Src1 = GetSrc<void*>(SSAData, Op->Header.Args[0]);
-            void *Src2 = GetSrc<void*>(SSAData, Op->Header.Args[1]);
-            uint8_t Tmp[16];
-
-            uint8_t Elements = OpSize / Op->Header.ElementSize;
-
-            auto Func = [](auto a, auto b) {
-              __int128_t res = a - b;
-              if (res < std::numeric_limits<decltype(a)>::min())
-                return std::numeric_limits<decltype(a)>::min();
-
-              if (res > std::numeric_limits<decltype(a)>::max())
-                return std::numeric_limits<decltype(a)>::max();
-              return (decltype(a))res;
-            };
-
-            switch (Op->Header.ElementSize) {
-              DO_VECTOR_OP(1, int8_t,  Func)
-              DO_VECTOR_OP(2, int16_t, Func)
-              DO_VECTOR_OP(4, int32_t, Func)
-              DO_VECTOR_OP(8, int64_t, Func)
-              default: LogMan::Msg::A("Unknown Element Size: %d", Op->Header.ElementSize); break;
-            }
-            memcpy(GDP, Tmp, OpSize);
-            break;
-          }
+    uint8_t *Data = *GetSrc<uint8_t **>(SSAData, Op->Addr);
 
-          case IR::OP_VFADD: {
-            auto Op = IROp->C<IR::IROp_VFAdd>();
-            void *Src1 = GetSrc<void*>(SSAData, Op->Header.Args[0]);
-            void *Src2 = GetSrc<void*>(SSAData, Op->Header.Args[1]);
-            uint8_t Tmp[16];
-
-            uint8_t Elements = OpSize / Op->Header.ElementSize;
-
-            auto Func = [](auto a, auto b) { return a + b; };
-            switch (Op->Header.ElementSize) {
-              DO_VECTOR_OP(4, float, Func)
-              DO_VECTOR_OP(8, double, Func)
-              default: LogMan::Msg::A("Unknown Element Size: %d", Op->Header.ElementSize); break;
-            }
-            memcpy(GDP, Tmp, OpSize);
-            break;
-          }
-          case IR::OP_VFADDP: {
-            auto Op = IROp->C<IR::IROp_VFAddP>();
-            void *Src1 = GetSrc<void*>(SSAData, Op->Header.Args[0]);
-            void *Src2 = GetSrc<void*>(SSAData, Op->Header.Args[1]);
-            uint8_t Tmp[16];
-
-            uint8_t Elements = (OpSize / Op->Header.ElementSize) / 2;
-
-            auto Func = [](auto a, auto b) { return a + b; };
-            switch (Op->Header.ElementSize) {
-              DO_VECTOR_PAIR_OP(4, float, Func)
-              DO_VECTOR_PAIR_OP(8, double, Func)
-              default: LogMan::Msg::A("Unknown Element Size: %d", Op->Header.ElementSize); break;
-            }
-            memcpy(GDP, Tmp, OpSize);
-            break;
-          }
-          case IR::OP_VFSUB: {
-            auto Op = IROp->C<IR::IROp_VFSub>();
-            void *Src1 = GetSrc<void*>(SSAData, Op->Header.Args[0]);
-            void *Src2 = GetSrc<void*>(SSAData, Op->Header.Args[1]);
-            uint8_t Tmp[16];
-
-            uint8_t Elements = OpSize / Op->Header.ElementSize;
-
-            auto Func = [](auto a, auto b) { return a - b; };
-            switch (Op->Header.ElementSize) {
-              DO_VECTOR_OP(4, float, Func)
-              DO_VECTOR_OP(8, double, Func)
-              default: LogMan::Msg::A("Unknown Element Size: %d", Op->Header.ElementSize); break;
-            }
-            memcpy(GDP, Tmp, OpSize);
-            break;
-          }
-          case IR::OP_VADDP: {
-            auto Op = IROp->C<IR::IROp_VAddP>();
-            void *Src1 = GetSrc<void*>(SSAData, Op->Header.Args[0]);
-            void *Src2 = GetSrc<void*>(SSAData, Op->Header.Args[1]);
-            uint8_t Tmp[16];
-
-            uint8_t Elements = (OpSize / Op->Header.ElementSize) / 2;
-
-            auto Func = [](auto a, auto b) { return a + b; };
-            switch (Op->Header.ElementSize) {
-              DO_VECTOR_PAIR_OP(1, uint8_t,  Func)
-              DO_VECTOR_PAIR_OP(2, uint16_t, Func)
-              DO_VECTOR_PAIR_OP(4, uint32_t, Func)
-              DO_VECTOR_PAIR_OP(8, uint64_t, Func)
-              default: LogMan::Msg::A("Unknown Element Size: %d", Op->Header.ElementSize); break;
-            }
-            memcpy(GDP, Tmp, OpSize);
-            break;
-          }
-          case IR::OP_VADDV: {
-            auto Op = IROp->C<IR::IROp_VAddV>();
-            void *Src = GetSrc<void*>(SSAData, Op->Header.Args[0]);
-            uint8_t Tmp[16];
-
-            uint8_t Elements = OpSize / Op->Header.ElementSize;
-
-            auto Func = [](auto current, auto a) { return current + a; };
-            switch (Op->Header.ElementSize) {
-              DO_VECTOR_REDUCE_1SRC_OP(1, int8_t, Func, 0)
-              DO_VECTOR_REDUCE_1SRC_OP(2, int16_t, Func, 0)
-              DO_VECTOR_REDUCE_1SRC_OP(4, int32_t, Func, 0)
-              DO_VECTOR_REDUCE_1SRC_OP(8, int64_t, Func, 0)
-              default: LogMan::Msg::A("Unknown Element Size: %d", Op->Header.ElementSize); break;
-            }
-            memcpy(GDP, Tmp, Op->Header.ElementSize);
-            break;
-          }
-          case IR::OP_VURAVG: {
-            auto Op = IROp->C<IR::IROp_VURAvg>();
-            void *Src1 = GetSrc<void*>(SSAData, Op->Header.Args[0]);
-            void *Src2 = GetSrc<void*>(SSAData, Op->Header.Args[1]);
-            uint8_t Tmp[16];
-
-            uint8_t Elements = OpSize / Op->Header.ElementSize;
-
-            auto Func = [](auto a, auto b) { return (a + b + 1) >> 1; };
-            switch (Op->Header.ElementSize) {
-              DO_VECTOR_OP(1, uint8_t,  Func)
-              DO_VECTOR_OP(2, uint16_t, Func)
-              default: LogMan::Msg::A("Unknown Element Size: %d", Op->Header.ElementSize); break;
-            }
-            memcpy(GDP, Tmp, OpSize);
-            break;
-          }
-          case IR::OP_VABS: {
-            auto Op = IROp->C<IR::IROp_VAbs>();
-            void *Src = GetSrc<void*>(SSAData, Op->Header.Args[0]);
-            uint8_t Tmp[16];
-
-            uint8_t Elements = OpSize / Op->Header.ElementSize;
-
-            auto Func = [](auto a) { return std::abs(a); };
-            switch (Op->Header.ElementSize) {
-              DO_VECTOR_1SRC_OP(1, int8_t, Func)
-              DO_VECTOR_1SRC_OP(2, int16_t, Func)
-              DO_VECTOR_1SRC_OP(4, int32_t, Func)
-              DO_VECTOR_1SRC_OP(8, int64_t, Func)
-              default: LogMan::Msg::A("Unknown Element Size: %d", Op->Header.ElementSize); break;
-            }
-            memcpy(GDP, Tmp, OpSize);
-            break;
-          }
-          case IR::OP_VFMUL: {
-            auto Op = IROp->C<IR::IROp_VFMul>();
-            void *Src1 = GetSrc<void*>(SSAData, Op->Header.Args[0]);
-            void *Src2 = GetSrc<void*>(SSAData, Op->Header.Args[1]);
-            uint8_t Tmp[16];
-
-            uint8_t Elements = OpSize / Op->Header.ElementSize;
-
-            auto Func = [](auto a, auto b) { return a * b; };
-            switch (Op->Header.ElementSize) {
-              DO_VECTOR_OP(4, float, Func)
-              DO_VECTOR_OP(8, double, Func)
-              default: LogMan::Msg::A("Unknown Element Size: %d", Op->Header.ElementSize); break;
-            }
-            memcpy(GDP, Tmp, OpSize);
-            break;
-          }
-          case IR::OP_VFDIV: {
-            auto Op = IROp->C<IR::IROp_VFDiv>();
-            void *Src1 = GetSrc<void*>(SSAData, Op->Header.Args[0]);
-            void *Src2 = GetSrc<void*>(SSAData, Op->Header.Args[1]);
-            uint8_t Tmp[16];
-
-            uint8_t Elements = OpSize / Op->Header.ElementSize;
-
-            auto Func = [](auto a, auto b) { return a / b; };
-            switch (Op->Header.ElementSize) {
-              DO_VECTOR_OP(4, float, Func)
-              DO_VECTOR_OP(8, double, Func)
-              default: LogMan::Msg::A("Unknown Element Size: %d", Op->Header.ElementSize); break;
-            }
-            memcpy(GDP, Tmp, OpSize);
-            break;
-          }
-          case IR::OP_VFMIN: {
-            auto Op = IROp->C<IR::IROp_VFMin>();
-            void *Src1 = GetSrc<void*>(SSAData, Op->Header.Args[0]);
-            void *Src2 = GetSrc<void*>(SSAData, Op->Header.Args[1]);
-            uint8_t Tmp[16];
-
-            uint8_t Elements = OpSize / Op->Header.ElementSize;
-
-            auto Func = [](auto a, auto b) { return std::min(a, b); };
-            switch (Op->Header.ElementSize) {
-              DO_VECTOR_OP(4, float, Func)
-              DO_VECTOR_OP(8, double, Func)
-              default: LogMan::Msg::A("Unknown Element Size: %d", Op->Header.ElementSize); break;
-            }
-            memcpy(GDP, Tmp, OpSize);
-            break;
-          }
-          case IR::OP_VFMAX: {
-            auto Op = IROp->C<IR::IROp_VFMax>();
-            void *Src1 = GetSrc<void*>(SSAData, Op->Header.Args[0]);
-            void *Src2 = GetSrc<void*>(SSAData, Op->Header.Args[1]);
-            uint8_t Tmp[16];
-
-            uint8_t Elements = OpSize / Op->Header.ElementSize;
-
-            auto Func = [](auto a, auto b) { return std::max(a, b); };
-            switch (Op->Header.ElementSize) {
-              DO_VECTOR_OP(4, float, Func)
-              DO_VECTOR_OP(8, double, Func)
-              default: LogMan::Msg::A("Unknown Element Size: %d", Op->Header.ElementSize); break;
-            }
-            memcpy(GDP, Tmp, OpSize);
-            break;
-          }
-          case IR::OP_VFRECP: {
-            auto Op = IROp->C<IR::IROp_VFRecp>();
-            void *Src = GetSrc<void*>(SSAData, Op->Header.Args[0]);
-            uint8_t Tmp[16];
-
-            uint8_t Elements = OpSize / Op->Header.ElementSize;
-
-            auto Func = [](auto a) { return 1.0 / a; };
-            switch (Op->Header.ElementSize) {
-              DO_VECTOR_1SRC_OP(4, float, Func)
-              DO_VECTOR_1SRC_OP(8, double, Func)
-              default: LogMan::Msg::A("Unknown Element Size: %d", Op->Header.ElementSize); break;
-            }
-            memcpy(GDP, Tmp, OpSize);
-            break;
-          }
-          case IR::OP_VFSQRT: {
-            auto Op = IROp->C<IR::IROp_VFSqrt>();
-            void *Src = GetSrc<void*>(SSAData, Op->Header.Args[0]);
-            uint8_t Tmp[16];
-
-            uint8_t Elements = OpSize / Op->Header.ElementSize;
-
-            auto Func = [](auto a) { return std::sqrt(a); };
-            switch (Op->Header.ElementSize) {
-              DO_VECTOR_1SRC_OP(4, float, Func)
-              DO_VECTOR_1SRC_OP(8, double, Func)
-              default: LogMan::Msg::A("Unknown Element Size: %d", Op->Header.ElementSize); break;
-            }
-            memcpy(GDP, Tmp, OpSize);
-            break;
-          }
-          case IR::OP_VFRSQRT: {
-            auto Op = IROp->C<IR::IROp_VFRSqrt>();
-            void *Src = GetSrc<void*>(SSAData, Op->Header.Args[0]);
-            uint8_t Tmp[16];
-
-            uint8_t Elements = OpSize / Op->Header.ElementSize;
-
-            auto Func = [](auto a) { return 1.0 / std::sqrt(a); };
-            switch (Op->Header.ElementSize) {
-              DO_VECTOR_1SRC_OP(4, float, Func)
-              DO_VECTOR_1SRC_OP(8, double, Func)
-              default: LogMan::Msg::A("Unknown Element Size: %d", Op->Header.ElementSize); break;
-            }
-            memcpy(GDP, Tmp, OpSize);
-            break;
-          }
-          #define DO_VECTOR_1SRC_2TYPE_OP(size, type, type2, func, min, max)              \
-            case size: {                                      \
-            auto *Dst_d  = reinterpret_cast<type*>(Tmp);  \
-            auto *Src_d = reinterpret_cast<type2*>(Src); \
-            for (uint8_t i = 0; i < Elements; ++i) {          \
-              Dst_d[i] = (type)func(Src_d[i], min, max);          \
-            }                                                 \
-            break;                                            \
-            }
-          #define DO_VECTOR_1SRC_2TYPE_OP_TOP(size, type, type2, func, min, max)              \
-            case size: {                                      \
-            auto *Dst_d  = reinterpret_cast<type*>(Tmp);  \
-            auto *Src_d = reinterpret_cast<type2*>(Src2); \
-            memcpy(Dst_d, Src1, Elements * sizeof(type2));\
-            for (uint8_t i = 0; i < Elements; ++i) {          \
-              Dst_d[i+Elements] = (type)func(Src_d[i], min, max);          \
-            }                                                 \
-            break;                                            \
-            }
-
-          #define DO_VECTOR_1SRC_2TYPE_OP_TOP_SRC(size, type, type2, func, min, max)              \
-            case size: {                                      \
-            auto *Dst_d  = reinterpret_cast<type*>(Tmp);  \
-            auto *Src_d = reinterpret_cast<type2*>(Src); \
-            for (uint8_t i = 0; i < Elements; ++i) {          \
-              Dst_d[i] = (type)func(Src_d[i+Elements], min, max);          \
-            }                                                 \
-            break;                                            \
-            }
-          #define DO_VECTOR_2SRC_2TYPE_OP(size, type, type2, func)              \
-            case size: {                                      \
-            auto *Dst_d  = reinterpret_cast<type*>(Tmp);  \
-            auto *Src1_d = reinterpret_cast<type2*>(Src1); \
-            auto *Src2_d = reinterpret_cast<type2*>(Src2); \
-            for (uint8_t i = 0; i < Elements; ++i) {          \
-              Dst_d[i] = (type)func((type)Src1_d[i], (type)Src2_d[i]);          \
-            }                                                 \
-            break;                                            \
-            }
-          #define DO_VECTOR_2SRC_2TYPE_OP_TOP_SRC(size, type, type2, func)              \
-            case size: {                                      \
-            auto *Dst_d  = reinterpret_cast<type*>(Tmp);  \
-            auto *Src1_d = reinterpret_cast<type2*>(Src1); \
-            auto *Src2_d = reinterpret_cast<type2*>(Src2); \
-            for (uint8_t i = 0; i < Elements; ++i) {          \
-              Dst_d[i] = (type)func((type)Src1_d[i+Elements], (type)Src2_d[i+Elements]);          \
-            }                                                 \
-            break;                                            \
-            }
-
-          case IR::OP_VUSHRNI: {
-            auto Op = IROp->C<IR::IROp_VUShrNI>();
-            void *Src = GetSrc<void*>(SSAData, Op->Header.Args[0]);
-            uint8_t BitShift = Op->BitShift;
-            uint8_t Tmp[16]{};
-
-            uint8_t Elements = OpSize / (Op->Header.ElementSize << 1);
-
-            auto Func = [BitShift](auto a, auto min, auto max) { return BitShift >= (sizeof(a) * 8) ? 0 : a >> BitShift; };
-            switch (Op->Header.ElementSize) {
-              DO_VECTOR_1SRC_2TYPE_OP(1, uint8_t, uint16_t, Func, 0, 0)
-              DO_VECTOR_1SRC_2TYPE_OP(2, uint16_t, uint32_t, Func, 0, 0)
-              DO_VECTOR_1SRC_2TYPE_OP(4, uint32_t, uint64_t, Func, 0, 0)
-              default: LogMan::Msg::A("Unknown Element Size: %d", Op->Header.ElementSize); break;
-            }
-            memcpy(GDP, Tmp, OpSize);
-            break;
-          }
-          case IR::OP_VUSHRNI2: {
-            auto Op = IROp->C<IR::IROp_VUShrNI2>();
-            void *Src1 = GetSrc<void*>(SSAData, Op->Header.Args[0]);
-            void *Src2 = GetSrc<void*>(SSAData, Op->Header.Args[1]);
-            uint8_t BitShift = Op->BitShift;
-            uint8_t Tmp[16];
-
-            uint8_t Elements = OpSize / (Op->Header.ElementSize << 1);
-
-            auto Func = [BitShift](auto a, auto min, auto max) { return BitShift >= (sizeof(a) * 8) ? 0 : a >> BitShift; };
-            switch (Op->Header.ElementSize) {
-              DO_VECTOR_1SRC_2TYPE_OP_TOP(1, uint8_t, uint16_t, Func, 0, 0)
-              DO_VECTOR_1SRC_2TYPE_OP_TOP(2, uint16_t, uint32_t, Func, 0, 0)
-              DO_VECTOR_1SRC_2TYPE_OP_TOP(4, uint32_t, uint64_t, Func, 0, 0)
-              default: LogMan::Msg::A("Unknown Element Size: %d", Op->Header.ElementSize); break;
-            }
-            memcpy(GDP, Tmp, OpSize);
-            break;
-          }
-          case IR::OP_VSQXTN: {
-            auto Op = IROp->C<IR::IROp_VSQXTN>();
-            void *Src = GetSrc<void*>(SSAData, Op->Header.Args[0]);
-            uint8_t Tmp[16]{};
-
-            uint8_t Elements = OpSize / (Op->Header.ElementSize << 1);
-
-            auto Func = [](auto a, auto min, auto max) { return std::max(std::min(a, (decltype(a))max), (decltype(a))min); };
-            switch (Op->Header.ElementSize) {
-              DO_VECTOR_1SRC_2TYPE_OP(1, int8_t, int16_t, Func, std::numeric_limits<int8_t>::min(), std::numeric_limits<int8_t>::max())
-              DO_VECTOR_1SRC_2TYPE_OP(2, int16_t, int32_t, Func, std::numeric_limits<int16_t>::min(), std::numeric_limits<int16_t>::max())
-              default: LogMan::Msg::A("Unknown Element Size: %d", Op->Header.ElementSize); break;
-            }
-            memcpy(GDP, Tmp, OpSize);
-            break;
-          }
-          case IR::OP_VSQXTN2: {
-            auto Op = IROp->C<IR::IROp_VSQXTN2>();
-            void *Src1 = GetSrc<void*>(SSAData, Op->Header.Args[0]);
-            void *Src2 = GetSrc<void*>(SSAData, Op->Header.Args[1]);
-            uint8_t Tmp[16]{};
-
-            uint8_t Elements = OpSize / (Op->Header.ElementSize << 1);
-
-            auto Func = [](auto a, auto min, auto max) { return std::max(std::min(a, (decltype(a))max), (decltype(a))min); };
-            switch (Op->Header.ElementSize) {
-              DO_VECTOR_1SRC_2TYPE_OP_TOP(1, int8_t, int16_t, Func, std::numeric_limits<int8_t>::min(), std::numeric_limits<int8_t>::max())
-              DO_VECTOR_1SRC_2TYPE_OP_TOP(2, int16_t, int32_t, Func, std::numeric_limits<int16_t>::min(), std::numeric_limits<int16_t>::max())
-              default: LogMan::Msg::A("Unknown Element Size: %d", Op->Header.ElementSize); break;
-            }
-            memcpy(GDP, Tmp, OpSize);
-            break;
-          }
-          case IR::OP_VSQXTUN: {
-            auto Op = IROp->C<IR::IROp_VSQXTUN>();
-            void *Src = GetSrc<void*>(SSAData, Op->Header.Args[0]);
-            uint8_t Tmp[16]{};
-
-            uint8_t Elements = OpSize / (Op->Header.ElementSize << 1);
-
-            auto Func = [](auto a, auto min, auto max) { return std::max(std::min(a, (decltype(a))max), (decltype(a))min); };
-            switch (Op->Header.ElementSize) {
-              DO_VECTOR_1SRC_2TYPE_OP(1, uint8_t, int16_t, Func, 0, (1 << 8) - 1)
-              DO_VECTOR_1SRC_2TYPE_OP(2, uint16_t, int32_t, Func, 0, (1 << 16) - 1)
-              default: LogMan::Msg::A("Unknown Element Size: %d", Op->Header.ElementSize); break;
-            }
-            memcpy(GDP, Tmp, OpSize);
-            break;
-          }
-          case IR::OP_VSQXTUN2: {
-            auto Op = IROp->C<IR::IROp_VSQXTUN2>();
-            void *Src1 = GetSrc<void*>(SSAData, Op->Header.Args[0]);
-            void *Src2 = GetSrc<void*>(SSAData, Op->Header.Args[1]);
-            uint8_t Tmp[16]{};
-
-            uint8_t Elements = OpSize / (Op->Header.ElementSize << 1);
-
-            auto Func = [](auto a, auto min, auto max) { return std::max(std::min(a, (decltype(a))max), (decltype(a))min); };
-            switch (Op->Header.ElementSize) {
-              DO_VECTOR_1SRC_2TYPE_OP_TOP(1, uint8_t, int16_t, Func, 0, (1 << 8) - 1)
-              DO_VECTOR_1SRC_2TYPE_OP_TOP(2, uint16_t, int32_t, Func, 0, (1 << 16) - 1)
-              default: LogMan::Msg::A("Unknown Element Size: %d", Op->Header.ElementSize); break;
-            }
-            memcpy(GDP, Tmp, OpSize);
-            break;
-          }
-          case IR::OP_VECTOR_UTOF: {
-            auto Op = IROp->C<IR::IROp_Vector_UToF>();
-            void *Src = GetSrc<void*>(SSAData, Op->Header.Args[0]);
-            uint8_t Tmp[16];
-
-            uint8_t Elements = OpSize / Op->Header.ElementSize;
-
-            auto Func = [](auto a, auto min, auto max) { return a; };
-            switch (Op->Header.ElementSize) {
-              DO_VECTOR_1SRC_2TYPE_OP(4, float, uint32_t, Func, 0, 0)
-              DO_VECTOR_1SRC_2TYPE_OP(8, double, uint64_t, Func, 0, 0)
-              default: LogMan::Msg::A("Unknown Element Size: %d", Op->Header.ElementSize); break;
-            }
-            memcpy(GDP, Tmp, OpSize);
-            break;
-          }
-          case IR::OP_VECTOR_STOF: {
-            auto Op = IROp->C<IR::IROp_Vector_SToF>();
-            void *Src = GetSrc<void*>(SSAData, Op->Header.Args[0]);
-            uint8_t Tmp[16];
-
-            uint8_t Elements = OpSize / Op->Header.ElementSize;
-
-            auto Func = [](auto a, auto min, auto max) { return a; };
-            switch (Op->Header.ElementSize) {
-              DO_VECTOR_1SRC_2TYPE_OP(4, float, int32_t, Func, 0, 0)
-              DO_VECTOR_1SRC_2TYPE_OP(8, double, int64_t, Func, 0, 0)
-              default: LogMan::Msg::A("Unknown Element Size: %d", Op->Header.ElementSize); break;
-            }
-            memcpy(GDP, Tmp, OpSize);
-            break;
-          }
-          case IR::OP_VECTOR_FTOZU: {
-            auto Op = IROp->C<IR::IROp_Vector_FToZU>();
-            void *Src = GetSrc<void*>(SSAData, Op->Header.Args[0]);
-            uint8_t Tmp[16];
-
-            uint8_t Elements = OpSize / Op->Header.ElementSize;
-
-            auto Func = [](auto a, auto min, auto max) { return a; };
-            switch (Op->Header.ElementSize) {
-              DO_VECTOR_1SRC_2TYPE_OP(4, uint32_t, float, Func, 0, 0)
-              DO_VECTOR_1SRC_2TYPE_OP(8, uint64_t, double, Func, 0, 0)
-              default: LogMan::Msg::A("Unknown Element Size: %d", Op->Header.ElementSize); break;
-            }
-            memcpy(GDP, Tmp, OpSize);
-            break;
-          }
-          case IR::OP_VECTOR_FTOZS: {
-            auto Op = IROp->C<IR::IROp_Vector_FToZS>();
-            void *Src = GetSrc<void*>(SSAData, Op->Header.Args[0]);
-            uint8_t Tmp[16];
-
-            uint8_t Elements = OpSize / Op->Header.ElementSize;
-
-            auto Func = [](auto a, auto min, auto max) { return a; };
-            switch (Op->Header.ElementSize) {
-              DO_VECTOR_1SRC_2TYPE_OP(4, int32_t, float, Func, 0, 0)
-              DO_VECTOR_1SRC_2TYPE_OP(8, int64_t, double, Func, 0, 0)
-              default: LogMan::Msg::A("Unknown Element Size: %d", Op->Header.ElementSize); break;
-            }
-            memcpy(GDP, Tmp, OpSize);
-            break;
-          }
-          case IR::OP_VECTOR_FTOU: {
-            auto Op = IROp->C<IR::IROp_Vector_FToU>();
-            void *Src = GetSrc<void*>(SSAData, Op->Header.Args[0]);
-            uint8_t Tmp[16];
-
-            uint8_t Elements = OpSize / Op->Header.ElementSize;
-
-            auto Func = [](auto a, auto min, auto max) { return a; };
-            switch (Op->Header.ElementSize) {
-              DO_VECTOR_1SRC_2TYPE_OP(4, uint32_t, float, Func, 0, 0)
-              DO_VECTOR_1SRC_2TYPE_OP(8, uint64_t, double, Func, 0, 0)
-              default: LogMan::Msg::A("Unknown Element Size: %d", Op->Header.ElementSize); break;
-            }
-            memcpy(GDP, Tmp, OpSize);
-            break;
-          }
-          case IR::OP_VECTOR_FTOS: {
-            auto Op = IROp->C<IR::IROp_Vector_FToS>();
-            void *Src = GetSrc<void*>(SSAData, Op->Header.Args[0]);
-            uint8_t Tmp[16];
-
-            uint8_t Elements = OpSize / Op->Header.ElementSize;
-
-            auto Func = [](auto a, auto min, auto max) { return a; };
-            switch (Op->Header.ElementSize) {
-              DO_VECTOR_1SRC_2TYPE_OP(4, int32_t, float, Func, 0, 0)
-              DO_VECTOR_1SRC_2TYPE_OP(8, int64_t, double, Func, 0, 0)
-              default: LogMan::Msg::A("Unknown Element Size: %d", Op->Header.ElementSize); break;
-            }
-            memcpy(GDP, Tmp, OpSize);
-            break;
-          }
-          case IR::OP_VUMUL: {
-            auto Op = IROp->C<IR::IROp_VUMul>();
-            void *Src1 = GetSrc<void*>(SSAData, Op->Header.Args[0]);
-            void *Src2 = GetSrc<void*>(SSAData, Op->Header.Args[1]);
-            uint8_t Tmp[16];
-
-            uint8_t Elements = OpSize / Op->Header.ElementSize;
-
-            auto Func = [](auto a, auto b) { return a * b; };
-            switch (Op->Header.ElementSize) {
-              DO_VECTOR_OP(1, uint8_t,  Func)
-              DO_VECTOR_OP(2, uint16_t, Func)
-              DO_VECTOR_OP(4, uint32_t, Func)
-              DO_VECTOR_OP(8, uint64_t, Func)
-              default: LogMan::Msg::A("Unknown Element Size: %d", Op->Header.ElementSize); break;
-            }
-            memcpy(GDP, Tmp, OpSize);
-            break;
-          }
-          case IR::OP_VSMUL: {
-            auto Op = IROp->C<IR::IROp_VSMul>();
-            void *Src1 = GetSrc<void*>(SSAData, Op->Header.Args[0]);
-            void *Src2 = GetSrc<void*>(SSAData, Op->Header.Args[1]);
-            uint8_t Tmp[16];
-
-            uint8_t Elements = OpSize / Op->Header.ElementSize;
-
-            auto Func = [](auto a, auto b) { return a * b; };
-            switch (Op->Header.ElementSize) {
-              DO_VECTOR_OP(1, int8_t,  Func)
-              DO_VECTOR_OP(2, int16_t, Func)
-              DO_VECTOR_OP(4, int32_t, Func)
-              DO_VECTOR_OP(8, int64_t, Func)
-              default: LogMan::Msg::A("Unknown Element Size: %d", Op->Header.ElementSize); break;
-            }
-            memcpy(GDP, Tmp, OpSize);
-            break;
-          }
-          case IR::OP_VUMULL: {
-            auto Op = IROp->C<IR::IROp_VUMull>();
-            void *Src1 = GetSrc<void*>(SSAData, Op->Header.Args[0]);
-            void *Src2 = GetSrc<void*>(SSAData, Op->Header.Args[1]);
-
-            uint8_t Tmp[16];
-
-            uint8_t Elements = OpSize / Op->Header.ElementSize;
-
-            auto Func = [](auto a, auto b) { return a * b; };
-            switch (Op->Header.ElementSize) {
-              DO_VECTOR_2SRC_2TYPE_OP(2, uint16_t, uint8_t, Func)
-              DO_VECTOR_2SRC_2TYPE_OP(4, uint32_t, uint16_t, Func)
-              DO_VECTOR_2SRC_2TYPE_OP(8, uint64_t, uint32_t, Func)
-              default: LogMan::Msg::A("Unknown Element Size: %d", Op->Header.ElementSize); break;
-            }
-            memcpy(GDP, Tmp, OpSize);
-            break;
-          }
-          case IR::OP_VSMULL: {
-            auto Op = IROp->C<IR::IROp_VSMull>();
-            void *Src1 = GetSrc<void*>(SSAData, Op->Header.Args[0]);
-            void *Src2 = GetSrc<void*>(SSAData, Op->Header.Args[1]);
-
-            uint8_t Tmp[16];
-
-            uint8_t Elements = OpSize / Op->Header.ElementSize;
-
-            auto Func = [](auto a, auto b) { return a * b; };
-            switch (Op->Header.ElementSize) {
-              DO_VECTOR_2SRC_2TYPE_OP(2, int16_t, int8_t, Func)
-              DO_VECTOR_2SRC_2TYPE_OP(4, int32_t, int16_t, Func)
-              DO_VECTOR_2SRC_2TYPE_OP(8, int64_t, int32_t, Func)
-              default: LogMan::Msg::A("Unknown Element Size: %d", Op->Header.ElementSize); break;
-            }
-            memcpy(GDP, Tmp, OpSize);
-            break;
-          }
-          case IR::OP_VUMULL2: {
-            auto Op = IROp->C<IR::IROp_VUMull2>();
-            void *Src1 = GetSrc<void*>(SSAData, Op->Header.Args[0]);
-            void *Src2 = GetSrc<void*>(SSAData, Op->Header.Args[1]);
-
-            uint8_t Tmp[16];
-
-            uint8_t Elements = OpSize / Op->Header.ElementSize;
-
-            auto Func = [](auto a, auto b) { return a * b; };
-            switch (Op->Header.ElementSize) {
-              DO_VECTOR_2SRC_2TYPE_OP_TOP_SRC(2, uint16_t, uint8_t, Func)
-              DO_VECTOR_2SRC_2TYPE_OP_TOP_SRC(4, uint32_t, uint16_t, Func)
-              DO_VECTOR_2SRC_2TYPE_OP_TOP_SRC(8, uint64_t, uint32_t, Func)
-              default: LogMan::Msg::A("Unknown Element Size: %d", Op->Header.ElementSize); break;
-            }
-            memcpy(GDP, Tmp, OpSize);
-            break;
-          }
-          case IR::OP_VSMULL2: {
-            auto Op = IROp->C<IR::IROp_VSMull2>();
-            void *Src1 = GetSrc<void*>(SSAData, Op->Header.Args[0]);
-            void *Src2 = GetSrc<void*>(SSAData, Op->Header.Args[1]);
-
-            uint8_t Tmp[16];
-
-            uint8_t Elements = OpSize / Op->Header.ElementSize;
-
-            auto Func = [](auto a, auto b) { return a * b; };
-            switch (Op->Header.ElementSize) {
-              DO_VECTOR_2SRC_2TYPE_OP_TOP_SRC(2, int16_t, int8_t, Func)
-              DO_VECTOR_2SRC_2TYPE_OP_TOP_SRC(4, int32_t, int16_t, Func)
-              DO_VECTOR_2SRC_2TYPE_OP_TOP_SRC(8, int64_t, int32_t, Func)
-              default: LogMan::Msg::A("Unknown Element Size: %d", Op->Header.ElementSize); break;
-            }
-            memcpy(GDP, Tmp, Op->Header.Size);
-            break;
-          }
-          case IR::OP_VSXTL: {
-            auto Op = IROp->C<IR::IROp_VSXTL>();
-            void *Src = GetSrc<void*>(SSAData, Op->Header.Args[0]);
-            uint8_t Tmp[16]{};
-
-            uint8_t Elements = OpSize / Op->Header.ElementSize;
-
-            auto Func = [](auto a, auto min, auto max) { return a; };
-            switch (Op->Header.ElementSize) {
-              DO_VECTOR_1SRC_2TYPE_OP(2, int16_t, int8_t, Func,  0, 0)
-              DO_VECTOR_1SRC_2TYPE_OP(4, int32_t, int16_t, Func, 0, 0)
-              DO_VECTOR_1SRC_2TYPE_OP(8, int64_t, int32_t, Func, 0, 0)
-              default: LogMan::Msg::A("Unknown Element Size: %d", Op->Header.ElementSize); break;
-            }
-            memcpy(GDP, Tmp, OpSize);
-            break;
-          }
-          case IR::OP_VSXTL2: {
-            auto Op = IROp->C<IR::IROp_VSXTL2>();
-            void *Src = GetSrc<void*>(SSAData, Op->Header.Args[0]);
-            uint8_t Tmp[16];
-
-            uint8_t Elements = OpSize / Op->Header.ElementSize;
-
-            auto Func = [](auto a, auto min, auto max) { return a; };
-            switch (Op->Header.ElementSize) {
-              DO_VECTOR_1SRC_2TYPE_OP_TOP_SRC(2, int16_t, int8_t, Func,  0, 0)
-              DO_VECTOR_1SRC_2TYPE_OP_TOP_SRC(4, int32_t, int16_t, Func, 0, 0)
-              DO_VECTOR_1SRC_2TYPE_OP_TOP_SRC(8, int64_t, int32_t, Func, 0, 0)
-              default: LogMan::Msg::A("Unknown Element Size: %d", Op->Header.ElementSize); break;
-            }
-            memcpy(GDP, Tmp, OpSize);
-            break;
-          }
-          case IR::OP_VUXTL: {
-            auto Op = IROp->C<IR::IROp_VUXTL>();
-            void *Src = GetSrc<void*>(SSAData, Op->Header.Args[0]);
-            uint8_t Tmp[16]{};
-
-            uint8_t Elements = OpSize / Op->Header.ElementSize;
-
-            auto Func = [](auto a, auto min, auto max) { return a; };
-            switch (Op->Header.ElementSize) {
-              DO_VECTOR_1SRC_2TYPE_OP(2, uint16_t, uint8_t, Func,  0, 0)
-              DO_VECTOR_1SRC_2TYPE_OP(4, uint32_t, uint16_t, Func, 0, 0)
-              DO_VECTOR_1SRC_2TYPE_OP(8, uint64_t, uint32_t, Func, 0, 0)
-              default: LogMan::Msg::A("Unknown Element Size: %d", Op->Header.ElementSize); break;
-            }
-            memcpy(GDP, Tmp, OpSize);
-            break;
-          }
-          case IR::OP_VUXTL2: {
-            auto Op = IROp->C<IR::IROp_VUXTL2>();
-            void *Src = GetSrc<void*>(SSAData, Op->Header.Args[0]);
-
-            uint8_t Tmp[16];
-
-            uint8_t Elements = OpSize / Op->Header.ElementSize;
-
-            auto Func = [](auto a, auto min, auto max) { return a; };
-            switch (Op->Header.ElementSize) {
-              DO_VECTOR_1SRC_2TYPE_OP_TOP_SRC(2, uint16_t, uint8_t, Func,  0, 0)
-              DO_VECTOR_1SRC_2TYPE_OP_TOP_SRC(4, uint32_t, uint16_t, Func, 0, 0)
-              DO_VECTOR_1SRC_2TYPE_OP_TOP_SRC(8, uint64_t, uint32_t, Func, 0, 0)
-              default: LogMan::Msg::A("Unknown Element Size: %d", Op->Header.ElementSize); break;
-            }
-            memcpy(GDP, Tmp, OpSize);
-            break;
-          }
-          case IR::OP_VUMIN: {
-            auto Op = IROp->C<IR::IROp_VUMin>();
-            void *Src1 = GetSrc<void*>(SSAData, Op->Header.Args[0]);
-            void *Src2 = GetSrc<void*>(SSAData, Op->Header.Args[1]);
-            uint8_t Tmp[16];
-
-            uint8_t Elements = OpSize / Op->Header.ElementSize;
-            auto Func = [](auto a, auto b) { return std::min(a, b); };
-
-            switch (Op->Header.ElementSize) {
-              DO_VECTOR_OP(1, uint8_t,  Func)
-              DO_VECTOR_OP(2, uint16_t, Func)
-              DO_VECTOR_OP(4, uint32_t, Func)
-              DO_VECTOR_OP(8, uint64_t, Func)
-              default: LogMan::Msg::A("Unknown Element Size: %d", Op->Header.ElementSize); break;
-            }
-            memcpy(GDP, Tmp, OpSize);
-            break;
-          }
-          case IR::OP_VSMIN: {
-            auto Op = IROp->C<IR::IROp_VSMin>();
-            void *Src1 = GetSrc<void*>(SSAData, Op->Header.Args[0]);
-            void *Src2 = GetSrc<void*>(SSAData, Op->Header.Args[1]);
-            uint8_t Tmp[16];
-
-            uint8_t Elements = OpSize / Op->Header.ElementSize;
-            auto Func = [](auto a, auto b) { return std::min(a, b); };
-
-            switch (Op->Header.ElementSize) {
-              DO_VECTOR_OP(1, int8_t,  Func)
-              DO_VECTOR_OP(2, int16_t, Func)
-              DO_VECTOR_OP(4, int32_t, Func)
-              DO_VECTOR_OP(8, int64_t, Func)
-              default: LogMan::Msg::A("Unknown Element Size: %d", Op->Header.ElementSize); break;
-            }
-            memcpy(GDP, Tmp, OpSize);
-            break;
-          }
-          case IR::OP_VUMAX: {
-            auto Op = IROp->C<IR::IROp_VUMax>();
-            void *Src1 = GetSrc<void*>(SSAData, Op->Header.Args[0]);
-            void *Src2 = GetSrc<void*>(SSAData, Op->Header.Args[1]);
-            uint8_t Tmp[16];
-
-            uint8_t Elements = OpSize / Op->Header.ElementSize;
-            auto Func = [](auto a, auto b) { return std::max(a, b); };
-
-            switch (Op->Header.ElementSize) {
-              DO_VECTOR_OP(1, uint8_t,  Func)
-              DO_VECTOR_OP(2, uint16_t, Func)
-              DO_VECTOR_OP(4, uint32_t, Func)
-              DO_VECTOR_OP(8, uint64_t, Func)
-              default: LogMan::Msg::A("Unknown Element Size: %d", Op->Header.ElementSize); break;
-            }
-            memcpy(GDP, Tmp, OpSize);
-            break;
-          }
-          case IR::OP_VSMAX: {
-            auto Op = IROp->C<IR::IROp_VSMax>();
-            void *Src1 = GetSrc<void*>(SSAData, Op->Header.Args[0]);
-            void *Src2 = GetSrc<void*>(SSAData, Op->Header.Args[1]);
-            uint8_t Tmp[16];
-
-            uint8_t Elements = OpSize / Op->Header.ElementSize;
-            auto Func = [](auto a, auto b) { return std::max(a, b); };
-
-            switch (Op->Header.ElementSize) {
-              DO_VECTOR_OP(1, int8_t,  Func)
-              DO_VECTOR_OP(2, int16_t, Func)
-              DO_VECTOR_OP(4, int32_t, Func)
-              DO_VECTOR_OP(8, int64_t, Func)
-              default: LogMan::Msg::A("Unknown Element Size: %d", Op->Header.ElementSize); break;
-            }
-            memcpy(GDP, Tmp, OpSize);
-            break;
-          }
-          case IR::OP_VUSHL: {
-            auto Op = IROp->C<IR::IROp_VUShl>();
-            void *Src1 = GetSrc<void*>(SSAData, Op->Header.Args[0]);
-            void *Src2 = GetSrc<void*>(SSAData, Op->Header.Args[1]);
-            uint8_t Tmp[16];
-
-            uint8_t Elements = OpSize / Op->Header.ElementSize;
-            auto Func = [](auto a, auto b) { return b >= (sizeof(a) * 8) ? 0 : a << b; };
-
-            switch (Op->Header.ElementSize) {
-              DO_VECTOR_OP(1, uint8_t,  Func)
-              DO_VECTOR_OP(2, uint16_t, Func)
-              DO_VECTOR_OP(4, uint32_t, Func)
-              DO_VECTOR_OP(8, uint64_t, Func)
-              default: LogMan::Msg::A("Unknown Element Size: %d", Op->Header.ElementSize); break;
-            }
-            memcpy(GDP, Tmp, OpSize);
-            break;
-          }
-          case IR::OP_VSSHR: {
-            auto Op = IROp->C<IR::IROp_VSShr>();
-            void *Src1 = GetSrc<void*>(SSAData, Op->Header.Args[0]);
-            void *Src2 = GetSrc<void*>(SSAData, Op->Header.Args[1]);
-            uint8_t Tmp[16];
-
-            uint8_t Elements = OpSize / Op->Header.ElementSize;
-            auto Func = [](auto a, auto b) { return b >= (sizeof(a) * 8) ? (a >> (sizeof(a) * 8 - 1)) : a >> b; };
-
-            switch (Op->Header.ElementSize) {
-              DO_VECTOR_OP(1, int8_t,  Func)
-              DO_VECTOR_OP(2, int16_t, Func)
-              DO_VECTOR_OP(4, int32_t, Func)
-              DO_VECTOR_OP(8, int64_t, Func)
-              default: LogMan::Msg::A("Unknown Element Size: %d", Op->Header.ElementSize); break;
-            }
-            memcpy(GDP, Tmp, OpSize);
-            break;
-          }
+    if (!Op->Offset.IsInvalid()) {
+      auto Offset = *GetSrc<uintptr_t const*>(SSAData, Op->Offset) * Op->OffsetScale;
 
-          case IR::OP_VUSHLS: {
-            auto Op = IROp->C<IR::IROp_VUShlS>();
-            void *Src1 = GetSrc<void*>(SSAData, Op->Header.Args[0]);
-            void *Src2 = GetSrc<void*>(SSAData, Op->Header.Args[1]);
-            uint8_t Tmp[16];
-
-            uint8_t Elements = OpSize / Op->Header.ElementSize;
-            auto Func = [](auto a, auto b) { return b >= (sizeof(a) * 8) ? 0 : a << b; };
-
-            switch (Op->Header.ElementSize) {
-              DO_VECTOR_SCALAR_OP(1, uint8_t, Func)
-              DO_VECTOR_SCALAR_OP(2, uint16_t, Func)
-              DO_VECTOR_SCALAR_OP(4, uint32_t, Func)
-              DO_VECTOR_SCALAR_OP(8, uint64_t, Func)
-              DO_VECTOR_SCALAR_OP(16, __uint128_t, Func)
-              default: LogMan::Msg::A("Unknown Element Size: %d", Op->Header.ElementSize); break;
-            }
-            memcpy(GDP, Tmp, OpSize);
-            break;
-          }
-          case IR::OP_VUSHRS: {
-            auto Op = IROp->C<IR::IROp_VUShrS>();
-            void *Src1 = GetSrc<void*>(SSAData, Op->Header.Args[0]);
-            void *Src2 = GetSrc<void*>(SSAData, Op->Header.Args[1]);
-            uint8_t Tmp[16];
-
-            uint8_t Elements = OpSize / Op->Header.ElementSize;
-            auto Func = [](auto a, auto b) { return b >= (sizeof(a) * 8) ? 0 : a >> b; };
-
-            switch (Op->Header.ElementSize) {
-              DO_VECTOR_SCALAR_OP(1, uint8_t, Func)
-              DO_VECTOR_SCALAR_OP(2, uint16_t, Func)
-              DO_VECTOR_SCALAR_OP(4, uint32_t, Func)
-              DO_VECTOR_SCALAR_OP(8, uint64_t, Func)
-              DO_VECTOR_SCALAR_OP(16, __uint128_t, Func)
-              default: LogMan::Msg::A("Unknown Element Size: %d", Op->Header.ElementSize); break;
-            }
-            memcpy(GDP, Tmp, OpSize);
-            break;
-          }
-          case IR::OP_VSSHRS: {
-            auto Op = IROp->C<IR::IROp_VSShrS>();
-            void *Src1 = GetSrc<void*>(SSAData, Op->Header.Args[0]);
-            void *Src2 = GetSrc<void*>(SSAData, Op->Header.Args[1]);
-            uint8_t Tmp[16];
-
-            uint8_t Elements = OpSize / Op->Header.ElementSize;
-            auto Func = [](auto a, auto b) { return b >= (sizeof(a) * 8) ? (a >> (sizeof(a) * 8 - 1)) : a >> b; };
-
-            switch (Op->Header.ElementSize) {
-              DO_VECTOR_SCALAR_OP(1, int8_t, Func)
-              DO_VECTOR_SCALAR_OP(2, int16_t, Func)
-              DO_VECTOR_SCALAR_OP(4, int32_t, Func)
-              DO_VECTOR_SCALAR_OP(8, int64_t, Func)
-              DO_VECTOR_SCALAR_OP(16, __int128_t, Func)
-              default: LogMan::Msg::A("Unknown Element Size: %d", Op->Header.ElementSize); break;
-            }
-            memcpy(GDP, Tmp, OpSize);
-            break;
-          }
-          case IR::OP_VUSHR: {
-            auto Op = IROp->C<IR::IROp_VUShr>();
-            void *Src1 = GetSrc<void*>(SSAData, Op->Header.Args[0]);
-            void *Src2 = GetSrc<void*>(SSAData, Op->Header.Args[1]);
-            uint8_t Tmp[16];
-
-            uint8_t Elements = OpSize / Op->Header.ElementSize;
-            auto Func = [](auto a, auto b) { return b >= (sizeof(a) * 8) ? 0 : a >> b; };
-
-            switch (Op->Header.ElementSize) {
-              DO_VECTOR_OP(1, uint8_t,  Func)
-              DO_VECTOR_OP(2, uint16_t, Func)
-              DO_VECTOR_OP(4, uint32_t, Func)
-              DO_VECTOR_OP(8, uint64_t, Func)
-              default: LogMan::Msg::A("Unknown Element Size: %d", Op->Header.ElementSize); break;
-            }
-            memcpy(GDP, Tmp, OpSize);
-            break;
-          }
-          case IR::OP_VZIP2:
-          case IR::OP_VZIP: {
-            auto Op = IROp->C<IR::IROp_VZip>();
-            void *Src1 = GetSrc<void*>(SSAData, Op->Header.Args[0]);
-            void *Src2 = GetSrc<void*>(SSAData, Op->Header.Args[1]);
-            uint8_t Tmp[16];
-            uint8_t Elements = OpSize / Op->Header.ElementSize;
-            uint8_t BaseOffset = IROp->Op == IR::OP_VZIP2 ? (Elements / 2) : 0;
-            Elements >>= 1;
-
-            switch (Op->Header.ElementSize) {
-              case 1: {
-                auto *Dst_d  = reinterpret_cast<uint8_t*>(Tmp);
-                auto *Src1_d = reinterpret_cast<uint8_t*>(Src1);
-                auto *Src2_d = reinterpret_cast<uint8_t*>(Src2);
-                for (unsigned i = 0; i < Elements; ++i) {
-                  Dst_d[i*2] = Src1_d[BaseOffset + i];
-                  Dst_d[i*2+1] = Src2_d[BaseOffset + i];
-                }
-                break;
-              }
-              case 2: {
-                auto *Dst_d  = reinterpret_cast<uint16_t*>(Tmp);
-                auto *Src1_d = reinterpret_cast<uint16_t*>(Src1);
-                auto *Src2_d = reinterpret_cast<uint16_t*>(Src2);
-                for (unsigned i = 0; i < Elements; ++i) {
-                  Dst_d[i*2] = Src1_d[BaseOffset + i];
-                  Dst_d[i*2+1] = Src2_d[BaseOffset + i];
-                }
-                break;
-              }
-              case 4: {
-                auto *Dst_d  = reinterpret_cast<uint32_t*>(Tmp);
-                auto *Src1_d = reinterpret_cast<uint32_t*>(Src1);
-                auto *Src2_d = reinterpret_cast<uint32_t*>(Src2);
-                for (unsigned i = 0; i < Elements; ++i) {
-                  Dst_d[i*2] = Src1_d[BaseOffset + i];
-                  Dst_d[i*2+1] = Src2_d[BaseOffset + i];
-                }
-                break;
-              }
-              case 8: {
-                auto *Dst_d  = reinterpret_cast<uint64_t*>(Tmp);
-                auto *Src1_d = reinterpret_cast<uint64_t*>(Src1);
-                auto *Src2_d = reinterpret_cast<uint64_t*>(Src2);
-                for (unsigned i = 0; i < Elements; ++i) {
-                  Dst_d[i*2] = Src1_d[BaseOffset + i];
-                  Dst_d[i*2+1] = Src2_d[BaseOffset + i];
-                }
-                break;
-              }
-              default: LogMan::Msg::A("Unknown Element Size: %d", Op->Header.ElementSize); break;
-            }
-
-            memcpy(GDP, Tmp, OpSize);
-            break;
-          }
-          case IR::OP_VINSELEMENT: {
-            auto Op = IROp->C<IR::IROp_VInsElement>();
-            void *Src1 = GetSrc<void*>(SSAData, Op->Header.Args[0]);
-            void *Src2 = GetSrc<void*>(SSAData, Op->Header.Args[1]);
-            uint8_t Tmp[16];
-
-            // Copy src1 in to dest
-            memcpy(Tmp, Src1, OpSize);
-            switch (Op->Header.ElementSize) {
-              case 1: {
-                auto *Dst_d  = reinterpret_cast<uint8_t*>(Tmp);
-                auto *Src2_d = reinterpret_cast<uint8_t*>(Src2);
-                Dst_d[Op->DestIdx] = Src2_d[Op->SrcIdx];
-                break;
-              }
-              case 2: {
-                auto *Dst_d  = reinterpret_cast<uint16_t*>(Tmp);
-                auto *Src2_d = reinterpret_cast<uint16_t*>(Src2);
-                Dst_d[Op->DestIdx] = Src2_d[Op->SrcIdx];
-                break;
-              }
-              case 4: {
-                auto *Dst_d  = reinterpret_cast<uint32_t*>(Tmp);
-                auto *Src2_d = reinterpret_cast<uint32_t*>(Src2);
-                Dst_d[Op->DestIdx] = Src2_d[Op->SrcIdx];
-                break;
-              }
-              case 8: {
-                auto *Dst_d  = reinterpret_cast<uint64_t*>(Tmp);
-                auto *Src2_d = reinterpret_cast<uint64_t*>(Src2);
-                Dst_d[Op->DestIdx] = Src2_d[Op->SrcIdx];
-                break;
-              }
-              default: LogMan::Msg::A("Unknown Element Size: %d", Op->Header.ElementSize); break;
-            };
-            memcpy(GDP, Tmp, OpSize);
-            break;
-          }
-          case IR::OP_VINSSCALARELEMENT: {
-            auto Op = IROp->C<IR::IROp_VInsScalarElement>();
-            void *Src1 = GetSrc<void*>(SSAData, Op->Header.Args[0]);
-            void *Src2 = GetSrc<void*>(SSAData, Op->Header.Args[1]);
-            uint8_t Tmp[16];
-
-            // Copy src1 in to dest
-            memcpy(Tmp, Src1, OpSize);
-            switch (Op->Header.ElementSize) {
-              case 1: {
-                auto *Dst_d  = reinterpret_cast<uint8_t*>(Tmp);
-                auto Src2_d = *reinterpret_cast<uint8_t*>(Src2);
-                Dst_d[Op->DestIdx] = Src2_d;
-                break;
-              }
-              case 2: {
-                auto *Dst_d  = reinterpret_cast<uint16_t*>(Tmp);
-                auto Src2_d = *reinterpret_cast<uint16_t*>(Src2);
-                Dst_d[Op->DestIdx] = Src2_d;
-                break;
-              }
-              case 4: {
-                auto *Dst_d  = reinterpret_cast<uint32_t*>(Tmp);
-                auto Src2_d = *reinterpret_cast<uint32_t*>(Src2);
-                Dst_d[Op->DestIdx] = Src2_d;
-                break;
-              }
-              case 8: {
-                auto *Dst_d  = reinterpret_cast<uint64_t*>(Tmp);
-                auto Src2_d = *reinterpret_cast<uint64_t*>(Src2);
-                Dst_d[Op->DestIdx] = Src2_d;
-                break;
-              }
-              default: LogMan::Msg::A("Unknown Element Size: %d", Op->Header.ElementSize); break;
-            };
-            memcpy(GDP, Tmp, OpSize);
-            break;
-          }
+      switch(Op->OffsetType.Val) {
+        case MEM_OFFSET_SXTX.Val: Data +=  Offset; break;
+        case MEM_OFFSET_UXTW.Val: Data += (uint32_t)Offset; break;
+        case MEM_OFFSET_SXTW.Val: Data += (int32_t)Offset; break;
+      }
+    }
+    memcpy(Data, GetSrc<void*>(SSAData, Op->Value), Op->Size);
+    NEXT_OP();
+  }
+  DEF_OP(VSTOREMEMELEMENT): {
+    #define STORE_DATA(x, y) \
+      case x: { \
+        y *Data = *GetSrc<y**>(SSAData, Op->Header.Args[0]); \
+        memcpy(Data, &GetSrc<y*>(SSAData, Op->Header.Args[1])[Op->Index], sizeof(y)); \
+        break; \
+      }
+
+    auto Op = IROp->C<IR::IROp_VStoreMemElement>();
+
+    switch (OpSize) {
+      STORE_DATA(1, uint8_t)
+      STORE_DATA(2, uint16_t)
+      STORE_DATA(4, uint32_t)
+      STORE_DATA(8, uint64_t)
+      default: LogMan::Msg::A("Unhandled StoreMem size"); break;
+    }
+    #undef STORE_DATA
+    NEXT_OP();
+  }
+  #define DO_OP(size, type, func)              \
+    case size: {                                      \
+    auto *Dst_d  = reinterpret_cast<type*>(GDP);  \
+    auto *Src1_d = reinterpret_cast<type*>(Src1); \
+    auto *Src2_d = reinterpret_cast<type*>(Src2); \
+    *Dst_d = func(*Src1_d, *Src2_d);          \
+    break;                                            \
+    }
+
+  DEF_OP(ADD): {
+    auto Op = IROp->C<IR::IROp_Add>();
+    void *Src1 = GetSrc<void*>(SSAData, Op->Header.Args[0]);
+    void *Src2 = GetSrc<void*>(SSAData, Op->Header.Args[1]);
+    auto Func = [](auto a, auto b) { return a + b; };
+
+    switch (OpSize) {
+      DO_OP(4, uint32_t, Func)
+      DO_OP(8, uint64_t, Func)
+      default: LogMan::Msg::A("Unknown Size: %d", OpSize); break;
+    }
+    NEXT_OP();
+  }
+  DEF_OP(SUB): {
+    auto Op = IROp->C<IR::IROp_Sub>();
+    void *Src1 = GetSrc<void*>(SSAData, Op->Header.Args[0]);
+    void *Src2 = GetSrc<void*>(SSAData, Op->Header.Args[1]);
+    auto Func = [](auto a, auto b) { return a - b; };
+
+    switch (OpSize) {
+      DO_OP(4, uint32_t, Func)
+      DO_OP(8, uint64_t, Func)
+      default: LogMan::Msg::A("Unknown Size: %d", OpSize); break;
+    }
+    NEXT_OP();
+  }
+  DEF_OP(NEG): {
+    auto Op = IROp->C<IR::IROp_Neg>();
+    uint64_t Src = *GetSrc<int64_t*>(SSAData, Op->Header.Args[0]);
+    switch (OpSize) {
+      case 4:
+        GD = -static_cast<int32_t>(Src);
+        break;
+      case 8:
+        GD = -static_cast<int64_t>(Src);
+        break;
+      default: LogMan::Msg::A("Unknown NEG Size: %d\n", OpSize); break;
+    };
+    NEXT_OP();
+  }
+  DEF_OP(OR): {
+    auto Op = IROp->C<IR::IROp_Or>();
+    void *Src1 = GetSrc<void*>(SSAData, Op->Header.Args[0]);
+    void *Src2 = GetSrc<void*>(SSAData, Op->Header.Args[1]);
+    auto Func = [](auto a, auto b) { return a | b; };
+
+    switch (OpSize) {
+      DO_OP(1, uint8_t,  Func)
+      DO_OP(2, uint16_t, Func)
+      DO_OP(4, uint32_t, Func)
+      DO_OP(8, uint64_t, Func)
+      DO_OP(16, __uint128_t, Func)
+      default: LogMan::Msg::A("Unknown Size: %d", OpSize); break;
+    }
+    NEXT_OP();
+  }
+  DEF_OP(AND): {
+    auto Op = IROp->C<IR::IROp_And>();
+    void *Src1 = GetSrc<void*>(SSAData, Op->Header.Args[0]);
+    void *Src2 = GetSrc<void*>(SSAData, Op->Header.Args[1]);
+    auto Func = [](auto a, auto b) { return a & b; };
+
+    switch (OpSize) {
+      DO_OP(1, uint8_t,  Func)
+      DO_OP(2, uint16_t, Func)
+      DO_OP(4, uint32_t, Func)
+      DO_OP(8, uint64_t, Func)
+      default: LogMan::Msg::A("Unknown Size: %d", OpSize); break;
+    }
+    NEXT_OP();
+  }
+  DEF_OP(XOR): {
+    auto Op = IROp->C<IR::IROp_Xor>();
+    void *Src1 = GetSrc<void*>(SSAData, Op->Header.Args[0]);
+    void *Src2 = GetSrc<void*>(SSAData, Op->Header.Args[1]);
+    auto Func = [](auto a, auto b) { return a ^ b; };
+
+    switch (OpSize) {
+      DO_OP(1, uint8_t,  Func)
+      DO_OP(2, uint16_t, Func)
+      DO_OP(4, uint32_t, Func)
+      DO_OP(8, uint64_t, Func)
+      default: LogMan::Msg::A("Unknown Size: %d", OpSize); break;
+    }
+    NEXT_OP();
+  }
+  DEF_OP(LSHL): {
+    auto Op = IROp->C<IR::IROp_Lshl>();
+    uint64_t Src1 = *GetSrc<uint64_t*>(SSAData, Op->Header.Args[0]);
+    uint64_t Src2 = *GetSrc<uint64_t*>(SSAData, Op->Header.Args[1]);
+    uint8_t Mask = OpSize * 8 - 1;
+    switch (OpSize) {
+      case 4:
+        GD = static_cast<int32_t>(Src1) << (Src2 & Mask);
+        break;
+      case 8:
+        GD = static_cast<int64_t>(Src1) << (Src2 & Mask);
+        break;
+      default: LogMan::Msg::A("Unknown LSHL Size: %d\n", OpSize); break;
+    };
+    NEXT_OP();
+  }
+  DEF_OP(LSHR): {
+    auto Op = IROp->C<IR::IROp_Lshr>();
+    uint64_t Src1 = *GetSrc<uint64_t*>(SSAData, Op->Header.Args[0]);
+    uint64_t Src2 = *GetSrc<uint64_t*>(SSAData, Op->Header.Args[1]);
+    uint8_t Mask = OpSize * 8 - 1;
+    switch (OpSize) {
+      case 4:
+        GD = static_cast<uint32_t>(Src1) >> (Src2 & Mask);
+        break;
+      case 8:
+        GD = static_cast<uint64_t>(Src1) >> (Src2 & Mask);
+        break;
+      default: LogMan::Msg::A("Unknown LSHR Size: %d\n", OpSize); break;
+    };
+    NEXT_OP();
+  }
+  DEF_OP(ASHR): {
+    auto Op = IROp->C<IR::IROp_Ashr>();
+    uint64_t Src1 = *GetSrc<uint64_t*>(SSAData, Op->Header.Args[0]);
+    uint64_t Src2 = *GetSrc<uint64_t*>(SSAData, Op->Header.Args[1]);
+    uint8_t Mask = OpSize * 8 - 1;
+    switch (OpSize) {
+      case 4:
+        GD = (uint32_t)(static_cast<int32_t>(Src1) >> (Src2 & Mask));
+        break;
+      case 8:
+        GD = (uint64_t)(static_cast<int64_t>(Src1) >> (Src2 & Mask));
+        break;
+      default: LogMan::Msg::A("Unknown ASHR Size: %d\n", OpSize); break;
+    };
+    NEXT_OP();
+  }
+  DEF_OP(ROR): {
+    auto Op = IROp->C<IR::IROp_Ror>();
+    uint64_t Src1 = *GetSrc<uint64_t*>(SSAData, Op->Header.Args[0]);
+    uint64_t Src2 = *GetSrc<uint64_t*>(SSAData, Op->Header.Args[1]);
+    auto Ror = [] (auto In, auto R) {
+    auto RotateMask = sizeof(In) * 8 - 1;
+      R &= RotateMask;
+      return (In >> R) | (In << (sizeof(In) * 8 - R));
+    };
+
+    switch (OpSize) {
+      case 4:
+        GD = Ror(static_cast<uint32_t>(Src1), static_cast<uint32_t>(Src2));
+        break;
+      case 8: {
+        GD = Ror(static_cast<uint64_t>(Src1), static_cast<uint64_t>(Src2));
+        break;
+      }
+      default: LogMan::Msg::A("Unknown ROR Size: %d\n", OpSize); break;
+    }
+    NEXT_OP();
+  }
+  DEF_OP(EXTR): {
+    auto Op = IROp->C<IR::IROp_Extr>();
+    uint64_t Src1 = *GetSrc<uint64_t*>(SSAData, Op->Header.Args[0]);
+    uint64_t Src2 = *GetSrc<uint64_t*>(SSAData, Op->Header.Args[1]);
+    auto Extr = [] (auto Src1, auto Src2, uint8_t lsb) -> decltype(Src1) {
+      __uint128_t Result{};
+      Result = Src1;
+      Result <<= sizeof(Src1) * 8;
+      Result |= Src2;
+      Result >>= lsb;
+      return Result;
+    };
+
+    switch (OpSize) {
+      case 4:
+        GD = Extr(static_cast<uint32_t>(Src1), static_cast<uint32_t>(Src2), Op->LSB);
+        break;
+      case 8: {
+        GD = Extr(static_cast<uint64_t>(Src1), static_cast<uint64_t>(Src2), Op->LSB);
+        break;
+      }
+      default: LogMan::Msg::A("Unknown EXTR Size: %d\n", OpSize); break;
+    }
+    NEXT_OP();
+  }
+  DEF_OP(NOT): {
+    auto Op = IROp->C<IR::IROp_Not>();
+    uint64_t Src = *GetSrc<uint64_t*>(SSAData, Op->Header.Args[0]);
+    const uint64_t mask[9]= { 0, 0xFF, 0xFFFF, 0, 0xFFFFFFFF, 0, 0, 0, 0xFFFFFFFFFFFFFFFFULL };
+    uint64_t Mask = mask[OpSize];
+    GD = (~Src) & Mask;
+    NEXT_OP();
+  }
+  DEF_OP(MUL): {
+    auto Op = IROp->C<IR::IROp_Mul>();
+    uint64_t Src1 = *GetSrc<uint64_t*>(SSAData, Op->Header.Args[0]);
+    uint64_t Src2 = *GetSrc<uint64_t*>(SSAData, Op->Header.Args[1]);
+
+    switch (OpSize) {
+      case 4:
+        GD = static_cast<int64_t>(static_cast<int32_t>(Src1)) * static_cast<int64_t>(static_cast<int32_t>(Src2));
+        break;
+      case 8:
+        GD = static_cast<int64_t>(Src1) * static_cast<int64_t>(Src2);
+        break;
+      case 16: {
+        __int128_t Tmp = static_cast<__int128_t>(static_cast<int64_t>(Src1)) * static_cast<__int128_t>(static_cast<int64_t>(Src2));
+        memcpy(GDP, &Tmp, 16);
+        break;
+      }
+      default: LogMan::Msg::A("Unknown Mul Size: %d\n", OpSize); break;
+    }
+    NEXT_OP();
+  }
+  DEF_OP(MULH): {
+    auto Op = IROp->C<IR::IROp_MulH>();
+    uint64_t Src1 = *GetSrc<uint64_t*>(SSAData, Op->Header.Args[0]);
+    uint64_t Src2 = *GetSrc<uint64_t*>(SSAData, Op->Header.Args[1]);
+
+    switch (OpSize) {
+      case 4: {
+        int64_t Tmp = static_cast<int64_t>(static_cast<int32_t>(Src1)) * static_cast<int64_t>(static_cast<int32_t>(Src2));
+        GD = Tmp >> 32;
+        break;
+      }
+      case 8: {
+        __int128_t Tmp = static_cast<__int128_t>(static_cast<int64_t>(Src1)) * static_cast<__int128_t>(static_cast<int64_t>(Src2));
+        GD = Tmp >> 64;
+      }
+      break;
+      default: LogMan::Msg::A("Unknown MulH Size: %d\n", OpSize); break;
+    }
+    NEXT_OP();
+  }
+  DEF_OP(UMUL): {
+    auto Op = IROp->C<IR::IROp_UMul>();
+    uint64_t Src1 = *GetSrc<uint64_t*>(SSAData, Op->Header.Args[0]);
+    uint64_t Src2 = *GetSrc<uint64_t*>(SSAData, Op->Header.Args[1]);
+
+    switch (OpSize) {
+      case 4:
+        GD = static_cast<uint32_t>(Src1) * static_cast<uint32_t>(Src2);
+        break;
+      case 8:
+        GD = static_cast<uint64_t>(Src1) * static_cast<uint64_t>(Src2);
+        break;
+      case 16: {
+        __uint128_t Tmp = static_cast<__uint128_t>(static_cast<uint64_t>(Src1)) * static_cast<__uint128_t>(static_cast<uint64_t>(Src2));
+        memcpy(GDP, &Tmp, 16);
+        break;
+      }
+      default: LogMan::Msg::A("Unknown UMul Size: %d\n", OpSize); break;
+    }
+    NEXT_OP();
+  }
+  DEF_OP(UMULH): {
+    auto Op = IROp->C<IR::IROp_UMulH>();
+    uint64_t Src1 = *GetSrc<uint64_t*>(SSAData, Op->Header.Args[0]);
+    uint64_t Src2 = *GetSrc<uint64_t*>(SSAData, Op->Header.Args[1]);
+    switch (OpSize) {
+      case 4:
+        GD = static_cast<uint64_t>(Src1) * static_cast<uint64_t>(Src2);
+        GD >>= 32;
+        break;
+      case 8: {
+        __uint128_t Tmp = static_cast<__uint128_t>(Src1) * static_cast<__uint128_t>(Src2);
+        GD = Tmp >> 64;
+        break;
+      }
+      case 16: {
+        // XXX: This is incorrect
+        __uint128_t Tmp = static_cast<__uint128_t>(Src1) * static_cast<__uint128_t>(Src2);
+        GD = Tmp >> 64;
+        break;
+      }
+      default: LogMan::Msg::A("Unknown UMulH Size: %d\n", OpSize); break;
+    }
+    NEXT_OP();
+  }
+  DEF_OP(DIV): {
+    auto Op = IROp->C<IR::IROp_Div>();
+    uint64_t Src1 = *GetSrc<uint64_t*>(SSAData, Op->Header.Args[0]);
+    uint64_t Src2 = *GetSrc<uint64_t*>(SSAData, Op->Header.Args[1]);
+
+    switch (OpSize) {
+      case 1:
+        GD = static_cast<int64_t>(static_cast<int8_t>(Src1)) / static_cast<int64_t>(static_cast<int8_t>(Src2));
+        break;
+      case 2:
+        GD = static_cast<int64_t>(static_cast<int16_t>(Src1)) / static_cast<int64_t>(static_cast<int16_t>(Src2));
+        break;
+      case 4:
+        GD = static_cast<int64_t>(static_cast<int32_t>(Src1)) / static_cast<int64_t>(static_cast<int32_t>(Src2));
+        break;
+      case 8:
+        GD = static_cast<int64_t>(Src1) / static_cast<int64_t>(Src2);
+        break;
+      case 16: {
+        __int128_t Tmp = *GetSrc<__int128_t*>(SSAData, Op->Header.Args[0]) / *GetSrc<__int128_t*>(SSAData, Op->Header.Args[1]);
+        memcpy(GDP, &Tmp, 16);
+        break;
+      }
+      default: LogMan::Msg::A("Unknown Mul Size: %d\n", OpSize); break;
+    }
+    NEXT_OP();
+  }
+  DEF_OP(UDIV): {
+    auto Op = IROp->C<IR::IROp_UDiv>();
+    uint64_t Src1 = *GetSrc<uint64_t*>(SSAData, Op->Header.Args[0]);
+    uint64_t Src2 = *GetSrc<uint64_t*>(SSAData, Op->Header.Args[1]);
+
+    switch (OpSize) {
+      case 1:
+        GD = static_cast<uint64_t>(static_cast<uint8_t>(Src1)) / static_cast<uint64_t>(static_cast<uint8_t>(Src2));
+        break;
+      case 2:
+        GD = static_cast<uint64_t>(static_cast<uint16_t>(Src1)) / static_cast<uint64_t>(static_cast<uint16_t>(Src2));
+        break;
+      case 4:
+        GD = static_cast<uint64_t>(static_cast<uint32_t>(Src1)) / static_cast<uint64_t>(static_cast<uint32_t>(Src2));
+        break;
+      case 8:
+        GD = static_cast<uint64_t>(Src1) / static_cast<uint64_t>(Src2);
+        break;
+      case 16: {
+        __uint128_t Tmp = *GetSrc<__uint128_t*>(SSAData, Op->Header.Args[0]) / *GetSrc<__uint128_t*>(SSAData, Op->Header.Args[1]);
+        memcpy(GDP, &Tmp, 16);
+        break;
+      }
+      default: LogMan::Msg::A("Unknown Mul Size: %d\n", OpSize); break;
+    }
+    NEXT_OP();
+  }
+  DEF_OP(REM): {
+    auto Op = IROp->C<IR::IROp_Rem>();
+    uint64_t Src1 = *GetSrc<uint64_t*>(SSAData, Op->Header.Args[0]);
+    uint64_t Src2 = *GetSrc<uint64_t*>(SSAData, Op->Header.Args[1]);
+
+    switch (OpSize) {
+      case 1:
+        GD = static_cast<int64_t>(static_cast<int8_t>(Src1)) % static_cast<int64_t>(static_cast<int8_t>(Src2));
+        break;
+      case 2:
+        GD = static_cast<int64_t>(static_cast<int16_t>(Src1)) % static_cast<int64_t>(static_cast<int16_t>(Src2));
+        break;
+      case 4:
+        GD = static_cast<int64_t>(static_cast<int32_t>(Src1)) % static_cast<int64_t>(static_cast<int32_t>(Src2));
+        break;
+      case 8:
+        GD = static_cast<int64_t>(Src1) % static_cast<int64_t>(Src2);
+        break;
+      case 16: {
+        __int128_t Tmp = *GetSrc<__int128_t*>(SSAData, Op->Header.Args[0]) % *GetSrc<__int128_t*>(SSAData, Op->Header.Args[1]);
+        memcpy(GDP, &Tmp, 16);
+        break;
+      }
+      default: LogMan::Msg::A("Unknown Mul Size: %d\n", OpSize); break;
+    }
+    NEXT_OP();
+  }
+  DEF_OP(UREM): {
+    auto Op = IROp->C<IR::IROp_URem>();
+    uint64_t Src1 = *GetSrc<uint64_t*>(SSAData, Op->Header.Args[0]);
+    uint64_t Src2 = *GetSrc<uint64_t*>(SSAData, Op->Header.Args[1]);
+
+    switch (OpSize) {
+      case 1:
+        GD = static_cast<uint64_t>(static_cast<uint8_t>(Src1)) % static_cast<uint64_t>(static_cast<uint8_t>(Src2));
+        break;
+      case 2:
+        GD = static_cast<uint64_t>(static_cast<uint16_t>(Src1)) % static_cast<uint64_t>(static_cast<uint16_t>(Src2));
+        break;
+      case 4:
+        GD = static_cast<uint64_t>(static_cast<uint32_t>(Src1)) % static_cast<uint64_t>(static_cast<uint32_t>(Src2));
+        break;
+      case 8:
+        GD = static_cast<uint64_t>(Src1) % static_cast<uint64_t>(Src2);
+        break;
+      case 16: {
+        __uint128_t Tmp = *GetSrc<__uint128_t*>(SSAData, Op->Header.Args[0]) % *GetSrc<__uint128_t*>(SSAData, Op->Header.Args[1]);
+        memcpy(GDP, &Tmp, 16);
+        break;
+      }
+      default: LogMan::Msg::A("Unknown Mul Size: %d\n", OpSize); break;
+    }
+    NEXT_OP();
+  }
+  DEF_OP(POPCOUNT): {
+    auto Op = IROp->C<IR::IROp_Popcount>();
+    uint64_t Src = *GetSrc<uint64_t*>(SSAData, Op->Header.Args[0]);
+    GD = __builtin_popcountl(Src);
+    NEXT_OP();
+  }
+  DEF_OP(FINDLSB): {
+    auto Op = IROp->C<IR::IROp_FindLSB>();
+    uint64_t Src = *GetSrc<uint64_t*>(SSAData, Op->Header.Args[0]);
+    uint64_t Result = __builtin_ffsll(Src);
+    GD = Result - 1;
+    NEXT_OP();
+  }
+  DEF_OP(FINDMSB): {
+    auto Op = IROp->C<IR::IROp_FindMSB>();
+    switch (OpSize) {
+      case 1: GD = ((24 + OpSize * 8) - __builtin_clz(*GetSrc<uint8_t*>(SSAData, Op->Header.Args[0]))) - 1; break;
+      case 2: GD = ((16 + OpSize * 8) - __builtin_clz(*GetSrc<uint16_t*>(SSAData, Op->Header.Args[0]))) - 1; break;
+      case 4: GD = (OpSize * 8 - __builtin_clz(*GetSrc<uint32_t*>(SSAData, Op->Header.Args[0]))) - 1; break;
+      case 8: GD = (OpSize * 8 - __builtin_clzll(*GetSrc<uint64_t*>(SSAData, Op->Header.Args[0]))) - 1; break;
+      default: LogMan::Msg::A("Unknown REV size: %d", OpSize); break;
+    }
+    NEXT_OP();
+  }
+  DEF_OP(REV): {
+    auto Op = IROp->C<IR::IROp_Rev>();
+    switch (OpSize) {
+      case 2: GD = __builtin_bswap16(*GetSrc<uint16_t*>(SSAData, Op->Header.Args[0])); break;
+      case 4: GD = __builtin_bswap32(*GetSrc<uint32_t*>(SSAData, Op->Header.Args[0])); break;
+      case 8: GD = __builtin_bswap64(*GetSrc<uint64_t*>(SSAData, Op->Header.Args[0])); break;
+      default: LogMan::Msg::A("Unknown REV size: %d", OpSize); break;
+    }
+    NEXT_OP();
+  }
+  DEF_OP(FINDTRAILINGZEROS): {
+    auto Op = IROp->C<IR::IROp_FindTrailingZeros>();
+    switch (OpSize) {
+      case 1: {
+        auto Src = *GetSrc<uint8_t*>(SSAData, Op->Header.Args[0]);
+        if (Src)
+          GD = __builtin_ctz(Src);
+        else
+          GD = sizeof(Src) * 8;
+        break;
+      }
+      case 2: {
+        auto Src = *GetSrc<uint16_t*>(SSAData, Op->Header.Args[0]);
+        if (Src)
+          GD = __builtin_ctz(Src);
+        else
+          GD = sizeof(Src) * 8;
+        break;
+      }
+      case 4: {
+        auto Src = *GetSrc<uint32_t*>(SSAData, Op->Header.Args[0]);
+        if (Src)
+          GD = __builtin_ctz(Src);
+        else
+          GD = sizeof(Src) * 8;
+        break;
+      }
+      case 8: {
+        auto Src = *GetSrc<uint64_t*>(SSAData, Op->Header.Args[0]);
+        if (Src)
+          GD = __builtin_ctzll(Src);
+        else
+          GD = sizeof(Src) * 8;
+        break;
+      }
+      default: LogMan::Msg::A("Unknown size: %d", OpSize); break;
+    }
+    NEXT_OP();
+  }
+  DEF_OP(COUNTLEADINGZEROES): {
+    auto Op = IROp->C<IR::IROp_CountLeadingZeroes>();
+    switch (OpSize) {
+      case 1: {
+        uint32_t Src = *GetSrc<uint8_t*>(SSAData, Op->Header.Args[0]);
+        Src <<= 24;
+        if (Src)
+          GD = __builtin_clz(Src);
+        else
+          GD = 8;
+        break;
+      }
+      case 2: {
+        uint32_t Src = *GetSrc<uint16_t*>(SSAData, Op->Header.Args[0]);
+        Src <<= 16;
+        if (Src)
+          GD = __builtin_clz(Src);
+        else
+          GD = 16;
+        break;
+      }
+      case 4: {
+        auto Src = *GetSrc<uint32_t*>(SSAData, Op->Header.Args[0]);
+        if (Src)
+          GD = __builtin_clz(Src);
+        else
+          GD = sizeof(Src) * 8;
+        break;
+      }
+      case 8: {
+        auto Src = *GetSrc<uint64_t*>(SSAData, Op->Header.Args[0]);
+        if (Src)
+          GD = __builtin_clzll(Src);
+        else
+          GD = sizeof(Src) * 8;
+        break;
+      }
+      default: LogMan::Msg::A("Unknown size: %d", OpSize); break;
+    }
+    NEXT_OP();
+  }
+  DEF_OP(BFI): {
+    auto Op = IROp->C<IR::IROp_Bfi>();
+    uint64_t SourceMask = (1ULL << Op->Width) - 1;
+    if (Op->Width == 64)
+      SourceMask = ~0ULL;
+    uint64_t DestMask = ~(SourceMask << Op->lsb);
+    uint64_t Src1 = *GetSrc<uint64_t*>(SSAData, Op->Header.Args[0]);
+    uint64_t Src2 = *GetSrc<uint64_t*>(SSAData, Op->Header.Args[1]);
+    uint64_t Res = (Src1 & DestMask) | ((Src2 & SourceMask) << Op->lsb);
+    GD = Res;
+    NEXT_OP();
+  }
+  DEF_OP(SBFE): {
+    auto Op = IROp->C<IR::IROp_Sbfe>();
+    LogMan::Throw::A(OpSize < 16, "OpSize is too large for BFE: %d", OpSize);
+    int64_t Src = *GetSrc<int64_t*>(SSAData, Op->Header.Args[0]);
+    uint64_t ShiftLeftAmount = (64 - (Op->Width + Op->lsb));
+    uint64_t ShiftRightAmount = ShiftLeftAmount + Op->lsb;
+    Src <<= ShiftLeftAmount;
+    Src >>= ShiftRightAmount;
+    GD = Src;
+    NEXT_OP();
+  }
+  DEF_OP(BFE): {
+    auto Op = IROp->C<IR::IROp_Bfe>();
+    LogMan::Throw::A(OpSize <= 8, "OpSize is too large for BFE: %d", OpSize);
+    uint64_t SourceMask = (1ULL << Op->Width) - 1;
+    if (Op->Width == 64)
+      SourceMask = ~0ULL;
+    SourceMask <<= Op->lsb;
+    uint64_t Src = *GetSrc<uint64_t*>(SSAData, Op->Header.Args[0]);
+    GD = (Src & SourceMask) >> Op->lsb;
+    NEXT_OP();
+  }
+  DEF_OP(SELECT): {
+    auto Op = IROp->C<IR::IROp_Select>();
+
+    uint64_t Src1 = *GetSrc<uint64_t*>(SSAData, Op->Header.Args[0]);
+    uint64_t Src2 = *GetSrc<uint64_t*>(SSAData, Op->Header.Args[1]);
+
+    uint64_t ArgTrue;
+    uint64_t ArgFalse;
+
+    if (OpSize == 4) {
+      ArgTrue = *GetSrc<uint32_t*>(SSAData, Op->Header.Args[2]);
+      ArgFalse = *GetSrc<uint32_t*>(SSAData, Op->Header.Args[3]);
+    } else {
+      ArgTrue = *GetSrc<uint64_t*>(SSAData, Op->Header.Args[2]);
+      ArgFalse = *GetSrc<uint64_t*>(SSAData, Op->Header.Args[3]);
+    }
+
+    bool CompResult;
+
+    if (Op->CompareSize == 4)
+      CompResult = IsConditionTrue<uint32_t, int32_t, float>(Op->Cond.Val, Src1, Src2);
+    else
+      CompResult = IsConditionTrue<uint64_t, int64_t, double>(Op->Cond.Val, Src1, Src2);
+
+    GD = CompResult ? ArgTrue : ArgFalse;
+    NEXT_OP();
+  }
+  DEF_OP(CAS): {
+    auto Op = IROp->C<IR::IROp_CAS>();
+    auto Size = OpSize;
+    switch (Size) {
+      case 1: {
+        std::atomic<uint8_t> *Data = *GetSrc<std::atomic<uint8_t> **>(SSAData, Op->Header.Args[2]);
+
+        uint8_t Src1 = *GetSrc<uint8_t*>(SSAData, Op->Header.Args[0]);
+        uint8_t Src2 = *GetSrc<uint8_t*>(SSAData, Op->Header.Args[1]);
+
+        uint8_t Expected = Src1;
+        bool Result = Data->compare_exchange_strong(Expected, Src2);
+        GD = Result ? Src1 : Expected;
+        break;
+      }
+      case 2: {
+        std::atomic<uint16_t> *Data = *GetSrc<std::atomic<uint16_t> **>(SSAData, Op->Header.Args[2]);
+        uint16_t Src1 = *GetSrc<uint16_t*>(SSAData, Op->Header.Args[0]);
+        uint16_t Src2 = *GetSrc<uint16_t*>(SSAData, Op->Header.Args[1]);
+
+        uint16_t Expected = Src1;
+        bool Result = Data->compare_exchange_strong(Expected, Src2);
+        GD = Result ? Src1 : Expected;
+        break;
+      }
+      case 4: {
+        std::atomic<uint32_t> *Data = *GetSrc<std::atomic<uint32_t> **>(SSAData, Op->Header.Args[2]);
+
+        uint32_t Src1 = *GetSrc<uint32_t*>(SSAData, Op->Header.Args[0]);
+        uint32_t Src2 = *GetSrc<uint32_t*>(SSAData, Op->Header.Args[1]);
+
+        uint32_t Expected = Src1;
+        bool Result = Data->compare_exchange_strong(Expected, Src2);
+        GD = Result ? Src1 : Expected;
+        break;
+      }
+      case 8: {
+        std::atomic<uint64_t> *Data = *GetSrc<std::atomic<uint64_t> **>(SSAData, Op->Header.Args[2]);
+
+        uint64_t Src1 = *GetSrc<uint64_t*>(SSAData, Op->Header.Args[0]);
+        uint64_t Src2 = *GetSrc<uint64_t*>(SSAData, Op->Header.Args[1]);
+
+        uint64_t Expected = Src1;
+        bool Result = Data->compare_exchange_strong(Expected, Src2);
+        GD = Result ? Src1 : Expected;
+        break;
+      }
+      default: LogMan::Msg::A("Unknown CAS size: %d", Size); break;
+    }
+    NEXT_OP();
+  }
+  DEF_OP(ATOMICADD): {
+    auto Op = IROp->C<IR::IROp_AtomicAdd>();
+    switch (Op->Size) {
+      case 1: {
+        std::atomic<uint8_t> *Data = *GetSrc<std::atomic<uint8_t> **>(SSAData, Op->Header.Args[0]);
+        uint8_t Src = *GetSrc<uint8_t*>(SSAData, Op->Header.Args[1]);
+        *Data += Src;
+        break;
+      }
+      case 2: {
+        std::atomic<uint16_t> *Data = *GetSrc<std::atomic<uint16_t> **>(SSAData, Op->Header.Args[0]);
+        uint16_t Src = *GetSrc<uint16_t*>(SSAData, Op->Header.Args[1]);
+        *Data += Src;
+        break;
+      }
+      case 4: {
+        std::atomic<uint32_t> *Data = *GetSrc<std::atomic<uint32_t> **>(SSAData, Op->Header.Args[0]);
+        uint32_t Src = *GetSrc<uint32_t*>(SSAData, Op->Header.Args[1]);
+        *Data += Src;
+        break;
+      }
+      case 8: {
+        std::atomic<uint64_t> *Data = *GetSrc<std::atomic<uint64_t> **>(SSAData, Op->Header.Args[0]);
+        uint64_t Src = *GetSrc<uint64_t*>(SSAData, Op->Header.Args[1]);
+        *Data += Src;
+        break;
+      }
+      default:  LogMan::Msg::A("Unhandled Atomic size: %d", Op->Size);
+    }
+    NEXT_OP();
+  }
+  DEF_OP(ATOMICSUB): {
+    auto Op = IROp->C<IR::IROp_AtomicSub>();
+    switch (Op->Size) {
+      case 1: {
+        std::atomic<uint8_t> *Data = *GetSrc<std::atomic<uint8_t> **>(SSAData, Op->Header.Args[0]);
+        uint8_t Src = *GetSrc<uint8_t*>(SSAData, Op->Header.Args[1]);
+        *Data -= Src;
+        break;
+      }
+      case 2: {
+        std::atomic<uint16_t> *Data = *GetSrc<std::atomic<uint16_t> **>(SSAData, Op->Header.Args[0]);
+        uint16_t Src = *GetSrc<uint16_t*>(SSAData, Op->Header.Args[1]);
+        *Data -= Src;
+        break;
+      }
+      case 4: {
+        std::atomic<uint32_t> *Data = *GetSrc<std::atomic<uint32_t> **>(SSAData, Op->Header.Args[0]);
+        uint32_t Src = *GetSrc<uint32_t*>(SSAData, Op->Header.Args[1]);
+        *Data -= Src;
+        break;
+      }
+      case 8: {
+        std::atomic<uint64_t> *Data = *GetSrc<std::atomic<uint64_t> **>(SSAData, Op->Header.Args[0]);
+        uint64_t Src = *GetSrc<uint64_t*>(SSAData, Op->Header.Args[1]);
+        *Data -= Src;
+        break;
+      }
+      default:  LogMan::Msg::A("Unhandled Atomic size: %d", Op->Size);
+    }
+    NEXT_OP();
+  }
+  DEF_OP(ATOMICAND): {
+    auto Op = IROp->C<IR::IROp_AtomicAnd>();
+    switch (Op->Size) {
+      case 1: {
+        std::atomic<uint8_t> *Data = *GetSrc<std::atomic<uint8_t> **>(SSAData, Op->Header.Args[0]);
+        uint8_t Src = *GetSrc<uint8_t*>(SSAData, Op->Header.Args[1]);
+        *Data &= Src;
+        break;
+      }
+      case 2: {
+        std::atomic<uint16_t> *Data = *GetSrc<std::atomic<uint16_t> **>(SSAData, Op->Header.Args[0]);
+        uint16_t Src = *GetSrc<uint16_t*>(SSAData, Op->Header.Args[1]);
+        *Data &= Src;
+        break;
+      }
+      case 4: {
+        std::atomic<uint32_t> *Data = *GetSrc<std::atomic<uint32_t> **>(SSAData, Op->Header.Args[0]);
+        uint32_t Src = *GetSrc<uint32_t*>(SSAData, Op->Header.Args[1]);
+        *Data &= Src;
+        break;
+      }
+      case 8: {
+        std::atomic<uint64_t> *Data = *GetSrc<std::atomic<uint64_t> **>(SSAData, Op->Header.Args[0]);
+        uint64_t Src = *GetSrc<uint64_t*>(SSAData, Op->Header.Args[1]);
+        *Data &= Src;
+        break;
+      }
+      default:  LogMan::Msg::A("Unhandled Atomic size: %d", Op->Size);
+    }
+    NEXT_OP();
+  }
+  DEF_OP(ATOMICOR): {
+    auto Op = IROp->C<IR::IROp_AtomicOr>();
+    switch (Op->Size) {
+      case 1: {
+        std::atomic<uint8_t> *Data = *GetSrc<std::atomic<uint8_t> **>(SSAData, Op->Header.Args[0]);
+        uint8_t Src = *GetSrc<uint8_t*>(SSAData, Op->Header.Args[1]);
+        *Data |= Src;
+        break;
+      }
+      case 2: {
+        std::atomic<uint16_t> *Data = *GetSrc<std::atomic<uint16_t> **>(SSAData, Op->Header.Args[0]);
+        uint16_t Src = *GetSrc<uint16_t*>(SSAData, Op->Header.Args[1]);
+        *Data |= Src;
+        break;
+      }
+      case 4: {
+        std::atomic<uint32_t> *Data = *GetSrc<std::atomic<uint32_t> **>(SSAData, Op->Header.Args[0]);
+        uint32_t Src = *GetSrc<uint32_t*>(SSAData, Op->Header.Args[1]);
+        *Data |= Src;
+        break;
+      }
+      case 8: {
+        std::atomic<uint64_t> *Data = *GetSrc<std::atomic<uint64_t> **>(SSAData, Op->Header.Args[0]);
+        uint64_t Src = *GetSrc<uint64_t*>(SSAData, Op->Header.Args[1]);
+        *Data |= Src;
+        break;
+      }
+      default:  LogMan::Msg::A("Unhandled Atomic size: %d", Op->Size);
+    }
+    NEXT_OP();
+  }
+  DEF_OP(ATOMICXOR): {
+    auto Op = IROp->C<IR::IROp_AtomicXor>();
+    switch (Op->Size) {
+      case 1: {
+        std::atomic<uint8_t> *Data = *GetSrc<std::atomic<uint8_t> **>(SSAData, Op->Header.Args[0]);
+        uint8_t Src = *GetSrc<uint8_t*>(SSAData, Op->Header.Args[1]);
+        *Data ^= Src;
+        break;
+      }
+      case 2: {
+        std::atomic<uint16_t> *Data = *GetSrc<std::atomic<uint16_t> **>(SSAData, Op->Header.Args[0]);
+        uint16_t Src = *GetSrc<uint16_t*>(SSAData, Op->Header.Args[1]);
+        *Data ^= Src;
+        break;
+      }
+      case 4: {
+        std::atomic<uint32_t> *Data = *GetSrc<std::atomic<uint32_t> **>(SSAData, Op->Header.Args[0]);
+        uint32_t Src = *GetSrc<uint32_t*>(SSAData, Op->Header.Args[1]);
+        *Data ^= Src;
+        break;
+      }
+      case 8: {
+        std::atomic<uint64_t> *Data = *GetSrc<std::atomic<uint64_t> **>(SSAData, Op->Header.Args[0]);
+        uint64_t Src = *GetSrc<uint64_t*>(SSAData, Op->Header.Args[1]);
+        *Data ^= Src;
+        break;
+      }
+      default:  LogMan::Msg::A("Unhandled Atomic size: %d", Op->Size);
+    }
+    NEXT_OP();
+  }
+  DEF_OP(ATOMICSWAP): {
+    auto Op = IROp->C<IR::IROp_AtomicSwap>();
+    switch (Op->Size) {
+      case 1: {
+        std::atomic<uint8_t> *Data = *GetSrc<std::atomic<uint8_t> **>(SSAData, Op->Header.Args[0]);
+        uint8_t Src = *GetSrc<uint8_t*>(SSAData, Op->Header.Args[1]);
+        uint8_t Previous = Data->exchange(Src);
+        GD = Previous;
+        break;
+      }
+      case 2: {
+        std::atomic<uint16_t> *Data = *GetSrc<std::atomic<uint16_t> **>(SSAData, Op->Header.Args[0]);
+        uint16_t Src = *GetSrc<uint16_t*>(SSAData, Op->Header.Args[1]);
+        uint16_t Previous = Data->exchange(Src);
+        GD = Previous;
+        break;
+      }
+      case 4: {
+        std::atomic<uint32_t> *Data = *GetSrc<std::atomic<uint32_t> **>(SSAData, Op->Header.Args[0]);
+        uint32_t Src = *GetSrc<uint32_t*>(SSAData, Op->Header.Args[1]);
+        uint32_t Previous = Data->exchange(Src);
+        GD = Previous;
+        break;
+      }
+      case 8: {
+        std::atomic<uint64_t> *Data = *GetSrc<std::atomic<uint64_t> **>(SSAData, Op->Header.Args[0]);
+        uint64_t Src = *GetSrc<uint64_t*>(SSAData, Op->Header.Args[1]);
+        uint64_t Previous = Data->exchange(Src);
+        GD = Previous;
+        break;
+      }
+      default:  LogMan::Msg::A("Unhandled Atomic size: %d", Op->Size);
+    }
+    NEXT_OP();
+  }
+  DEF_OP(ATOMICFETCHADD): {
+    auto Op = IROp->C<IR::IROp_AtomicFetchAdd>();
+    switch (Op->Size) {
+      case 1: {
+        std::atomic<uint8_t> *Data = *GetSrc<std::atomic<uint8_t> **>(SSAData, Op->Header.Args[0]);
+        uint8_t Src = *GetSrc<uint8_t*>(SSAData, Op->Header.Args[1]);
+        uint8_t Previous = Data->fetch_add(Src);
+        GD = Previous;
+        break;
+      }
+      case 2: {
+        std::atomic<uint16_t> *Data = *GetSrc<std::atomic<uint16_t> **>(SSAData, Op->Header.Args[0]);
+        uint16_t Src = *GetSrc<uint16_t*>(SSAData, Op->Header.Args[1]);
+        uint16_t Previous = Data->fetch_add(Src);
+        GD = Previous;
+        break;
+      }
+      case 4: {
+        std::atomic<uint32_t> *Data = *GetSrc<std::atomic<uint32_t> **>(SSAData, Op->Header.Args[0]);
+        uint32_t Src = *GetSrc<uint32_t*>(SSAData, Op->Header.Args[1]);
+        uint32_t Previous = Data->fetch_add(Src);
+        GD = Previous;
+        break;
+      }
+      case 8: {
+        std::atomic<uint64_t> *Data = *GetSrc<std::atomic<uint64_t> **>(SSAData, Op->Header.Args[0]);
+        uint64_t Src = *GetSrc<uint64_t*>(SSAData, Op->Header.Args[1]);
+        uint64_t Previous = Data->fetch_add(Src);
+        GD = Previous;
+        break;
+      }
+      default:  LogMan::Msg::A("Unhandled Atomic size: %d", Op->Size);
+    }
+    NEXT_OP();
+  }
+  DEF_OP(ATOMICFETCHSUB): {
+    auto Op = IROp->C<IR::IROp_AtomicFetchSub>();
+    switch (Op->Size) {
+      case 1: {
+        std::atomic<uint8_t> *Data = *GetSrc<std::atomic<uint8_t> **>(SSAData, Op->Header.Args[0]);
+        uint8_t Src = *GetSrc<uint8_t*>(SSAData, Op->Header.Args[1]);
+        uint8_t Previous = Data->fetch_sub(Src);
+        GD = Previous;
+        break;
+      }
+      case 2: {
+        std::atomic<uint16_t> *Data = *GetSrc<std::atomic<uint16_t> **>(SSAData, Op->Header.Args[0]);
+        uint16_t Src = *GetSrc<uint16_t*>(SSAData, Op->Header.Args[1]);
+        uint16_t Previous = Data->fetch_sub(Src);
+        GD = Previous;
+        break;
+      }
+      case 4: {
+        std::atomic<uint32_t> *Data = *GetSrc<std::atomic<uint32_t> **>(SSAData, Op->Header.Args[0]);
+        uint32_t Src = *GetSrc<uint32_t*>(SSAData, Op->Header.Args[1]);
+        uint32_t Previous = Data->fetch_sub(Src);
+        GD = Previous;
+        break;
+      }
+      case 8: {
+        std::atomic<uint64_t> *Data = *GetSrc<std::atomic<uint64_t> **>(SSAData, Op->Header.Args[0]);
+        uint64_t Src = *GetSrc<uint64_t*>(SSAData, Op->Header.Args[1]);
+        uint64_t Previous = Data->fetch_sub(Src);
+        GD = Previous;
+        break;
+      }
+      default:  LogMan::Msg::A("Unhandled Atomic size: %d", Op->Size);
+    }
+    NEXT_OP();
+  }
+  DEF_OP(ATOMICFETCHAND): {
+    auto Op = IROp->C<IR::IROp_AtomicFetchAnd>();
+    switch (Op->Size) {
+      case 1: {
+        std::atomic<uint8_t> *Data = *GetSrc<std::atomic<uint8_t> **>(SSAData, Op->Header.Args[0]);
+        uint8_t Src = *GetSrc<uint8_t*>(SSAData, Op->Header.Args[1]);
+        uint8_t Previous = Data->fetch_and(Src);
+        GD = Previous;
+        break;
+      }
+      case 2: {
+        std::atomic<uint16_t> *Data = *GetSrc<std::atomic<uint16_t> **>(SSAData, Op->Header.Args[0]);
+        uint16_t Src = *GetSrc<uint16_t*>(SSAData, Op->Header.Args[1]);
+        uint16_t Previous = Data->fetch_and(Src);
+        GD = Previous;
+        break;
+      }
+      case 4: {
+        std::atomic<uint32_t> *Data = *GetSrc<std::atomic<uint32_t> **>(SSAData, Op->Header.Args[0]);
+        uint32_t Src = *GetSrc<uint32_t*>(SSAData, Op->Header.Args[1]);
+        uint32_t Previous = Data->fetch_and(Src);
+        GD = Previous;
+        break;
+      }
+      case 8: {
+        std::atomic<uint64_t> *Data = *GetSrc<std::atomic<uint64_t> **>(SSAData, Op->Header.Args[0]);
+        uint64_t Src = *GetSrc<uint64_t*>(SSAData, Op->Header.Args[1]);
+        uint64_t Previous = Data->fetch_and(Src);
+        GD = Previous;
+        break;
+      }
+      default:  LogMan::Msg::A("Unhandled Atomic size: %d", Op->Size);
+    }
+    NEXT_OP();
+  }
+  DEF_OP(ATOMICFETCHOR): {
+    auto Op = IROp->C<IR::IROp_AtomicFetchOr>();
+    switch (Op->Size) {
+      case 1: {
+        std::atomic<uint8_t> *Data = *GetSrc<std::atomic<uint8_t> **>(SSAData, Op->Header.Args[0]);
+        uint8_t Src = *GetSrc<uint8_t*>(SSAData, Op->Header.Args[1]);
+        uint8_t Previous = Data->fetch_or(Src);
+        GD = Previous;
+        break;
+      }
+      case 2: {
+        std::atomic<uint16_t> *Data = *GetSrc<std::atomic<uint16_t> **>(SSAData, Op->Header.Args[0]);
+        uint16_t Src = *GetSrc<uint16_t*>(SSAData, Op->Header.Args[1]);
+        uint16_t Previous = Data->fetch_or(Src);
+        GD = Previous;
+        break;
+      }
+      case 4: {
+        std::atomic<uint32_t> *Data = *GetSrc<std::atomic<uint32_t> **>(SSAData, Op->Header.Args[0]);
+        uint32_t Src = *GetSrc<uint32_t*>(SSAData, Op->Header.Args[1]);
+        uint32_t Previous = Data->fetch_or(Src);
+        GD = Previous;
+        break;
+      }
+      case 8: {
+        std::atomic<uint64_t> *Data = *GetSrc<std::atomic<uint64_t> **>(SSAData, Op->Header.Args[0]);
+        uint64_t Src = *GetSrc<uint64_t*>(SSAData, Op->Header.Args[1]);
+        uint64_t Previous = Data->fetch_or(Src);
+        GD = Previous;
+        break;
+      }
+      default:  LogMan::Msg::A("Unhandled Atomic size: %d", Op->Size);
+    }
+    NEXT_OP();
+  }
+  DEF_OP(ATOMICFETCHXOR): {
+    auto Op = IROp->C<IR::IROp_AtomicFetchXor>();
+    switch (Op->Size) {
+      case 1: {
+        std::atomic<uint8_t> *Data = *GetSrc<std::atomic<uint8_t> **>(SSAData, Op->Header.Args[0]);
+        uint8_t Src = *GetSrc<uint8_t*>(SSAData, Op->Header.Args[1]);
+        uint8_t Previous = Data->fetch_xor(Src);
+        GD = Previous;
+        break;
+      }
+      case 2: {
+        std::atomic<uint16_t> *Data = *GetSrc<std::atomic<uint16_t> **>(SSAData, Op->Header.Args[0]);
+        uint16_t Src = *GetSrc<uint16_t*>(SSAData, Op->Header.Args[1]);
+        uint16_t Previous = Data->fetch_xor(Src);
+        GD = Previous;
+        break;
+      }
+      case 4: {
+        std::atomic<uint32_t> *Data = *GetSrc<std::atomic<uint32_t> **>(SSAData, Op->Header.Args[0]);
+        uint32_t Src = *GetSrc<uint32_t*>(SSAData, Op->Header.Args[1]);
+        uint32_t Previous = Data->fetch_xor(Src);
+        GD = Previous;
+        break;
+      }
+      case 8: {
+        std::atomic<uint64_t> *Data = *GetSrc<std::atomic<uint64_t> **>(SSAData, Op->Header.Args[0]);
+        uint64_t Src = *GetSrc<uint64_t*>(SSAData, Op->Header.Args[1]);
+        uint64_t Previous = Data->fetch_xor(Src);
+        GD = Previous;
+        break;
+      }
+      default:  LogMan::Msg::A("Unhandled Atomic size: %d", Op->Size);
+    }
+    NEXT_OP();
+  }
+  // Vector ops
+  DEF_OP(CREATEVECTOR2): {
+    auto Op = IROp->C<IR::IROp_CreateVector2>();
+    LogMan::Throw::A(OpSize <= 16, "Can't handle a vector of size: %d", OpSize);
+    void *Src1 = GetSrc<void*>(SSAData, Op->Header.Args[0]);
+    void *Src2 = GetSrc<void*>(SSAData, Op->Header.Args[1]);
+    uint8_t Tmp[16];
+    uint8_t ElementSize = OpSize / 2;
+    #define CREATE_VECTOR(elementsize, type) \
+      case elementsize: { \
+        auto *Dst_d = reinterpret_cast<type*>(Tmp); \
+        auto *Src1_d = reinterpret_cast<type*>(Src1); \
+        auto *Src2_d = reinterpret_cast<type*>(Src2); \
+        Dst_d[0] = *Src1_d; \
+        Dst_d[1] = *Src2_d; \
+        break; \
+      }
+    switch (ElementSize) {
+      CREATE_VECTOR(1, uint8_t)
+      CREATE_VECTOR(2, uint16_t)
+      CREATE_VECTOR(4, uint32_t)
+      CREATE_VECTOR(8, uint64_t)
+      default: LogMan::Msg::A("Unknown Element Size: %d", ElementSize); break;
+    }
+    #undef CREATE_VECTOR
+    memcpy(GDP, Tmp, OpSize);
+
+    NEXT_OP();
+  }
+  DEF_OP(SPLATVECTOR4):
+  DEF_OP(SPLATVECTOR2): {
+    auto Op = IROp->C<IR::IROp_SplatVector2>();
+    LogMan::Throw::A(OpSize <= 16, "Can't handle a vector of size: %d", OpSize);
+    void *Src = GetSrc<void*>(SSAData, Op->Header.Args[0]);
+    uint8_t Tmp[16];
+    uint8_t Elements = 0;
+
+    switch (Op->Header.Op) {
+      case IR::OP_SPLATVECTOR4: Elements = 4; break;
+      case IR::OP_SPLATVECTOR2: Elements = 2; break;
+      default: LogMan::Msg::A("Uknown Splat size"); break;
+    }
+
+    #define CREATE_VECTOR(elementsize, type) \
+      case elementsize: { \
+        auto *Dst_d = reinterpret_cast<type*>(Tmp); \
+        auto *Src_d = reinterpret_cast<type*>(Src); \
+        for (uint8_t i = 0; i < Elements; ++i) \
+          Dst_d[i] = *Src_d;\
+        break; \
+      }
+    uint8_t ElementSize = OpSize / Elements;
+    switch (ElementSize) {
+      CREATE_VECTOR(1, uint8_t)
+      CREATE_VECTOR(2, uint16_t)
+      CREATE_VECTOR(4, uint32_t)
+      CREATE_VECTOR(8, uint64_t)
+      default: LogMan::Msg::A("Unknown Element Size: %d", Op->Header.Size); break;
+    }
+    #undef CREATE_VECTOR
+    memcpy(GDP, Tmp, OpSize);
+
+    NEXT_OP();
+  }
+  DEF_OP(VMOV): {
+    auto Op = IROp->C<IR::IROp_VMov>();
+    __uint128_t Src = *GetSrc<__uint128_t*>(SSAData, Op->Header.Args[0]);
+
+    memcpy(GDP, &Src, OpSize);
+    NEXT_OP();
+  }
+  DEF_OP(VOR): {
+    auto Op = IROp->C<IR::IROp_VOr>();
+    __uint128_t Src1 = *GetSrc<__uint128_t*>(SSAData, Op->Header.Args[0]);
+    __uint128_t Src2 = *GetSrc<__uint128_t*>(SSAData, Op->Header.Args[1]);
+
+    __uint128_t Dst = Src1 | Src2;
+    memcpy(GDP, &Dst, 16);
+    NEXT_OP();
+  }
+  DEF_OP(VAND): {
+    auto Op = IROp->C<IR::IROp_VAnd>();
+    __uint128_t Src1 = *GetSrc<__uint128_t*>(SSAData, Op->Header.Args[0]);
+    __uint128_t Src2 = *GetSrc<__uint128_t*>(SSAData, Op->Header.Args[1]);
+
+    __uint128_t Dst = Src1 & Src2;
+    memcpy(GDP, &Dst, 16);
+    NEXT_OP();
+  }
+  DEF_OP(VXOR): {
+    auto Op = IROp->C<IR::IROp_VXor>();
+    __uint128_t Src1 = *GetSrc<__uint128_t*>(SSAData, Op->Header.Args[0]);
+    __uint128_t Src2 = *GetSrc<__uint128_t*>(SSAData, Op->Header.Args[1]);
+
+    __uint128_t Dst = Src1 ^ Src2;
+    memcpy(GDP, &Dst, 16);
+    NEXT_OP();
+  }
+  DEF_OP(VSLI): {
+    auto Op = IROp->C<IR::IROp_VSLI>();
+    __uint128_t Src1 = *GetSrc<__uint128_t*>(SSAData, Op->Header.Args[0]);
+    __uint128_t Src2 = Op->ByteShift * 8;
+
+    __uint128_t Dst = Op->ByteShift >= sizeof(__uint128_t) ? 0 : Src1 << Src2;
+    memcpy(GDP, &Dst, 16);
+    NEXT_OP();
+  }
+  DEF_OP(VSRI): {
+    auto Op = IROp->C<IR::IROp_VSRI>();
+    __uint128_t Src1 = *GetSrc<__uint128_t*>(SSAData, Op->Header.Args[0]);
+    __uint128_t Src2 = Op->ByteShift * 8;
+
+    __uint128_t Dst = Op->ByteShift >= sizeof(__uint128_t) ? 0 : Src1 >> Src2;
+    memcpy(GDP, &Dst, 16);
+    NEXT_OP();
+  }
+  DEF_OP(VNOT): {
+    auto Op = IROp->C<IR::IROp_VNot>();
+    __uint128_t Src1 = *GetSrc<__uint128_t*>(SSAData, Op->Header.Args[0]);
+
+    __uint128_t Dst = ~Src1;
+    memcpy(GDP, &Dst, 16);
+    NEXT_OP();
+  }
+  #define DO_VECTOR_OP(size, type, func)              \
+    case size: {                                      \
+    auto *Dst_d  = reinterpret_cast<type*>(Tmp);  \
+    auto *Src1_d = reinterpret_cast<type*>(Src1); \
+    auto *Src2_d = reinterpret_cast<type*>(Src2); \
+    for (uint8_t i = 0; i < Elements; ++i) {          \
+      Dst_d[i] = func(Src1_d[i], Src2_d[i]);          \
+    }                                                 \
+    break;                                            \
+    }
+  #define DO_VECTOR_PAIR_OP(size, type, func)              \
+    case size: {                                      \
+    auto *Dst_d  = reinterpret_cast<type*>(Tmp);  \
+    auto *Src1_d = reinterpret_cast<type*>(Src1); \
+    auto *Src2_d = reinterpret_cast<type*>(Src2); \
+    for (uint8_t i = 0; i < Elements; ++i) {          \
+      Dst_d[i] = func(Src1_d[i*2], Src1_d[i*2 + 1]);          \
+      Dst_d[i+Elements] = func(Src2_d[i*2], Src2_d[i*2 + 1]);          \
+    }                                                 \
+    break;                                            \
+    }
+  #define DO_VECTOR_SCALAR_OP(size, type, func)\
+    case size: {                                      \
+    auto *Dst_d  = reinterpret_cast<type*>(Tmp);  \
+    auto *Src1_d = reinterpret_cast<type*>(Src1); \
+    auto *Src2_d = reinterpret_cast<type*>(Src2); \
+    for (uint8_t i = 0; i < Elements; ++i) {          \
+      Dst_d[i] = func(Src1_d[i], *Src2_d);          \
+    }                                                 \
+    break;                                            \
+    }
+  #define DO_VECTOR_0SRC_OP(size, type, func)              \
+    case size: {                                      \
+    auto *Dst_d  = reinterpret_cast<type*>(Tmp);  \
+    for (uint8_t i = 0; i < Elements; ++i) {          \
+      Dst_d[i] = func();          \
+    }                                                 \
+    break;                                            \
+    }
+  #define DO_VECTOR_1SRC_OP(size, type, func)              \
+    case size: {                                      \
+    auto *Dst_d  = reinterpret_cast<type*>(Tmp);  \
+    auto *Src_d = reinterpret_cast<type*>(Src); \
+    for (uint8_t i = 0; i < Elements; ++i) {          \
+      Dst_d[i] = func(Src_d[i]);          \
+    }                                                 \
+    break;                                            \
+    }
+  #define DO_VECTOR_REDUCE_1SRC_OP(size, type, func, start_val)              \
+    case size: {                                      \
+    auto *Dst_d  = reinterpret_cast<type*>(Tmp);  \
+    auto *Src_d = reinterpret_cast<type*>(Src); \
+    type begin = start_val;                           \
+    for (uint8_t i = 0; i < Elements; ++i) {          \
+      begin = func(begin, Src_d[i]);          \
+    }                                                 \
+    Dst_d[0] = begin;                                 \
+    break;                                            \
+    }
+  #define DO_VECTOR_SAT_OP(size, type, func, min, max)              \
+    case size: {                                      \
+    auto *Dst_d  = reinterpret_cast<type*>(Tmp);  \
+    auto *Src1_d = reinterpret_cast<type*>(Src1); \
+    auto *Src2_d = reinterpret_cast<type*>(Src2); \
+    for (uint8_t i = 0; i < Elements; ++i) {          \
+      Dst_d[i] = func(Src1_d[i], Src2_d[i], min, max);          \
+    }                                                 \
+    break;                                            \
+    }
+  DEF_OP(VECTORIMM): {
+    auto Op = IROp->C<IR::IROp_VectorImm>();
+    uint8_t Tmp[16];
+
+    uint8_t Elements = OpSize / Op->Header.ElementSize;
+    uint8_t Imm = Op->Immediate;
+
+    auto Func = [Imm]() { return Imm; };
+    switch (Op->Header.ElementSize) {
+      DO_VECTOR_0SRC_OP(1, int8_t, Func)
+      DO_VECTOR_0SRC_OP(2, int16_t, Func)
+      DO_VECTOR_0SRC_OP(4, int32_t, Func)
+      DO_VECTOR_0SRC_OP(8, int64_t, Func)
+      default: LogMan::Msg::A("Unknown Element Size: %d", Op->Header.ElementSize); break;
+    }
+    memcpy(GDP, Tmp, OpSize);
+    NEXT_OP();
+  }
+  DEF_OP(VNEG): {
+    auto Op = IROp->C<IR::IROp_VNeg>();
+    void *Src = GetSrc<void*>(SSAData, Op->Header.Args[0]);
+    uint8_t Tmp[16];
+
+    uint8_t Elements = OpSize / Op->Header.ElementSize;
+
+    auto Func = [](auto a) { return -a; };
+    switch (Op->Header.ElementSize) {
+      DO_VECTOR_1SRC_OP(1, int8_t, Func)
+      DO_VECTOR_1SRC_OP(2, int16_t, Func)
+      DO_VECTOR_1SRC_OP(4, int32_t, Func)
+      DO_VECTOR_1SRC_OP(8, int64_t, Func)
+      default: LogMan::Msg::A("Unknown Element Size: %d", Op->Header.ElementSize); break;
+    }
+    memcpy(GDP, Tmp, OpSize);
+    NEXT_OP();
+  }
+  DEF_OP(VFNEG): {
+    auto Op = IROp->C<IR::IROp_VFNeg>();
+    void *Src = GetSrc<void*>(SSAData, Op->Header.Args[0]);
+    uint8_t Tmp[16];
+
+    uint8_t Elements = OpSize / Op->Header.ElementSize;
+
+    auto Func = [](auto a) { return -a; };
+    switch (Op->Header.ElementSize) {
+      DO_VECTOR_1SRC_OP(4, float, Func)
+      DO_VECTOR_1SRC_OP(8, double, Func)
+      default: LogMan::Msg::A("Unknown Element Size: %d", Op->Header.ElementSize); break;
+    }
+    memcpy(GDP, Tmp, OpSize);
+    NEXT_OP();
+  }
+  DEF_OP(VUSHRI): {
+    auto Op = IROp->C<IR::IROp_VUShrI>();
+    void *Src = GetSrc<void*>(SSAData, Op->Header.Args[0]);
+    uint8_t BitShift = Op->BitShift;
+    uint8_t Tmp[16];
+
+    uint8_t Elements = OpSize / Op->Header.ElementSize;
+
+    auto Func = [BitShift](auto a) { return BitShift >= (sizeof(a) * 8) ? 0 : a >> BitShift; };
+    switch (Op->Header.ElementSize) {
+      DO_VECTOR_1SRC_OP(1, uint8_t, Func)
+      DO_VECTOR_1SRC_OP(2, uint16_t, Func)
+      DO_VECTOR_1SRC_OP(4, uint32_t, Func)
+      DO_VECTOR_1SRC_OP(8, uint64_t, Func)
+      default: LogMan::Msg::A("Unknown Element Size: %d", Op->Header.ElementSize); break;
+    }
+    memcpy(GDP, Tmp, OpSize);
+    NEXT_OP();
+  }
+  DEF_OP(VSSHRI): {
+    auto Op = IROp->C<IR::IROp_VSShrI>();
+    void *Src = GetSrc<void*>(SSAData, Op->Header.Args[0]);
+    uint8_t BitShift = Op->BitShift;
+    uint8_t Tmp[16];
+
+    uint8_t Elements = OpSize / Op->Header.ElementSize;
+
+    auto Func = [BitShift](auto a) { return BitShift >= (sizeof(a) * 8) ? (a >> (sizeof(a) * 8 - 1)) : a >> BitShift; };
+    switch (Op->Header.ElementSize) {
+      DO_VECTOR_1SRC_OP(1, int8_t, Func)
+      DO_VECTOR_1SRC_OP(2, int16_t, Func)
+      DO_VECTOR_1SRC_OP(4, int32_t, Func)
+      DO_VECTOR_1SRC_OP(8, int64_t, Func)
+      default: LogMan::Msg::A("Unknown Element Size: %d", Op->Header.ElementSize); break;
+    }
+    memcpy(GDP, Tmp, OpSize);
+    NEXT_OP();
+  }
+  DEF_OP(VSHLI): {
+    auto Op = IROp->C<IR::IROp_VShlI>();
+    void *Src = GetSrc<void*>(SSAData, Op->Header.Args[0]);
+    uint8_t BitShift = Op->BitShift;
+    uint8_t Tmp[16];
+
+    uint8_t Elements = OpSize / Op->Header.ElementSize;
+
+    auto Func = [BitShift](auto a) { return BitShift >= (sizeof(a) * 8) ? 0 : (a << BitShift); };
+    switch (Op->Header.ElementSize) {
+      DO_VECTOR_1SRC_OP(1, uint8_t, Func)
+      DO_VECTOR_1SRC_OP(2, uint16_t, Func)
+      DO_VECTOR_1SRC_OP(4, uint32_t, Func)
+      DO_VECTOR_1SRC_OP(8, uint64_t, Func)
+      default: LogMan::Msg::A("Unknown Element Size: %d", Op->Header.ElementSize); break;
+    }
+    memcpy(GDP, Tmp, OpSize);
+    NEXT_OP();
+  }
+
+  DEF_OP(VADD): {
+    auto Op = IROp->C<IR::IROp_VAdd>();
+    void *Src1 = GetSrc<void*>(SSAData, Op->Header.Args[0]);
+    void *Src2 = GetSrc<void*>(SSAData, Op->Header.Args[1]);
+    uint8_t Tmp[16];
+
+    uint8_t Elements = OpSize / Op->Header.ElementSize;
+
+    auto Func = [](auto a, auto b) { return a + b; };
+    switch (Op->Header.ElementSize) {
+      DO_VECTOR_OP(1, uint8_t,  Func)
+      DO_VECTOR_OP(2, uint16_t, Func)
+      DO_VECTOR_OP(4, uint32_t, Func)
+      DO_VECTOR_OP(8, uint64_t, Func)
+      default: LogMan::Msg::A("Unknown Element Size: %d", Op->Header.ElementSize); break;
+    }
+    memcpy(GDP, Tmp, OpSize);
+    NEXT_OP();
+  }
+  DEF_OP(VSUB): {
+    auto Op = IROp->C<IR::IROp_VSub>();
+    void *Src1 = GetSrc<void*>(SSAData, Op->Header.Args[0]);
+    void *Src2 = GetSrc<void*>(SSAData, Op->Header.Args[1]);
+    uint8_t Tmp[16];
+
+    uint8_t Elements = OpSize / Op->Header.ElementSize;
+
+    auto Func = [](auto a, auto b) { return a - b; };
+    switch (Op->Header.ElementSize) {
+      DO_VECTOR_OP(1, uint8_t,  Func)
+      DO_VECTOR_OP(2, uint16_t, Func)
+      DO_VECTOR_OP(4, uint32_t, Func)
+      DO_VECTOR_OP(8, uint64_t, Func)
+      default: LogMan::Msg::A("Unknown Element Size: %d", Op->Header.ElementSize); break;
+    }
+    memcpy(GDP, Tmp, OpSize);
+    NEXT_OP();
+  }
+  DEF_OP(VUQADD): {
+    auto Op = IROp->C<IR::IROp_VUQAdd>();
+    void *Src1 = GetSrc<void*>(SSAData, Op->Header.Args[0]);
+    void *Src2 = GetSrc<void*>(SSAData, Op->Header.Args[1]);
+    uint8_t Tmp[16];
+
+    uint8_t Elements = OpSize / Op->Header.ElementSize;
+
+    auto Func = [](auto a, auto b) {
+      decltype(a) res = a + b;
+      return res < a ? ~0U : res;
+    };
+    switch (Op->Header.ElementSize) {
+      DO_VECTOR_OP(1, uint8_t,  Func)
+      DO_VECTOR_OP(2, uint16_t, Func)
+      DO_VECTOR_OP(4, uint32_t, Func)
+      DO_VECTOR_OP(8, uint64_t, Func)
+      default: LogMan::Msg::A("Unknown Element Size: %d", Op->Header.ElementSize); break;
+    }
+    memcpy(GDP, Tmp, OpSize);
+    NEXT_OP();
+  }
+  DEF_OP(VUQSUB): {
+    auto Op = IROp->C<IR::IROp_VUQSub>();
+    void *Src1 = GetSrc<void*>(SSAData, Op->Header.Args[0]);
+    void *Src2 = GetSrc<void*>(SSAData, Op->Header.Args[1]);
+    uint8_t Tmp[16];
+
+    uint8_t Elements = OpSize / Op->Header.ElementSize;
+
+    auto Func = [](auto a, auto b) {
+      decltype(a) res = a - b;
+      return res > a ? 0U : res;
+    };
+    switch (Op->Header.ElementSize) {
+      DO_VECTOR_OP(1, uint8_t,  Func)
+      DO_VECTOR_OP(2, uint16_t, Func)
+      DO_VECTOR_OP(4, uint32_t, Func)
+      DO_VECTOR_OP(8, uint64_t, Func)
+      default: LogMan::Msg::A("Unknown Element Size: %d", Op->Header.ElementSize); break;
+    }
+    memcpy(GDP, Tmp, OpSize);
+    NEXT_OP();
+  }
+  DEF_OP(VSQADD): {
+    auto Op = IROp->C<IR::IROp_VSQAdd>();
+    void *Src1 = GetSrc<void*>(SSAData, Op->Header.Args[0]);
+    void *Src2 = GetSrc<void*>(SSAData, Op->Header.Args[1]);
+    uint8_t Tmp[16];
+
+    uint8_t Elements = OpSize / Op->Header.ElementSize;
+
+    auto Func = [](auto a, auto b) {
+      decltype(a) res = a + b;
+
+      if (a > 0) {
+        if (b > (std::numeric_limits<decltype(a)>::max() - a)) {
+          return std::numeric_limits<decltype(a)>::max();
+        }
+      }
+      else if (b < (std::numeric_limits<decltype(a)>::min() - a)) {
+        return std::numeric_limits<decltype(a)>::min();
+      }
+
+      return res;
+    };
+    switch (Op->Header.ElementSize) {
+      DO_VECTOR_OP(1, int8_t,  Func)
+      DO_VECTOR_OP(2, int16_t, Func)
+      DO_VECTOR_OP(4, int32_t, Func)
+      DO_VECTOR_OP(8, int64_t, Func)
+      default: LogMan::Msg::A("Unknown Element Size: %d", Op->Header.ElementSize); break;
+    }
+    memcpy(GDP, Tmp, OpSize);
+    NEXT_OP();
+  }
+  DEF_OP(VSQSUB): {
+    auto Op = IROp->C<IR::IROp_VSQSub>();
+    void *Src1 = GetSrc<void*>(SSAData, Op->Header.Args[0]);
+    void *Src2 = GetSrc<void*>(SSAData, Op->Header.Args[1]);
+    uint8_t Tmp[16];
+
+    uint8_t Elements = OpSize / Op->Header.ElementSize;
+
+    auto Func = [](auto a, auto b) {
+      __int128_t res = a - b;
+      if (res < std::numeric_limits<decltype(a)>::min())
+        return std::numeric_limits<decltype(a)>::min();
+
+      if (res > std::numeric_limits<decltype(a)>::max())
+        return std::numeric_limits<decltype(a)>::max();
+      return (decltype(a))res;
+    };
+
+    switch (Op->Header.ElementSize) {
+      DO_VECTOR_OP(1, int8_t,  Func)
+      DO_VECTOR_OP(2, int16_t, Func)
+      DO_VECTOR_OP(4, int32_t, Func)
+      DO_VECTOR_OP(8, int64_t, Func)
+      default: LogMan::Msg::A("Unknown Element Size: %d", Op->Header.ElementSize); break;
+    }
+    memcpy(GDP, Tmp, OpSize);
+    NEXT_OP();
+  }
+
+  DEF_OP(VFADD): {
+    auto Op = IROp->C<IR::IROp_VFAdd>();
+    void *Src1 = GetSrc<void*>(SSAData, Op->Header.Args[0]);
+    void *Src2 = GetSrc<void*>(SSAData, Op->Header.Args[1]);
+    uint8_t Tmp[16];
+
+    uint8_t Elements = OpSize / Op->Header.ElementSize;
+
+    auto Func = [](auto a, auto b) { return a + b; };
+    switch (Op->Header.ElementSize) {
+      DO_VECTOR_OP(4, float, Func)
+      DO_VECTOR_OP(8, double, Func)
+      default: LogMan::Msg::A("Unknown Element Size: %d", Op->Header.ElementSize); break;
+    }
+    memcpy(GDP, Tmp, OpSize);
+    NEXT_OP();
+  }
+  DEF_OP(VFADDP): {
+    auto Op = IROp->C<IR::IROp_VFAddP>();
+    void *Src1 = GetSrc<void*>(SSAData, Op->Header.Args[0]);
+    void *Src2 = GetSrc<void*>(SSAData, Op->Header.Args[1]);
+    uint8_t Tmp[16];
+
+    uint8_t Elements = (OpSize / Op->Header.ElementSize) / 2;
+
+    auto Func = [](auto a, auto b) { return a + b; };
+    switch (Op->Header.ElementSize) {
+      DO_VECTOR_PAIR_OP(4, float, Func)
+      DO_VECTOR_PAIR_OP(8, double, Func)
+      default: LogMan::Msg::A("Unknown Element Size: %d", Op->Header.ElementSize); break;
+    }
+    memcpy(GDP, Tmp, OpSize);
+    NEXT_OP();
+  }
+  DEF_OP(VFSUB): {
+    auto Op = IROp->C<IR::IROp_VFSub>();
+    void *Src1 = GetSrc<void*>(SSAData, Op->Header.Args[0]);
+    void *Src2 = GetSrc<void*>(SSAData, Op->Header.Args[1]);
+    uint8_t Tmp[16];
+
+    uint8_t Elements = OpSize / Op->Header.ElementSize;
+
+    auto Func = [](auto a, auto b) { return a - b; };
+    switch (Op->Header.ElementSize) {
+      DO_VECTOR_OP(4, float, Func)
+      DO_VECTOR_OP(8, double, Func)
+      default: LogMan::Msg::A("Unknown Element Size: %d", Op->Header.ElementSize); break;
+    }
+    memcpy(GDP, Tmp, OpSize);
+    NEXT_OP();
+  }
+  DEF_OP(VADDP): {
+    auto Op = IROp->C<IR::IROp_VAddP>();
+    void *Src1 = GetSrc<void*>(SSAData, Op->Header.Args[0]);
+    void *Src2 = GetSrc<void*>(SSAData, Op->Header.Args[1]);
+    uint8_t Tmp[16];
+
+    uint8_t Elements = (OpSize / Op->Header.ElementSize) / 2;
+
+    auto Func = [](auto a, auto b) { return a + b; };
+    switch (Op->Header.ElementSize) {
+      DO_VECTOR_PAIR_OP(1, uint8_t,  Func)
+      DO_VECTOR_PAIR_OP(2, uint16_t, Func)
+      DO_VECTOR_PAIR_OP(4, uint32_t, Func)
+      DO_VECTOR_PAIR_OP(8, uint64_t, Func)
+      default: LogMan::Msg::A("Unknown Element Size: %d", Op->Header.ElementSize); break;
+    }
+    memcpy(GDP, Tmp, OpSize);
+    NEXT_OP();
+  }
+  DEF_OP(VADDV): {
+    auto Op = IROp->C<IR::IROp_VAddV>();
+    void *Src = GetSrc<void*>(SSAData, Op->Header.Args[0]);
+    uint8_t Tmp[16];
+
+    uint8_t Elements = OpSize / Op->Header.ElementSize;
+
+    auto Func = [](auto current, auto a) { return current + a; };
+    switch (Op->Header.ElementSize) {
+      DO_VECTOR_REDUCE_1SRC_OP(1, int8_t, Func, 0)
+      DO_VECTOR_REDUCE_1SRC_OP(2, int16_t, Func, 0)
+      DO_VECTOR_REDUCE_1SRC_OP(4, int32_t, Func, 0)
+      DO_VECTOR_REDUCE_1SRC_OP(8, int64_t, Func, 0)
+      default: LogMan::Msg::A("Unknown Element Size: %d", Op->Header.ElementSize); break;
+    }
+    memcpy(GDP, Tmp, Op->Header.ElementSize);
+    NEXT_OP();
+  }
+  DEF_OP(VURAVG): {
+    auto Op = IROp->C<IR::IROp_VURAvg>();
+    void *Src1 = GetSrc<void*>(SSAData, Op->Header.Args[0]);
+    void *Src2 = GetSrc<void*>(SSAData, Op->Header.Args[1]);
+    uint8_t Tmp[16];
+
+    uint8_t Elements = OpSize / Op->Header.ElementSize;
+
+    auto Func = [](auto a, auto b) { return (a + b + 1) >> 1; };
+    switch (Op->Header.ElementSize) {
+      DO_VECTOR_OP(1, uint8_t,  Func)
+      DO_VECTOR_OP(2, uint16_t, Func)
+      default: LogMan::Msg::A("Unknown Element Size: %d", Op->Header.ElementSize); break;
+    }
+    memcpy(GDP, Tmp, OpSize);
+    NEXT_OP();
+  }
+  DEF_OP(VABS): {
+    auto Op = IROp->C<IR::IROp_VAbs>();
+    void *Src = GetSrc<void*>(SSAData, Op->Header.Args[0]);
+    uint8_t Tmp[16];
+
+    uint8_t Elements = OpSize / Op->Header.ElementSize;
+
+    auto Func = [](auto a) { return std::abs(a); };
+    switch (Op->Header.ElementSize) {
+      DO_VECTOR_1SRC_OP(1, int8_t, Func)
+      DO_VECTOR_1SRC_OP(2, int16_t, Func)
+      DO_VECTOR_1SRC_OP(4, int32_t, Func)
+      DO_VECTOR_1SRC_OP(8, int64_t, Func)
+      default: LogMan::Msg::A("Unknown Element Size: %d", Op->Header.ElementSize); break;
+    }
+    memcpy(GDP, Tmp, OpSize);
+    NEXT_OP();
+  }
+  DEF_OP(VFMUL): {
+    auto Op = IROp->C<IR::IROp_VFMul>();
+    void *Src1 = GetSrc<void*>(SSAData, Op->Header.Args[0]);
+    void *Src2 = GetSrc<void*>(SSAData, Op->Header.Args[1]);
+    uint8_t Tmp[16];
+
+    uint8_t Elements = OpSize / Op->Header.ElementSize;
+
+    auto Func = [](auto a, auto b) { return a * b; };
+    switch (Op->Header.ElementSize) {
+      DO_VECTOR_OP(4, float, Func)
+      DO_VECTOR_OP(8, double, Func)
+      default: LogMan::Msg::A("Unknown Element Size: %d", Op->Header.ElementSize); break;
+    }
+    memcpy(GDP, Tmp, OpSize);
+    NEXT_OP();
+  }
+  DEF_OP(VFDIV): {
+    auto Op = IROp->C<IR::IROp_VFDiv>();
+    void *Src1 = GetSrc<void*>(SSAData, Op->Header.Args[0]);
+    void *Src2 = GetSrc<void*>(SSAData, Op->Header.Args[1]);
+    uint8_t Tmp[16];
+
+    uint8_t Elements = OpSize / Op->Header.ElementSize;
+
+    auto Func = [](auto a, auto b) { return a / b; };
+    switch (Op->Header.ElementSize) {
+      DO_VECTOR_OP(4, float, Func)
+      DO_VECTOR_OP(8, double, Func)
+      default: LogMan::Msg::A("Unknown Element Size: %d", Op->Header.ElementSize); break;
+    }
+    memcpy(GDP, Tmp, OpSize);
+    NEXT_OP();
+  }
+  DEF_OP(VFMIN): {
+    auto Op = IROp->C<IR::IROp_VFMin>();
+    void *Src1 = GetSrc<void*>(SSAData, Op->Header.Args[0]);
+    void *Src2 = GetSrc<void*>(SSAData, Op->Header.Args[1]);
+    uint8_t Tmp[16];
+
+    uint8_t Elements = OpSize / Op->Header.ElementSize;
+
+    auto Func = [](auto a, auto b) { return std::min(a, b); };
+    switch (Op->Header.ElementSize) {
+      DO_VECTOR_OP(4, float, Func)
+      DO_VECTOR_OP(8, double, Func)
+      default: LogMan::Msg::A("Unknown Element Size: %d", Op->Header.ElementSize); break;
+    }
+    memcpy(GDP, Tmp, OpSize);
+    NEXT_OP();
+  }
+  DEF_OP(VFMAX): {
+    auto Op = IROp->C<IR::IROp_VFMax>();
+    void *Src1 = GetSrc<void*>(SSAData, Op->Header.Args[0]);
+    void *Src2 = GetSrc<void*>(SSAData, Op->Header.Args[1]);
+    uint8_t Tmp[16];
+
+    uint8_t Elements = OpSize / Op->Header.ElementSize;
+
+    auto Func = [](auto a, auto b) { return std::max(a, b); };
+    switch (Op->Header.ElementSize) {
+      DO_VECTOR_OP(4, float, Func)
+      DO_VECTOR_OP(8, double, Func)
+      default: LogMan::Msg::A("Unknown Element Size: %d", Op->Header.ElementSize); break;
+    }
+    memcpy(GDP, Tmp, OpSize);
+    NEXT_OP();
+  }
+  DEF_OP(VFRECP): {
+    auto Op = IROp->C<IR::IROp_VFRecp>();
+    void *Src = GetSrc<void*>(SSAData, Op->Header.Args[0]);
+    uint8_t Tmp[16];
+
+    uint8_t Elements = OpSize / Op->Header.ElementSize;
+
+    auto Func = [](auto a) { return 1.0 / a; };
+    switch (Op->Header.ElementSize) {
+      DO_VECTOR_1SRC_OP(4, float, Func)
+      DO_VECTOR_1SRC_OP(8, double, Func)
+      default: LogMan::Msg::A("Unknown Element Size: %d", Op->Header.ElementSize); break;
+    }
+    memcpy(GDP, Tmp, OpSize);
+    NEXT_OP();
+  }
+  DEF_OP(VFSQRT): {
+    auto Op = IROp->C<IR::IROp_VFSqrt>();
+    void *Src = GetSrc<void*>(SSAData, Op->Header.Args[0]);
+    uint8_t Tmp[16];
+
+    uint8_t Elements = OpSize / Op->Header.ElementSize;
+
+    auto Func = [](auto a) { return std::sqrt(a); };
+    switch (Op->Header.ElementSize) {
+      DO_VECTOR_1SRC_OP(4, float, Func)
+      DO_VECTOR_1SRC_OP(8, double, Func)
+      default: LogMan::Msg::A("Unknown Element Size: %d", Op->Header.ElementSize); break;
+    }
+    memcpy(GDP, Tmp, OpSize);
+    NEXT_OP();
+  }
+  DEF_OP(VFRSQRT): {
+    auto Op = IROp->C<IR::IROp_VFRSqrt>();
+    void *Src = GetSrc<void*>(SSAData, Op->Header.Args[0]);
+    uint8_t Tmp[16];
+
+    uint8_t Elements = OpSize / Op->Header.ElementSize;
+
+    auto Func = [](auto a) { return 1.0 / std::sqrt(a); };
+    switch (Op->Header.ElementSize) {
+      DO_VECTOR_1SRC_OP(4, float, Func)
+      DO_VECTOR_1SRC_OP(8, double, Func)
+      default: LogMan::Msg::A("Unknown Element Size: %d", Op->Header.ElementSize); break;
+    }
+    memcpy(GDP, Tmp, OpSize);
+    NEXT_OP();
+  }
+  #define DO_VECTOR_1SRC_2TYPE_OP(size, type, type2, func, min, max)              \
+    case size: {                                      \
+    auto *Dst_d  = reinterpret_cast<type*>(Tmp);  \
+    auto *Src_d = reinterpret_cast<type2*>(Src); \
+    for (uint8_t i = 0; i < Elements; ++i) {          \
+      Dst_d[i] = (type)func(Src_d[i], min, max);          \
+    }                                                 \
+    break;                                            \
+    }
+  #define DO_VECTOR_1SRC_2TYPE_OP_TOP(size, type, type2, func, min, max)              \
+    case size: {                                      \
+    auto *Dst_d  = reinterpret_cast<type*>(Tmp);  \
+    auto *Src_d = reinterpret_cast<type2*>(Src2); \
+    memcpy(Dst_d, Src1, Elements * sizeof(type2));\
+    for (uint8_t i = 0; i < Elements; ++i) {          \
+      Dst_d[i+Elements] = (type)func(Src_d[i], min, max);          \
+    }                                                 \
+    break;                                            \
+    }
+
+  #define DO_VECTOR_1SRC_2TYPE_OP_TOP_SRC(size, type, type2, func, min, max)              \
+    case size: {                                      \
+    auto *Dst_d  = reinterpret_cast<type*>(Tmp);  \
+    auto *Src_d = reinterpret_cast<type2*>(Src); \
+    for (uint8_t i = 0; i < Elements; ++i) {          \
+      Dst_d[i] = (type)func(Src_d[i+Elements], min, max);          \
+    }                                                 \
+    break;                                            \
+    }
+  #define DO_VECTOR_2SRC_2TYPE_OP(size, type, type2, func)              \
+    case size: {                                      \
+    auto *Dst_d  = reinterpret_cast<type*>(Tmp);  \
+    auto *Src1_d = reinterpret_cast<type2*>(Src1); \
+    auto *Src2_d = reinterpret_cast<type2*>(Src2); \
+    for (uint8_t i = 0; i < Elements; ++i) {          \
+      Dst_d[i] = (type)func((type)Src1_d[i], (type)Src2_d[i]);          \
+    }                                                 \
+    break;                                            \
+    }
+  #define DO_VECTOR_2SRC_2TYPE_OP_TOP_SRC(size, type, type2, func)              \
+    case size: {                                      \
+    auto *Dst_d  = reinterpret_cast<type*>(Tmp);  \
+    auto *Src1_d = reinterpret_cast<type2*>(Src1); \
+    auto *Src2_d = reinterpret_cast<type2*>(Src2); \
+    for (uint8_t i = 0; i < Elements; ++i) {          \
+      Dst_d[i] = (type)func((type)Src1_d[i+Elements], (type)Src2_d[i+Elements]);          \
+    }                                                 \
+    break;                                            \
+    }
+
+  DEF_OP(VUSHRNI): {
+    auto Op = IROp->C<IR::IROp_VUShrNI>();
+    void *Src = GetSrc<void*>(SSAData, Op->Header.Args[0]);
+    uint8_t BitShift = Op->BitShift;
+    uint8_t Tmp[16]{};
+
+    uint8_t Elements = OpSize / (Op->Header.ElementSize << 1);
+
+    auto Func = [BitShift](auto a, auto min, auto max) { return BitShift >= (sizeof(a) * 8) ? 0 : a >> BitShift; };
+    switch (Op->Header.ElementSize) {
+      DO_VECTOR_1SRC_2TYPE_OP(1, uint8_t, uint16_t, Func, 0, 0)
+      DO_VECTOR_1SRC_2TYPE_OP(2, uint16_t, uint32_t, Func, 0, 0)
+      DO_VECTOR_1SRC_2TYPE_OP(4, uint32_t, uint64_t, Func, 0, 0)
+      default: LogMan::Msg::A("Unknown Element Size: %d", Op->Header.ElementSize); break;
+    }
+    memcpy(GDP, Tmp, OpSize);
+    NEXT_OP();
+  }
+  DEF_OP(VUSHRNI2): {
+    auto Op = IROp->C<IR::IROp_VUShrNI2>();
+    void *Src1 = GetSrc<void*>(SSAData, Op->Header.Args[0]);
+    void *Src2 = GetSrc<void*>(SSAData, Op->Header.Args[1]);
+    uint8_t BitShift = Op->BitShift;
+    uint8_t Tmp[16];
+
+    uint8_t Elements = OpSize / (Op->Header.ElementSize << 1);
+
+    auto Func = [BitShift](auto a, auto min, auto max) { return BitShift >= (sizeof(a) * 8) ? 0 : a >> BitShift; };
+    switch (Op->Header.ElementSize) {
+      DO_VECTOR_1SRC_2TYPE_OP_TOP(1, uint8_t, uint16_t, Func, 0, 0)
+      DO_VECTOR_1SRC_2TYPE_OP_TOP(2, uint16_t, uint32_t, Func, 0, 0)
+      DO_VECTOR_1SRC_2TYPE_OP_TOP(4, uint32_t, uint64_t, Func, 0, 0)
+      default: LogMan::Msg::A("Unknown Element Size: %d", Op->Header.ElementSize); break;
+    }
+    memcpy(GDP, Tmp, OpSize);
+    NEXT_OP();
+  }
+  DEF_OP(VSQXTN): {
+    auto Op = IROp->C<IR::IROp_VSQXTN>();
+    void *Src = GetSrc<void*>(SSAData, Op->Header.Args[0]);
+    uint8_t Tmp[16]{};
+
+    uint8_t Elements = OpSize / (Op->Header.ElementSize << 1);
+
+    auto Func = [](auto a, auto min, auto max) { return std::max(std::min(a, (decltype(a))max), (decltype(a))min); };
+    switch (Op->Header.ElementSize) {
+      DO_VECTOR_1SRC_2TYPE_OP(1, int8_t, int16_t, Func, std::numeric_limits<int8_t>::min(), std::numeric_limits<int8_t>::max())
+      DO_VECTOR_1SRC_2TYPE_OP(2, int16_t, int32_t, Func, std::numeric_limits<int16_t>::min(), std::numeric_limits<int16_t>::max())
+      default: LogMan::Msg::A("Unknown Element Size: %d", Op->Header.ElementSize); break;
+    }
+    memcpy(GDP, Tmp, OpSize);
+    NEXT_OP();
+  }
+  DEF_OP(VSQXTN2): {
+    auto Op = IROp->C<IR::IROp_VSQXTN2>();
+    void *Src1 = GetSrc<void*>(SSAData, Op->Header.Args[0]);
+    void *Src2 = GetSrc<void*>(SSAData, Op->Header.Args[1]);
+    uint8_t Tmp[16]{};
+
+    uint8_t Elements = OpSize / (Op->Header.ElementSize << 1);
+
+    auto Func = [](auto a, auto min, auto max) { return std::max(std::min(a, (decltype(a))max), (decltype(a))min); };
+    switch (Op->Header.ElementSize) {
+      DO_VECTOR_1SRC_2TYPE_OP_TOP(1, int8_t, int16_t, Func, std::numeric_limits<int8_t>::min(), std::numeric_limits<int8_t>::max())
+      DO_VECTOR_1SRC_2TYPE_OP_TOP(2, int16_t, int32_t, Func, std::numeric_limits<int16_t>::min(), std::numeric_limits<int16_t>::max())
+      default: LogMan::Msg::A("Unknown Element Size: %d", Op->Header.ElementSize); break;
+    }
+    memcpy(GDP, Tmp, OpSize);
+    NEXT_OP();
+  }
+  DEF_OP(VSQXTUN): {
+    auto Op = IROp->C<IR::IROp_VSQXTUN>();
+    void *Src = GetSrc<void*>(SSAData, Op->Header.Args[0]);
+    uint8_t Tmp[16]{};
+
+    uint8_t Elements = OpSize / (Op->Header.ElementSize << 1);
+
+    auto Func = [](auto a, auto min, auto max) { return std::max(std::min(a, (decltype(a))max), (decltype(a))min); };
+    switch (Op->Header.ElementSize) {
+      DO_VECTOR_1SRC_2TYPE_OP(1, uint8_t, int16_t, Func, 0, (1 << 8) - 1)
+      DO_VECTOR_1SRC_2TYPE_OP(2, uint16_t, int32_t, Func, 0, (1 << 16) - 1)
+      default: LogMan::Msg::A("Unknown Element Size: %d", Op->Header.ElementSize); break;
+    }
+    memcpy(GDP, Tmp, OpSize);
+    NEXT_OP();
+  }
+  DEF_OP(VSQXTUN2): {
+    auto Op = IROp->C<IR::IROp_VSQXTUN2>();
+    void *Src1 = GetSrc<void*>(SSAData, Op->Header.Args[0]);
+    void *Src2 = GetSrc<void*>(SSAData, Op->Header.Args[1]);
+    uint8_t Tmp[16]{};
+
+    uint8_t Elements = OpSize / (Op->Header.ElementSize << 1);
+
+    auto Func = [](auto a, auto min, auto max) { return std::max(std::min(a, (decltype(a))max), (decltype(a))min); };
+    switch (Op->Header.ElementSize) {
+      DO_VECTOR_1SRC_2TYPE_OP_TOP(1, uint8_t, int16_t, Func, 0, (1 << 8) - 1)
+      DO_VECTOR_1SRC_2TYPE_OP_TOP(2, uint16_t, int32_t, Func, 0, (1 << 16) - 1)
+      default: LogMan::Msg::A("Unknown Element Size: %d", Op->Header.ElementSize); break;
+    }
+    memcpy(GDP, Tmp, OpSize);
+    NEXT_OP();
+  }
+  DEF_OP(VECTOR_UTOF): {
+    auto Op = IROp->C<IR::IROp_Vector_UToF>();
+    void *Src = GetSrc<void*>(SSAData, Op->Header.Args[0]);
+    uint8_t Tmp[16];
+
+    uint8_t Elements = OpSize / Op->Header.ElementSize;
+
+    auto Func = [](auto a, auto min, auto max) { return a; };
+    switch (Op->Header.ElementSize) {
+      DO_VECTOR_1SRC_2TYPE_OP(4, float, uint32_t, Func, 0, 0)
+      DO_VECTOR_1SRC_2TYPE_OP(8, double, uint64_t, Func, 0, 0)
+      default: LogMan::Msg::A("Unknown Element Size: %d", Op->Header.ElementSize); break;
+    }
+    memcpy(GDP, Tmp, OpSize);
+    NEXT_OP();
+  }
+  DEF_OP(VECTOR_STOF): {
+    auto Op = IROp->C<IR::IROp_Vector_SToF>();
+    void *Src = GetSrc<void*>(SSAData, Op->Header.Args[0]);
+    uint8_t Tmp[16];
+
+    uint8_t Elements = OpSize / Op->Header.ElementSize;
+
+    auto Func = [](auto a, auto min, auto max) { return a; };
+    switch (Op->Header.ElementSize) {
+      DO_VECTOR_1SRC_2TYPE_OP(4, float, int32_t, Func, 0, 0)
+      DO_VECTOR_1SRC_2TYPE_OP(8, double, int64_t, Func, 0, 0)
+      default: LogMan::Msg::A("Unknown Element Size: %d", Op->Header.ElementSize); break;
+    }
+    memcpy(GDP, Tmp, OpSize);
+    NEXT_OP();
+  }
+  DEF_OP(VECTOR_FTOZU): {
+    auto Op = IROp->C<IR::IROp_Vector_FToZU>();
+    void *Src = GetSrc<void*>(SSAData, Op->Header.Args[0]);
+    uint8_t Tmp[16];
+
+    uint8_t Elements = OpSize / Op->Header.ElementSize;
+
+    auto Func = [](auto a, auto min, auto max) { return a; };
+    switch (Op->Header.ElementSize) {
+      DO_VECTOR_1SRC_2TYPE_OP(4, uint32_t, float, Func, 0, 0)
+      DO_VECTOR_1SRC_2TYPE_OP(8, uint64_t, double, Func, 0, 0)
+      default: LogMan::Msg::A("Unknown Element Size: %d", Op->Header.ElementSize); break;
+    }
+    memcpy(GDP, Tmp, OpSize);
+    NEXT_OP();
+  }
+  DEF_OP(VECTOR_FTOZS): {
+    auto Op = IROp->C<IR::IROp_Vector_FToZS>();
+    void *Src = GetSrc<void*>(SSAData, Op->Header.Args[0]);
+    uint8_t Tmp[16];
+
+    uint8_t Elements = OpSize / Op->Header.ElementSize;
+
+    auto Func = [](auto a, auto min, auto max) { return a; };
+    switch (Op->Header.ElementSize) {
+      DO_VECTOR_1SRC_2TYPE_OP(4, int32_t, float, Func, 0, 0)
+      DO_VECTOR_1SRC_2TYPE_OP(8, int64_t, double, Func, 0, 0)
+      default: LogMan::Msg::A("Unknown Element Size: %d", Op->Header.ElementSize); break;
+    }
+    memcpy(GDP, Tmp, OpSize);
+    NEXT_OP();
+  }
+  DEF_OP(VECTOR_FTOU): {
+    auto Op = IROp->C<IR::IROp_Vector_FToU>();
+    void *Src = GetSrc<void*>(SSAData, Op->Header.Args[0]);
+    uint8_t Tmp[16];
+
+    uint8_t Elements = OpSize / Op->Header.ElementSize;
+
+    auto Func = [](auto a, auto min, auto max) { return a; };
+    switch (Op->Header.ElementSize) {
+      DO_VECTOR_1SRC_2TYPE_OP(4, uint32_t, float, Func, 0, 0)
+      DO_VECTOR_1SRC_2TYPE_OP(8, uint64_t, double, Func, 0, 0)
+      default: LogMan::Msg::A("Unknown Element Size: %d", Op->Header.ElementSize); break;
+    }
+    memcpy(GDP, Tmp, OpSize);
+    NEXT_OP();
+  }
+  DEF_OP(VECTOR_FTOS): {
+    auto Op = IROp->C<IR::IROp_Vector_FToS>();
+    void *Src = GetSrc<void*>(SSAData, Op->Header.Args[0]);
+    uint8_t Tmp[16];
+
+    uint8_t Elements = OpSize / Op->Header.ElementSize;
+
+    auto Func = [](auto a, auto min, auto max) { return a; };
+    switch (Op->Header.ElementSize) {
+      DO_VECTOR_1SRC_2TYPE_OP(4, int32_t, float, Func, 0, 0)
+      DO_VECTOR_1SRC_2TYPE_OP(8, int64_t, double, Func, 0, 0)
+      default: LogMan::Msg::A("Unknown Element Size: %d", Op->Header.ElementSize); break;
+    }
+    memcpy(GDP, Tmp, OpSize);
+    NEXT_OP();
+  }
+  DEF_OP(VUMUL): {
+    auto Op = IROp->C<IR::IROp_VUMul>();
+    void *Src1 = GetSrc<void*>(SSAData, Op->Header.Args[0]);
+    void *Src2 = GetSrc<void*>(SSAData, Op->Header.Args[1]);
+    uint8_t Tmp[16];
+
+    uint8_t Elements = OpSize / Op->Header.ElementSize;
+
+    auto Func = [](auto a, auto b) { return a * b; };
+    switch (Op->Header.ElementSize) {
+      DO_VECTOR_OP(1, uint8_t,  Func)
+      DO_VECTOR_OP(2, uint16_t, Func)
+      DO_VECTOR_OP(4, uint32_t, Func)
+      DO_VECTOR_OP(8, uint64_t, Func)
+      default: LogMan::Msg::A("Unknown Element Size: %d", Op->Header.ElementSize); break;
+    }
+    memcpy(GDP, Tmp, OpSize);
+    NEXT_OP();
+  }
+  DEF_OP(VSMUL): {
+    auto Op = IROp->C<IR::IROp_VSMul>();
+    void *Src1 = GetSrc<void*>(SSAData, Op->Header.Args[0]);
+    void *Src2 = GetSrc<void*>(SSAData, Op->Header.Args[1]);
+    uint8_t Tmp[16];
+
+    uint8_t Elements = OpSize / Op->Header.ElementSize;
+
+    auto Func = [](auto a, auto b) { return a * b; };
+    switch (Op->Header.ElementSize) {
+      DO_VECTOR_OP(1, int8_t,  Func)
+      DO_VECTOR_OP(2, int16_t, Func)
+      DO_VECTOR_OP(4, int32_t, Func)
+      DO_VECTOR_OP(8, int64_t, Func)
+      default: LogMan::Msg::A("Unknown Element Size: %d", Op->Header.ElementSize); break;
+    }
+    memcpy(GDP, Tmp, OpSize);
+    NEXT_OP();
+  }
+  DEF_OP(VUMULL): {
+    auto Op = IROp->C<IR::IROp_VUMull>();
+    void *Src1 = GetSrc<void*>(SSAData, Op->Header.Args[0]);
+    void *Src2 = GetSrc<void*>(SSAData, Op->Header.Args[1]);
+
+    uint8_t Tmp[16];
+
+    uint8_t Elements = OpSize / Op->Header.ElementSize;
+
+    auto Func = [](auto a, auto b) { return a * b; };
+    switch (Op->Header.ElementSize) {
+      DO_VECTOR_2SRC_2TYPE_OP(2, uint16_t, uint8_t, Func)
+      DO_VECTOR_2SRC_2TYPE_OP(4, uint32_t, uint16_t, Func)
+      DO_VECTOR_2SRC_2TYPE_OP(8, uint64_t, uint32_t, Func)
+      default: LogMan::Msg::A("Unknown Element Size: %d", Op->Header.ElementSize); break;
+    }
+    memcpy(GDP, Tmp, OpSize);
+    NEXT_OP();
+  }
+  DEF_OP(VSMULL): {
+    auto Op = IROp->C<IR::IROp_VSMull>();
+    void *Src1 = GetSrc<void*>(SSAData, Op->Header.Args[0]);
+    void *Src2 = GetSrc<void*>(SSAData, Op->Header.Args[1]);
+
+    uint8_t Tmp[16];
+
+    uint8_t Elements = OpSize / Op->Header.ElementSize;
+
+    auto Func = [](auto a, auto b) { return a * b; };
+    switch (Op->Header.ElementSize) {
+      DO_VECTOR_2SRC_2TYPE_OP(2, int16_t, int8_t, Func)
+      DO_VECTOR_2SRC_2TYPE_OP(4, int32_t, int16_t, Func)
+      DO_VECTOR_2SRC_2TYPE_OP(8, int64_t, int32_t, Func)
+      default: LogMan::Msg::A("Unknown Element Size: %d", Op->Header.ElementSize); break;
+    }
+    memcpy(GDP, Tmp, OpSize);
+    NEXT_OP();
+  }
+  DEF_OP(VUMULL2): {
+    auto Op = IROp->C<IR::IROp_VUMull2>();
+    void *Src1 = GetSrc<void*>(SSAData, Op->Header.Args[0]);
+    void *Src2 = GetSrc<void*>(SSAData, Op->Header.Args[1]);
+
+    uint8_t Tmp[16];
+
+    uint8_t Elements = OpSize / Op->Header.ElementSize;
+
+    auto Func = [](auto a, auto b) { return a * b; };
+    switch (Op->Header.ElementSize) {
+      DO_VECTOR_2SRC_2TYPE_OP_TOP_SRC(2, uint16_t, uint8_t, Func)
+      DO_VECTOR_2SRC_2TYPE_OP_TOP_SRC(4, uint32_t, uint16_t, Func)
+      DO_VECTOR_2SRC_2TYPE_OP_TOP_SRC(8, uint64_t, uint32_t, Func)
+      default: LogMan::Msg::A("Unknown Element Size: %d", Op->Header.ElementSize); break;
+    }
+    memcpy(GDP, Tmp, OpSize);
+    NEXT_OP();
+  }
+  DEF_OP(VSMULL2): {
+    auto Op = IROp->C<IR::IROp_VSMull2>();
+    void *Src1 = GetSrc<void*>(SSAData, Op->Header.Args[0]);
+    void *Src2 = GetSrc<void*>(SSAData, Op->Header.Args[1]);
+
+    uint8_t Tmp[16];
+
+    uint8_t Elements = OpSize / Op->Header.ElementSize;
+
+    auto Func = [](auto a, auto b) { return a * b; };
+    switch (Op->Header.ElementSize) {
+      DO_VECTOR_2SRC_2TYPE_OP_TOP_SRC(2, int16_t, int8_t, Func)
+      DO_VECTOR_2SRC_2TYPE_OP_TOP_SRC(4, int32_t, int16_t, Func)
+      DO_VECTOR_2SRC_2TYPE_OP_TOP_SRC(8, int64_t, int32_t, Func)
+      default: LogMan::Msg::A("Unknown Element Size: %d", Op->Header.ElementSize); break;
+    }
+    memcpy(GDP, Tmp, Op->Header.Size);
+    NEXT_OP();
+  }
+  DEF_OP(VSXTL): {
+    auto Op = IROp->C<IR::IROp_VSXTL>();
+    void *Src = GetSrc<void*>(SSAData, Op->Header.Args[0]);
+    uint8_t Tmp[16]{};
+
+    uint8_t Elements = OpSize / Op->Header.ElementSize;
+
+    auto Func = [](auto a, auto min, auto max) { return a; };
+    switch (Op->Header.ElementSize) {
+      DO_VECTOR_1SRC_2TYPE_OP(2, int16_t, int8_t, Func,  0, 0)
+      DO_VECTOR_1SRC_2TYPE_OP(4, int32_t, int16_t, Func, 0, 0)
+      DO_VECTOR_1SRC_2TYPE_OP(8, int64_t, int32_t, Func, 0, 0)
+      default: LogMan::Msg::A("Unknown Element Size: %d", Op->Header.ElementSize); break;
+    }
+    memcpy(GDP, Tmp, OpSize);
+    NEXT_OP();
+  }
+  DEF_OP(VSXTL2): {
+    auto Op = IROp->C<IR::IROp_VSXTL2>();
+    void *Src = GetSrc<void*>(SSAData, Op->Header.Args[0]);
+    uint8_t Tmp[16];
+
+    uint8_t Elements = OpSize / Op->Header.ElementSize;
+
+    auto Func = [](auto a, auto min, auto max) { return a; };
+    switch (Op->Header.ElementSize) {
+      DO_VECTOR_1SRC_2TYPE_OP_TOP_SRC(2, int16_t, int8_t, Func,  0, 0)
+      DO_VECTOR_1SRC_2TYPE_OP_TOP_SRC(4, int32_t, int16_t, Func, 0, 0)
+      DO_VECTOR_1SRC_2TYPE_OP_TOP_SRC(8, int64_t, int32_t, Func, 0, 0)
+      default: LogMan::Msg::A("Unknown Element Size: %d", Op->Header.ElementSize); break;
+    }
+    memcpy(GDP, Tmp, OpSize);
+    NEXT_OP();
+  }
+  DEF_OP(VUXTL): {
+    auto Op = IROp->C<IR::IROp_VUXTL>();
+    void *Src = GetSrc<void*>(SSAData, Op->Header.Args[0]);
+    uint8_t Tmp[16]{};
+
+    uint8_t Elements = OpSize / Op->Header.ElementSize;
+
+    auto Func = [](auto a, auto min, auto max) { return a; };
+    switch (Op->Header.ElementSize) {
+      DO_VECTOR_1SRC_2TYPE_OP(2, uint16_t, uint8_t, Func,  0, 0)
+      DO_VECTOR_1SRC_2TYPE_OP(4, uint32_t, uint16_t, Func, 0, 0)
+      DO_VECTOR_1SRC_2TYPE_OP(8, uint64_t, uint32_t, Func, 0, 0)
+      default: LogMan::Msg::A("Unknown Element Size: %d", Op->Header.ElementSize); break;
+    }
+    memcpy(GDP, Tmp, OpSize);
+    NEXT_OP();
+  }
+  DEF_OP(VUXTL2): {
+    auto Op = IROp->C<IR::IROp_VUXTL2>();
+    void *Src = GetSrc<void*>(SSAData, Op->Header.Args[0]);
+
+    uint8_t Tmp[16];
+
+    uint8_t Elements = OpSize / Op->Header.ElementSize;
+
+    auto Func = [](auto a, auto min, auto max) { return a; };
+    switch (Op->Header.ElementSize) {
+      DO_VECTOR_1SRC_2TYPE_OP_TOP_SRC(2, uint16_t, uint8_t, Func,  0, 0)
+      DO_VECTOR_1SRC_2TYPE_OP_TOP_SRC(4, uint32_t, uint16_t, Func, 0, 0)
+      DO_VECTOR_1SRC_2TYPE_OP_TOP_SRC(8, uint64_t, uint32_t, Func, 0, 0)
+      default: LogMan::Msg::A("Unknown Element Size: %d", Op->Header.ElementSize); break;
+    }
+    memcpy(GDP, Tmp, OpSize);
+    NEXT_OP();
+  }
+  DEF_OP(VUMIN): {
+    auto Op = IROp->C<IR::IROp_VUMin>();
+    void *Src1 = GetSrc<void*>(SSAData, Op->Header.Args[0]);
+    void *Src2 = GetSrc<void*>(SSAData, Op->Header.Args[1]);
+    uint8_t Tmp[16];
+
+    uint8_t Elements = OpSize / Op->Header.ElementSize;
+    auto Func = [](auto a, auto b) { return std::min(a, b); };
+
+    switch (Op->Header.ElementSize) {
+      DO_VECTOR_OP(1, uint8_t,  Func)
+      DO_VECTOR_OP(2, uint16_t, Func)
+      DO_VECTOR_OP(4, uint32_t, Func)
+      DO_VECTOR_OP(8, uint64_t, Func)
+      default: LogMan::Msg::A("Unknown Element Size: %d", Op->Header.ElementSize); break;
+    }
+    memcpy(GDP, Tmp, OpSize);
+    NEXT_OP();
+  }
+  DEF_OP(VSMIN): {
+    auto Op = IROp->C<IR::IROp_VSMin>();
+    void *Src1 = GetSrc<void*>(SSAData, Op->Header.Args[0]);
+    void *Src2 = GetSrc<void*>(SSAData, Op->Header.Args[1]);
+    uint8_t Tmp[16];
+
+    uint8_t Elements = OpSize / Op->Header.ElementSize;
+    auto Func = [](auto a, auto b) { return std::min(a, b); };
+
+    switch (Op->Header.ElementSize) {
+      DO_VECTOR_OP(1, int8_t,  Func)
+      DO_VECTOR_OP(2, int16_t, Func)
+      DO_VECTOR_OP(4, int32_t, Func)
+      DO_VECTOR_OP(8, int64_t, Func)
+      default: LogMan::Msg::A("Unknown Element Size: %d", Op->Header.ElementSize); break;
+    }
+    memcpy(GDP, Tmp, OpSize);
+    NEXT_OP();
+  }
+  DEF_OP(VUMAX): {
+    auto Op = IROp->C<IR::IROp_VUMax>();
+    void *Src1 = GetSrc<void*>(SSAData, Op->Header.Args[0]);
+    void *Src2 = GetSrc<void*>(SSAData, Op->Header.Args[1]);
+    uint8_t Tmp[16];
+
+    uint8_t Elements = OpSize / Op->Header.ElementSize;
+    auto Func = [](auto a, auto b) { return std::max(a, b); };
+
+    switch (Op->Header.ElementSize) {
+      DO_VECTOR_OP(1, uint8_t,  Func)
+      DO_VECTOR_OP(2, uint16_t, Func)
+      DO_VECTOR_OP(4, uint32_t, Func)
+      DO_VECTOR_OP(8, uint64_t, Func)
+      default: LogMan::Msg::A("Unknown Element Size: %d", Op->Header.ElementSize); break;
+    }
+    memcpy(GDP, Tmp, OpSize);
+    NEXT_OP();
+  }
+  DEF_OP(VSMAX): {
+    auto Op = IROp->C<IR::IROp_VSMax>();
+    void *Src1 = GetSrc<void*>(SSAData, Op->Header.Args[0]);
+    void *Src2 = GetSrc<void*>(SSAData, Op->Header.Args[1]);
+    uint8_t Tmp[16];
+
+    uint8_t Elements = OpSize / Op->Header.ElementSize;
+    auto Func = [](auto a, auto b) { return std::max(a, b); };
+
+    switch (Op->Header.ElementSize) {
+      DO_VECTOR_OP(1, int8_t,  Func)
+      DO_VECTOR_OP(2, int16_t, Func)
+      DO_VECTOR_OP(4, int32_t, Func)
+      DO_VECTOR_OP(8, int64_t, Func)
+      default: LogMan::Msg::A("Unknown Element Size: %d", Op->Header.ElementSize); break;
+    }
+    memcpy(GDP, Tmp, OpSize);
+    NEXT_OP();
+  }
+  DEF_OP(VUSHL): {
+    auto Op = IROp->C<IR::IROp_VUShl>();
+    void *Src1 = GetSrc<void*>(SSAData, Op->Header.Args[0]);
+    void *Src2 = GetSrc<void*>(SSAData, Op->Header.Args[1]);
+    uint8_t Tmp[16];
+
+    uint8_t Elements = OpSize / Op->Header.ElementSize;
+    auto Func = [](auto a, auto b) { return b >= (sizeof(a) * 8) ? 0 : a << b; };
+
+    switch (Op->Header.ElementSize) {
+      DO_VECTOR_OP(1, uint8_t,  Func)
+      DO_VECTOR_OP(2, uint16_t, Func)
+      DO_VECTOR_OP(4, uint32_t, Func)
+      DO_VECTOR_OP(8, uint64_t, Func)
+      default: LogMan::Msg::A("Unknown Element Size: %d", Op->Header.ElementSize); break;
+    }
+    memcpy(GDP, Tmp, OpSize);
+    NEXT_OP();
+  }
+  DEF_OP(VSSHR): {
+    auto Op = IROp->C<IR::IROp_VSShr>();
+    void *Src1 = GetSrc<void*>(SSAData, Op->Header.Args[0]);
+    void *Src2 = GetSrc<void*>(SSAData, Op->Header.Args[1]);
+    uint8_t Tmp[16];
+
+    uint8_t Elements = OpSize / Op->Header.ElementSize;
+    auto Func = [](auto a, auto b) { return b >= (sizeof(a) * 8) ? (a >> (sizeof(a) * 8 - 1)) : a >> b; };
+
+    switch (Op->Header.ElementSize) {
+      DO_VECTOR_OP(1, int8_t,  Func)
+      DO_VECTOR_OP(2, int16_t, Func)
+      DO_VECTOR_OP(4, int32_t, Func)
+      DO_VECTOR_OP(8, int64_t, Func)
+      default: LogMan::Msg::A("Unknown Element Size: %d", Op->Header.ElementSize); break;
+    }
+    memcpy(GDP, Tmp, OpSize);
+    NEXT_OP();
+  }
+
+  DEF_OP(VUSHLS): {
+    auto Op = IROp->C<IR::IROp_VUShlS>();
+    void *Src1 = GetSrc<void*>(SSAData, Op->Header.Args[0]);
+    void *Src2 = GetSrc<void*>(SSAData, Op->Header.Args[1]);
+    uint8_t Tmp[16];
+
+    uint8_t Elements = OpSize / Op->Header.ElementSize;
+    auto Func = [](auto a, auto b) { return b >= (sizeof(a) * 8) ? 0 : a << b; };
+
+    switch (Op->Header.ElementSize) {
+      DO_VECTOR_SCALAR_OP(1, uint8_t, Func)
+      DO_VECTOR_SCALAR_OP(2, uint16_t, Func)
+      DO_VECTOR_SCALAR_OP(4, uint32_t, Func)
+      DO_VECTOR_SCALAR_OP(8, uint64_t, Func)
+      DO_VECTOR_SCALAR_OP(16, __uint128_t, Func)
+      default: LogMan::Msg::A("Unknown Element Size: %d", Op->Header.ElementSize); break;
+    }
+    memcpy(GDP, Tmp, OpSize);
+    NEXT_OP();
+  }
+  DEF_OP(VUSHRS): {
+    auto Op = IROp->C<IR::IROp_VUShrS>();
+    void *Src1 = GetSrc<void*>(SSAData, Op->Header.Args[0]);
+    void *Src2 = GetSrc<void*>(SSAData, Op->Header.Args[1]);
+    uint8_t Tmp[16];
+
+    uint8_t Elements = OpSize / Op->Header.ElementSize;
+    auto Func = [](auto a, auto b) { return b >= (sizeof(a) * 8) ? 0 : a >> b; };
+
+    switch (Op->Header.ElementSize) {
+      DO_VECTOR_SCALAR_OP(1, uint8_t, Func)
+      DO_VECTOR_SCALAR_OP(2, uint16_t, Func)
+      DO_VECTOR_SCALAR_OP(4, uint32_t, Func)
+      DO_VECTOR_SCALAR_OP(8, uint64_t, Func)
+      DO_VECTOR_SCALAR_OP(16, __uint128_t, Func)
+      default: LogMan::Msg::A("Unknown Element Size: %d", Op->Header.ElementSize); break;
+    }
+    memcpy(GDP, Tmp, OpSize);
+    NEXT_OP();
+  }
+  DEF_OP(VSSHRS): {
+    auto Op = IROp->C<IR::IROp_VSShrS>();
+    void *Src1 = GetSrc<void*>(SSAData, Op->Header.Args[0]);
+    void *Src2 = GetSrc<void*>(SSAData, Op->Header.Args[1]);
+    uint8_t Tmp[16];
+
+    uint8_t Elements = OpSize / Op->Header.ElementSize;
+    auto Func = [](auto a, auto b) { return b >= (sizeof(a) * 8) ? (a >> (sizeof(a) * 8 - 1)) : a >> b; };
+
+    switch (Op->Header.ElementSize) {
+      DO_VECTOR_SCALAR_OP(1, int8_t, Func)
+      DO_VECTOR_SCALAR_OP(2, int16_t, Func)
+      DO_VECTOR_SCALAR_OP(4, int32_t, Func)
+      DO_VECTOR_SCALAR_OP(8, int64_t, Func)
+      DO_VECTOR_SCALAR_OP(16, __int128_t, Func)
+      default: LogMan::Msg::A("Unknown Element Size: %d", Op->Header.ElementSize); break;
+    }
+    memcpy(GDP, Tmp, OpSize);
+    NEXT_OP();
+  }
+  DEF_OP(VUSHR): {
+    auto Op = IROp->C<IR::IROp_VUShr>();
+    void *Src1 = GetSrc<void*>(SSAData, Op->Header.Args[0]);
+    void *Src2 = GetSrc<void*>(SSAData, Op->Header.Args[1]);
+    uint8_t Tmp[16];
+
+    uint8_t Elements = OpSize / Op->Header.ElementSize;
+    auto Func = [](auto a, auto b) { return b >= (sizeof(a) * 8) ? 0 : a >> b; };
+
+    switch (Op->Header.ElementSize) {
+      DO_VECTOR_OP(1, uint8_t,  Func)
+      DO_VECTOR_OP(2, uint16_t, Func)
+      DO_VECTOR_OP(4, uint32_t, Func)
+      DO_VECTOR_OP(8, uint64_t, Func)
+      default: LogMan::Msg::A("Unknown Element Size: %d", Op->Header.ElementSize); break;
+    }
+    memcpy(GDP, Tmp, OpSize);
+    NEXT_OP();
+  }
+  DEF_OP(VZIP2):
+  DEF_OP(VZIP): {
+    auto Op = IROp->C<IR::IROp_VZip>();
+    void *Src1 = GetSrc<void*>(SSAData, Op->Header.Args[0]);
+    void *Src2 = GetSrc<void*>(SSAData, Op->Header.Args[1]);
+    uint8_t Tmp[16];
+    uint8_t Elements = OpSize / Op->Header.ElementSize;
+    uint8_t BaseOffset = IROp->Op == IR::OP_VZIP2 ? (Elements / 2) : 0;
+    Elements >>= 1;
+
+    switch (Op->Header.ElementSize) {
+      case 1: {
+        auto *Dst_d  = reinterpret_cast<uint8_t*>(Tmp);
+        auto *Src1_d = reinterpret_cast<uint8_t*>(Src1);
+        auto *Src2_d = reinterpret_cast<uint8_t*>(Src2);
+        for (unsigned i = 0; i < Elements; ++i) {
+          Dst_d[i*2] = Src1_d[BaseOffset + i];
+          Dst_d[i*2+1] = Src2_d[BaseOffset + i];
+        }
+        break;
+      }
+      case 2: {
+        auto *Dst_d  = reinterpret_cast<uint16_t*>(Tmp);
+        auto *Src1_d = reinterpret_cast<uint16_t*>(Src1);
+        auto *Src2_d = reinterpret_cast<uint16_t*>(Src2);
+        for (unsigned i = 0; i < Elements; ++i) {
+          Dst_d[i*2] = Src1_d[BaseOffset + i];
+          Dst_d[i*2+1] = Src2_d[BaseOffset + i];
+        }
+        break;
+      }
+      case 4: {
+        auto *Dst_d  = reinterpret_cast<uint32_t*>(Tmp);
+        auto *Src1_d = reinterpret_cast<uint32_t*>(Src1);
+        auto *Src2_d = reinterpret_cast<uint32_t*>(Src2);
+        for (unsigned i = 0; i < Elements; ++i) {
+          Dst_d[i*2] = Src1_d[BaseOffset + i];
+          Dst_d[i*2+1] = Src2_d[BaseOffset + i];
+        }
+        break;
+      }
+      case 8: {
+        auto *Dst_d  = reinterpret_cast<uint64_t*>(Tmp);
+        auto *Src1_d = reinterpret_cast<uint64_t*>(Src1);
+        auto *Src2_d = reinterpret_cast<uint64_t*>(Src2);
+        for (unsigned i = 0; i < Elements; ++i) {
+          Dst_d[i*2] = Src1_d[BaseOffset + i];
+          Dst_d[i*2+1] = Src2_d[BaseOffset + i];
+        }
+        break;
+      }
+      default: LogMan::Msg::A("Unknown Element Size: %d", Op->Header.ElementSize); break;
+    }
+
+    memcpy(GDP, Tmp, OpSize);
+    NEXT_OP();
+  }
+  DEF_OP(VINSELEMENT): {
+    auto Op = IROp->C<IR::IROp_VInsElement>();
+    void *Src1 = GetSrc<void*>(SSAData, Op->Header.Args[0]);
+    void *Src2 = GetSrc<void*>(SSAData, Op->Header.Args[1]);
+    uint8_t Tmp[16];
+
+    // Copy src1 in to dest
+    memcpy(Tmp, Src1, OpSize);
+    switch (Op->Header.ElementSize) {
+      case 1: {
+        auto *Dst_d  = reinterpret_cast<uint8_t*>(Tmp);
+        auto *Src2_d = reinterpret_cast<uint8_t*>(Src2);
+        Dst_d[Op->DestIdx] = Src2_d[Op->SrcIdx];
+        break;
+      }
+      case 2: {
+        auto *Dst_d  = reinterpret_cast<uint16_t*>(Tmp);
+        auto *Src2_d = reinterpret_cast<uint16_t*>(Src2);
+        Dst_d[Op->DestIdx] = Src2_d[Op->SrcIdx];
+        break;
+      }
+      case 4: {
+        auto *Dst_d  = reinterpret_cast<uint32_t*>(Tmp);
+        auto *Src2_d = reinterpret_cast<uint32_t*>(Src2);
+        Dst_d[Op->DestIdx] = Src2_d[Op->SrcIdx];
+        break;
+      }
+      case 8: {
+        auto *Dst_d  = reinterpret_cast<uint64_t*>(Tmp);
+        auto *Src2_d = reinterpret_cast<uint64_t*>(Src2);
+        Dst_d[Op->DestIdx] = Src2_d[Op->SrcIdx];
+        break;
+      }
+      default: LogMan::Msg::A("Unknown Element Size: %d", Op->Header.ElementSize); break;
+    };
+    memcpy(GDP, Tmp, OpSize);
+    NEXT_OP();
+  }
+  DEF_OP(VINSSCALARELEMENT): {
+    auto Op = IROp->C<IR::IROp_VInsScalarElement>();
+    void *Src1 = GetSrc<void*>(SSAData, Op->Header.Args[0]);
+    void *Src2 = GetSrc<void*>(SSAData, Op->Header.Args[1]);
+    uint8_t Tmp[16];
+
+    // Copy src1 in to dest
+    memcpy(Tmp, Src1, OpSize);
+    switch (Op->Header.ElementSize) {
+      case 1: {
+        auto *Dst_d  = reinterpret_cast<uint8_t*>(Tmp);
+        auto Src2_d = *reinterpret_cast<uint8_t*>(Src2);
+        Dst_d[Op->DestIdx] = Src2_d;
+        break;
+      }
+      case 2: {
+        auto *Dst_d  = reinterpret_cast<uint16_t*>(Tmp);
+        auto Src2_d = *reinterpret_cast<uint16_t*>(Src2);
+        Dst_d[Op->DestIdx] = Src2_d;
+        break;
+      }
+      case 4: {
+        auto *Dst_d  = reinterpret_cast<uint32_t*>(Tmp);
+        auto Src2_d = *reinterpret_cast<uint32_t*>(Src2);
+        Dst_d[Op->DestIdx] = Src2_d;
+        break;
+      }
+      case 8: {
+        auto *Dst_d  = reinterpret_cast<uint64_t*>(Tmp);
+        auto Src2_d = *reinterpret_cast<uint64_t*>(Src2);
+        Dst_d[Op->DestIdx] = Src2_d;
+        break;
+      }
+      default: LogMan::Msg::A("Unknown Element Size: %d", Op->Header.ElementSize); break;
+    };
+    memcpy(GDP, Tmp, OpSize);
+    NEXT_OP();
+  }
+
+  DEF_OP(VBSL): {
+    auto Op = IROp->C<IR::IROp_VBSL>();
+    __uint128_t Src1 = *GetSrc<__uint128_t*>(SSAData, Op->Header.Args[0]);
+    __uint128_t Src2 = *GetSrc<__uint128_t*>(SSAData, Op->Header.Args[1]);
+    __uint128_t Src3 = *GetSrc<__uint128_t*>(SSAData, Op->Header.Args[2]);
+
+    __uint128_t Tmp{};
+    Tmp = Src2 & Src1;
+    Tmp |= Src3 & ~Src1;
+
+    memcpy(GDP, &Tmp, 16);
+    NEXT_OP();
+  }
+  DEF_OP(VCMPEQ): {
+    auto Op = IROp->C<IR::IROp_VCMPEQ>();
+    void *Src1 = GetSrc<void*>(SSAData, Op->Header.Args[0]);
+    void *Src2 = GetSrc<void*>(SSAData, Op->Header.Args[1]);
+    uint8_t Tmp[16];
+
+    uint8_t Elements = OpSize / Op->Header.ElementSize;
+    auto Func = [](auto a, auto b) { return a == b ? ~0ULL : 0; };
+
+    switch (Op->Header.ElementSize) {
+      DO_VECTOR_OP(1, uint8_t,   Func)
+      DO_VECTOR_OP(2, uint16_t,  Func)
+      DO_VECTOR_OP(4, uint32_t,  Func)
+      DO_VECTOR_OP(8, uint64_t,  Func)
+      default: LogMan::Msg::A("Unknown Element Size: %d", Op->Header.ElementSize); break;
+    }
+
+    memcpy(GDP, Tmp, OpSize);
+    NEXT_OP();
+  }
+  DEF_OP(VCMPEQZ): {
+    auto Op = IROp->C<IR::IROp_VCMPEQZ>();
+    void *Src1 = GetSrc<void*>(SSAData, Op->Header.Args[0]);
+    uint8_t Src2[16]{};
+    uint8_t Tmp[16];
+
+    uint8_t Elements = OpSize / Op->Header.ElementSize;
+    auto Func = [](auto a, auto b) { return a == b ? ~0ULL : 0; };
+
+    switch (Op->Header.ElementSize) {
+      DO_VECTOR_OP(1, uint8_t,   Func)
+      DO_VECTOR_OP(2, uint16_t,  Func)
+      DO_VECTOR_OP(4, uint32_t,  Func)
+      DO_VECTOR_OP(8, uint64_t,  Func)
+      default: LogMan::Msg::A("Unknown Element Size: %d", Op->Header.ElementSize); break;
+    }
+
+    memcpy(GDP, Tmp, OpSize);
+    NEXT_OP();
+  }
+  DEF_OP(VCMPGT): {
+    auto Op = IROp->C<IR::IROp_VCMPGT>();
+    void *Src1 = GetSrc<void*>(SSAData, Op->Header.Args[0]);
+    void *Src2 = GetSrc<void*>(SSAData, Op->Header.Args[1]);
+    uint8_t Tmp[16];
+
+    uint8_t Elements = OpSize / Op->Header.ElementSize;
+    auto Func = [](auto a, auto b) { return a > b ? ~0ULL : 0; };
+
+    switch (Op->Header.ElementSize) {
+      DO_VECTOR_OP(1, int8_t,   Func)
+      DO_VECTOR_OP(2, int16_t,  Func)
+      DO_VECTOR_OP(4, int32_t,  Func)
+      DO_VECTOR_OP(8, int64_t,  Func)
+      default: LogMan::Msg::A("Unknown Element Size: %d", Op->Header.ElementSize); break;
+    }
+
+    memcpy(GDP, Tmp, OpSize);
+    NEXT_OP();
+  }
+  DEF_OP(VCMPGTZ): {
+    auto Op = IROp->C<IR::IROp_VCMPGTZ>();
+    void *Src1 = GetSrc<void*>(SSAData, Op->Header.Args[0]);
+    uint8_t Src2[16]{};
+    uint8_t Tmp[16];
+
+    uint8_t Elements = OpSize / Op->Header.ElementSize;
+    auto Func = [](auto a, auto b) { return a > b ? ~0ULL : 0; };
+
+    switch (Op->Header.ElementSize) {
+      DO_VECTOR_OP(1, int8_t,   Func)
+      DO_VECTOR_OP(2, int16_t,  Func)
+      DO_VECTOR_OP(4, int32_t,  Func)
+      DO_VECTOR_OP(8, int64_t,  Func)
+      default: LogMan::Msg::A("Unknown Element Size: %d", Op->Header.ElementSize); break;
+    }
+
+    memcpy(GDP, Tmp, OpSize);
+    NEXT_OP();
+  }
+  DEF_OP(VCMPLTZ): {
+    auto Op = IROp->C<IR::IROp_VCMPLTZ>();
+    void *Src1 = GetSrc<void*>(SSAData, Op->Header.Args[0]);
+    uint8_t Src2[16]{};
+    uint8_t Tmp[16];
+
+    uint8_t Elements = OpSize / Op->Header.ElementSize;
+    auto Func = [](auto a, auto b) { return a < b ? ~0ULL : 0; };
+
+    switch (Op->Header.ElementSize) {
+      DO_VECTOR_OP(1, int8_t,   Func)
+      DO_VECTOR_OP(2, int16_t,  Func)
+      DO_VECTOR_OP(4, int32_t,  Func)
+      DO_VECTOR_OP(8, int64_t,  Func)
+      default: LogMan::Msg::A("Unknown Element Size: %d", Op->Header.ElementSize); break;
+    }
+
+    memcpy(GDP, Tmp, OpSize);
+    NEXT_OP();
+  }
+  DEF_OP(LUDIV): {
+    auto Op = IROp->C<IR::IROp_LUDiv>();
+    // Each source is OpSize in size
+    // So you can have up to a 128bit divide from x86-64
+    switch (OpSize) {
+      case 2: {
+        uint16_t SrcLow = *GetSrc<uint16_t*>(SSAData, Op->Header.Args[0]);
+        uint16_t SrcHigh = *GetSrc<uint16_t*>(SSAData, Op->Header.Args[1]);
+        uint16_t Divisor = *GetSrc<uint16_t*>(SSAData, Op->Header.Args[2]);
+        uint32_t Source = (static_cast<uint32_t>(SrcHigh) << 16) | SrcLow;
+        uint32_t Res = Source / Divisor;
+
+        // We only store the lower bits of the result
+        GD = static_cast<uint16_t>(Res);
+        break;
+      }
+      case 4: {
+        uint32_t SrcLow = *GetSrc<uint32_t*>(SSAData, Op->Header.Args[0]);
+        uint32_t SrcHigh = *GetSrc<uint32_t*>(SSAData, Op->Header.Args[1]);
+        uint32_t Divisor = *GetSrc<uint32_t*>(SSAData, Op->Header.Args[2]);
+        uint64_t Source = (static_cast<uint64_t>(SrcHigh) << 32) | SrcLow;
+        uint64_t Res = Source / Divisor;
+
+        // We only store the lower bits of the result
+        GD = static_cast<uint32_t>(Res);
+        break;
+      }
+      case 8: {
+        uint64_t SrcLow = *GetSrc<uint64_t*>(SSAData, Op->Header.Args[0]);
+        uint64_t SrcHigh = *GetSrc<uint64_t*>(SSAData, Op->Header.Args[1]);
+        uint64_t Divisor = *GetSrc<uint64_t*>(SSAData, Op->Header.Args[2]);
+        __uint128_t Source = (static_cast<__uint128_t>(SrcHigh) << 64) | SrcLow;
+        __uint128_t Res = Source / Divisor;
+
+        // We only store the lower bits of the result
+        memcpy(GDP, &Res, OpSize);
+        break;
+      }
+      default: LogMan::Msg::A("Unknown LUDIV Size: %d", OpSize); break;
+    }
+    NEXT_OP();
+  }
+  DEF_OP(LDIV): {
+    auto Op = IROp->C<IR::IROp_LDiv>();
+    // Each source is OpSize in size
+    // So you can have up to a 128bit divide from x86-64
+    switch (OpSize) {
+      case 2: {
+        uint16_t SrcLow = *GetSrc<uint16_t*>(SSAData, Op->Header.Args[0]);
+        uint16_t SrcHigh = *GetSrc<uint16_t*>(SSAData, Op->Header.Args[1]);
+        int16_t Divisor = *GetSrc<uint16_t*>(SSAData, Op->Header.Args[2]);
+        int32_t Source = (static_cast<uint32_t>(SrcHigh) << 16) | SrcLow;
+        int32_t Res = Source / Divisor;
+
+        // We only store the lower bits of the result
+        GD = static_cast<int16_t>(Res);
+        break;
+      }
+      case 4: {
+        uint32_t SrcLow = *GetSrc<uint32_t*>(SSAData, Op->Header.Args[0]);
+        uint32_t SrcHigh = *GetSrc<uint32_t*>(SSAData, Op->Header.Args[1]);
+        int32_t Divisor = *GetSrc<uint32_t*>(SSAData, Op->Header.Args[2]);
+        int64_t Source = (static_cast<uint64_t>(SrcHigh) << 32) | SrcLow;
+        int64_t Res = Source / Divisor;
+
+        // We only store the lower bits of the result
+        GD = static_cast<int32_t>(Res);
+        break;
+      }
+      case 8: {
+        uint64_t SrcLow = *GetSrc<uint64_t*>(SSAData, Op->Header.Args[0]);
+        uint64_t SrcHigh = *GetSrc<uint64_t*>(SSAData, Op->Header.Args[1]);
+        int64_t Divisor = *GetSrc<int64_t*>(SSAData, Op->Header.Args[2]);
+        __int128_t Source = (static_cast<__int128_t>(SrcHigh) << 64) | SrcLow;
+        __int128_t Res = Source / Divisor;
+
+        // We only store the lower bits of the result
+        memcpy(GDP, &Res, OpSize);
+        break;
+      }
+      default: LogMan::Msg::A("Unknown LDIV Size: %d", OpSize); break;
+    }
+    NEXT_OP();
+  }
+  DEF_OP(LUREM): {
+    auto Op = IROp->C<IR::IROp_LURem>();
+    // Each source is OpSize in size
+    // So you can have up to a 128bit Remainder from x86-64
+    switch (OpSize) {
+      case 2: {
+        uint16_t SrcLow = *GetSrc<uint16_t*>(SSAData, Op->Header.Args[0]);
+        uint16_t SrcHigh = *GetSrc<uint16_t*>(SSAData, Op->Header.Args[1]);
+        uint16_t Divisor = *GetSrc<uint16_t*>(SSAData, Op->Header.Args[2]);
+        uint32_t Source = (static_cast<uint32_t>(SrcHigh) << 16) | SrcLow;
+        uint32_t Res = Source % Divisor;
+
+        // We only store the lower bits of the result
+        GD = static_cast<uint16_t>(Res);
+        break;
+      }
+
+      case 4: {
+        uint32_t SrcLow = *GetSrc<uint32_t*>(SSAData, Op->Header.Args[0]);
+        uint32_t SrcHigh = *GetSrc<uint32_t*>(SSAData, Op->Header.Args[1]);
+        uint32_t Divisor = *GetSrc<uint32_t*>(SSAData, Op->Header.Args[2]);
+        uint64_t Source = (static_cast<uint64_t>(SrcHigh) << 32) | SrcLow;
+        uint64_t Res = Source % Divisor;
+
+        // We only store the lower bits of the result
+        GD = static_cast<uint32_t>(Res);
+        break;
+      }
+      case 8: {
+        uint64_t SrcLow = *GetSrc<uint64_t*>(SSAData, Op->Header.Args[0]);
+        uint64_t SrcHigh = *GetSrc<uint64_t*>(SSAData, Op->Header.Args[1]);
+        uint64_t Divisor = *GetSrc<uint64_t*>(SSAData, Op->Header.Args[2]);
+        __uint128_t Source = (static_cast<__uint128_t>(SrcHigh) << 64) | SrcLow;
+        __uint128_t Res = Source % Divisor;
+        // We only store the lower bits of the result
+        memcpy(GDP, &Res, OpSize);
+        break;
+      }
+      default: LogMan::Msg::A("Unknown LUREM Size: %d", OpSize); break;
+    }
+    NEXT_OP();
+  }
+  DEF_OP(LREM): {
+    auto Op = IROp->C<IR::IROp_LRem>();
+    // Each source is OpSize in size
+    // So you can have up to a 128bit Remainder from x86-64
+    switch (OpSize) {
+      case 2: {
+        uint16_t SrcLow = *GetSrc<uint16_t*>(SSAData, Op->Header.Args[0]);
+        uint16_t SrcHigh = *GetSrc<uint16_t*>(SSAData, Op->Header.Args[1]);
+        int16_t Divisor = *GetSrc<uint16_t*>(SSAData, Op->Header.Args[2]);
+        int32_t Source = (static_cast<uint32_t>(SrcHigh) << 16) | SrcLow;
+        int32_t Res = Source % Divisor;
+
+        // We only store the lower bits of the result
+        GD = static_cast<int16_t>(Res);
+        break;
+      }
+      case 4: {
+        uint32_t SrcLow = *GetSrc<uint32_t*>(SSAData, Op->Header.Args[0]);
+        uint32_t SrcHigh = *GetSrc<uint32_t*>(SSAData, Op->Header.Args[1]);
+        int32_t Divisor = *GetSrc<uint32_t*>(SSAData, Op->Header.Args[2]);
+        int64_t Source = (static_cast<uint64_t>(SrcHigh) << 32) | SrcLow;
+        int64_t Res = Source % Divisor;
+
+        // We only store the lower bits of the result
+        GD = static_cast<int32_t>(Res);
+        break;
+      }
+      case 8: {
+        uint64_t SrcLow = *GetSrc<uint64_t*>(SSAData, Op->Header.Args[0]);
+        uint64_t SrcHigh = *GetSrc<uint64_t*>(SSAData, Op->Header.Args[1]);
+        int64_t Divisor = *GetSrc<int64_t*>(SSAData, Op->Header.Args[2]);
+        __int128_t Source = (static_cast<__int128_t>(SrcHigh) << 64) | SrcLow;
+        __int128_t Res = Source % Divisor;
+        // We only store the lower bits of the result
+        memcpy(GDP, &Res, OpSize);
+        break;
+      }
+      default: LogMan::Msg::A("Unknown LREM Size: %d", OpSize); break;
+    }
+    NEXT_OP();
+  }
+  DEF_OP(VEXTR): {
+    auto Op = IROp->C<IR::IROp_VExtr>();
+    __uint128_t Src1 = *GetSrc<__uint128_t*>(SSAData, Op->Header.Args[0]);
+    __uint128_t Src2 = *GetSrc<__uint128_t*>(SSAData, Op->Header.Args[1]);
+
+    uint64_t Offset = Op->Index * Op->Header.ElementSize * 8;
+    __uint128_t Dst{};
+    if (Offset >= (OpSize * 8)) {
+      Offset -= OpSize * 8;
+      Dst = Src1 >> Offset;
+    }
+    else {
+      Dst = (Src1 << (OpSize * 8 - Offset)) | (Src2 >> Offset);
+    }
+
+    memcpy(GDP, &Dst, OpSize);
+    NEXT_OP();
+  }
+  DEF_OP(VINSGPR): {
+    auto Op = IROp->C<IR::IROp_VInsGPR>();
+    __uint128_t Src1 = *GetSrc<__uint128_t*>(SSAData, Op->Header.Args[0]);
+    __uint128_t Src2 = *GetSrc<__uint128_t*>(SSAData, Op->Header.Args[1]);
+
+    uint64_t Offset = Op->Index * Op->Header.ElementSize * 8;
+    __uint128_t Mask = (1ULL << (Op->Header.ElementSize * 8)) - 1;
+    Mask <<= Offset;
+    Mask = ~Mask;
+    __uint128_t Dst = Src1 & Mask;
+    Dst |= Src2 << Offset;
+
+    memcpy(GDP, &Dst, OpSize);
+    NEXT_OP();
+  }
+  DEF_OP(FLOAT_FROMGPR_S): {
+    auto Op = IROp->C<IR::IROp_Float_FromGPR_S>();
+
+    uint16_t Conv = (Op->Header.ElementSize << 8) | Op->SrcElementSize;
+    switch (Conv) {
+      case 0x0404: { // Float <- int32_t
+        float Dst = (float)*GetSrc<int32_t*>(SSAData, Op->Header.Args[0]);
+        memcpy(GDP, &Dst, Op->Header.ElementSize);
+        break;
+      }
+      case 0x0408: { // Float <- int64_t
+        float Dst = (float)*GetSrc<int64_t*>(SSAData, Op->Header.Args[0]);
+        memcpy(GDP, &Dst, Op->Header.ElementSize);
+        break;
+      }
+      case 0x0804: { // Double <- int32_t
+        double Dst = (double)*GetSrc<int32_t*>(SSAData, Op->Header.Args[0]);
+        memcpy(GDP, &Dst, Op->Header.ElementSize);
+        break;
+      }
+      case 0x0808: { // Double <- int64_t
+        double Dst = (double)*GetSrc<int64_t*>(SSAData, Op->Header.Args[0]);
+        memcpy(GDP, &Dst, Op->Header.ElementSize);
+        break;
+      }
+    }
+    NEXT_OP();
+  }
+  DEF_OP(FLOAT_FROMGPR_U): {
+    auto Op = IROp->C<IR::IROp_Float_FromGPR_U>();
+    uint16_t Conv = (Op->Header.ElementSize << 8) | Op->SrcElementSize;
+    switch (Conv) {
+      case 0x0404: { // Float <- int32_t
+        float Dst = (float)*GetSrc<uint32_t*>(SSAData, Op->Header.Args[0]);
+        memcpy(GDP, &Dst, Op->Header.ElementSize);
+        break;
+      }
+      case 0x0408: { // Float <- int64_t
+        float Dst = (float)*GetSrc<uint64_t*>(SSAData, Op->Header.Args[0]);
+        memcpy(GDP, &Dst, Op->Header.ElementSize);
+        break;
+      }
+      case 0x0804: { // Double <- int32_t
+        double Dst = (double)*GetSrc<uint32_t*>(SSAData, Op->Header.Args[0]);
+        memcpy(GDP, &Dst, Op->Header.ElementSize);
+        break;
+      }
+      case 0x0808: { // Double <- int64_t
+        double Dst = (double)*GetSrc<uint64_t*>(SSAData, Op->Header.Args[0]);
+        memcpy(GDP, &Dst, Op->Header.ElementSize);
+        break;
+      }
+    }
+    NEXT_OP();
+  }
+  DEF_OP(FLOAT_TOGPR_ZS): {
+    auto Op = IROp->C<IR::IROp_Float_ToGPR_ZS>();
+    if (Op->Header.ElementSize == 8) {
+      int64_t Dst = (int64_t)*GetSrc<double*>(SSAData, Op->Header.Args[0]);
+      memcpy(GDP, &Dst, Op->Header.ElementSize);
+    }
+    else {
+      int32_t Dst = (int32_t)*GetSrc<float*>(SSAData, Op->Header.Args[0]);
+      memcpy(GDP, &Dst, Op->Header.ElementSize);
+    }
+    NEXT_OP();
+  }
+  DEF_OP(FLOAT_TOGPR_ZU): {
+    auto Op = IROp->C<IR::IROp_Float_ToGPR_ZU>();
+    if (Op->Header.ElementSize == 8) {
+      uint64_t Dst = (uint64_t)*GetSrc<double*>(SSAData, Op->Header.Args[0]);
+      memcpy(GDP, &Dst, Op->Header.ElementSize);
+    }
+    else {
+      uint32_t Dst = (uint32_t)*GetSrc<float*>(SSAData, Op->Header.Args[0]);
+      memcpy(GDP, &Dst, Op->Header.ElementSize);
+    }
+    NEXT_OP();
+  }
+  DEF_OP(FLOAT_TOGPR_S): {
+    auto Op = IROp->C<IR::IROp_Float_ToGPR_S>();
+    // Rounds with the current rounding mode, a cast would always truncate
+    if (Op->Header.ElementSize == 8) {
+      int64_t Dst = std::llrint(*GetSrc<double*>(SSAData, Op->Header.Args[0]));
+      memcpy(GDP, &Dst, Op->Header.ElementSize);
+    }
+    else {
+      int32_t Dst = std::lrint(*GetSrc<float*>(SSAData, Op->Header.Args[0]));
+      memcpy(GDP, &Dst, Op->Header.ElementSize);
+    }
+    NEXT_OP();
+  }
+  DEF_OP(FLOAT_TOGPR_U): {
+    auto Op = IROp->C<IR::IROp_Float_ToGPR_U>();
+    if (Op->Header.ElementSize == 8) {
+      uint64_t Dst = (uint64_t)*GetSrc<double*>(SSAData, Op->Header.Args[0]);
+      memcpy(GDP, &Dst, Op->Header.ElementSize);
+    }
+    else {
+      uint32_t Dst = (uint32_t)*GetSrc<float*>(SSAData, Op->Header.Args[0]);
+      memcpy(GDP, &Dst, Op->Header.ElementSize);
+    }
+    NEXT_OP();
+  }
+  DEF_OP(FLOAT_FTOF): {
+    auto Op = IROp->C<IR::IROp_Float_FToF>();
+    uint16_t Conv = (Op->Header.ElementSize << 8) | Op->SrcElementSize;
+    switch (Conv) {
+      case 0x0804: { // Double <- Float
+        double Dst = (double)*GetSrc<float*>(SSAData, Op->Header.Args[0]);
+        memcpy(GDP, &Dst, 8);
+        break;
+      }
+      case 0x0408: { // Float <- Double
+        float Dst = (float)*GetSrc<double*>(SSAData, Op->Header.Args[0]);
+        memcpy(GDP, &Dst, 4);
+        break;
+      }
+      default: LogMan::Msg::A("Unknown FCVT sizes: 0x%x", Conv);
+    }
+    NEXT_OP();
+  }
+  DEF_OP(VECTOR_FTOF): {
+    auto Op = IROp->C<IR::IROp_Vector_FToF>();
+    void *Src = GetSrc<void*>(SSAData, Op->Header.Args[0]);
+    uint8_t Tmp[16]{};
+
+    uint16_t Conv = (Op->Header.ElementSize << 8) | Op->SrcElementSize;
+
+    auto Func = [](auto a, auto min, auto max) { return a; };
+    switch (Conv) {
+      case 0x0804: { // Double <- float
+        uint8_t Elements = OpSize / Op->SrcElementSize;
+        switch (Op->SrcElementSize) {
+        DO_VECTOR_1SRC_2TYPE_OP(4, double, float, Func, 0, 0)
+        }
+        break;
+      }
+      case 0x0408: { // Float <- Double
+        uint8_t Elements = (OpSize << 1) / Op->SrcElementSize;
+        switch (Op->SrcElementSize) {
+        DO_VECTOR_1SRC_2TYPE_OP(8, float, double, Func, 0, 0)
+        }
+        break;
+
+        break;
+      }
+      default: LogMan::Msg::A("Unknown Conversion Type : 0%04x", Conv); break;
+    }
+    memcpy(GDP, Tmp, OpSize);
+    NEXT_OP();
+  }
+  DEF_OP(FCMP): {
+    auto Op = IROp->C<IR::IROp_FCmp>();
+    uint32_t ResultFlags{};
+    if (Op->ElementSize == 4) {
+      float Src1 = *GetSrc<float*>(SSAData, Op->Header.Args[0]);
+      float Src2 = *GetSrc<float*>(SSAData, Op->Header.Args[1]);
+      bool Unordered = std::isnan(Src1) || std::isnan(Src2);
+      if (Op->Flags & (1 << FCMP_FLAG_LT)) {
+        if (Unordered || (Src1 < Src2)) {
+          ResultFlags |= (1 << FCMP_FLAG_LT);
+        }
+      }
+      if (Op->Flags & (1 << FCMP_FLAG_UNORDERED)) {
+        if (Unordered) {
+          ResultFlags |= (1 << FCMP_FLAG_UNORDERED);
+        }
+      }
+      if (Op->Flags & (1 << FCMP_FLAG_EQ)) {
+        if (Unordered || (Src1 == Src2)) {
+          ResultFlags |= (1 << FCMP_FLAG_EQ);
+        }
+      }
+    }
+    else {
+      double Src1 = *GetSrc<double*>(SSAData, Op->Header.Args[0]);
+      double Src2 = *GetSrc<double*>(SSAData, Op->Header.Args[1]);
+      bool Unordered = std::isnan(Src1) || std::isnan(Src2);
+      if (Op->Flags & (1 << FCMP_FLAG_LT)) {
+        if (Unordered || (Src1 < Src2)) {
+          ResultFlags |= (1 << FCMP_FLAG_LT);
+        }
+      }
+      if (Op->Flags & (1 << FCMP_FLAG_UNORDERED)) {
+        if (Unordered) {
+          ResultFlags |= (1 << FCMP_FLAG_UNORDERED);
+        }
+      }
+      if (Op->Flags & (1 << FCMP_FLAG_EQ)) {
+        if (Unordered || (Src1 == Src2)) {
+          ResultFlags |= (1 << FCMP_FLAG_EQ);
+        }
+      }
+    }
+
+    GD = ResultFlags;
+    NEXT_OP();
+  }
+  DEF_OP(VTBL1): {
+    auto Op = IROp->C<IR::IROp_VTBL1>();
+    uint8_t *Src1 = GetSrc<uint8_t*>(SSAData, Op->Header.Args[0]);
+    uint8_t *Src2 = GetSrc<uint8_t*>(SSAData, Op->Header.Args[1]);
+
+    uint8_t Tmp[16];
+
+    for (size_t i = 0; i < OpSize; ++i) {
+      uint8_t Index = Src2[i];
+      Tmp[i] = Index >= OpSize ? 0 : Src1[Index];
+    }
+    memcpy(GDP, Tmp, OpSize);
+    NEXT_OP();
+  }
+
+  DEF_OP(GETHOSTFLAG): {
+    auto Op = IROp->C<IR::IROp_GetHostFlag>();
+    GD = (*GetSrc<uint64_t*>(SSAData, Op->Header.Args[0]) >> Op->Flag) & 1;
+    NEXT_OP();
+  }
+  #define DO_SCALAR_COMPARE_OP(size, type, type2, func)              \
+    case size: {                                      \
+    auto *Dst_d  = reinterpret_cast<type2*>(Tmp);  \
+    auto *Src1_d = reinterpret_cast<type*>(Src1); \
+    auto *Src2_d = reinterpret_cast<type*>(Src2); \
+    Dst_d[0] = func(Src1_d[0], Src2_d[0]);          \
+    break;                                            \
+    }
+
+  #define DO_VECTOR_COMPARE_OP(size, type, type2, func)              \
+    case size: {                                      \
+    auto *Dst_d  = reinterpret_cast<type2*>(Tmp);  \
+    auto *Src1_d = reinterpret_cast<type*>(Src1); \
+    auto *Src2_d = reinterpret_cast<type*>(Src2); \
+    for (uint8_t i = 0; i < Elements; ++i) {          \
+      Dst_d[i] = func(Src1_d[i], Src2_d[i]);          \
+    }                                                 \
+    break;                                            \
+    }
+
+  DEF_OP(VFCMPEQ): {
+    auto Op = IROp->C<IR::IROp_VFCMPEQ>();
+    void *Src1 = GetSrc<void*>(SSAData, Op->Header.Args[0]);
+    void *Src2 = GetSrc<void*>(SSAData, Op->Header.Args[1]);
+
+    auto Func = [](auto a, auto b) { return a == b ? ~0ULL : 0; };
+
+    uint8_t Tmp[16];
+    uint8_t Elements = OpSize / Op->Header.ElementSize;
 
-          case IR::OP_VBSL: {
-            auto Op = IROp->C<IR::IROp_VBSL>();
-            __uint128_t Src1 = *GetSrc<__uint128_t*>(SSAData, Op->Header.Args[0]);
-            __uint128_t Src2 = *GetSrc<__uint128_t*>(SSAData, Op->Header.Args[1]);
-            __uint128_t Src3 = *GetSrc<__uint128_t*>(SSAData, Op->Header.Args[2]);
+    if (Op->Header.ElementSize == OpSize) {
+      switch (Op->Header.ElementSize) {
+      DO_SCALAR_COMPARE_OP(4, float, uint32_t, Func);
+      DO_SCALAR_COMPARE_OP(8, double, uint64_t, Func);
+      default: LogMan::Msg::A("Unsupported elementSize: %d", Op->Header.ElementSize);
+      }
+    }
+    else {
+      switch (Op->Header.ElementSize) {
+      DO_VECTOR_COMPARE_OP(4, float, uint32_t, Func);
+      DO_VECTOR_COMPARE_OP(8, double, uint64_t, Func);
+      default: LogMan::Msg::A("Unsupported elementSize: %d", Op->Header.ElementSize);
+      }
+    }
 
-            __uint128_t Tmp{};
-            Tmp = Src2 & Src1;
-            Tmp |= Src3 & ~Src1;
+    memcpy(GDP, Tmp, OpSize);
+    NEXT_OP();
+  }
+  DEF_OP(VFCMPNEQ): {
+    auto Op = IROp->C<IR::IROp_VFCMPNEQ>();
+    void *Src1 = GetSrc<void*>(SSAData, Op->Header.Args[0]);
+    void *Src2 = GetSrc<void*>(SSAData, Op->Header.Args[1]);
 
-            memcpy(GDP, &Tmp, 16);
-            break;
-          }
-          case IR::OP_VCMPEQ: {
-            auto Op = IROp->C<IR::IROp_VCMPEQ>();
-            void *Src1 = GetSrc<void*>(SSAData, Op->Header.Args[0]);
-            void *Src2 = GetSrc<void*>(SSAData, Op->Header.Args[1]);
-            uint8_t Tmp[16];
-
-            uint8_t Elements = OpSize / Op->Header.ElementSize;
-            auto Func = [](auto a, auto b) { return a == b ? ~0ULL : 0; };
-
-            switch (Op->Header.ElementSize) {
-              DO_VECTOR_OP(1, uint8_t,   Func)
-              DO_VECTOR_OP(2, uint16_t,  Func)
-              DO_VECTOR_OP(4, uint32_t,  Func)
-              DO_VECTOR_OP(8, uint64_t,  Func)
-              default: LogMan::Msg::A("Unknown Element Size: %d", Op->Header.ElementSize); break;
-            }
-
-            memcpy(GDP, Tmp, OpSize);
-            break;
-          }
-          case IR::OP_VCMPEQZ: {
-            auto Op = IROp->C<IR::IROp_VCMPEQZ>();
-            void *Src1 = GetSrc<void*>(SSAData, Op->Header.Args[0]);
-            uint8_t Src2[16]{};
-            uint8_t Tmp[16];
-
-            uint8_t Elements = OpSize / Op->Header.ElementSize;
-            auto Func = [](auto a, auto b) { return a == b ? ~0ULL : 0; };
-
-            switch (Op->Header.ElementSize) {
-              DO_VECTOR_OP(1, uint8_t,   Func)
-              DO_VECTOR_OP(2, uint16_t,  Func)
-              DO_VECTOR_OP(4, uint32_t,  Func)
-              DO_VECTOR_OP(8, uint64_t,  Func)
-              default: LogMan::Msg::A("Unknown Element Size: %d", Op->Header.ElementSize); break;
-            }
-
-            memcpy(GDP, Tmp, OpSize);
-            break;
-          }
-          case IR::OP_VCMPGT: {
-            auto Op = IROp->C<IR::IROp_VCMPGT>();
-            void *Src1 = GetSrc<void*>(SSAData, Op->Header.Args[0]);
-            void *Src2 = GetSrc<void*>(SSAData, Op->Header.Args[1]);
-            uint8_t Tmp[16];
-
-            uint8_t Elements = OpSize / Op->Header.ElementSize;
-            auto Func = [](auto a, auto b) { return a > b ? ~0ULL : 0; };
-
-            switch (Op->Header.ElementSize) {
-              DO_VECTOR_OP(1, int8_t,   Func)
-              DO_VECTOR_OP(2, int16_t,  Func)
-              DO_VECTOR_OP(4, int32_t,  Func)
-              DO_VECTOR_OP(8, int64_t,  Func)
-              default: LogMan::Msg::A("Unknown Element Size: %d", Op->Header.ElementSize); break;
-            }
-
-            memcpy(GDP, Tmp, OpSize);
-            break;
-          }
-          case IR::OP_VCMPGTZ: {
-            auto Op = IROp->C<IR::IROp_VCMPGTZ>();
-            void *Src1 = GetSrc<void*>(SSAData, Op->Header.Args[0]);
-            uint8_t Src2[16]{};
-            uint8_t Tmp[16];
-
-            uint8_t Elements = OpSize / Op->Header.ElementSize;
-            auto Func = [](auto a, auto b) { return a > b ? ~0ULL : 0; };
-
-            switch (Op->Header.ElementSize) {
-              DO_VECTOR_OP(1, int8_t,   Func)
-              DO_VECTOR_OP(2, int16_t,  Func)
-              DO_VECTOR_OP(4, int32_t,  Func)
-              DO_VECTOR_OP(8, int64_t,  Func)
-              default: LogMan::Msg::A("Unknown Element Size: %d", Op->Header.ElementSize); break;
-            }
-
-            memcpy(GDP, Tmp, OpSize);
-            break;
-          }
-          case IR::OP_VCMPLTZ: {
-            auto Op = IROp->C<IR::IROp_VCMPLTZ>();
-            void *Src1 = GetSrc<void*>(SSAData, Op->Header.Args[0]);
-            uint8_t Src2[16]{};
-            uint8_t Tmp[16];
-
-            uint8_t Elements = OpSize / Op->Header.ElementSize;
-            auto Func = [](auto a, auto b) { return a < b ? ~0ULL : 0; };
-
-            switch (Op->Header.ElementSize) {
-              DO_VECTOR_OP(1, int8_t,   Func)
-              DO_VECTOR_OP(2, int16_t,  Func)
-              DO_VECTOR_OP(4, int32_t,  Func)
-              DO_VECTOR_OP(8, int64_t,  Func)
-              default: LogMan::Msg::A("Unknown Element Size: %d", Op->Header.ElementSize); break;
-            }
-
-            memcpy(GDP, Tmp, OpSize);
-            break;
-          }
-          case IR::OP_LUDIV: {
-            auto Op = IROp->C<IR::IROp_LUDiv>();
-            // Each source is OpSize in size
-            // So you can have up to a 128bit divide from x86-64
-            switch (OpSize) {
-              case 2: {
-                uint16_t SrcLow = *GetSrc<uint16_t*>(SSAData, Op->Header.Args[0]);
-                uint16_t SrcHigh = *GetSrc<uint16_t*>(SSAData, Op->Header.Args[1]);
-                uint16_t Divisor = *GetSrc<uint16_t*>(SSAData, Op->Header.Args[2]);
-                uint32_t Source = (static_cast<uint32_t>(SrcHigh) << 16) | SrcLow;
-                uint32_t Res = Source / Divisor;
-
-                // We only store the lower bits of the result
-                GD = static_cast<uint16_t>(Res);
-                break;
-              }
-              case 4: {
-                uint32_t SrcLow = *GetSrc<uint32_t*>(SSAData, Op->Header.Args[0]);
-                uint32_t SrcHigh = *GetSrc<uint32_t*>(SSAData, Op->Header.Args[1]);
-                uint32_t Divisor = *GetSrc<uint32_t*>(SSAData, Op->Header.Args[2]);
-                uint64_t Source = (static_cast<uint64_t>(SrcHigh) << 32) | SrcLow;
-                uint64_t Res = Source / Divisor;
-
-                // We only store the lower bits of the result
-                GD = static_cast<uint32_t>(Res);
-                break;
-              }
-              case 8: {
-                uint64_t SrcLow = *GetSrc<uint64_t*>(SSAData, Op->Header.Args[0]);
-                uint64_t SrcHigh = *GetSrc<uint64_t*>(SSAData, Op->Header.Args[1]);
-                uint64_t Divisor = *GetSrc<uint64_t*>(SSAData, Op->Header.Args[2]);
-                __uint128_t Source = (static_cast<__uint128_t>(SrcHigh) << 64) | SrcLow;
-                __uint128_t Res = Source / Divisor;
-
-                // We only store the lower bits of the result
-                memcpy(GDP, &Res, OpSize);
-                break;
-              }
-              default: LogMan::Msg::A("Unknown LUDIV Size: %d", OpSize); break;
-            }
-            break;
-          }
-          case IR::OP_LDIV: {
-            auto Op = IROp->C<IR::IROp_LDiv>();
-            // Each source is OpSize in size
-            // So you can have up to a 128bit divide from x86-64
-            switch (OpSize) {
-              case 2: {
-                uint16_t SrcLow = *GetSrc<uint16_t*>(SSAData, Op->Header.Args[0]);
-                uint16_t SrcHigh = *GetSrc<uint16_t*>(SSAData, Op->Header.Args[1]);
-                int16_t Divisor = *GetSrc<uint16_t*>(SSAData, Op->Header.Args[2]);
-                int32_t Source = (static_cast<uint32_t>(SrcHigh) << 16) | SrcLow;
-                int32_t Res = Source / Divisor;
-
-                // We only store the lower bits of the result
-                GD = static_cast<int16_t>(Res);
-                break;
-              }
-              case 4: {
-                uint32_t SrcLow = *GetSrc<uint32_t*>(SSAData, Op->Header.Args[0]);
-                uint32_t SrcHigh = *GetSrc<uint32_t*>(SSAData, Op->Header.Args[1]);
-                int32_t Divisor = *GetSrc<uint32_t*>(SSAData, Op->Header.Args[2]);
-                int64_t Source = (static_cast<uint64_t>(SrcHigh) << 32) | SrcLow;
-                int64_t Res = Source / Divisor;
-
-                // We only store the lower bits of the result
-                GD = static_cast<int32_t>(Res);
-                break;
-              }
-              case 8: {
-                uint64_t SrcLow = *GetSrc<uint64_t*>(SSAData, Op->Header.Args[0]);
-                uint64_t SrcHigh = *GetSrc<uint64_t*>(SSAData, Op->Header.Args[1]);
-                int64_t Divisor = *GetSrc<int64_t*>(SSAData, Op->Header.Args[2]);
-                __int128_t Source = (static_cast<__int128_t>(SrcHigh) << 64) | SrcLow;
-                __int128_t Res = Source / Divisor;
-
-                // We only store the lower bits of the result
-                memcpy(GDP, &Res, OpSize);
-                break;
-              }
-              default: LogMan::Msg::A("Unknown LDIV Size: %d", OpSize); break;
-            }
-            break;
-          }
-          case IR::OP_LUREM: {
-            auto Op = IROp->C<IR::IROp_LURem>();
-            // Each source is OpSize in size
-            // So you can have up to a 128bit Remainder from x86-64
-            switch (OpSize) {
-              case 2: {
-                uint16_t SrcLow = *GetSrc<uint16_t*>(SSAData, Op->Header.Args[0]);
-                uint16_t SrcHigh = *GetSrc<uint16_t*>(SSAData, Op->Header.Args[1]);
-                uint16_t Divisor = *GetSrc<uint16_t*>(SSAData, Op->Header.Args[2]);
-                uint32_t Source = (static_cast<uint32_t>(SrcHigh) << 16) | SrcLow;
-                uint32_t Res = Source % Divisor;
-
-                // We only store the lower bits of the result
-                GD = static_cast<uint16_t>(Res);
-                break;
-              }
-
-              case 4: {
-                uint32_t SrcLow = *GetSrc<uint32_t*>(SSAData, Op->Header.Args[0]);
-                uint32_t SrcHigh = *GetSrc<uint32_t*>(SSAData, Op->Header.Args[1]);
-                uint32_t Divisor = *GetSrc<uint32_t*>(SSAData, Op->Header.Args[2]);
-                uint64_t Source = (static_cast<uint64_t>(SrcHigh) << 32) | SrcLow;
-                uint64_t Res = Source % Divisor;
-
-                // We only store the lower bits of the result
-                GD = static_cast<uint32_t>(Res);
-                break;
-              }
-              case 8: {
-                uint64_t SrcLow = *GetSrc<uint64_t*>(SSAData, Op->Header.Args[0]);
-                uint64_t SrcHigh = *GetSrc<uint64_t*>(SSAData, Op->Header.Args[1]);
-                uint64_t Divisor = *GetSrc<uint64_t*>(SSAData, Op->Header.Args[2]);
-                __uint128_t Source = (static_cast<__uint128_t>(SrcHigh) << 64) | SrcLow;
-                __uint128_t Res = Source % Divisor;
-                // We only store the lower bits of the result
-                memcpy(GDP, &Res, OpSize);
-                break;
-              }
-              default: LogMan::Msg::A("Unknown LUREM Size: %d", OpSize); break;
-            }
-            break;
-          }
-          case IR::OP_LREM: {
-            auto Op = IROp->C<IR::IROp_LRem>();
-            // Each source is OpSize in size
-            // So you can have up to a 128bit Remainder from x86-64
-            switch (OpSize) {
-              case 2: {
-                uint16_t SrcLow = *GetSrc<uint16_t*>(SSAData, Op->Header.Args[0]);
-                uint16_t SrcHigh = *GetSrc<uint16_t*>(SSAData, Op->Header.Args[1]);
-                int16_t Divisor = *GetSrc<uint16_t*>(SSAData, Op->Header.Args[2]);
-                int32_t Source = (static_cast<uint32_t>(SrcHigh) << 16) | SrcLow;
-                int32_t Res = Source % Divisor;
-
-                // We only store the lower bits of the result
-                GD = static_cast<int16_t>(Res);
-                break;
-              }
-              case 4: {
-                uint32_t SrcLow = *GetSrc<uint32_t*>(SSAData, Op->Header.Args[0]);
-                uint32_t SrcHigh = *GetSrc<uint32_t*>(SSAData, Op->Header.Args[1]);
-                int32_t Divisor = *GetSrc<uint32_t*>(SSAData, Op->Header.Args[2]);
-                int64_t Source = (static_cast<uint64_t>(SrcHigh) << 32) | SrcLow;
-                int64_t Res = Source % Divisor;
-
-                // We only store the lower bits of the result
-                GD = static_cast<int32_t>(Res);
-                break;
-              }
-              case 8: {
-                uint64_t SrcLow = *GetSrc<uint64_t*>(SSAData, Op->Header.Args[0]);
-                uint64_t SrcHigh = *GetSrc<uint64_t*>(SSAData, Op->Header.Args[1]);
-                int64_t Divisor = *GetSrc<int64_t*>(SSAData, Op->Header.Args[2]);
-                __int128_t Source = (static_cast<__int128_t>(SrcHigh) << 64) | SrcLow;
-                __int128_t Res = Source % Divisor;
-                // We only store the lower bits of the result
-                memcpy(GDP, &Res, OpSize);
-                break;
-              }
-              default: LogMan::Msg::A("Unknown LREM Size: %d", OpSize); break;
-            }
-            break;
-          }
-          case IR::OP_VEXTR: {
-            auto Op = IROp->C<IR::IROp_VExtr>();
-            __uint128_t Src1 = *GetSrc<__uint128_t*>(SSAData, Op->Header.Args[0]);
-            __uint128_t Src2 = *GetSrc<__uint128_t*>(SSAData, Op->Header.Args[1]);
-
-            uint64_t Offset = Op->Index * Op->Header.ElementSize * 8;
-            __uint128_t Dst{};
-            if (Offset >= (OpSize * 8)) {
-              Offset -= OpSize * 8;
-              Dst = Src1 >> Offset;
-            }
-            else {
-              Dst = (Src1 << (OpSize * 8 - Offset)) | (Src2 >> Offset);
-            }
-
-            memcpy(GDP, &Dst, OpSize);
-            break;
-          }
-          case IR::OP_VINSGPR: {
-            auto Op = IROp->C<IR::IROp_VInsGPR>();
-            __uint128_t Src1 = *GetSrc<__uint128_t*>(SSAData, Op->Header.Args[0]);
-            __uint128_t Src2 = *GetSrc<__uint128_t*>(SSAData, Op->Header.Args[1]);
-
-            uint64_t Offset = Op->Index * Op->Header.ElementSize * 8;
-            __uint128_t Mask = (1ULL << (Op->Header.ElementSize * 8)) - 1;
-            Mask <<= Offset;
-            Mask = ~Mask;
-            __uint128_t Dst = Src1 & Mask;
-            Dst |= Src2 << Offset;
-
-            memcpy(GDP, &Dst, OpSize);
-            break;
-          }
-          case IR::OP_FLOAT_FROMGPR_S: {
-            auto Op = IROp->C<IR::IROp_Float_FromGPR_S>();
-
-            uint16_t Conv = (Op->Header.ElementSize << 8) | Op->SrcElementSize;
-            switch (Conv) {
-              case 0x0404: { // Float <- int32_t
-                float Dst = (float)*GetSrc<int32_t*>(SSAData, Op->Header.Args[0]);
-                memcpy(GDP, &Dst, Op->Header.ElementSize);
-                break;
-              }
-              case 0x0408: { // Float <- int64_t
-                float Dst = (float)*GetSrc<int64_t*>(SSAData, Op->Header.Args[0]);
-                memcpy(GDP, &Dst, Op->Header.ElementSize);
-                break;
-              }
-              case 0x0804: { // Double <- int32_t
-                double Dst = (double)*GetSrc<int32_t*>(SSAData, Op->Header.Args[0]);
-                memcpy(GDP, &Dst, Op->Header.ElementSize);
-                break;
-              }
-              case 0x0808: { // Double <- int64_t
-                double Dst = (double)*GetSrc<int64_t*>(SSAData, Op->Header.Args[0]);
-                memcpy(GDP, &Dst, Op->Header.ElementSize);
-                break;
-              }
-            }
-            break;
-          }
-          case IR::OP_FLOAT_FROMGPR_U: {
-            auto Op = IROp->C<IR::IROp_Float_FromGPR_U>();
-            uint16_t Conv = (Op->Header.ElementSize << 8) | Op->SrcElementSize;
-            switch (Conv) {
-              case 0x0404: { // Float <- int32_t
-                float Dst = (float)*GetSrc<uint32_t*>(SSAData, Op->Header.Args[0]);
-                memcpy(GDP, &Dst, Op->Header.ElementSize);
-                break;
-              }
-              case 0x0408: { // Float <- int64_t
-                float Dst = (float)*GetSrc<uint64_t*>(SSAData, Op->Header.Args[0]);
-                memcpy(GDP, &Dst, Op->Header.ElementSize);
-                break;
-              }
-              case 0x0804: { // Double <- int32_t
-                double Dst = (double)*GetSrc<uint32_t*>(SSAData, Op->Header.Args[0]);
-                memcpy(GDP, &Dst, Op->Header.ElementSize);
-                break;
-              }
-              case 0x0808: { // Double <- int64_t
-                double Dst = (double)*GetSrc<uint64_t*>(SSAData, Op->Header.Args[0]);
-                memcpy(GDP, &Dst, Op->Header.ElementSize);
-                break;
-              }
-            }
-            break;
-          }
-          case IR::OP_FLOAT_TOGPR_ZS: {
-            auto Op = IROp->C<IR::IROp_Float_ToGPR_ZS>();
-            if (Op->Header.ElementSize == 8) {
-              int64_t Dst = (int64_t)*GetSrc<double*>(SSAData, Op->Header.Args[0]);
-              memcpy(GDP, &Dst, Op->Header.ElementSize);
-            }
-            else {
-              int32_t Dst = (int32_t)*GetSrc<float*>(SSAData, Op->Header.Args[0]);
-              memcpy(GDP, &Dst, Op->Header.ElementSize);
-            }
-            break;
-          }
-          case IR::OP_FLOAT_TOGPR_ZU: {
-            auto Op = IROp->C<IR::IROp_Float_ToGPR_ZU>();
-            if (Op->Header.ElementSize == 8) {
-              uint64_t Dst = (uint64_t)*GetSrc<double*>(SSAData, Op->Header.Args[0]);
-              memcpy(GDP, &Dst, Op->Header.ElementSize);
-            }
-            else {
-              uint32_t Dst = (uint32_t)*GetSrc<float*>(SSAData, Op->Header.Args[0]);
-              memcpy(GDP, &Dst, Op->Header.ElementSize);
-            }
-            break;
-          }
-          case IR::OP_FLOAT_TOGPR_S: {
-            auto Op = IROp->C<IR::IROp_Float_ToGPR_S>();
-            if (Op->Header.ElementSize == 8) {
-              int64_t Dst = (int64_t)*GetSrc<double*>(SSAData, Op->Header.Args[0]);
-              memcpy(GDP, &Dst, Op->Header.ElementSize);
-            }
-            else {
-              int32_t Dst = (int32_t)*GetSrc<float*>(SSAData, Op->Header.Args[0]);
-              memcpy(GDP, &Dst, Op->Header.ElementSize);
-            }
-            break;
-          }
-          case IR::OP_FLOAT_TOGPR_U: {
-            auto Op = IROp->C<IR::IROp_Float_ToGPR_U>();
-            if (Op->Header.ElementSize == 8) {
-              uint64_t Dst = (uint64_t)*GetSrc<double*>(SSAData, Op->Header.Args[0]);
-              memcpy(GDP, &Dst, Op->Header.ElementSize);
-            }
-            else {
-              uint32_t Dst = (uint32_t)*GetSrc<float*>(SSAData, Op->Header.Args[0]);
-              memcpy(GDP, &Dst, Op->Header.ElementSize);
-            }
-            break;
-          }
-          case IR::OP_FLOAT_FTOF: {
-            auto Op = IROp->C<IR::IROp_Float_FToF>();
-            uint16_t Conv = (Op->Header.ElementSize << 8) | Op->SrcElementSize;
-            switch (Conv) {
-              case 0x0804: { // Double <- Float
-                double Dst = (double)*GetSrc<float*>(SSAData, Op->Header.Args[0]);
-                memcpy(GDP, &Dst, 8);
-                break;
-              }
-              case 0x0408: { // Float <- Double
-                float Dst = (float)*GetSrc<double*>(SSAData, Op->Header.Args[0]);
-                memcpy(GDP, &Dst, 4);
-                break;
-              }
-              default: LogMan::Msg::A("Unknown FCVT sizes: 0x%x", Conv);
-            }
-            break;
-          }
-          case IR::OP_VECTOR_FTOF: {
-            auto Op = IROp->C<IR::IROp_Vector_FToF>();
-            void *Src = GetSrc<void*>(SSAData, Op->Header.Args[0]);
-            uint8_t Tmp[16]{};
-
-            uint16_t Conv = (Op->Header.ElementSize << 8) | Op->SrcElementSize;
-
-            auto Func = [](auto a, auto min, auto max) { return a; };
-            switch (Conv) {
-              case 0x0804: { // Double <- float
-                uint8_t Elements = OpSize / Op->SrcElementSize;
-                switch (Op->SrcElementSize) {
-                DO_VECTOR_1SRC_2TYPE_OP(4, double, float, Func, 0, 0)
-                }
-                break;
-              }
-              case 0x0408: { // Float <- Double
-                uint8_t Elements = (OpSize << 1) / Op->SrcElementSize;
-                switch (Op->SrcElementSize) {
-                DO_VECTOR_1SRC_2TYPE_OP(8, float, double, Func, 0, 0)
-                }
-                break;
-
-                break;
-              }
-              default: LogMan::Msg::A("Unknown Conversion Type : 0%04x", Conv); break;
-            }
-            memcpy(GDP, Tmp, OpSize);
-            break;
-          }
-          case IR::OP_FCMP: {
-            auto Op = IROp->C<IR::IROp_FCmp>();
-            uint32_t ResultFlags{};
-            if (Op->ElementSize == 4) {
-              float Src1 = *GetSrc<float*>(SSAData, Op->Header.Args[0]);
-              float Src2 = *GetSrc<float*>(SSAData, Op->Header.Args[1]);
-              bool Unordered = std::isnan(Src1) || std::isnan(Src2);
-              if (Op->Flags & (1 << FCMP_FLAG_LT)) {
-                if (Unordered || (Src1 < Src2)) {
-                  ResultFlags |= (1 << FCMP_FLAG_LT);
-                }
-              }
-              if (Op->Flags & (1 << FCMP_FLAG_UNORDERED)) {
-                if (Unordered) {
-                  ResultFlags |= (1 << FCMP_FLAG_UNORDERED);
-                }
-              }
-              if (Op->Flags & (1 << FCMP_FLAG_EQ)) {
-                if (Unordered || (Src1 == Src2)) {
-                  ResultFlags |= (1 << FCMP_FLAG_EQ);
-                }
-              }
-            }
-            else {
-              double Src1 = *GetSrc<double*>(SSAData, Op->Header.Args[0]);
-              double Src2 = *GetSrc<double*>(SSAData, Op->Header.Args[1]);
-              bool Unordered = std::isnan(Src1) || std::isnan(Src2);
-              if (Op->Flags & (1 << FCMP_FLAG_LT)) {
-                if (Unordered || (Src1 < Src2)) {
-                  ResultFlags |= (1 << FCMP_FLAG_LT);
-                }
-              }
-              if (Op->Flags & (1 << FCMP_FLAG_UNORDERED)) {
-                if (Unordered) {
-                  ResultFlags |= (1 << FCMP_FLAG_UNORDERED);
-                }
-              }
-              if (Op->Flags & (1 << FCMP_FLAG_EQ)) {
-                if (Unordered || (Src1 == Src2)) {
-                  ResultFlags |= (1 << FCMP_FLAG_EQ);
-                }
-              }
-            }
-
-            GD = ResultFlags;
-            break;
-          }
-          case IR::OP_VTBL1: {
-            auto Op = IROp->C<IR::IROp_VTBL1>();
-            uint8_t *Src1 = GetSrc<uint8_t*>(SSAData, Op->Header.Args[0]);
-            uint8_t *Src2 = GetSrc<uint8_t*>(SSAData, Op->Header.Args[1]);
-
-            uint8_t Tmp[16];
-
-            for (size_t i = 0; i < OpSize; ++i) {
-              uint8_t Index = Src2[i];
-              Tmp[i] = Index >= OpSize ? 0 : Src1[Index];
-            }
-            memcpy(GDP, Tmp, OpSize);
-            break;
-          }
+    auto Func = [](auto a, auto b) { return a != b ? ~0ULL : 0; };
 
-          case IR::OP_GETHOSTFLAG: {
-            auto Op = IROp->C<IR::IROp_GetHostFlag>();
-            GD = (*GetSrc<uint64_t*>(SSAData, Op->Header.Args[0]) >> Op->Flag) & 1;
-            break;
-          }
-          #define DO_SCALAR_COMPARE_OP(size, type, type2, func)              \
-            case size: {                                      \
-            auto *Dst_d  = reinterpret_cast<type2*>(Tmp);  \
-            auto *Src1_d = reinterpret_cast<type*>(Src1); \
-            auto *Src2_d = reinterpret_cast<type*>(Src2); \
-            Dst_d[0] = func(Src1_d[0], Src2_d[0]);          \
-            break;                                            \
-            }
-
-          #define DO_VECTOR_COMPARE_OP(size, type, type2, func)              \
-            case size: {                                      \
-            auto *Dst_d  = reinterpret_cast<type2*>(Tmp);  \
-            auto *Src1_d = reinterpret_cast<type*>(Src1); \
-            auto *Src2_d = reinterpret_cast<type*>(Src2); \
-            for (uint8_t i = 0; i < Elements; ++i) {          \
-              Dst_d[i] = func(Src1_d[i], Src2_d[i]);          \
-            }                                                 \
-            break;                                            \
-            }
-
-          case IR::OP_VFCMPEQ: {
-            auto Op = IROp->C<IR::IROp_VFCMPEQ>();
-            void *Src1 = GetSrc<void*>(SSAData, Op->Header.Args[0]);
-            void *Src2 = GetSrc<void*>(SSAData, Op->Header.Args[1]);
-
-            auto Func = [](auto a, auto b) { return a == b ? ~0ULL : 0; };
-
-            uint8_t Tmp[16];
-            uint8_t Elements = OpSize / Op->Header.ElementSize;
-
-            if (Op->Header.ElementSize == OpSize) {
-              switch (Op->Header.ElementSize) {
-              DO_SCALAR_COMPARE_OP(4, float, uint32_t, Func);
-              DO_SCALAR_COMPARE_OP(8, double, uint64_t, Func);
-              default: LogMan::Msg::A("Unsupported elementSize: %d", Op->Header.ElementSize);
-              }
-            }
-            else {
-              switch (Op->Header.ElementSize) {
-              DO_VECTOR_COMPARE_OP(4, float, uint32_t, Func);
-              DO_VECTOR_COMPARE_OP(8, double, uint64_t, Func);
-              default: LogMan::Msg::A("Unsupported elementSize: %d", Op->Header.ElementSize);
-              }
-            }
-
-            memcpy(GDP, Tmp, OpSize);
-            break;
-          }
-          case IR::OP_VFCMPNEQ: {
-            auto Op = IROp->C<IR::IROp_VFCMPNEQ>();
-            void *Src1 = GetSrc<void*>(SSAData, Op->Header.Args[0]);
-            void *Src2 = GetSrc<void*>(SSAData, Op->Header.Args[1]);
-
-            auto Func = [](auto a, auto b) { return a != b ? ~0ULL : 0; };
-
-            uint8_t Tmp[16];
-            uint8_t Elements = OpSize / Op->Header.ElementSize;
-
-            if (Op->Header.ElementSize == OpSize) {
-              switch (Op->Header.ElementSize) {
-              DO_SCALAR_COMPARE_OP(4, float, uint32_t, Func);
-              DO_SCALAR_COMPARE_OP(8, double, uint64_t, Func);
-              default: LogMan::Msg::A("Unsupported elementSize: %d", Op->Header.ElementSize);
-              }
-            }
-            else {
-              switch (Op->Header.ElementSize) {
-              DO_VECTOR_COMPARE_OP(4, float, uint32_t, Func);
-              DO_VECTOR_COMPARE_OP(8, double, uint64_t, Func);
-              default: LogMan::Msg::A("Unsupported elementSize: %d", Op->Header.ElementSize);
-              }
-            }
-
-            memcpy(GDP, Tmp, OpSize);
-            break;
-          }
-          case IR::OP_VFCMPLT: {
-            auto Op = IROp->C<IR::IROp_VFCMPLT>();
-            void *Src1 = GetSrc<void*>(SSAData, Op->Header.Args[0]);
-            void *Src2 = GetSrc<void*>(SSAData, Op->Header.Args[1]);
-
-            auto Func = [](auto a, auto b) { return a < b ? ~0ULL : 0; };
-
-            uint8_t Tmp[16];
-            uint8_t Elements = OpSize / Op->Header.ElementSize;
-
-            if (Op->Header.ElementSize == OpSize) {
-              switch (Op->Header.ElementSize) {
-              DO_SCALAR_COMPARE_OP(4, float, uint32_t, Func);
-              DO_SCALAR_COMPARE_OP(8, double, uint64_t, Func);
-              default: LogMan::Msg::A("Unsupported elementSize: %d", Op->Header.ElementSize);
-              }
-            }
-            else {
-              switch (Op->Header.ElementSize) {
-              DO_VECTOR_COMPARE_OP(4, float, uint32_t, Func);
-              DO_VECTOR_COMPARE_OP(8, double, uint64_t, Func);
-              default: LogMan::Msg::A("Unsupported elementSize: %d", Op->Header.ElementSize);
-              }
-            }
-
-            memcpy(GDP, Tmp, OpSize);
-            break;
-          }
-          case IR::OP_VFCMPLE: {
-            auto Op = IROp->C<IR::IROp_VFCMPLE>();
-            void *Src1 = GetSrc<void*>(SSAData, Op->Header.Args[0]);
-            void *Src2 = GetSrc<void*>(SSAData, Op->Header.Args[1]);
-
-            auto Func = [](auto a, auto b) { return a <= b ? ~0ULL : 0; };
-
-            uint8_t Tmp[16];
-            uint8_t Elements = OpSize / Op->Header.ElementSize;
-
-            if (Op->Header.ElementSize == OpSize) {
-              switch (Op->Header.ElementSize) {
-              DO_SCALAR_COMPARE_OP(4, float, uint32_t, Func);
-              DO_SCALAR_COMPARE_OP(8, double, uint64_t, Func);
-              default: LogMan::Msg::A("Unsupported elementSize: %d", Op->Header.ElementSize);
-              }
-            }
-            else {
-              switch (Op->Header.ElementSize) {
-              DO_VECTOR_COMPARE_OP(4, float, uint32_t, Func);
-              DO_VECTOR_COMPARE_OP(8, double, uint64_t, Func);
-              default: LogMan::Msg::A("Unsupported elementSize: %d", Op->Header.ElementSize);
-              }
-            }
-
-            memcpy(GDP, Tmp, OpSize);
-            break;
-          }
-          case IR::OP_VFCMPUNO: {
-            auto Op = IROp->C<IR::IROp_VFCMPUNO>();
-            void *Src1 = GetSrc<void*>(SSAData, Op->Header.Args[0]);
-            void *Src2 = GetSrc<void*>(SSAData, Op->Header.Args[1]);
-
-            auto Func = [](auto a, auto b) { return (std::isnan(a) || std::isnan(b)) ? ~0ULL : 0; };
-
-            uint8_t Tmp[16];
-            uint8_t Elements = OpSize / Op->Header.ElementSize;
-
-            if (Op->Header.ElementSize == OpSize) {
-              switch (Op->Header.ElementSize) {
-              DO_SCALAR_COMPARE_OP(4, float, uint32_t, Func);
-              DO_SCALAR_COMPARE_OP(8, double, uint64_t, Func);
-              default: LogMan::Msg::A("Unsupported elementSize: %d", Op->Header.ElementSize);
-              }
-            }
-            else {
-              switch (Op->Header.ElementSize) {
-              DO_VECTOR_COMPARE_OP(4, float, uint32_t, Func);
-              DO_VECTOR_COMPARE_OP(8, double, uint64_t, Func);
-              default: LogMan::Msg::A("Unsupported elementSize: %d", Op->Header.ElementSize);
-              }
-            }
-
-            memcpy(GDP, Tmp, OpSize);
-            break;
-          }
-          case IR::OP_VFCMPORD: {
-            auto Op = IROp->C<IR::IROp_VFCMPORD>();
-            void *Src1 = GetSrc<void*>(SSAData, Op->Header.Args[0]);
-            void *Src2 = GetSrc<void*>(SSAData, Op->Header.Args[1]);
-
-            auto Func = [](auto a, auto b) { return (!std::isnan(a) && !std::isnan(b)) ? ~0ULL : 0; };
-
-            uint8_t Tmp[16];
-            uint8_t Elements = OpSize / Op->Header.ElementSize;
-
-            if (Op->Header.ElementSize == OpSize) {
-              switch (Op->Header.ElementSize) {
-              DO_SCALAR_COMPARE_OP(4, float, uint32_t, Func);
-              DO_SCALAR_COMPARE_OP(8, double, uint64_t, Func);
-              default: LogMan::Msg::A("Unsupported elementSize: %d", Op->Header.ElementSize);
-              }
-            }
-            else {
-              switch (Op->Header.ElementSize) {
-              DO_VECTOR_COMPARE_OP(4, float, uint32_t, Func);
-              DO_VECTOR_COMPARE_OP(8, double, uint64_t, Func);
-              default: LogMan::Msg::A("Unsupported elementSize: %d", Op->Header.ElementSize);
-              }
-            }
-
-            memcpy(GDP, Tmp, OpSize);
-            break;
-          }
-          case IR::OP_VAESIMC: {
-            auto Op = IROp->C<IR::IROp_VAESImc>();
-            __uint128_t Src1 = *GetSrc<__uint128_t*>(SSAData, Op->Header.Args[0]);
-
-            // Pseudo-code
-            // Dst = InvMixColumns(STATE)
-            __uint128_t Tmp{};
-            Tmp = AES::InvMixColumns(reinterpret_cast<uint8_t*>(&Src1));
-            memcpy(GDP, &Tmp, sizeof(Tmp));
-            break;
-          }
-          case IR::OP_VAESENC: {
-            auto Op = IROp->C<IR::IROp_VAESEnc>();
-            __uint128_t Src1 = *GetSrc<__uint128_t*>(SSAData, Op->Header.Args[0]);
-            __uint128_t Src2 = *GetSrc<__uint128_t*>(SSAData, Op->Header.Args[1]);
-
-            // Pseudo-code
-            // STATE = Src1
-            // RoundKey = Src2
-            // STATE = ShiftRows(STATE)
-            // STATE = SubBytes(STATE)
-            // STATE = MixColumns(STATE)
-            // Dst = STATE XOR RoundKey
-            __uint128_t Tmp{};
-            Tmp = AES::ShiftRows(reinterpret_cast<uint8_t*>(&Src1));
-            Tmp = AES::SubBytes(reinterpret_cast<uint8_t*>(&Tmp), 16);
-            Tmp = AES::MixColumns(reinterpret_cast<uint8_t*>(&Tmp));
-            Tmp = Tmp ^ Src2;
-            memcpy(GDP, &Tmp, sizeof(Tmp));
-            break;
-          }
-          case IR::OP_VAESENCLAST: {
-            auto Op = IROp->C<IR::IROp_VAESEncLast>();
-            __uint128_t Src1 = *GetSrc<__uint128_t*>(SSAData, Op->Header.Args[0]);
-            __uint128_t Src2 = *GetSrc<__uint128_t*>(SSAData, Op->Header.Args[1]);
-
-            // Pseudo-code
-            // STATE = Src1
-            // RoundKey = Src2
-            // STATE = ShiftRows(STATE)
-            // STATE = SubBytes(STATE)
-            // Dst = STATE XOR RoundKey
-            __uint128_t Tmp{};
-            Tmp = AES::ShiftRows(reinterpret_cast<uint8_t*>(&Src1));
-            Tmp = AES::SubBytes(reinterpret_cast<uint8_t*>(&Tmp), 16);
-            Tmp = Tmp ^ Src2;
-            memcpy(GDP, &Tmp, sizeof(Tmp));
-            break;
-          }
-          case IR::OP_VAESDEC: {
-            auto Op = IROp->C<IR::IROp_VAESDec>();
-            __uint128_t Src1 = *GetSrc<__uint128_t*>(SSAData, Op->Header.Args[0]);
-            __uint128_t Src2 = *GetSrc<__uint128_t*>(SSAData, Op->Header.Args[1]);
-
-            // Pseudo-code
-            // STATE = Src1
-            // RoundKey = Src2
-            // STATE = InvShiftRows(STATE)
-            // STATE = InvSubBytes(STATE)
-            // STATE = InvMixColumns(STATE)
-            // Dst = STATE XOR RoundKey
-            __uint128_t Tmp{};
-            Tmp = AES::InvShiftRows(reinterpret_cast<uint8_t*>(&Src1));
-            Tmp = AES::InvSubBytes(reinterpret_cast<uint8_t*>(&Tmp));
-            Tmp = AES::InvMixColumns(reinterpret_cast<uint8_t*>(&Tmp));
-            Tmp = Tmp ^ Src2;
-            memcpy(GDP, &Tmp, sizeof(Tmp));
-            break;
-          }
-          case IR::OP_VAESDECLAST: {
-            auto Op = IROp->C<IR::IROp_VAESDecLast>();
-            __uint128_t Src1 = *GetSrc<__uint128_t*>(SSAData, Op->Header.Args[0]);
-            __uint128_t Src2 = *GetSrc<__uint128_t*>(SSAData, Op->Header.Args[1]);
-
-            // Pseudo-code
-            // STATE = Src1
-            // RoundKey = Src2
-            // STATE = InvShiftRows(STATE)
-            // STATE = InvSubBytes(STATE)
-            // Dst = STATE XOR RoundKey
-            __uint128_t Tmp{};
-            Tmp = AES::InvShiftRows(reinterpret_cast<uint8_t*>(&Src1));
-            Tmp = AES::InvSubBytes(reinterpret_cast<uint8_t*>(&Tmp));
-            Tmp = Tmp ^ Src2;
-            memcpy(GDP, &Tmp, sizeof(Tmp));
-            break;
-          }
-          case IR::OP_VAESKEYGENASSIST: {
-            auto Op = IROp->C<IR::IROp_VAESKeyGenAssist>();
-            uint8_t *Src1 = GetSrc<uint8_t*>(SSAData, Op->Header.Args[0]);
-
-            // Pseudo-code
-            // X3 = Src1[127:96]
-            // X2 = Src1[95:64]
-            // X1 = Src1[63:32]
-            // X0 = Src1[31:30]
-            // RCON = (Zext)rcon
-            // Dest[31:0] = SubWord(X1)
-            // Dest[63:32] = RotWord(SubWord(X1)) XOR RCON
-            // Dest[95:64] = SubWord(X3)
-            // Dest[127:96] = RotWord(SubWord(X3)) XOR RCON
-            __uint128_t Tmp{};
-            uint32_t X1{};
-            uint32_t X3{};
-            memcpy(&X1, &Src1[4], 4);
-            memcpy(&X3, &Src1[12], 4);
-            uint32_t SubWord_X1 = AES::SubBytes(reinterpret_cast<uint8_t*>(&X1), 4);
-            uint32_t SubWord_X3 = AES::SubBytes(reinterpret_cast<uint8_t*>(&X3), 4);
-
-            auto Ror = [] (auto In, auto R) {
-              auto RotateMask = sizeof(In) * 8 - 1;
-              R &= RotateMask;
-              return (In >> R) | (In << (sizeof(In) * 8 - R));
-            };
-
-            uint32_t Rot_X1 = Ror(SubWord_X1, 8);
-            uint32_t Rot_X3 = Ror(SubWord_X3, 8);
-
-            Tmp = Rot_X3 ^ Op->RCON;
-            Tmp <<= 32;
-            Tmp |= SubWord_X3;
-            Tmp <<= 32;
-            Tmp |= Rot_X1 ^ Op->RCON;
-            Tmp <<= 32;
-            Tmp |= SubWord_X1;
-            memcpy(GDP, &Tmp, sizeof(Tmp));
-            break;
-          }
-          case IR::OP_F80LOADFCW: {
-            OpHandlers<IR::OP_F80LOADFCW>::handle(*GetSrc<uint16_t*>(SSAData, IROp->Args[0]));
-            break;
-          }
-          case IR::OP_F80ADD: {
-            auto Op = IROp->C<IR::IROp_F80Add>();
-            X80SoftFloat Src1 = *GetSrc<X80SoftFloat*>(SSAData, Op->Header.Args[0]);
-            X80SoftFloat Src2 = *GetSrc<X80SoftFloat*>(SSAData, Op->Header.Args[1]);
-            X80SoftFloat Tmp;
-            Tmp = X80SoftFloat::FADD(Src1, Src2);
-
-            memcpy(GDP, &Tmp, sizeof(X80SoftFloat));
-            break;
-          }
-          case IR::OP_F80SUB: {
-            auto Op = IROp->C<IR::IROp_F80Sub>();
-            X80SoftFloat Src1 = *GetSrc<X80SoftFloat*>(SSAData, Op->Header.Args[0]);
-            X80SoftFloat Src2 = *GetSrc<X80SoftFloat*>(SSAData, Op->Header.Args[1]);
-            X80SoftFloat Tmp;
-            Tmp = X80SoftFloat::FSUB(Src1, Src2);
-
-            memcpy(GDP, &Tmp, sizeof(X80SoftFloat));
-            break;
-          }
-          case IR::OP_F80MUL: {
-            auto Op = IROp->C<IR::IROp_F80Mul>();
-            X80SoftFloat Src1 = *GetSrc<X80SoftFloat*>(SSAData, Op->Header.Args[0]);
-            X80SoftFloat Src2 = *GetSrc<X80SoftFloat*>(SSAData, Op->Header.Args[1]);
-            X80SoftFloat Tmp;
-            Tmp = X80SoftFloat::FMUL(Src1, Src2);
-
-            memcpy(GDP, &Tmp, sizeof(X80SoftFloat));
-            break;
-          }
-          case IR::OP_F80DIV: {
-            auto Op = IROp->C<IR::IROp_F80Div>();
-            X80SoftFloat Src1 = *GetSrc<X80SoftFloat*>(SSAData, Op->Header.Args[0]);
-            X80SoftFloat Src2 = *GetSrc<X80SoftFloat*>(SSAData, Op->Header.Args[1]);
-            X80SoftFloat Tmp;
-            Tmp = X80SoftFloat::FDIV(Src1, Src2);
-
-            memcpy(GDP, &Tmp, sizeof(X80SoftFloat));
-            break;
-          }
-          case IR::OP_F80FYL2X: {
-            auto Op = IROp->C<IR::IROp_F80FYL2X>();
-            X80SoftFloat Src1 = *GetSrc<X80SoftFloat*>(SSAData, Op->Header.Args[0]);
-            X80SoftFloat Src2 = *GetSrc<X80SoftFloat*>(SSAData, Op->Header.Args[1]);
-            X80SoftFloat Tmp;
-            Tmp = X80SoftFloat::FYL2X(Src1, Src2);
-
-            memcpy(GDP, &Tmp, sizeof(X80SoftFloat));
-            break;
-          }
-          case IR::OP_F80ATAN: {
-            auto Op = IROp->C<IR::IROp_F80ATAN>();
-            X80SoftFloat Src1 = *GetSrc<X80SoftFloat*>(SSAData, Op->Header.Args[0]);
-            X80SoftFloat Src2 = *GetSrc<X80SoftFloat*>(SSAData, Op->Header.Args[1]);
-            X80SoftFloat Tmp;
-            Tmp = X80SoftFloat::FATAN(Src1, Src2);
-
-            memcpy(GDP, &Tmp, sizeof(X80SoftFloat));
-            break;
-          }
-          case IR::OP_F80FPREM1: {
-            auto Op = IROp->C<IR::IROp_F80FPREM1>();
-            X80SoftFloat Src1 = *GetSrc<X80SoftFloat*>(SSAData, Op->Header.Args[0]);
-            X80SoftFloat Src2 = *GetSrc<X80SoftFloat*>(SSAData, Op->Header.Args[1]);
-            X80SoftFloat Tmp;
-            Tmp = X80SoftFloat::FREM1(Src1, Src2);
-
-            memcpy(GDP, &Tmp, sizeof(X80SoftFloat));
-            break;
-          }
-          case IR::OP_F80FPREM: {
-            auto Op = IROp->C<IR::IROp_F80FPREM>();
-            X80SoftFloat Src1 = *GetSrc<X80SoftFloat*>(SSAData, Op->Header.Args[0]);
-            X80SoftFloat Src2 = *GetSrc<X80SoftFloat*>(SSAData, Op->Header.Args[1]);
-            X80SoftFloat Tmp;
-            Tmp = X80SoftFloat::FREM(Src1, Src2);
-
-            memcpy(GDP, &Tmp, sizeof(X80SoftFloat));
-            break;
-          }
-          case IR::OP_F80SCALE: {
-            auto Op = IROp->C<IR::IROp_F80SCALE>();
-            X80SoftFloat Src1 = *GetSrc<X80SoftFloat*>(SSAData, Op->Header.Args[0]);
-            X80SoftFloat Src2 = *GetSrc<X80SoftFloat*>(SSAData, Op->Header.Args[1]);
-            X80SoftFloat Tmp;
-            Tmp = X80SoftFloat::FSCALE(Src1, Src2);
-
-            memcpy(GDP, &Tmp, sizeof(X80SoftFloat));
-            break;
-          }
-          case IR::OP_F80CVT: {
-            auto Op = IROp->C<IR::IROp_F80CVT>();
-            X80SoftFloat Src = *GetSrc<X80SoftFloat*>(SSAData, Op->Header.Args[0]);
-
-            switch (OpSize) {
-              case 4: {
-                float Tmp = Src;
-                memcpy(GDP, &Tmp, OpSize);
-                break;
-              }
-              case 8: {
-                double Tmp = Src;
-                memcpy(GDP, &Tmp, OpSize);
-                break;
-              }
-            default: LogMan::Msg::D("Unhandled size: %d", OpSize);
-            }
-            break;
-          }
-          case IR::OP_F80CVTINT: {
-            auto Op = IROp->C<IR::IROp_F80CVTInt>();
-            X80SoftFloat Src = *GetSrc<X80SoftFloat*>(SSAData, Op->Header.Args[0]);
-
-            switch (OpSize) {
-              case 2: {
-                int16_t Tmp = (Op->Truncate? OpHandlers<IR::OP_F80CVTINT>::handle2t : OpHandlers<IR::OP_F80CVTINT>::handle2)(Src);
-                memcpy(GDP, &Tmp, sizeof(Tmp));
-                break;
-              }
-              case 4: {
-                int32_t Tmp = (Op->Truncate? OpHandlers<IR::OP_F80CVTINT>::handle4t : OpHandlers<IR::OP_F80CVTINT>::handle4)(Src);
-                memcpy(GDP, &Tmp, sizeof(Tmp));
-                break;
-              }
-              case 8: {
-                int64_t Tmp = (Op->Truncate? OpHandlers<IR::OP_F80CVTINT>::handle8t : OpHandlers<IR::OP_F80CVTINT>::handle8)(Src);
-                memcpy(GDP, &Tmp, sizeof(Tmp));
-                break;
-              }
-            default: LogMan::Msg::D("Unhandled size: %d", OpSize);
-            }
-            break;
-          }
-          case IR::OP_F80CVTTO: {
-            auto Op = IROp->C<IR::IROp_F80CVTTo>();
-
-            switch (Op->Size) {
-              case 4: {
-                float Src = *GetSrc<float *>(SSAData, Op->Header.Args[0]);
-                X80SoftFloat Tmp = Src;
-                memcpy(GDP, &Tmp, sizeof(X80SoftFloat));
-                break;
-              }
-              case 8: {
-                double Src = *GetSrc<double *>(SSAData, Op->Header.Args[0]);
-                X80SoftFloat Tmp = Src;
-                memcpy(GDP, &Tmp, sizeof(X80SoftFloat));
-                break;
-              }
-            default: LogMan::Msg::D("Unhandled size: %d", OpSize);
-            }
-            break;
-          }
-          case IR::OP_F80CVTTOINT: {
-            auto Op = IROp->C<IR::IROp_F80CVTToInt>();
-
-            switch (Op->Size) {
-              case 2: {
-                int16_t Src = *GetSrc<int16_t*>(SSAData, Op->Header.Args[0]);
-                X80SoftFloat Tmp = Src;
-                memcpy(GDP, &Tmp, sizeof(X80SoftFloat));
-                break;
-              }
-              case 4: {
-                int32_t Src = *GetSrc<int32_t*>(SSAData, Op->Header.Args[0]);
-                X80SoftFloat Tmp = Src;
-                memcpy(GDP, &Tmp, sizeof(X80SoftFloat));
-                break;
-              }
-            default: LogMan::Msg::D("Unhandled size: %d", OpSize);
-            }
-            break;
-          }
-          case IR::OP_F80ROUND: {
-            auto Op = IROp->C<IR::IROp_F80Round>();
-            X80SoftFloat Src = *GetSrc<X80SoftFloat*>(SSAData, Op->Header.Args[0]);
-            X80SoftFloat Tmp;
-            Tmp = X80SoftFloat::FRNDINT(Src);
-
-            memcpy(GDP, &Tmp, sizeof(X80SoftFloat));
-            break;
-          }
-          case IR::OP_F80F2XM1: {
-            auto Op = IROp->C<IR::IROp_F80F2XM1>();
-            X80SoftFloat Src = *GetSrc<X80SoftFloat*>(SSAData, Op->Header.Args[0]);
-            X80SoftFloat Tmp;
-            Tmp = X80SoftFloat::F2XM1(Src);
-
-            memcpy(GDP, &Tmp, sizeof(X80SoftFloat));
-            break;
-          }
-          case IR::OP_F80TAN: {
-            auto Op = IROp->C<IR::IROp_F80TAN>();
-            X80SoftFloat Src = *GetSrc<X80SoftFloat*>(SSAData, Op->Header.Args[0]);
-            X80SoftFloat Tmp;
-            Tmp = X80SoftFloat::FTAN(Src);
-
-            memcpy(GDP, &Tmp, sizeof(X80SoftFloat));
-            break;
-          }
-          case IR::OP_F80SQRT: {
-            auto Op = IROp->C<IR::IROp_F80SQRT>();
-            X80SoftFloat Src = *GetSrc<X80SoftFloat*>(SSAData, Op->Header.Args[0]);
-            X80SoftFloat Tmp;
-            Tmp = X80SoftFloat::FSQRT(Src);
-
-            memcpy(GDP, &Tmp, sizeof(X80SoftFloat));
-            break;
-          }
-          case IR::OP_F80SIN: {
-            auto Op = IROp->C<IR::IROp_F80SIN>();
-            X80SoftFloat Src = *GetSrc<X80SoftFloat*>(SSAData, Op->Header.Args[0]);
-            X80SoftFloat Tmp;
-            Tmp = X80SoftFloat::FSIN(Src);
-            memcpy(GDP, &Tmp, sizeof(X80SoftFloat));
-            break;
-          }
-          case IR::OP_F80COS: {
-            auto Op = IROp->C<IR::IROp_F80COS>();
-            X80SoftFloat Src = *GetSrc<X80SoftFloat*>(SSAData, Op->Header.Args[0]);
-            X80SoftFloat Tmp;
-            Tmp = X80SoftFloat::FCOS(Src);
-            memcpy(GDP, &Tmp, sizeof(X80SoftFloat));
-            break;
-          }
-          case IR::OP_F80XTRACT_EXP: {
-            auto Op = IROp->C<IR::IROp_F80XTRACT_EXP>();
-            X80SoftFloat Src = *GetSrc<X80SoftFloat*>(SSAData, Op->Header.Args[0]);
-            X80SoftFloat Tmp;
-            Tmp = X80SoftFloat::FXTRACT_EXP(Src);
-            memcpy(GDP, &Tmp, sizeof(X80SoftFloat));
-            break;
-          }
-          case IR::OP_F80XTRACT_SIG: {
-            auto Op = IROp->C<IR::IROp_F80XTRACT_SIG>();
-            X80SoftFloat Src = *GetSrc<X80SoftFloat*>(SSAData, Op->Header.Args[0]);
-            X80SoftFloat Tmp;
-            Tmp = X80SoftFloat::FXTRACT_SIG(Src);
-            memcpy(GDP, &Tmp, sizeof(X80SoftFloat));
-            break;
-          }
-          case IR::OP_F80CMP: {
-            auto Op = IROp->C<IR::IROp_F80Cmp>();
-            uint32_t ResultFlags{};
-            X80SoftFloat Src1 = *GetSrc<X80SoftFloat*>(SSAData, Op->Header.Args[0]);
-            X80SoftFloat Src2 = *GetSrc<X80SoftFloat*>(SSAData, Op->Header.Args[1]);
-            bool eq, lt, nan;
-            X80SoftFloat::FCMP(Src1, Src2, &eq, &lt, &nan);
-            if (Op->Flags & (1 << FCMP_FLAG_LT) &&
-                lt) {
-              ResultFlags |= (1 << FCMP_FLAG_LT);
-            }
-            if (Op->Flags & (1 << FCMP_FLAG_UNORDERED) &&
-                nan) {
-              ResultFlags |= (1 << FCMP_FLAG_UNORDERED);
-            }
-            if (Op->Flags & (1 << FCMP_FLAG_EQ) &&
-                eq) {
-              ResultFlags |= (1 << FCMP_FLAG_EQ);
-            }
-
-            GD = ResultFlags;
-            break;
-          }
-          case IR::OP_GETROUNDINGMODE: {
-            uint32_t GuestRounding{};
+    uint8_t Tmp[16];
+    uint8_t Elements = OpSize / Op->Header.ElementSize;
+
+    if (Op->Header.ElementSize == OpSize) {
+      switch (Op->Header.ElementSize) {
+      DO_SCALAR_COMPARE_OP(4, float, uint32_t, Func);
+      DO_SCALAR_COMPARE_OP(8, double, uint64_t, Func);
+      default: LogMan::Msg::A("Unsupported elementSize: %d", Op->Header.ElementSize);
+      }
+    }
+    else {
+      switch (Op->Header.ElementSize) {
+      DO_VECTOR_COMPARE_OP(4, float, uint32_t, Func);
+      DO_VECTOR_COMPARE_OP(8, double, uint64_t, Func);
+      default: LogMan::Msg::A("Unsupported elementSize: %d", Op->Header.ElementSize);
+      }
+    }
+
+    memcpy(GDP, Tmp, OpSize);
+    NEXT_OP();
+  }
+  DEF_OP(VFCMPLT): {
+    auto Op = IROp->C<IR::IROp_VFCMPLT>();
+    void *Src1 = GetSrc<void*>(SSAData, Op->Header.Args[0]);
+    void *Src2 = GetSrc<void*>(SSAData, Op->Header.Args[1]);
+
+    auto Func = [](auto a, auto b) { return a < b ? ~0ULL : 0; };
+
+    uint8_t Tmp[16];
+    uint8_t Elements = OpSize / Op->Header.ElementSize;
+
+    if (Op->Header.ElementSize == OpSize) {
+      switch (Op->Header.ElementSize) {
+      DO_SCALAR_COMPARE_OP(4, float, uint32_t, Func);
+      DO_SCALAR_COMPARE_OP(8, double, uint64_t, Func);
+      default: LogMan::Msg::A("Unsupported elementSize: %d", Op->Header.ElementSize);
+      }
+    }
+    else {
+      switch (Op->Header.ElementSize) {
+      DO_VECTOR_COMPARE_OP(4, float, uint32_t, Func);
+      DO_VECTOR_COMPARE_OP(8, double, uint64_t, Func);
+      default: LogMan::Msg::A("Unsupported elementSize: %d", Op->Header.ElementSize);
+      }
+    }
+
+    memcpy(GDP, Tmp, OpSize);
+    NEXT_OP();
+  }
+  DEF_OP(VFCMPLE): {
+    auto Op = IROp->C<IR::IROp_VFCMPLE>();
+    void *Src1 = GetSrc<void*>(SSAData, Op->Header.Args[0]);
+    void *Src2 = GetSrc<void*>(SSAData, Op->Header.Args[1]);
+
+    auto Func = [](auto a, auto b) { return a <= b ? ~0ULL : 0; };
+
+    uint8_t Tmp[16];
+    uint8_t Elements = OpSize / Op->Header.ElementSize;
+
+    if (Op->Header.ElementSize == OpSize) {
+      switch (Op->Header.ElementSize) {
+      DO_SCALAR_COMPARE_OP(4, float, uint32_t, Func);
+      DO_SCALAR_COMPARE_OP(8, double, uint64_t, Func);
+      default: LogMan::Msg::A("Unsupported elementSize: %d", Op->Header.ElementSize);
+      }
+    }
+    else {
+      switch (Op->Header.ElementSize) {
+      DO_VECTOR_COMPARE_OP(4, float, uint32_t, Func);
+      DO_VECTOR_COMPARE_OP(8, double, uint64_t, Func);
+      default: LogMan::Msg::A("Unsupported elementSize: %d", Op->Header.ElementSize);
+      }
+    }
+
+    memcpy(GDP, Tmp, OpSize);
+    NEXT_OP();
+  }
+  DEF_OP(VFCMPUNO): {
+    auto Op = IROp->C<IR::IROp_VFCMPUNO>();
+    void *Src1 = GetSrc<void*>(SSAData, Op->Header.Args[0]);
+    void *Src2 = GetSrc<void*>(SSAData, Op->Header.Args[1]);
+
+    auto Func = [](auto a, auto b) { return (std::isnan(a) || std::isnan(b)) ? ~0ULL : 0; };
+
+    uint8_t Tmp[16];
+    uint8_t Elements = OpSize / Op->Header.ElementSize;
+
+    if (Op->Header.ElementSize == OpSize) {
+      switch (Op->Header.ElementSize) {
+      DO_SCALAR_COMPARE_OP(4, float, uint32_t, Func);
+      DO_SCALAR_COMPARE_OP(8, double, uint64_t, Func);
+      default: LogMan::Msg::A("Unsupported elementSize: %d", Op->Header.ElementSize);
+      }
+    }
+    else {
+      switch (Op->Header.ElementSize) {
+      DO_VECTOR_COMPARE_OP(4, float, uint32_t, Func);
+      DO_VECTOR_COMPARE_OP(8, double, uint64_t, Func);
+      default: LogMan::Msg::A("Unsupported elementSize: %d", Op->Header.ElementSize);
+      }
+    }
+
+    memcpy(GDP, Tmp, OpSize);
+    NEXT_OP();
+  }
+  DEF_OP(VFCMPORD): {
+    auto Op = IROp->C<IR::IROp_VFCMPORD>();
+    void *Src1 = GetSrc<void*>(SSAData, Op->Header.Args[0]);
+    void *Src2 = GetSrc<void*>(SSAData, Op->Header.Args[1]);
+
+    auto Func = [](auto a, auto b) { return (!std::isnan(a) && !std::isnan(b)) ? ~0ULL : 0; };
+
+    uint8_t Tmp[16];
+    uint8_t Elements = OpSize / Op->Header.ElementSize;
+
+    if (Op->Header.ElementSize == OpSize) {
+      switch (Op->Header.ElementSize) {
+      DO_SCALAR_COMPARE_OP(4, float, uint32_t, Func);
+      DO_SCALAR_COMPARE_OP(8, double, uint64_t, Func);
+      default: LogMan::Msg::A("Unsupported elementSize: %d", Op->Header.ElementSize);
+      }
+    }
+    else {
+      switch (Op->Header.ElementSize) {
+      DO_VECTOR_COMPARE_OP(4, float, uint32_t, Func);
+      DO_VECTOR_COMPARE_OP(8, double, uint64_t, Func);
+      default: LogMan::Msg::A("Unsupported elementSize: %d", Op->Header.ElementSize);
+      }
+    }
+
+    memcpy(GDP, Tmp, OpSize);
+    NEXT_OP();
+  }
+  DEF_OP(VAESIMC): {
+    auto Op = IROp->C<IR::IROp_VAESImc>();
+    __uint128_t Src1 = *GetSrc<__uint128_t*>(SSAData, Op->Header.Args[0]);
+
+    // Pseudo-code
+    // Dst = InvMixColumns(STATE)
+    __uint128_t Tmp{};
+    Tmp = AES::InvMixColumns(reinterpret_cast<uint8_t*>(&Src1));
+    memcpy(GDP, &Tmp, sizeof(Tmp));
+    NEXT_OP();
+  }
+  DEF_OP(VAESENC): {
+    auto Op = IROp->C<IR::IROp_VAESEnc>();
+    __uint128_t Src1 = *GetSrc<__uint128_t*>(SSAData, Op->Header.Args[0]);
+    __uint128_t Src2 = *GetSrc<__uint128_t*>(SSAData, Op->Header.Args[1]);
+
+    // Pseudo-code
+    // STATE = Src1
+    // RoundKey = Src2
+    // STATE = ShiftRows(STATE)
+    // STATE = SubBytes(STATE)
+    // STATE = MixColumns(STATE)
+    // Dst = STATE XOR RoundKey
+    __uint128_t Tmp{};
+    Tmp = AES::ShiftRows(reinterpret_cast<uint8_t*>(&Src1));
+    Tmp = AES::SubBytes(reinterpret_cast<uint8_t*>(&Tmp), 16);
+    Tmp = AES::MixColumns(reinterpret_cast<uint8_t*>(&Tmp));
+    Tmp = Tmp ^ Src2;
+    memcpy(GDP, &Tmp, sizeof(Tmp));
+    NEXT_OP();
+  }
+  DEF_OP(VAESENCLAST): {
+    auto Op = IROp->C<IR::IROp_VAESEncLast>();
+    __uint128_t Src1 = *GetSrc<__uint128_t*>(SSAData, Op->Header.Args[0]);
+    __uint128_t Src2 = *GetSrc<__uint128_t*>(SSAData, Op->Header.Args[1]);
+
+    // Pseudo-code
+    // STATE = Src1
+    // RoundKey = Src2
+    // STATE = ShiftRows(STATE)
+    // STATE = SubBytes(STATE)
+    // Dst = STATE XOR RoundKey
+    __uint128_t Tmp{};
+    Tmp = AES::ShiftRows(reinterpret_cast<uint8_t*>(&Src1));
+    Tmp = AES::SubBytes(reinterpret_cast<uint8_t*>(&Tmp), 16);
+    Tmp = Tmp ^ Src2;
+    memcpy(GDP, &Tmp, sizeof(Tmp));
+    NEXT_OP();
+  }
+  DEF_OP(VAESDEC): {
+    auto Op = IROp->C<IR::IROp_VAESDec>();
+    __uint128_t Src1 = *GetSrc<__uint128_t*>(SSAData, Op->Header.Args[0]);
+    __uint128_t Src2 = *GetSrc<__uint128_t*>(SSAData, Op->Header.Args[1]);
+
+    // Pseudo-code
+    // STATE = Src1
+    // RoundKey = Src2
+    // STATE = InvShiftRows(STATE)
+    // STATE = InvSubBytes(STATE)
+    // STATE = InvMixColumns(STATE)
+    // Dst = STATE XOR RoundKey
+    __uint128_t Tmp{};
+    Tmp = AES::InvShiftRows(reinterpret_cast<uint8_t*>(&Src1));
+    Tmp = AES::InvSubBytes(reinterpret_cast<uint8_t*>(&Tmp));
+    Tmp = AES::InvMixColumns(reinterpret_cast<uint8_t*>(&Tmp));
+    Tmp = Tmp ^ Src2;
+    memcpy(GDP, &Tmp, sizeof(Tmp));
+    NEXT_OP();
+  }
+  DEF_OP(VAESDECLAST): {
+    auto Op = IROp->C<IR::IROp_VAESDecLast>();
+    __uint128_t Src1 = *GetSrc<__uint128_t*>(SSAData, Op->Header.Args[0]);
+    __uint128_t Src2 = *GetSrc<__uint128_t*>(SSAData, Op->Header.Args[1]);
+
+    // Pseudo-code
+    // STATE = Src1
+    // RoundKey = Src2
+    // STATE = InvShiftRows(STATE)
+    // STATE = InvSubBytes(STATE)
+    // Dst = STATE XOR RoundKey
+    __uint128_t Tmp{};
+    Tmp = AES::InvShiftRows(reinterpret_cast<uint8_t*>(&Src1));
+    Tmp = AES::InvSubBytes(reinterpret_cast<uint8_t*>(&Tmp));
+    Tmp = Tmp ^ Src2;
+    memcpy(GDP, &Tmp, sizeof(Tmp));
+    NEXT_OP();
+  }
+  DEF_OP(VAESKEYGENASSIST): {
+    auto Op = IROp->C<IR::IROp_VAESKeyGenAssist>();
+    uint8_t *Src1 = GetSrc<uint8_t*>(SSAData, Op->Header.Args[0]);
+
+    // Pseudo-code
+    // X3 = Src1[127:96]
+    // X2 = Src1[95:64]
+    // X1 = Src1[63:32]
+    // X0 = Src1[31:30]
+    // RCON = (Zext)rcon
+    // Dest[31:0] = SubWord(X1)
+    // Dest[63:32] = RotWord(SubWord(X1)) XOR RCON
+    // Dest[95:64] = SubWord(X3)
+    // Dest[127:96] = RotWord(SubWord(X3)) XOR RCON
+    __uint128_t Tmp{};
+    uint32_t X1{};
+    uint32_t X3{};
+    memcpy(&X1, &Src1[4], 4);
+    memcpy(&X3, &Src1[12], 4);
+    uint32_t SubWord_X1 = AES::SubBytes(reinterpret_cast<uint8_t*>(&X1), 4);
+    uint32_t SubWord_X3 = AES::SubBytes(reinterpret_cast<uint8_t*>(&X3), 4);
+
+    auto Ror = [] (auto In, auto R) {
+      auto RotateMask = sizeof(In) * 8 - 1;
+      R &= RotateMask;
+      return (In >> R) | (In << (sizeof(In) * 8 - R));
+    };
+
+    uint32_t Rot_X1 = Ror(SubWord_X1, 8);
+    uint32_t Rot_X3 = Ror(SubWord_X3, 8);
+
+    Tmp = Rot_X3 ^ Op->RCON;
+    Tmp <<= 32;
+    Tmp |= SubWord_X3;
+    Tmp <<= 32;
+    Tmp |= Rot_X1 ^ Op->RCON;
+    Tmp <<= 32;
+    Tmp |= SubWord_X1;
+    memcpy(GDP, &Tmp, sizeof(Tmp));
+    NEXT_OP();
+  }
+  DEF_OP(F80LOADFCW): {
+    OpHandlers<IR::OP_F80LOADFCW>::handle(*GetSrc<uint16_t*>(SSAData, IROp->Args[0]));
+    NEXT_OP();
+  }
+  DEF_OP(F80ADD): {
+    auto Op = IROp->C<IR::IROp_F80Add>();
+    X80SoftFloat Src1 = *GetSrc<X80SoftFloat*>(SSAData, Op->Header.Args[0]);
+    X80SoftFloat Src2 = *GetSrc<X80SoftFloat*>(SSAData, Op->Header.Args[1]);
+    X80SoftFloat Tmp;
+    Tmp = X80SoftFloat::FADD(Src1, Src2);
+
+    memcpy(GDP, &Tmp, sizeof(X80SoftFloat));
+    NEXT_OP();
+  }
+  DEF_OP(F80SUB): {
+    auto Op = IROp->C<IR::IROp_F80Sub>();
+    X80SoftFloat Src1 = *GetSrc<X80SoftFloat*>(SSAData, Op->Header.Args[0]);
+    X80SoftFloat Src2 = *GetSrc<X80SoftFloat*>(SSAData, Op->Header.Args[1]);
+    X80SoftFloat Tmp;
+    Tmp = X80SoftFloat::FSUB(Src1, Src2);
+
+    memcpy(GDP, &Tmp, sizeof(X80SoftFloat));
+    NEXT_OP();
+  }
+  DEF_OP(F80MUL): {
+    auto Op = IROp->C<IR::IROp_F80Mul>();
+    X80SoftFloat Src1 = *GetSrc<X80SoftFloat*>(SSAData, Op->Header.Args[0]);
+    X80SoftFloat Src2 = *GetSrc<X80SoftFloat*>(SSAData, Op->Header.Args[1]);
+    X80SoftFloat Tmp;
+    Tmp = X80SoftFloat::FMUL(Src1, Src2);
+
+    memcpy(GDP, &Tmp, sizeof(X80SoftFloat));
+    NEXT_OP();
+  }
+  DEF_OP(F80DIV): {
+    auto Op = IROp->C<IR::IROp_F80Div>();
+    X80SoftFloat Src1 = *GetSrc<X80SoftFloat*>(SSAData, Op->Header.Args[0]);
+    X80SoftFloat Src2 = *GetSrc<X80SoftFloat*>(SSAData, Op->Header.Args[1]);
+    X80SoftFloat Tmp;
+    Tmp = X80SoftFloat::FDIV(Src1, Src2);
+
+    memcpy(GDP, &Tmp, sizeof(X80SoftFloat));
+    NEXT_OP();
+  }
+  DEF_OP(F80FYL2X): {
+    auto Op = IROp->C<IR::IROp_F80FYL2X>();
+    X80SoftFloat Src1 = *GetSrc<X80SoftFloat*>(SSAData, Op->Header.Args[0]);
+    X80SoftFloat Src2 = *GetSrc<X80SoftFloat*>(SSAData, Op->Header.Args[1]);
+    X80SoftFloat Tmp;
+    Tmp = X80SoftFloat::FYL2X(Src1, Src2);
+
+    memcpy(GDP, &Tmp, sizeof(X80SoftFloat));
+    NEXT_OP();
+  }
+  DEF_OP(F80ATAN): {
+    auto Op = IROp->C<IR::IROp_F80ATAN>();
+    X80SoftFloat Src1 = *GetSrc<X80SoftFloat*>(SSAData, Op->Header.Args[0]);
+    X80SoftFloat Src2 = *GetSrc<X80SoftFloat*>(SSAData, Op->Header.Args[1]);
+    X80SoftFloat Tmp;
+    Tmp = X80SoftFloat::FATAN(Src1, Src2);
+
+    memcpy(GDP, &Tmp, sizeof(X80SoftFloat));
+    NEXT_OP();
+  }
+  DEF_OP(F80FPREM1): {
+    auto Op = IROp->C<IR::IROp_F80FPREM1>();
+    X80SoftFloat Src1 = *GetSrc<X80SoftFloat*>(SSAData, Op->Header.Args[0]);
+    X80SoftFloat Src2 = *GetSrc<X80SoftFloat*>(SSAData, Op->Header.Args[1]);
+    X80SoftFloat Tmp;
+    Tmp = X80SoftFloat::FREM1(Src1, Src2);
+
+    memcpy(GDP, &Tmp, sizeof(X80SoftFloat));
+    NEXT_OP();
+  }
+  DEF_OP(F80FPREM): {
+    auto Op = IROp->C<IR::IROp_F80FPREM>();
+    X80SoftFloat Src1 = *GetSrc<X80SoftFloat*>(SSAData, Op->Header.Args[0]);
+    X80SoftFloat Src2 = *GetSrc<X80SoftFloat*>(SSAData, Op->Header.Args[1]);
+    X80SoftFloat Tmp;
+    Tmp = X80SoftFloat::FREM(Src1, Src2);
+
+    memcpy(GDP, &Tmp, sizeof(X80SoftFloat));
+    NEXT_OP();
+  }
+  DEF_OP(F80SCALE): {
+    auto Op = IROp->C<IR::IROp_F80SCALE>();
+    X80SoftFloat Src1 = *GetSrc<X80SoftFloat*>(SSAData, Op->Header.Args[0]);
+    X80SoftFloat Src2 = *GetSrc<X80SoftFloat*>(SSAData, Op->Header.Args[1]);
+    X80SoftFloat Tmp;
+    Tmp = X80SoftFloat::FSCALE(Src1, Src2);
+
+    memcpy(GDP, &Tmp, sizeof(X80SoftFloat));
+    NEXT_OP();
+  }
+  DEF_OP(F80CVT): {
+    auto Op = IROp->C<IR::IROp_F80CVT>();
+    X80SoftFloat Src = *GetSrc<X80SoftFloat*>(SSAData, Op->Header.Args[0]);
+
+    switch (OpSize) {
+      case 4: {
+        float Tmp = Src;
+        memcpy(GDP, &Tmp, OpSize);
+        break;
+      }
+      case 8: {
+        double Tmp = Src;
+        memcpy(GDP, &Tmp, OpSize);
+        break;
+      }
+    default: LogMan::Msg::D("Unhandled size: %d", OpSize);
+    }
+    NEXT_OP();
+  }
+  DEF_OP(F80CVTINT): {
+    auto Op = IROp->C<IR::IROp_F80CVTInt>();
+    X80SoftFloat Src = *GetSrc<X80SoftFloat*>(SSAData, Op->Header.Args[0]);
+
+    switch (OpSize) {
+      case 2: {
+        int16_t Tmp = (Op->Truncate? OpHandlers<IR::OP_F80CVTINT>::handle2t : OpHandlers<IR::OP_F80CVTINT>::handle2)(Src);
+        memcpy(GDP, &Tmp, sizeof(Tmp));
+        break;
+      }
+      case 4: {
+        int32_t Tmp = (Op->Truncate? OpHandlers<IR::OP_F80CVTINT>::handle4t : OpHandlers<IR::OP_F80CVTINT>::handle4)(Src);
+        memcpy(GDP, &Tmp, sizeof(Tmp));
+        break;
+      }
+      case 8: {
+        int64_t Tmp = (Op->Truncate? OpHandlers<IR::OP_F80CVTINT>::handle8t : OpHandlers<IR::OP_F80CVTINT>::handle8)(Src);
+        memcpy(GDP, &Tmp, sizeof(Tmp));
+        break;
+      }
+    default: LogMan::Msg::D("Unhandled size: %d", OpSize);
+    }
+    NEXT_OP();
+  }
+  DEF_OP(F80CVTTO): {
+    auto Op = IROp->C<IR::IROp_F80CVTTo>();
+
+    switch (Op->Size) {
+      case 4: {
+        float Src = *GetSrc<float *>(SSAData, Op->Header.Args[0]);
+        X80SoftFloat Tmp = Src;
+        memcpy(GDP, &Tmp, sizeof(X80SoftFloat));
+        break;
+      }
+      case 8: {
+        double Src = *GetSrc<double *>(SSAData, Op->Header.Args[0]);
+        X80SoftFloat Tmp = Src;
+        memcpy(GDP, &Tmp, sizeof(X80SoftFloat));
+        break;
+      }
+    default: LogMan::Msg::D("Unhandled size: %d", OpSize);
+    }
+    NEXT_OP();
+  }
+  DEF_OP(F80CVTTOINT): {
+    auto Op = IROp->C<IR::IROp_F80CVTToInt>();
+
+    switch (Op->Size) {
+      case 2: {
+        int16_t Src = *GetSrc<int16_t*>(SSAData, Op->Header.Args[0]);
+        X80SoftFloat Tmp = Src;
+        memcpy(GDP, &Tmp, sizeof(X80SoftFloat));
+        break;
+      }
+      case 4: {
+        int32_t Src = *GetSrc<int32_t*>(SSAData, Op->Header.Args[0]);
+        X80SoftFloat Tmp = Src;
+        memcpy(GDP, &Tmp, sizeof(X80SoftFloat));
+        break;
+      }
+    default: LogMan::Msg::D("Unhandled size: %d", OpSize);
+    }
+    NEXT_OP();
+  }
+  DEF_OP(F80ROUND): {
+    auto Op = IROp->C<IR::IROp_F80Round>();
+    X80SoftFloat Src = *GetSrc<X80SoftFloat*>(SSAData, Op->Header.Args[0]);
+    X80SoftFloat Tmp;
+    Tmp = X80SoftFloat::FRNDINT(Src);
+
+    memcpy(GDP, &Tmp, sizeof(X80SoftFloat));
+    NEXT_OP();
+  }
+  DEF_OP(F80F2XM1): {
+    auto Op = IROp->C<IR::IROp_F80F2XM1>();
+    X80SoftFloat Src = *GetSrc<X80SoftFloat*>(SSAData, Op->Header.Args[0]);
+    X80SoftFloat Tmp;
+    Tmp = X80SoftFloat::F2XM1(Src);
+
+    memcpy(GDP, &Tmp, sizeof(X80SoftFloat));
+    NEXT_OP();
+  }
+  DEF_OP(F80TAN): {
+    auto Op = IROp->C<IR::IROp_F80TAN>();
+    X80SoftFloat Src = *GetSrc<X80SoftFloat*>(SSAData, Op->Header.Args[0]);
+    X80SoftFloat Tmp;
+    Tmp = X80SoftFloat::FTAN(Src);
+
+    memcpy(GDP, &Tmp, sizeof(X80SoftFloat));
+    NEXT_OP();
+  }
+  DEF_OP(F80SQRT): {
+    auto Op = IROp->C<IR::IROp_F80SQRT>();
+    X80SoftFloat Src = *GetSrc<X80SoftFloat*>(SSAData, Op->Header.Args[0]);
+    X80SoftFloat Tmp;
+    Tmp = X80SoftFloat::FSQRT(Src);
+
+    memcpy(GDP, &Tmp, sizeof(X80SoftFloat));
+    NEXT_OP();
+  }
+  DEF_OP(F80SIN): {
+    auto Op = IROp->C<IR::IROp_F80SIN>();
+    X80SoftFloat Src = *GetSrc<X80SoftFloat*>(SSAData, Op->Header.Args[0]);
+    X80SoftFloat Tmp;
+    Tmp = X80SoftFloat::FSIN(Src);
+    memcpy(GDP, &Tmp, sizeof(X80SoftFloat));
+    NEXT_OP();
+  }
+  DEF_OP(F80COS): {
+    auto Op = IROp->C<IR::IROp_F80COS>();
+    X80SoftFloat Src = *GetSrc<X80SoftFloat*>(SSAData, Op->Header.Args[0]);
+    X80SoftFloat Tmp;
+    Tmp = X80SoftFloat::FCOS(Src);
+    memcpy(GDP, &Tmp, sizeof(X80SoftFloat));
+    NEXT_OP();
+  }
+  DEF_OP(F80XTRACT_EXP): {
+    auto Op = IROp->C<IR::IROp_F80XTRACT_EXP>();
+    X80SoftFloat Src = *GetSrc<X80SoftFloat*>(SSAData, Op->Header.Args[0]);
+    X80SoftFloat Tmp;
+    Tmp = X80SoftFloat::FXTRACT_EXP(Src);
+    memcpy(GDP, &Tmp, sizeof(X80SoftFloat));
+    NEXT_OP();
+  }
+  DEF_OP(F80XTRACT_SIG): {
+    auto Op = IROp->C<IR::IROp_F80XTRACT_SIG>();
+    X80SoftFloat Src = *GetSrc<X80SoftFloat*>(SSAData, Op->Header.Args[0]);
+    X80SoftFloat Tmp;
+    Tmp = X80SoftFloat::FXTRACT_SIG(Src);
+    memcpy(GDP, &Tmp, sizeof(X80SoftFloat));
+    NEXT_OP();
+  }
+  DEF_OP(F80CMP): {
+    auto Op = IROp->C<IR::IROp_F80Cmp>();
+    uint32_t ResultFlags{};
+    X80SoftFloat Src1 = *GetSrc<X80SoftFloat*>(SSAData, Op->Header.Args[0]);
+    X80SoftFloat Src2 = *GetSrc<X80SoftFloat*>(SSAData, Op->Header.Args[1]);
+    bool eq, lt, nan;
+    X80SoftFloat::FCMP(Src1, Src2, &eq, &lt, &nan);
+    if (Op->Flags & (1 << FCMP_FLAG_LT) &&
+        lt) {
+      ResultFlags |= (1 << FCMP_FLAG_LT);
+    }
+    if (Op->Flags & (1 << FCMP_FLAG_UNORDERED) &&
+        nan) {
+      ResultFlags |= (1 << FCMP_FLAG_UNORDERED);
+    }
+    if (Op->Flags & (1 << FCMP_FLAG_EQ) &&
+        eq) {
+      ResultFlags |= (1 << FCMP_FLAG_EQ);
+    }
+
+    GD = ResultFlags;
+    NEXT_OP();
+  }
+  DEF_OP(GETROUNDINGMODE): {
+    uint32_t GuestRounding{};
 #ifdef _M_ARM_64
-            uint64_t Tmp{};
-            __asm(R"(
-              mrs %[Tmp], FPCR;
-            )"
-            : [Tmp] "=r" (Tmp));
-            // Extract the rounding
-            // On ARM the ordering is different than on x86
-            GuestRounding |= ((Tmp >> 24) & 1) ? ROUND_MODE_FLUSH_TO_ZERO : 0;
-            uint8_t RoundingMode = (Tmp >> 22) & 0b11;
-            if (RoundingMode == 0)
-              GuestRounding |= ROUND_MODE_NEAREST;
-            else if (RoundingMode == 1)
-              GuestRounding |= ROUND_MODE_POSITIVE_INFINITY;
-            else if (RoundingMode == 2)
-              GuestRounding |= ROUND_MODE_NEGATIVE_INFINITY;
-            else if (RoundingMode == 3)
-              GuestRounding |= ROUND_MODE_TOWARDS_ZERO;
+    uint64_t Tmp{};
+    __asm(R"(
+      mrs %[Tmp], FPCR;
+    )"
+    : [Tmp] "=r" (Tmp));
+    // Extract the rounding
+    // On ARM the ordering is different than on x86
+    GuestRounding |= ((Tmp >> 24) & 1) ? ROUND_MODE_FLUSH_TO_ZERO : 0;
+    uint8_t RoundingMode = (Tmp >> 22) & 0b11;
+    if (RoundingMode == 0)
+      GuestRounding |= ROUND_MODE_NEAREST;
+    else if (RoundingMode == 1)
+      GuestRounding |= ROUND_MODE_POSITIVE_INFINITY;
+    else if (RoundingMode == 2)
+      GuestRounding |= ROUND_MODE_NEGATIVE_INFINITY;
+    else if (RoundingMode == 3)
+      GuestRounding |= ROUND_MODE_TOWARDS_ZERO;
 #else
-            GuestRounding = _mm_getcsr();
+    GuestRounding = _mm_getcsr();
 
-            // Extract the rounding
-            GuestRounding = (GuestRounding >> 13) & 0b111;
+    // Extract the rounding
+    GuestRounding = (GuestRounding >> 13) & 0b111;
 #endif
-            memcpy(GDP, &GuestRounding, sizeof(GuestRounding));
-            break;
-          }
+    memcpy(GDP, &GuestRounding, sizeof(GuestRounding));
+    NEXT_OP();
+  }
 
-          case IR::OP_SETROUNDINGMODE: {
-            auto Op = IROp->C<IR::IROp_SetRoundingMode>();
-            uint8_t GuestRounding = *GetSrc<uint8_t*>(SSAData, Op->Header.Args[0]);
+  DEF_OP(SETROUNDINGMODE): {
+    auto Op = IROp->C<IR::IROp_SetRoundingMode>();
+    uint8_t GuestRounding = *GetSrc<uint8_t*>(SSAData, Op->Header.Args[0]);
 #ifdef _M_ARM_64
-            uint64_t HostRounding{};
-            __asm volatile(R"(
-              mrs %[Tmp], FPCR;
-            )"
-            : [Tmp] "=r" (HostRounding));
-            // Mask out the rounding
-            HostRounding &= ~(0b111 << 22);
-
-            HostRounding |= (GuestRounding & ROUND_MODE_FLUSH_TO_ZERO) ? (1U << 24) : 0;
-
-            uint8_t RoundingMode = GuestRounding & 0b11;
-            if (RoundingMode == ROUND_MODE_NEAREST)
-              HostRounding |= (0b00U << 22);
-            else if (RoundingMode == ROUND_MODE_POSITIVE_INFINITY)
-              HostRounding |= (0b01U << 22);
-            else if (RoundingMode == ROUND_MODE_NEGATIVE_INFINITY)
-              HostRounding |= (0b10U << 22);
-            else if (RoundingMode == ROUND_MODE_TOWARDS_ZERO)
-              HostRounding |= (0b11U << 22);
-
-            __asm volatile(R"(
-              msr FPCR, %[Tmp];
-            )"
-            :: [Tmp] "r" (HostRounding));
+    uint64_t HostRounding{};
+    __asm volatile(R"(
+      mrs %[Tmp], FPCR;
+    )"
+    : [Tmp] "=r" (HostRounding));
+    // Mask out the rounding
+    HostRounding &= ~(0b111 << 22);
+
+    HostRounding |= (GuestRounding & ROUND_MODE_FLUSH_TO_ZERO) ? (1U << 24) : 0;
+
+    uint8_t RoundingMode = GuestRounding & 0b11;
+    if (RoundingMode == ROUND_MODE_NEAREST)
+      HostRounding |= (0b00U << 22);
+    else if (RoundingMode == ROUND_MODE_POSITIVE_INFINITY)
+      HostRounding |= (0b01U << 22);
+    else if (RoundingMode == ROUND_MODE_NEGATIVE_INFINITY)
+      HostRounding |= (0b10U << 22);
+    else if (RoundingMode == ROUND_MODE_TOWARDS_ZERO)
+      HostRounding |= (0b11U << 22);
+
+    __asm volatile(R"(
+      msr FPCR, %[Tmp];
+    )"
+    :: [Tmp] "r" (HostRounding));
 #else
-            uint32_t HostRounding = _mm_getcsr();
+    uint32_t HostRounding = _mm_getcsr();
 
-            // Cut out the host rounding mode
-            HostRounding &= ~(0b111 << 13);
+    // Cut out the host rounding mode
+    HostRounding &= ~(0b111 << 13);
 
-            // Insert our new rounding mode
-            HostRounding |= GuestRounding << 13;
-            _mm_setcsr(HostRounding);
+    // Insert our new rounding mode
+    HostRounding |= GuestRounding << 13;
+    _mm_setcsr(HostRounding);
 #endif
-            break;
-          }
-          case IR::OP_F80BCDLOAD: {
-            auto Op = IROp->C<IR::IROp_F80BCDLoad>();
-            uint8_t *Src1 = GetSrc<uint8_t*>(SSAData, Op->Header.Args[0]);
-            uint64_t BCD{};
-            // We walk through each uint8_t and pull out the BCD encoding
-            // Each 4bit split is a digit
-            // Only 0-9 is supported, A-F results in undefined data
-            // | 4 bit     | 4 bit    |
-            // | 10s place | 1s place |
-            // EG 0x48 = 48
-            // EG 0x4847 = 4847
-            // This gives us an 18digit value encoded in BCD
-            // The last byte lets us know if it negative or not
-            for (size_t i = 0; i < 9; ++i) {
-              uint8_t Digit = Src1[8 - i];
-              // First shift our last value over
-              BCD *= 100;
-
-              // Add the tens place digit
-              BCD += (Digit >> 4) * 10;
-
-              // Add the ones place digit
-              BCD += Digit & 0xF;
-            }
-
-            // Set negative flag once converted to x87
-            bool Negative = Src1[9] & 0x80;
-            X80SoftFloat Tmp;
-
-            Tmp = BCD;
-            Tmp.Sign = Negative;
-
-            memcpy(GDP, &Tmp, sizeof(X80SoftFloat));
-            break;
-          }
-          case IR::OP_F80BCDSTORE: {
-            auto Op = IROp->C<IR::IROp_F80BCDStore>();
-            X80SoftFloat Src1 = *GetSrc<X80SoftFloat*>(SSAData, Op->Header.Args[0]);
-            bool Negative = Src1.Sign;
-
-            // Clear the Sign bit
-            Src1.Sign = 0;
+    NEXT_OP();
+  }
+  DEF_OP(F80BCDLOAD): {
+    auto Op = IROp->C<IR::IROp_F80BCDLoad>();
+    uint8_t *Src1 = GetSrc<uint8_t*>(SSAData, Op->Header.Args[0]);
+    uint64_t BCD{};
+    // We walk through each uint8_t and pull out the BCD encoding
+    // Each 4bit split is a digit
+    // Only 0-9 is supported, A-F results in undefined data
+    // | 4 bit     | 4 bit    |
+    // | 10s place | 1s place |
+    // EG 0x48 = 48
+    // EG 0x4847 = 4847
+    // This gives us an 18digit value encoded in BCD
+    // The last byte lets us know if it negative or not
+    for (size_t i = 0; i < 9; ++i) {
+      uint8_t Digit = Src1[8 - i];
+      // First shift our last value over
+      BCD *= 100;
 
-            uint64_t Tmp = Src1;
-            uint8_t BCD[10]{};
+      // Add the tens place digit
+      BCD += (Digit >> 4) * 10;
 
-            for (size_t i = 0; i < 9; ++i) {
-              if (Tmp == 0) {
-                // Nothing left? Just leave
-                break;
-              }
-              // Extract the lower 100 values
-              uint8_t Digit = Tmp % 100;
+      // Add the ones place digit
+      BCD += Digit & 0xF;
+    }
 
-              // Now divide it for the next iteration
-              Tmp /= 100;
+    // Set negative flag once converted to x87
+    bool Negative = Src1[9] & 0x80;
+    X80SoftFloat Tmp;
 
-              uint8_t UpperNibble = Digit / 10;
-              uint8_t LowerNibble = Digit % 10;
+    Tmp = BCD;
+    Tmp.Sign = Negative;
 
-              // Now store the BCD
-              BCD[i] = (UpperNibble << 4) | LowerNibble;
-            }
+    memcpy(GDP, &Tmp, sizeof(X80SoftFloat));
+    NEXT_OP();
+  }
+  DEF_OP(F80BCDSTORE): {
+    auto Op = IROp->C<IR::IROp_F80BCDStore>();
+    X80SoftFloat Src1 = *GetSrc<X80SoftFloat*>(SSAData, Op->Header.Args[0]);
+    bool Negative = Src1.Sign;
 
-            // Set negative flag once converted to x87
-            BCD[9] = Negative ? 0x80 : 0;
+    // Clear the Sign bit
+    Src1.Sign = 0;
 
-            memcpy(GDP, BCD, 10);
-            break;
-          }
-          default:
-            LogMan::Msg::A("Unknown IR Op: %d(%s)", IROp->Op, FEXCore::IR::GetName(IROp->Op).data());
-            break;
-        }
+    uint64_t Tmp = Src1;
+    uint8_t BCD[10]{};
 
-        // CodeLast is inclusive. So we still need to dump the CodeLast op as well
-        if (CodeBegin == CodeLast) {
-          break;
-        }
-        ++CodeBegin;
+    for (size_t i = 0; i < 9; ++i) {
+      if (Tmp == 0) {
+        // Nothing left? Just leave
+        break;
       }
-    };
+      // Extract the lower 100 values
+      uint8_t Digit = Tmp % 100;
 
-    HandleBlock(BlockNode);
+      // Now divide it for the next iteration
+      Tmp /= 100;
 
-    if (BlockResults.Redo) {
-      continue;
-    }
+      uint8_t UpperNibble = Digit / 10;
+      uint8_t LowerNibble = Digit % 10;
 
-    if (BlockResults.Quit || ++BlockIterator == BlockEnd) {
-      break;
+      // Now store the BCD
+      BCD[i] = (UpperNibble << 4) | LowerNibble;
     }
+
+    // Set negative flag once converted to x87
+    BCD[9] = Negative ? 0x80 : 0;
+
+    memcpy(GDP, BCD, 10);
+    NEXT_OP();
   }
+  DEF_OP(Unknown):
+    LogMan::Msg::A("Unknown IR Op: %d(%s)", IROp->Op, FEXCore::IR::GetName(IROp->Op).data());
+    NEXT_OP();
+
+BlockEnd:
+  Core->SSAStackTop = SSABase;
+  return nullptr;
+#undef JUMP_OP
+#undef NEXT_OP
+#undef DISPATCH
+#undef DEF_OP
 }
 
 }
\ No newline at end of file
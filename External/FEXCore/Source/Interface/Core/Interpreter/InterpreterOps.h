@@ -1,3 +1,10 @@
+#pragma once
+#include <FEXCore/IR/IR.h>
+
+#include <memory>
+#include <stdint.h>
+#include <vector>
+
 namespace FEXCore::Core {
   struct InternalThreadState;
 }
@@ -12,6 +19,8 @@ namespace FEXCore::Core{
 }
 
 namespace FEXCore::CPU {
+  class InterpreterCore;
+
   enum FallbackABI {
     FABI_UNKNOWN,
     FABI_VOID_U16,
@@ -34,10 +43,53 @@ namespace FEXCore::CPU {
     void *fn;
   };
   
+  /**
+   * @brief A block's IR lowered to a flat array of ops for the interpreter
+   *
+   * Nodes without any work at runtime are dropped and jump targets are resolved to op indices,
+   * so running a block never has to walk the IR lists.
+   * The lookup cache maps guest code straight to these.
+   *
+   * A program is one allocation from the interpreter's program region: this header, the ops, the links and a copy
+   * of the block's IR ops. Nothing in it points outside of that allocation, so it stays valid until the backend
+   * recycles the generation it lives in, however long the block's IR and debug data are kept.
+   *
+   * Every op gets its own SSA slot, numbered from 1 in op order. The arguments in the copied IR are rewritten to
+   * those slot numbers, so a program only needs as many slots as it has ops rather than one per IR node.
+   */
+  struct InterpreterProgram {
+    struct Op {
+      IR::IROp_Header *IROp; ///< Points in to the program's copy of the IR
+      uint32_t Slot; ///< The SSA slot the op writes its result to, 0 for ops without one
+      IR::IROps OpCode;
+      uint8_t Size;
+      uint8_t ArgSize; ///< Size of the op that produced the first argument, for the ops that depend on it
+      uint32_t Targets[2]; ///< Op index a jump continues at, CondJump has the true target first. ExitFunction has its index in Links
+    };
+
+    constexpr static uint32_t NO_LINK = ~0U;
+    // Each slot holds the largest result an op can have
+    constexpr static size_t SLOT_SIZE = 16;
+
+    Op *Ops; ///< Always ends with an OP_LAST op
+    InterpreterProgram **Links; ///< Block each direct exit continues in, null until linked. Other threads may unlink it
+    uint32_t NumLinks;
+    uint32_t NumSlots;
+    uint64_t GuestInstructionCount;
+  };
+
   class InterpreterOps {
 
     public:
-      static void InterpretIR(FEXCore::Core::InternalThreadState *Thread, FEXCore::IR::IRListView<true> *CurrentIR, FEXCore::Core::DebugData *DebugData);
+      static InterpreterProgram *LowerIR(FEXCore::IR::IRListView<true> const *IR, FEXCore::Core::DebugData *DebugData, InterpreterCore *Core);
+
+      /**
+       * @brief Runs a block
+       *
+       * @return The program of the next block when the block left through a linked exit, otherwise nullptr
+       */
+      static InterpreterProgram *InterpretIR(FEXCore::Core::InternalThreadState *Thread, InterpreterProgram *Program);
+      static InterpreterProgram *LinkExit(FEXCore::Core::InternalThreadState *Thread, InterpreterProgram *Program, uint32_t Link);
       static bool GetFallbackHandler(IR::IROp_Header *IROp, FallbackInfo *Info);
   };
 };
\ No newline at end of file
@@ -87,6 +87,8 @@ DispatchGenerator::DispatchGenerator(FEXCore::Context::Context *ctx, FEXCore::Co
   mov(qword [rdi + offsetof(FEXCore::Core::ThreadState, ReturningStackLocation)], rsp);
 
   Label LoopTop;
+  Label FullLookup;
+  Label RunBlock;
   Label NoBlock;
   Label ExitBlock;
   Label ThreadPauseHandler;
@@ -95,40 +97,69 @@ DispatchGenerator::DispatchGenerator(FEXCore::Context::Context *ctx, FEXCore::Co
   AbsoluteLoopTopAddress = getCurr<uint64_t>();
 
   {
-    mov(r13, Thread->LookupCache->GetPagePointer());
-
     // Load our RIP
     mov(rdx, qword [STATE + offsetof(FEXCore::Core::CPUState, rip)]);
 
+    // L1 Cache
+    // Programs too far from the host code base for L2 are only cached here
+    mov(rsi, Thread->LookupCache->GetL1Pointer());
     mov(rax, rdx);
-    mov(rbx, Thread->LookupCache->GetVirtualMemorySize() - 1);
-    and_(rax, rbx);
-    shr(rax, 12);
 
-    // Load page pointer
+    and_(rax, LookupCache::L1_ENTRIES_MASK);
+    shl(rax, 4);
+    cmp(qword[rsi + rax + 8], rdx);
+    jne(FullLookup);
+    mov(rsi, qword[rsi + rax + 0]);
+    jmp(RunBlock);
+
+    L(FullLookup);
+    mov(r13, Thread->LookupCache->GetRootPointer());
+
+    // Walks the radix tree in CodeCache.cpp::WalkL2
+    // Addresses outside of the guest address space never have an entry
+    mov(rax, rdx);
+    shr(rax, CodeCache::ROOT_SHIFT);
+    cmp(rax, CodeCache::ROOT_ENTRIES);
+    jae(NoBlock);
+
+    // Load directory pointer
     mov(rdi, qword [r13 + rax * 8]);
+    test(rdi, rdi);
+    jz(NoBlock);
 
-    cmp(rdi, 0);
-    je(NoBlock);
+    // Load table pointer
+    mov(rax, rdx);
+    shr(rax, CodeCache::DIRECTORY_SHIFT);
+    and_(rax, CodeCache::TABLE_MASK);
+    mov(rdi, qword [rdi + rax * 8]);
+    test(rdi, rdi);
+    jz(NoBlock);
+
+    // Load page pointer
+    mov(rax, rdx);
+    shr(rax, CodeCache::TABLE_SHIFT);
+    and_(rax, CodeCache::TABLE_MASK);
+    mov(rdi, qword [rdi + rax * 8]);
+    test(rdi, rdi);
+    jz(NoBlock);
 
     mov (rax, rdx);
-    and_(rax, 0x0FFF);
+    and_(rax, CodeCache::PAGE_MASK);
 
-    shl(rax, (int)log2(sizeof(FEXCore::LookupCache::LookupCacheEntry)));
+    // Load the offset of the block from the host code base
+    static_assert(sizeof(FEXCore::CodeCache::L2Entry) == 4, "This is expected to be size of 4");
+    movsxd(rax, dword [rdi + rax * 4]);
 
-    // check for aliasing
-    mov(rcx, qword [rdi + rax + 8]);
-    cmp(rcx, rdx);
-    jne(NoBlock);
-    
-    // Load the block pointer
-    mov(rax, qword [rdi + rax]);
+    test(rax, rax);
+    jz(NoBlock);
 
-    cmp(rax, 0);
-    je(NoBlock);
+    mov(rsi, Thread->LookupCache->GetHostCodeBase());
+    add(rsi, rax);
 
-    // Real block if we made it here
+    // Real block if we made it here, rsi holds its program
+    L(RunBlock);
     mov(rdi, STATE);
+    mov(rax, reinterpret_cast<uint64_t>(InterpreterExecution));
     call(rax);
 
     if (CTX->GetGdbServerStatus()) {
@@ -185,8 +216,11 @@ DispatchGenerator::DispatchGenerator(FEXCore::Context::Context *ctx, FEXCore::Co
 
     call(rax);
 
-    // rdx already contains RIP here
-    jmp(LoopTop);
+    // Run the program it hands back, a block it just compiled isn't in L1 or L2 yet and would miss again
+    test(rax, rax);
+    jz(LoopTop);
+    mov(rsi, rax);
+    jmp(RunBlock);
   }
 
   {
@@ -25,8 +25,8 @@ DEF_OP(SignalReturn) {
   ResetStack();
 
   // Now branch to our signal return helper
-  // This can't be a direct branch since the code needs to live at a constant location
-  LoadConstant(x0, ThreadSharedData.SignalReturnInstruction);
+  // Blocks can be shared between threads, anything thread specific comes from the state
+  ldr(x0, MemOperand(STATE, offsetof(FEXCore::Core::InternalThreadState, Dispatcher.SignalHandlerReturn)));
   br(x0);
 }
 
@@ -39,7 +39,7 @@ DEF_OP(CallbackReturn) {
   ResetStack();
 
   // We can now lower the ref counter again
-  LoadConstant(x0, reinterpret_cast<uint64_t>(ThreadSharedData.SignalHandlerRefCounterPtr));
+  ldr(x0, MemOperand(STATE, offsetof(FEXCore::Core::InternalThreadState, Dispatcher.SignalHandlerRefCounter)));
   ldr(w2, MemOperand(x0));
   sub(w2, w2, 1);
   str(w2, MemOperand(x0));
@@ -66,7 +66,14 @@ DEF_OP(ExitFunction) {
   uint64_t NewRIP;
 
   if (IsInlineConstant(Op->NewRIP, &NewRIP)) {
-    Literal l_BranchHost{ExitFunctionLinkerAddress};
+    // Keep the host literal naturally aligned, other threads may be running this exit while it is patched
+    if (GetBuffer()->GetOffsetAddress<uint64_t>(GetCursorOffset()) & 7) {
+      nop();
+    }
+
+    // Until linked the exit goes to the stub after the record, which jumps to the linker of the thread running it
+    uint64_t StubAddress = GetBuffer()->GetOffsetAddress<uint64_t>(GetCursorOffset()) + 24;
+    Literal l_BranchHost{StubAddress};
     Literal l_BranchGuest{NewRIP};
 
     ldr(x0, &l_BranchHost);
@@ -74,11 +81,22 @@ DEF_OP(ExitFunction) {
 
     place(&l_BranchHost);
     place(&l_BranchGuest);
+
+    LogMan::Throw::A(GetBuffer()->GetOffsetAddress<uint64_t>(GetCursorOffset()) == StubAddress, "Exit stub isn't where the record expects it");
+    ldr(x0, MemOperand(STATE, offsetof(FEXCore::Core::InternalThreadState, Dispatcher.ExitFunctionLinker)));
+    br(x0);
   } else {
     RipReg = GetReg<RA_64>(Op->Header.Args[0].ID());
-    
+
+    // L1 is only valid once it has caught up with blocks erased by any thread
+    LoadConstant(x0, reinterpret_cast<uint64_t>(CTX->CodeCache->GetEraseCountPointer()));
+    ldr(x0, MemOperand(x0));
+    ldr(x1, MemOperand(STATE, offsetof(FEXCore::Core::InternalThreadState, Dispatcher.L1EraseCount)));
+    cmp(x0, x1);
+    b(&FullLookup, Condition::ne);
+
     // L1 Cache
-    LoadConstant(x0, State->LookupCache->GetL1Pointer());
+    ldr(x0, MemOperand(STATE, offsetof(FEXCore::Core::InternalThreadState, Dispatcher.L1Pointer)));
 
     and_(x3, RipReg, LookupCache::L1_ENTRIES_MASK);
     add(x0, x0, Operand(x3, Shift::LSL, 4));
@@ -89,8 +107,8 @@ DEF_OP(ExitFunction) {
     br(x1);
 
     bind(&FullLookup);
-    LoadConstant(TMP1, AbsoluteLoopTopAddress);
     str(RipReg, MemOperand(STATE, offsetof(FEXCore::Core::ThreadState, State.rip)));
+    ldr(TMP1, MemOperand(STATE, offsetof(FEXCore::Core::InternalThreadState, Dispatcher.LoopTop)));
     br(TMP1);
   }
 }
@@ -212,8 +230,13 @@ DEF_OP(Syscall) {
   mov(x1, STATE);
   mov(x2, sp);
 
+  Label Return;
+  HoldCodeForSyscall(&Return, x3);
+
   LoadConstant(x3, reinterpret_cast<uint64_t>(FEXCore::Context::HandleSyscall));
   blr(x3);
+  bind(&Return);
+  str(xzr, MemOperand(STATE, offsetof(FEXCore::Core::InternalThreadState, Dispatcher.HeldCode)));
 
   add(sp, sp, SPOffset);
   
@@ -226,6 +249,51 @@ DEF_OP(Syscall) {
   mov(GetReg<RA_64>(Node), x0);
 }
 
+DEF_OP(SyscallDirect) {
+  auto Op = IROp->C<IR::IROp_SyscallDirect>();
+  // Arguments are passed as follows:
+  // X0: ThreadState
+  // X1-X6: Syscall arguments
+
+  const std::array<aarch64::Register, 6> ArgRegs = { x1, x2, x3, x4, x5, x6 };
+
+  PushDynamicRegsAndLR();
+  SpillStaticRegs();
+
+  // Sources can live in the argument registers, go through the stack so nothing is overwritten early
+  uint64_t SPOffset = AlignUp(ArgRegs.size() * 8, 16);
+  sub(sp, sp, SPOffset);
+  for (uint32_t i = 0; i < ArgRegs.size(); ++i) {
+    if (Op->Header.Args[i].IsInvalid()) continue;
+    str(GetReg<RA_64>(Op->Header.Args[i].ID()), MemOperand(sp, i * 8));
+  }
+
+  for (uint32_t i = 0; i < ArgRegs.size(); ++i) {
+    if (Op->Header.Args[i].IsInvalid()) continue;
+    ldr(ArgRegs[i], MemOperand(sp, i * 8));
+  }
+
+  mov(x0, STATE);
+
+  Label Return;
+  HoldCodeForSyscall(&Return, x7);
+
+  LoadConstant(x7, Op->HostHandler);
+  blr(x7);
+  bind(&Return);
+  str(xzr, MemOperand(STATE, offsetof(FEXCore::Core::InternalThreadState, Dispatcher.HeldCode)));
+
+  add(sp, sp, SPOffset);
+
+  // Result is now in x0
+  // Fix the stack and any values that were stepped on
+  FillStaticRegs();
+  PopDynamicRegsAndLR();
+
+  // Move result to its destination register
+  mov(GetReg<RA_64>(Node), x0);
+}
+
 DEF_OP(Thunk) {
   auto Op = IROp->C<IR::IROp_Thunk>();
   // Arguments are passed as follows:
@@ -311,6 +379,26 @@ DEF_OP(RemoveCodeEntry) {
   PopDynamicRegsAndLR();
 }
 
+DEF_OP(PromoteCodeEntry) {
+  auto Op = IROp->C<IR::IROp_PromoteCodeEntry>();
+  // Arguments are passed as follows:
+  // X0: Thread
+  // X1: RIP
+
+  PushDynamicRegsAndLR();
+
+  mov(x0, STATE);
+  LoadConstant(x1, Op->RIP);
+
+  LoadConstant(x2, reinterpret_cast<uintptr_t>(&Context::Context::PromoteCodeEntry));
+  SpillStaticRegs();
+  blr(x2);
+  FillStaticRegs();
+
+  // Fix the stack and any values that were stepped on
+  PopDynamicRegsAndLR();
+}
+
 DEF_OP(CPUID) {
   auto Op = IROp->C<IR::IROp_CPUID>();
   
@@ -355,9 +443,11 @@ void JITCore::RegisterBranchHandlers() {
   REGISTER_OP(JUMP,              Jump);
   REGISTER_OP(CONDJUMP,          CondJump);
   REGISTER_OP(SYSCALL,           Syscall);
+  REGISTER_OP(SYSCALLDIRECT,     SyscallDirect);
   REGISTER_OP(THUNK,             Thunk);
   REGISTER_OP(VALIDATECODE,      ValidateCode);
   REGISTER_OP(REMOVECODEENTRY,   RemoveCodeEntry);
+  REGISTER_OP(PROMOTECODEENTRY,  PromoteCodeEntry);
   REGISTER_OP(CPUID,             CPUID);
 #undef REGISTER_OP
 }
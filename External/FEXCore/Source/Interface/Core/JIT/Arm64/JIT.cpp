@@ -1,6 +1,7 @@
 #include "Interface/Context/Context.h"
 
 #include "Interface/Core/ArchHelpers/Arm64.h"
+#include "Interface/Core/JIT/JITCore.h"
 #include "Interface/Core/JIT/Arm64/JITClass.h"
 #include "Interface/Core/InternalThreadState.h"
 
@@ -19,11 +20,6 @@
 
 namespace FEXCore::CPU {
 
-void JITCore::CopyNecessaryDataForCompileThread(CPUBackend *Original) {
-  JITCore *Core = reinterpret_cast<JITCore*>(Original);
-  ThreadSharedData = Core->ThreadSharedData;
-}
-
 static void SleepThread(FEXCore::Context::Context *ctx, FEXCore::Core::InternalThreadState *Thread) {
   --ctx->IdleWaitRefCount;
   ctx->IdleWaitCV.notify_all();
@@ -300,27 +296,14 @@ void JITCore::Op_NoOp(FEXCore::IR::IROp_Header *IROp, uint32_t Node) {
 }
 
 bool JITCore::IsAddressInJITCode(uint64_t Address, bool IncludeDispatcher) {
-  // Check the initial code buffer first
-  // It's the most likely place to end up
+  uint64_t CodeBase{};
+  uint64_t CodeEnd{};
 
-  uint64_t CodeBase = reinterpret_cast<uint64_t>(InitialCodeBuffer.Ptr);
-  uint64_t CodeEnd = CodeBase + InitialCodeBuffer.Size;
-  if (Address >= CodeBase &&
-      Address < CodeEnd) {
+  // Blocks from every thread live in the shared code cache
+  if (CTX->CodeCache->Contains(Address)) {
     return true;
   }
 
-  // Check the generated code buffers
-  // Not likely to have any but can happen with recursive signals
-  for (auto &CodeBuffer : CodeBuffers) {
-    CodeBase = reinterpret_cast<uint64_t>(CodeBuffer.Ptr);
-    CodeEnd = CodeBase + CodeBuffer.Size;
-    if (Address >= CodeBase &&
-        Address < CodeEnd) {
-      return true;
-    }
-  }
-
   if (IncludeDispatcher) {
     // Check the dispatcher. Unlikely to crash here but not impossible
     CodeBase = reinterpret_cast<uint64_t>(DispatcherCodeBuffer.Ptr);
@@ -433,12 +416,15 @@ bool JITCore::HandleSIGILL(int Signal, void *info, void *ucontext) {
   ucontext_t* _context = (ucontext_t*)ucontext;
   mcontext_t* _mcontext = &_context->uc_mcontext;
 
-  if (_mcontext->pc == ThreadSharedData.SignalReturnInstruction) {
+  if (_mcontext->pc == SignalReturnInstruction) {
     RestoreThreadState(ucontext);
 
     // Ref count our faults
     // We use this to track if it is safe to clear cache
     --SignalHandlerRefCounter;
+
+    // Retirements couldn't be acknowledged under the handler, go back through the safe point for them
+    State->LookupCache->RequestSync();
     return true;
   }
 
@@ -448,6 +434,9 @@ bool JITCore::HandleSIGILL(int Signal, void *info, void *ucontext) {
     // Ref count our faults
     // We use this to track if it is safe to clear cache
     --SignalHandlerRefCounter;
+
+    // Retirements couldn't be acknowledged under the handler, go back through the safe point for them
+    State->LookupCache->RequestSync();
     return true;
   }
 
@@ -768,14 +757,14 @@ bool JITCore::HandleSignalPause(int Signal, void *info, void *ucontext) {
   return false;
 }
 
-JITCore::JITCore(FEXCore::Context::Context *ctx, FEXCore::Core::InternalThreadState *Thread, CodeBuffer Buffer, bool CompileThread)
-  : vixl::aarch64::Assembler(Buffer.Ptr, Buffer.Size, vixl::aarch64::PositionDependentCode)
+JITCore::JITCore(FEXCore::Context::Context *ctx, FEXCore::Core::InternalThreadState *Thread, bool CompileThread)
+  : vixl::aarch64::Assembler(AllocateNewCodeBuffer(MAX_DISPATCHER_CODE_SIZE).Ptr, MAX_DISPATCHER_CODE_SIZE, vixl::aarch64::PositionDependentCode)
   , CTX {ctx}
   , State {Thread}
-  , InitialCodeBuffer {Buffer}
 {
-  CurrentCodeBuffer = &InitialCodeBuffer;
-  ThreadSharedData.SignalHandlerRefCounterPtr = &SignalHandlerRefCounter;
+  // Starts out pointing at the dispatcher's buffer, each block gets pointed at a chunk of the shared code cache
+  DispatcherCodeBuffer = CodeBuffer{GetBuffer()->GetStartAddress<uint8_t*>(), MAX_DISPATCHER_CODE_SIZE};
+  IsCompileThread = CompileThread;
 
   auto Features = vixl::CPUFeatures::InferFromOS();
   SupportsAtomics = Features.Has(vixl::CPUFeatures::Feature::kAtomics);
@@ -863,59 +852,8 @@ JITCore::JITCore(FEXCore::Context::Context *ctx, FEXCore::Core::InternalThreadSt
   }
 }
 
-void JITCore::ClearCache() {
-  // Get the backing code buffer
-  auto Buffer = GetBuffer();
-  if (*ThreadSharedData.SignalHandlerRefCounterPtr == 0) {
-    if (!CodeBuffers.empty()) {
-      // If we have more than one code buffer we are tracking then walk them and delete
-      // This is a cleanup step
-      for (auto CodeBuffer : CodeBuffers) {
-        FreeCodeBuffer(CodeBuffer);
-      }
-      CodeBuffers.clear();
-
-      // Set the current code buffer to the initial
-      *Buffer = vixl::CodeBuffer(InitialCodeBuffer.Ptr, InitialCodeBuffer.Size);
-      CurrentCodeBuffer = &InitialCodeBuffer;
-    }
-
-    if (CurrentCodeBuffer->Size == MAX_CODE_SIZE) {
-      // Rewind to the start of the code cache start
-      Buffer->Reset();
-    }
-    else {
-      FreeCodeBuffer(InitialCodeBuffer);
-
-      // Resize the code buffer and reallocate our code size
-      InitialCodeBuffer.Size *= 1.5;
-      InitialCodeBuffer.Size = std::min(InitialCodeBuffer.Size, MAX_CODE_SIZE);
-
-      InitialCodeBuffer = JITCore::AllocateNewCodeBuffer(InitialCodeBuffer.Size);
-      *Buffer = vixl::CodeBuffer(InitialCodeBuffer.Ptr, InitialCodeBuffer.Size);
-    }
-  }
-  else {
-    // We have signal handlers that have generated code
-    // This means that we can not safely clear the code at this point in time
-    // Allocate some new code buffers that we can switch over to instead
-    auto NewCodeBuffer = JITCore::AllocateNewCodeBuffer(JITCore::INITIAL_CODE_SIZE);
-    EmplaceNewCodeBuffer(NewCodeBuffer);
-    *Buffer = vixl::CodeBuffer(NewCodeBuffer.Ptr, NewCodeBuffer.Size);
-  }
-}
-
 JITCore::~JITCore() {
-  for (auto CodeBuffer : CodeBuffers) {
-    FreeCodeBuffer(CodeBuffer);
-  }
-  CodeBuffers.clear();
-
-  if (DispatcherCodeBuffer.Ptr) {
-    // Dispatcher may not exist if this is a compile thread
-    FreeCodeBuffer(DispatcherCodeBuffer);
-  }
-  FreeCodeBuffer(InitialCodeBuffer);
+  FreeCodeBuffer(DispatcherCodeBuffer);
 }
 
 void JITCore::LoadConstant(vixl::aarch64::Register Reg, uint64_t Constant) {
@@ -1041,19 +979,19 @@ void *JITCore::CompileCode([[maybe_unused]] FEXCore::IR::IRListView<true> const
   this->RAData = RAData;
 
   auto HeaderOp = IR->GetHeader();
-  
+
+  // Fairly excessive buffer range to make sure we don't overflow
+  uint32_t BufferRange = SSACount * 16;
+  // Compiles from the dispatcher and compile threads have no guest code on the stack
+  auto Chunk = State->LookupCache->ReserveCode(BufferRange, SignalHandlerRefCounter == 0);
+  *GetBuffer() = vixl::CodeBuffer(Chunk.Ptr, Chunk.Size);
+
   #ifndef NDEBUG
   LoadConstant(x0, HeaderOp->Entry);
   #endif
 
   this->IR = IR;
 
-  // Fairly excessive buffer range to make sure we don't overflow
-  uint32_t BufferRange = SSACount * 16;
-  if ((GetCursorOffset() + BufferRange) > CurrentCodeBuffer->Size) {
-    State->CTX->ClearCodeCache(State, false);
-  }
-
   // AAPCS64
   // r30      = LR
   // r29      = FP
@@ -1078,7 +1016,7 @@ void *JITCore::CompileCode([[maybe_unused]] FEXCore::IR::IRListView<true> const
   auto Entry = Buffer->GetOffsetAddress<uint64_t>(GetCursorOffset());
 
  if (CTX->GetGdbServerStatus()) {
-    aarch64::Label RunBlock;
+    Label RunBlock;
 
     // If we have a gdb server running then run in a less efficient mode that checks if we need to exit
     // This happens when single stepping
@@ -1095,7 +1033,8 @@ void *JITCore::CompileCode([[maybe_unused]] FEXCore::IR::IRListView<true> const
       str(x0, MemOperand(STATE, offsetof(FEXCore::Core::ThreadState, State.rip)));
 
       // Stop the thread
-      LoadConstant(x0, ThreadPauseHandlerAddressSpillSRA);
+      // Blocks are shared between threads, so go through the handler of the thread running it
+      ldr(x0, MemOperand(STATE, offsetof(FEXCore::Core::InternalThreadState, Dispatcher.ThreadPauseHandler)));
       br(x0);
     }
     bind(&RunBlock);
@@ -1166,6 +1105,7 @@ void *JITCore::CompileCode([[maybe_unused]] FEXCore::IR::IRListView<true> const
 
   auto CodeEnd = Buffer->GetOffsetAddress<uint64_t>(GetCursorOffset());
   CPU.EnsureIAndDCacheCoherency(reinterpret_cast<void*>(Entry), CodeEnd - reinterpret_cast<uint64_t>(Entry));
+  State->LookupCache->CommitCode(GetCursorOffset());
 
   if (DebugData) {
     DebugData->HostCodeSize = reinterpret_cast<uintptr_t>(CodeEnd) - reinterpret_cast<uintptr_t>(Entry);
@@ -1259,8 +1199,11 @@ void JITCore::PopCalleeSavedRegisters() {
 
 uint64_t JITCore::ExitFunctionLink(JITCore *core, FEXCore::Core::InternalThreadState *Thread, uint64_t *record) {
   auto GuestRip = record[1];
+  auto LookupCache = Thread->LookupCache.get();
 
-  auto HostCode = Thread->LookupCache->FindBlock(GuestRip);
+  // Don't link to anything that has been erased
+  LookupCache->Sync();
+  auto HostCode = LookupCache->FindBlock(GuestRip);
 
   if (!HostCode) {
     //printf("ExitFunctionLink: Aborting, %lX not in cache\n", GuestRip);
@@ -1268,21 +1211,29 @@ uint64_t JITCore::ExitFunctionLink(JITCore *core, FEXCore::Core::InternalThreadS
     return core->AbsoluteLoopTopAddress;
   }
 
-  uintptr_t branch = (uintptr_t)(record) - 8;
-  auto LinkerAddress = core->ExitFunctionLinkerAddress;
-
-  auto offset = HostCode/4 - branch/4;
-  if (IsInt26(offset)) {
-    // optimal case - can branch directly
-    // patch the code
-    vixl::aarch64::Assembler emit((uint8_t*)(branch), 24);
-    vixl::CodeBufferCheckScope scope(&emit, 24, vixl::CodeBufferCheckScope::kDontReserveBufferSpace, vixl::CodeBufferCheckScope::kNoAssert);
-    emit.b(offset);
-    emit.FinalizeCode();
-    vixl::aarch64::CPU::EnsureIAndDCacheCoherency((void*)branch, 24);
-    
-    // Add de-linking handler
-    Thread->LookupCache->AddBlockLink(GuestRip, (uintptr_t)record, [branch, LinkerAddress]{
+  // The record is followed by a stub that jumps to this thread's linker, unlinking sends the exit back there
+  // This fails if either block was erased in the meantime, the exit then keeps coming through here
+  LookupCache->AddBlockLink(GuestRip, HostCode, (uintptr_t)record, (uintptr_t)&record[2],
+    [](uintptr_t HostLink, uintptr_t HostCode) {
+      uintptr_t branch = HostLink - 8;
+      auto offset = HostCode/4 - branch/4;
+      if (IsInt26(offset)) {
+        // optimal case - can branch directly
+        // patch the code
+        vixl::aarch64::Assembler emit((uint8_t*)(branch), 24);
+        vixl::CodeBufferCheckScope scope(&emit, 24, vixl::CodeBufferCheckScope::kDontReserveBufferSpace, vixl::CodeBufferCheckScope::kNoAssert);
+        emit.b(offset);
+        emit.FinalizeCode();
+        vixl::aarch64::CPU::EnsureIAndDCacheCoherency((void*)branch, 24);
+      }
+      else {
+        // fallback case - do a soft-er link by patching the pointer
+        reinterpret_cast<uint64_t*>(HostLink)[0] = HostCode;
+      }
+    },
+    [](uintptr_t HostLink, uintptr_t LinkerAddress) {
+      // undo the link, this puts back the exit exactly as it was emitted
+      uintptr_t branch = HostLink - 8;
       vixl::aarch64::Assembler emit((uint8_t*)(branch), 24);
       vixl::CodeBufferCheckScope scope(&emit, 24, vixl::CodeBufferCheckScope::kDontReserveBufferSpace, vixl::CodeBufferCheckScope::kNoAssert);
       Literal l_BranchHost{LinkerAddress};
@@ -1292,26 +1243,23 @@ uint64_t JITCore::ExitFunctionLink(JITCore *core, FEXCore::Core::InternalThreadS
       emit.FinalizeCode();
       vixl::aarch64::CPU::EnsureIAndDCacheCoherency((void*)branch, 24);
     });
-  } else {
-    // fallback case - do a soft-er link by patching the pointer
-    record[0] = HostCode;
 
-    // Add de-linking handler
-    Thread->LookupCache->AddBlockLink(GuestRip, (uintptr_t)record, [record, LinkerAddress]{
-      record[0] = LinkerAddress;
-    });
+  if (LookupCache->NeedsSync()) {
+    // Retired code is waiting on this thread, the loop top acknowledges it before running anything
+    Thread->State.State.rip = GuestRip;
+    return core->AbsoluteLoopTopAddress;
   }
 
-  
-  
   return HostCode;
 }
 
-void JITCore::CreateCustomDispatch(FEXCore::Core::InternalThreadState *Thread) {
-  auto OriginalBuffer = *GetBuffer();
+void JITCore::SyncLookupCache(JITCore *core, FEXCore::Core::InternalThreadState *Thread) {
+  // Anything under a signal frame can still return in to retired code
+  Thread->LookupCache->SafePoint(core->SignalHandlerRefCounter == 0);
+}
 
+void JITCore::CreateCustomDispatch(FEXCore::Core::InternalThreadState *Thread) {
   // Dispatcher lives outside of traditional space-time
-  DispatcherCodeBuffer = JITCore::AllocateNewCodeBuffer(MAX_DISPATCHER_CODE_SIZE);
   *GetBuffer() = vixl::CodeBuffer(DispatcherCodeBuffer.Ptr, DispatcherCodeBuffer.Size);
 
   auto Buffer = GetBuffer();
@@ -1337,9 +1285,8 @@ void JITCore::CreateCustomDispatch(FEXCore::Core::InternalThreadState *Thread) {
   // }
 
 
-  uint64_t VirtualMemorySize = Thread->LookupCache->GetVirtualMemorySize();
-  Literal l_VirtualMemory {VirtualMemorySize};
-  Literal l_PagePtr {Thread->LookupCache->GetPagePointer()};
+  Literal l_RootPtr {Thread->LookupCache->GetRootPointer()};
+  Literal l_HostCodeBase {Thread->LookupCache->GetHostCodeBase()};
   Literal l_CTX {reinterpret_cast<uintptr_t>(CTX)};
   Literal l_Sleep {reinterpret_cast<uint64_t>(SleepThread)};
 
@@ -1358,6 +1305,8 @@ void JITCore::CreateCustomDispatch(FEXCore::Core::InternalThreadState *Thread) {
 
   Literal l_CompileBlock {CompileBlockPtr};
   Literal l_ExitFunctionLink {(uintptr_t)&ExitFunctionLink};
+  Literal l_SyncLookupCache {(uintptr_t)&SyncLookupCache};
+  Literal l_EraseCountPtr {reinterpret_cast<uintptr_t>(CTX->CodeCache->GetEraseCountPointer())};
 
   // Push all the register we need to save
   PushCalleeSavedRegisters();
@@ -1386,13 +1335,23 @@ void JITCore::CreateCustomDispatch(FEXCore::Core::InternalThreadState *Thread) {
 
   // We want to ensure that we are 16 byte aligned at the top of this loop
   Align16B();
-  aarch64::Label FullLookup{};
-  aarch64::Label LoopTop{};
-  aarch64::Label ExitSpillSRA{};
+  Label FullLookup{};
+  Label LoopTop{};
+  Label Lookup{};
+  Label SyncCache{};
+  Label ExitSpillSRA{};
 
   bind(&LoopTop);
   AbsoluteLoopTopAddress = GetLabelAddress<uint64_t>(&LoopTop);
 
+  // L1 can't be trusted until it has caught up with blocks erased by any thread
+  ldr(x0, &l_EraseCountPtr);
+  ldr(x0, MemOperand(x0));
+  ldr(x1, MemOperand(STATE, offsetof(FEXCore::Core::InternalThreadState, Dispatcher.L1EraseCount)));
+  cmp(x0, x1);
+  b(&SyncCache, Condition::ne);
+
+  bind(&Lookup);
   // Load in our RIP
   // Don't modify x2 since it contains our RIP once the block doesn't exist
   ldr(x2, MemOperand(STATE, offsetof(FEXCore::Core::ThreadState, State.rip)));
@@ -1412,45 +1371,44 @@ void JITCore::CreateCustomDispatch(FEXCore::Core::InternalThreadState *Thread) {
   bind(&FullLookup);
 
   // This is the block cache lookup routine
-  // It matches what is going on it LookupCache.h::FindBlock
-  ldr(x0, &l_PagePtr);
+  // It matches what is going on it CodeCache.cpp::WalkL2
+  ldr(x0, &l_RootPtr);
 
-  // Mask the address by the virtual address size so we can check for aliases
-  if (__builtin_popcountl(VirtualMemorySize) == 1) {
-    and_(x3, RipReg, Thread->LookupCache->GetVirtualMemorySize() - 1);
-  }
-  else {
-    ldr(x3, &l_VirtualMemory);
-    and_(x3, RipReg, x3);
-  }
-
-  aarch64::Label NoBlock;
+  Label NoBlock;
   {
-    // Offset the address and add to our page pointer
-    lsr(x1, x3, 12);
+    // Walk the radix tree, addresses outside of the guest address space never have an entry
+    lsr(x1, RipReg, CodeCache::ROOT_SHIFT);
+    cmp(x1, CodeCache::ROOT_ENTRIES);
+    b(&NoBlock, Condition::hs);
 
-    // Load the pointer from the offset
+    // Load the directory pointer
     ldr(x0, MemOperand(x0, x1, Shift::LSL, 3));
+    cbz(x0, &NoBlock);
 
-    // If page pointer is zero then we have no block
+    // Load the table pointer
+    ubfx(x1, RipReg, CodeCache::DIRECTORY_SHIFT, CodeCache::TABLE_BITS);
+    ldr(x0, MemOperand(x0, x1, Shift::LSL, 3));
     cbz(x0, &NoBlock);
 
-    // Steal the page offset
-    and_(x1, x3, 0x0FFF);
+    // Load the page pointer
+    ubfx(x1, RipReg, CodeCache::TABLE_SHIFT, CodeCache::TABLE_BITS);
+    ldr(x0, MemOperand(x0, x1, Shift::LSL, 3));
 
-    // Shift the offset by the size of the block cache entry
-    add(x0, x0, Operand(x1, Shift::LSL, (int)log2(sizeof(FEXCore::LookupCache::LookupCacheEntry))));
+    // If page pointer is zero then we have no block
+    cbz(x0, &NoBlock);
 
-    // Load the guest address first to ensure it maps to the address we are currently at
-    // This fixes aliasing problems
-    ldr(x1, MemOperand(x0, offsetof(FEXCore::LookupCache::LookupCacheEntry, GuestCode)));
-    cmp(x1, RipReg);
-    b(&NoBlock, Condition::ne);
+    // Steal the page offset
+    and_(x1, RipReg, CodeCache::PAGE_MASK);
 
-    // Now load the actual host block to execute if we can
-    ldr(x3, MemOperand(x0, offsetof(FEXCore::LookupCache::LookupCacheEntry, HostCode)));
+    // Load the offset of the block from the host code base
+    static_assert(sizeof(FEXCore::CodeCache::L2Entry) == 4, "This is expected to be size of 4");
+    ldrsw(x3, MemOperand(x0, x1, Shift::LSL, 2));
     cbz(x3, &NoBlock);
 
+    // Turn it back in to the host block to execute
+    ldr(x0, &l_HostCodeBase);
+    add(x3, x3, x0);
+
     // If we've made it here then we have a real compiled block
     {
       // update L1 cache
@@ -1511,10 +1469,26 @@ void JITCore::CreateCustomDispatch(FEXCore::Core::InternalThreadState *Thread) {
     b(&LoopTop);
   }
 
+  {
+    // Other threads erased blocks, or retired code is waiting on this thread
+    bind(&SyncCache);
+    SpillStaticRegs();
+
+    LoadConstant(x0, (uintptr_t)this);
+    mov(x1, STATE);
+    ldr(x2, &l_SyncLookupCache);
+    blr(x2);
+
+    FillStaticRegs();
+
+    // Skip the check, the count stays behind while an acknowledgement is pending and this can't always give it
+    b(&Lookup);
+  }
+
   {
     Label RestoreContextStateHelperLabel{};
     bind(&RestoreContextStateHelperLabel);
-    ThreadSharedData.SignalReturnInstruction = Buffer->GetOffsetAddress<uint64_t>(GetCursorOffset());
+    SignalReturnInstruction = Buffer->GetOffsetAddress<uint64_t>(GetCursorOffset());
 
     // Now to get back to our old location we need to do a fault dance
     // We can't use SIGTRAP here since gdb catches it and never gives it to the application!
@@ -1592,12 +1566,14 @@ void JITCore::CreateCustomDispatch(FEXCore::Core::InternalThreadState *Thread) {
     b(&LoopTop);
   }
 
-  place(&l_VirtualMemory);
-  place(&l_PagePtr);
+  place(&l_RootPtr);
+  place(&l_HostCodeBase);
   place(&l_CTX);
   place(&l_Sleep);
   place(&l_CompileBlock);
   place(&l_ExitFunctionLink);
+  place(&l_SyncLookupCache);
+  place(&l_EraseCountPtr);
 
   FinalizeCode();
   uint64_t CodeEnd = Buffer->GetOffsetAddress<uint64_t>(GetCursorOffset());
@@ -1608,7 +1584,14 @@ void JITCore::CreateCustomDispatch(FEXCore::Core::InternalThreadState *Thread) {
   CTX->Symbols.Register(reinterpret_cast<void*>(DispatchPtr), CodeEnd - reinterpret_cast<uint64_t>(DispatchPtr), Name);
 #endif
 
-  *GetBuffer() = OriginalBuffer;
+  // Blocks reach everything thread specific through the state, so any thread can run them
+  // Blocks enter these with the static registers live
+  Thread->Dispatcher.LoopTop = AbsoluteLoopTopAddress;
+  Thread->Dispatcher.ExitFunctionLinker = ExitFunctionLinkerAddress;
+  Thread->Dispatcher.ThreadStopHandler = ThreadStopHandlerAddressSpillSRA;
+  Thread->Dispatcher.ThreadPauseHandler = ThreadPauseHandlerAddressSpillSRA;
+  Thread->Dispatcher.SignalHandlerReturn = SignalReturnInstruction;
+  Thread->Dispatcher.SignalHandlerRefCounter = &SignalHandlerRefCounter;
 }
 
 void JITCore::SpillStaticRegs() {
@@ -1631,6 +1614,17 @@ void JITCore::FillStaticRegs() {
   }
 }
 
+void JITCore::HoldCodeForSyscall(Label *Return, Register Tmp) {
+  // Under a signal handler or callback there is more guest code further up the stack
+  Label Nested;
+  ldr(Tmp, MemOperand(STATE, offsetof(FEXCore::Core::InternalThreadState, Dispatcher.SignalHandlerRefCounter)));
+  ldr(Tmp.W(), MemOperand(Tmp));
+  cbnz(Tmp.W(), &Nested);
+  adr(Tmp, Return);
+  str(Tmp, MemOperand(STATE, offsetof(FEXCore::Core::InternalThreadState, Dispatcher.HeldCode)));
+  bind(&Nested);
+}
+
 void JITCore::PushDynamicRegsAndLR() {
   uint64_t SPOffset = AlignUp((RA64.size() + 1) * 8 + RAFPR.size() * 16, 16);
 
@@ -1691,6 +1685,14 @@ void JITCore::ResetStack() {
 }
 
 FEXCore::CPU::CPUBackend *CreateJITCore(FEXCore::Context::Context *ctx, FEXCore::Core::InternalThreadState *Thread, bool CompileThread) {
-  return new JITCore(ctx, Thread, JITCore::AllocateNewCodeBuffer(JITCore::INITIAL_CODE_SIZE), CompileThread);
+  return new JITCore(ctx, Thread, CompileThread);
+}
+
+FEXCore::CodeCache *CreateJITCodeCache() {
+  return new FEXCore::CodeCache(JITCore::INITIAL_CODE_SIZE, JITCore::MAX_CODE_SIZE, JITCore::MAX_CODE_GENERATIONS, true);
+}
+
+JITStaticRegisters GetJITStaticRegisters(FEXCore::Context::Context *CTX) {
+  return {static_cast<uint32_t>(SRA64.size()), static_cast<uint32_t>(SRAFPR.size())};
 }
 }
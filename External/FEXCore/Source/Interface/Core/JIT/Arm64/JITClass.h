@@ -1,6 +1,7 @@
 #pragma once
 
 #include "Interface/Core/LookupCache.h"
+#include "Interface/Core/CodeCache.h"
 
 #include "aarch64/assembler-aarch64.h"
 #include "aarch64/cpu-aarch64.h"
@@ -11,6 +12,8 @@
 #include <FEXCore/IR/IR.h>
 #include <FEXCore/IR/IntrusiveIRList.h>
 
+#include <memory>
+
 #define STATE x28
 #define TMP1 x0
 #define TMP2 x1
@@ -74,7 +77,7 @@ public:
     size_t Size;
   };
 
-  explicit JITCore(FEXCore::Context::Context *ctx, FEXCore::Core::InternalThreadState *Thread, CodeBuffer Buffer, bool CompileThread);
+  explicit JITCore(FEXCore::Context::Context *ctx, FEXCore::Core::InternalThreadState *Thread, bool CompileThread);
 
   ~JITCore() override;
   std::string GetName() override { return "JIT"; }
@@ -84,25 +87,25 @@ public:
 
   bool NeedsOpDispatch() override { return true; }
 
-  void ClearCache() override;
-
   bool HandleSIGILL(int Signal, void *info, void *ucontext);
   bool HandleSIGBUS(int Signal, void *info, void *ucontext);
   bool HandleSignalPause(int Signal, void *info, void *ucontext);
   bool HandleGuestSignal(int Signal, void *info, void *ucontext, GuestSigAction *GuestAction, stack_t *GuestStack);
 
   static constexpr size_t INITIAL_CODE_SIZE = 1024 * 1024 * 16;
+  // We don't want to mvoe above 128MB atm because that means we will have to encode longer jumps
+  static constexpr size_t MAX_CODE_SIZE = 1024 * 1024 * 128;
+  // Number of generations the shared code cache fills before it starts retiring the oldest one
+  static constexpr size_t MAX_CODE_GENERATIONS = 4;
   static CodeBuffer AllocateNewCodeBuffer(size_t Size);
 
-  void CopyNecessaryDataForCompileThread(CPUBackend *Original) override;
-
 private:
   Label *PendingTargetLabel;
   FEXCore::Context::Context *CTX;
   FEXCore::Core::InternalThreadState *State;
   FEXCore::IR::IRListView<true> const *IR;
 
-  std::map<IR::OrderedNodeWrapper::NodeOffsetType, aarch64::Label> JumpTargets;
+  std::map<IR::OrderedNodeWrapper::NodeOffsetType, Label> JumpTargets;
 
   /**
    * @name Register Allocation
@@ -165,28 +168,12 @@ private:
   bool SupportsAtomics{};
   bool SupportsRCPC{};
 
-  void EmplaceNewCodeBuffer(CodeBuffer Buffer) {
-    CurrentCodeBuffer = &CodeBuffers.emplace_back(Buffer);
-  }
-
   void FreeCodeBuffer(CodeBuffer Buffer);
 
-  // This is the initial code buffer that we will fall back to
-  // In a program without signals and code clearing, we will typically
-  // only have this code buffer
-  CodeBuffer InitialCodeBuffer{};
-  // This is the array of /additional/ code buffers that we may need to allocate
-  // Allocation only occurs when we've hit signals and need to clear code cache
-  // For code safety we can't delete code buffers until outside of all signals
-  std::vector<CodeBuffer> CodeBuffers{};
-
   // This is the codebuffer that our dispatcher lives in
+  // Blocks are emitted in to chunks of the Context's CodeCache
   CodeBuffer DispatcherCodeBuffer{};
-  // This is the current code buffer that we are tracking
-  CodeBuffer *CurrentCodeBuffer{};
 
-  // We don't want to mvoe above 128MB atm because that means we will have to encode longer jumps
-  static constexpr size_t MAX_CODE_SIZE = 1024 * 1024 * 128;
   static constexpr size_t MAX_DISPATCHER_CODE_SIZE = 4096 * 2;
 
   bool IsAddressInJITCode(uint64_t Address, bool IncludeDispatcher = true);
@@ -202,6 +189,8 @@ private:
   void PopCalleeSavedRegisters();
 
   static uint64_t ExitFunctionLink(JITCore *core, FEXCore::Core::InternalThreadState *Thread, uint64_t *record);
+  // Catches L1 up with the shared erase log, acknowledging retired code when no signal frames are live
+  static void SyncLookupCache(JITCore *core, FEXCore::Core::InternalThreadState *Thread);
 
   /**
    * @name Dispatch Helper functions
@@ -215,20 +204,15 @@ private:
   uint64_t ThreadStopHandlerAddressSpillSRA{};
   uint64_t ThreadStopHandlerAddress{};
   uint64_t PauseReturnInstruction{};
+  uint64_t SignalReturnInstruction{};
 
   uint32_t SignalHandlerRefCounter{};
+  bool IsCompileThread{};
 
   void StoreThreadState(int Signal, void *ucontext);
   void RestoreThreadState(void *ucontext);
   /**  @} */
 
-  struct CompilerSharedData {
-    uint64_t SignalReturnInstruction{};
-
-    uint32_t *SignalHandlerRefCounterPtr{};
-  };
-
-  CompilerSharedData ThreadSharedData;
   IR::RegisterAllocationPass *RAPass;
   IR::RegisterAllocationData *RAData;
 
@@ -240,6 +224,9 @@ private:
   void PushDynamicRegsAndLR();
   void PopDynamicRegsAndLR();
 
+  // Publishes Return as the only code the thread needs while it is in a syscall, see LookupCache::SetHeldCode
+  void HoldCodeForSyscall(Label *Return, Register Tmp);
+
   void ResetStack();
 
   using OpHandler = void (JITCore::*)(FEXCore::IR::IROp_Header *IROp, uint32_t Node);
@@ -335,9 +322,11 @@ private:
   DEF_OP(Jump);
   DEF_OP(CondJump);
   DEF_OP(Syscall);
+  DEF_OP(SyscallDirect);
   DEF_OP(Thunk);
   DEF_OP(ValidateCode);
   DEF_OP(RemoveCodeEntry);
+  DEF_OP(PromoteCodeEntry);
   DEF_OP(CPUID);
 
   ///< Conversion ops
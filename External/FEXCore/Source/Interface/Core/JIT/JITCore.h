@@ -1,5 +1,7 @@
 #pragma once
 
+#include <stdint.h>
+
 namespace FEXCore::Context {
 struct Context;
 }
@@ -8,8 +10,30 @@ namespace FEXCore::Core {
 struct InternalThreadState;
 }
 
+namespace FEXCore {
+class CodeCache;
+}
+
 namespace FEXCore::CPU {
 class CPUBackend;
 
 FEXCore::CPU::CPUBackend *CreateJITCore(FEXCore::Context::Context *ctx, FEXCore::Core::InternalThreadState *Thread, bool CompileThread);
+
+/**
+ * @brief Creates the code cache every thread's JIT emits in to
+ */
+FEXCore::CodeCache *CreateJITCodeCache();
+
+/**
+ * @brief Guest registers the JIT keeps in host registers
+ *
+ * Guest GPRs [0, GPRs) and XMMs [0, FPRs) are statically allocated, everything else goes through the context
+ * The x86-64 JIT only maps them with the StaticRegisterAllocation option
+ */
+struct JITStaticRegisters {
+  uint32_t GPRs;
+  uint32_t FPRs;
+};
+
+JITStaticRegisters GetJITStaticRegisters(FEXCore::Context::Context *CTX);
 }
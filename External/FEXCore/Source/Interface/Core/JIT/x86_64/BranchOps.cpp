@@ -24,8 +24,8 @@ DEF_OP(SignalReturn) {
     add(rsp, SpillSlots * 16); // + 8 to consume return address
   }
 
-  mov(TMP1, ThreadSharedData.SignalHandlerReturnAddress);
-  jmp(TMP1);
+  // Blocks can be shared between threads, anything thread specific comes from the state
+  jmp(qword [STATE + offsetof(FEXCore::Core::InternalThreadState, Dispatcher.SignalHandlerReturn)]);
 }
 
 DEF_OP(CallbackReturn) {
@@ -35,12 +35,15 @@ DEF_OP(CallbackReturn) {
   }
 
   // Make sure to adjust the refcounter so we don't clear the cache now
-  mov(rax, reinterpret_cast<uint64_t>(ThreadSharedData.SignalHandlerRefCounterPtr));
+  mov(rax, qword [STATE + offsetof(FEXCore::Core::InternalThreadState, Dispatcher.SignalHandlerRefCounter)]);
   sub(dword [rax], 1);
 
   // We need to adjust an additional 8 bytes to get back to the original "misaligned" RSP state
   add(qword [STATE + offsetof(FEXCore::Core::InternalThreadState, State.State.gregs[X86State::REG_RSP])], 8);
 
+  // The thunk fills the static registers from the context once we are back
+  SpillStaticRegs();
+
   // Now jump back to the thunk
   // XXX: XMM?
   add(rsp, 8);
@@ -73,15 +76,23 @@ DEF_OP(ExitFunction) {
     lea(rax, ptr[rip + l_BranchHost]);
     jmp(qword[rax]);
 
+    // Until this is linked it goes to the stub after it, which enters the running thread's linker
     L(l_BranchHost);
-    dq(ExitFunctionLinkerAddress);
+    dq(getCurr<uint64_t>() + 16);
     L(l_BranchGuest);
     dq(NewRIP);
+    jmp(qword [STATE + offsetof(FEXCore::Core::InternalThreadState, Dispatcher.ExitFunctionLinker)]);
   } else {
     Xbyak::Reg RipReg = GetSrc<RA_64>(Op->NewRIP.ID());
-    
+
+    // L1 is only valid once it has caught up with blocks erased by any thread
+    mov(rcx, reinterpret_cast<uint64_t>(CTX->CodeCache->GetEraseCountPointer()));
+    mov(rcx, qword [rcx]);
+    cmp(rcx, qword [STATE + offsetof(FEXCore::Core::InternalThreadState, Dispatcher.L1EraseCount)]);
+    jne(FullLookup);
+
     // L1 Cache
-    mov(rcx, ThreadState->LookupCache->GetL1Pointer());
+    mov(rcx, qword [STATE + offsetof(FEXCore::Core::InternalThreadState, Dispatcher.L1Pointer)]);
     mov(rax, RipReg);
 
     and_(rax, LookupCache::L1_ENTRIES_MASK);
@@ -94,9 +105,8 @@ DEF_OP(ExitFunction) {
     jmp(qword[LookupBase + 0]);
 
     L(FullLookup);
-    mov(rax, AbsoluteLoopTopAddress);
     mov(qword [STATE + offsetof(FEXCore::Core::InternalThreadState, State.State.rip)], RipReg);
-    jmp(rax);
+    jmp(qword [STATE + offsetof(FEXCore::Core::InternalThreadState, Dispatcher.LoopTop)]);
   }
 
 #ifdef BLOCKSTATS
@@ -170,6 +180,10 @@ DEF_OP(Syscall) {
   // XXX: This is very terrible, but I don't care for right now
 
   auto NumPush = RA64.size();
+  Label Return;
+
+  SpillStaticRegs();
+  HoldCodeForSyscall(Return);
 
   for (auto &Reg : RA64)
     push(Reg);
@@ -198,6 +212,8 @@ DEF_OP(Syscall) {
     sub(rsp, 8); // Align
   // {rdi, rsi, rdx}
   call(rax);
+  L(Return);
+  mov(qword [STATE + offsetof(FEXCore::Core::InternalThreadState, Dispatcher.HeldCode)], 0);
 
   if (NumPush & 1)
     add(rsp, 8); // Align
@@ -211,6 +227,63 @@ DEF_OP(Syscall) {
   for (uint32_t i = RA64.size(); i > 0; --i)
     pop(RA64[i - 1]);
 
+  FillStaticRegs();
+
+  mov (GetDst<RA_64>(Node), rax);
+}
+
+DEF_OP(SyscallDirect) {
+  auto Op = IROp->C<IR::IROp_SyscallDirect>();
+
+  // Handler ABI for x86-64
+  // Thread: rdi
+  // Arguments: rsi, rdx, rcx, r8, r9, Stack
+  //
+  // Result: RAX
+  const std::array<Xbyak::Reg, 5> ArgRegs = { rsi, rdx, rcx, r8, r9 };
+  // Sixth argument goes on the stack
+  const uint32_t NumArgs = ArgRegs.size() + 1;
+  bool HasStackArg = !Op->Header.Args[NumArgs - 1].IsInvalid();
+  bool NeedsAlign = (RA64.size() + HasStackArg) & 1;
+  Label Return;
+
+  SpillStaticRegs();
+  HoldCodeForSyscall(Return);
+
+  for (auto &Reg : RA64)
+    push(Reg);
+
+  // The padding has to sit above the stack argument
+  if (NeedsAlign)
+    sub(rsp, 8); // Align
+
+  // Sources can live in the argument registers, go through the stack so nothing is overwritten early
+  // These are pushed in reverse order because stacks
+  for (uint32_t i = NumArgs; i > 0; --i) {
+    if (Op->Header.Args[i - 1].IsInvalid()) continue;
+    push(GetSrc<RA_64>(Op->Header.Args[i - 1].ID()));
+  }
+
+  // Only the stack argument is left after this
+  for (uint32_t i = 0; i < ArgRegs.size(); ++i) {
+    if (Op->Header.Args[i].IsInvalid()) continue;
+    pop(ArgRegs[i]);
+  }
+
+  mov(rdi, STATE);
+  mov(rax, Op->HostHandler);
+  call(rax);
+  L(Return);
+  mov(qword [STATE + offsetof(FEXCore::Core::InternalThreadState, Dispatcher.HeldCode)], 0);
+
+  if (HasStackArg || NeedsAlign)
+    add(rsp, (HasStackArg + NeedsAlign) * 8);
+
+  for (uint32_t i = RA64.size(); i > 0; --i)
+    pop(RA64[i - 1]);
+
+  FillStaticRegs();
+
   mov (GetDst<RA_64>(Node), rax);
 }
 
@@ -219,6 +292,8 @@ DEF_OP(Thunk) {
 
   auto NumPush = RA64.size();
 
+  SpillStaticRegs();
+
   for (auto &Reg : RA64)
     push(Reg);
 
@@ -235,6 +310,8 @@ DEF_OP(Thunk) {
 
   for (uint32_t i = RA64.size(); i > 0; --i)
     pop(RA64[i - 1]);
+
+  FillStaticRegs();
 }
 
 DEF_OP(ValidateCode) {
@@ -272,6 +349,8 @@ DEF_OP(RemoveCodeEntry) {
 
   auto NumPush = RA64.size();
 
+  SpillStaticRegs();
+
   for (auto &Reg : RA64)
     push(Reg);
 
@@ -291,6 +370,37 @@ DEF_OP(RemoveCodeEntry) {
 
   for (uint32_t i = RA64.size(); i > 0; --i)
     pop(RA64[i - 1]);
+
+  FillStaticRegs();
+}
+
+DEF_OP(PromoteCodeEntry) {
+  auto Op = IROp->C<IR::IROp_PromoteCodeEntry>();
+
+  auto NumPush = RA64.size();
+
+  SpillStaticRegs();
+
+  for (auto &Reg : RA64)
+    push(Reg);
+
+  if (NumPush & 1)
+    sub(rsp, 8); // Align
+
+  mov(rdi, STATE);
+  mov(rax, Op->RIP); // imm64 move
+  mov(rsi, rax);
+
+  mov(rax, reinterpret_cast<uintptr_t>(&Context::Context::PromoteCodeEntry));
+  call(rax);
+
+  if (NumPush & 1)
+    add(rsp, 8); // Align
+
+  for (uint32_t i = RA64.size(); i > 0; --i)
+    pop(RA64[i - 1]);
+
+  FillStaticRegs();
 }
 
 DEF_OP(CPUID) {
@@ -303,6 +413,8 @@ DEF_OP(CPUID) {
   } Ptr;
   Ptr.ClassPtr = &CPUIDEmu::RunFunction;
 
+  SpillStaticRegs();
+
   for (auto &Reg : RA64)
     push(Reg);
 
@@ -332,6 +444,8 @@ DEF_OP(CPUID) {
   for (uint32_t i = RA64.size(); i > 0; --i)
     pop(RA64[i - 1]);
 
+  FillStaticRegs();
+
   auto Dst = GetSrcPair<RA_64>(Node);
   mov(Dst.first, rax);
   mov(Dst.second, rdx);
@@ -349,9 +463,11 @@ void JITCore::RegisterBranchHandlers() {
   REGISTER_OP(JUMP,              Jump);
   REGISTER_OP(CONDJUMP,          CondJump);
   REGISTER_OP(SYSCALL,           Syscall);
+  REGISTER_OP(SYSCALLDIRECT,     SyscallDirect);
   REGISTER_OP(THUNK,             Thunk);
   REGISTER_OP(VALIDATECODE,      ValidateCode);
   REGISTER_OP(REMOVECODEENTRY,   RemoveCodeEntry);
+  REGISTER_OP(PROMOTECODEENTRY,  PromoteCodeEntry);
   REGISTER_OP(CPUID,             CPUID);
 #undef REGISTER_OP
 }
@@ -1,5 +1,6 @@
 #include "Interface/Context/Context.h"
 
+#include "Interface/Core/JIT/JITCore.h"
 #include "Interface/Core/JIT/x86_64/JITClass.h"
 #include "Interface/Core/InternalThreadState.h"
 
@@ -47,6 +48,7 @@ struct ContextBackup {
 
   // Guest state
   int Signal;
+  uint32_t StaticRegsLive;
   FEXCore::Core::CPUState GuestState;
 };
 
@@ -85,6 +87,7 @@ void JITCore::StoreThreadState(int Signal, void *ucontext) {
   // We can't guarantee if registers are in context or host GPRs
   // So we need to save everything
   memcpy(&Context->GuestState, &ThreadState->State, sizeof(FEXCore::Core::CPUState));
+  Context->StaticRegsLive = ThreadState->Dispatcher.StaticRegsLive;
 
   // Set the new SP
   _mcontext->gregs[REG_RSP] = NewSP;
@@ -108,6 +111,8 @@ void JITCore::RestoreThreadState(void *ucontext) {
 
   // First thing, reset the guest state
   memcpy(&ThreadState->State, &Context->GuestState, sizeof(FEXCore::Core::CPUState));
+  // The host registers come back below, so whatever was live in them is again
+  ThreadState->Dispatcher.StaticRegsLive = Context->StaticRegsLive;
 
   // Now restore host state
 
@@ -121,14 +126,70 @@ void JITCore::RestoreThreadState(void *ucontext) {
   CTX->SignalDelegation->SetCurrentSignal(Context->Signal);
 }
 
+bool JITCore::IsAddressInJITCode(uint64_t Address, bool IncludeDispatcher) {
+  uint64_t CodeBase{};
+  uint64_t CodeEnd{};
+
+  // Blocks from every thread live in the shared code cache
+  if (CTX->CodeCache->Contains(Address)) {
+    return true;
+  }
+
+  if (IncludeDispatcher) {
+    CodeBase = reinterpret_cast<uint64_t>(DispatcherCodeBuffer.Ptr);
+    CodeEnd = CodeBase + DispatcherCodeBuffer.Size;
+    if (Address >= CodeBase &&
+        Address < CodeEnd) {
+      return true;
+    }
+  }
+  return false;
+}
+
+// Maps an x86 register encoding to its location in the host mcontext
+static int GetMContextGPR(Xbyak::Reg const &Reg) {
+  constexpr std::array<int, 16> MContextGPRs = {
+    REG_RAX, REG_RCX, REG_RDX, REG_RBX,
+    REG_RSP, REG_RBP, REG_RSI, REG_RDI,
+    REG_R8,  REG_R9,  REG_R10, REG_R11,
+    REG_R12, REG_R13, REG_R14, REG_R15,
+  };
+  return MContextGPRs[Reg.getIdx()];
+}
+
+void JITCore::SyncStaticRegsFromSignal(void *ucontext) {
+  ucontext_t* _context = (ucontext_t*)ucontext;
+  mcontext_t* _mcontext = &_context->uc_mcontext;
+
+  // Call this after StoreThreadState, the host registers come back with the mcontext
+  // The backed up context has to be the one the JIT spilled, it can be mid fill
+  if (!ThreadState->Dispatcher.StaticRegsLive) {
+    // Spilled, the registers might have been clobbered by a call since
+    return;
+  }
+
+  for (size_t i = 0; i < SRA64.size(); ++i) {
+    ThreadState->State.State.gregs[i] = _mcontext->gregs[GetMContextGPR(SRA64[i])];
+  }
+
+  for (size_t i = 0; i < SRAXMM.size(); ++i) {
+    memcpy(ThreadState->State.State.xmm[i], &_mcontext->fpregs->_xmm[SRAXMM[i].getIdx()], sizeof(ThreadState->State.State.xmm[i]));
+  }
+
+  // Wherever the handler sends the thread next fills them again
+  ThreadState->Dispatcher.StaticRegsLive = 0;
+}
+
 bool JITCore::HandleGuestSignal(int Signal, void *info, void *ucontext, GuestSigAction *GuestAction, stack_t *GuestStack) {
   ucontext_t* _context = (ucontext_t*)ucontext;
   mcontext_t* _mcontext = &_context->uc_mcontext;
 
   StoreThreadState(Signal, ucontext);
+  SyncStaticRegsFromSignal(ucontext);
 
   // Set the new PC
-  _mcontext->gregs[REG_RIP] = AbsoluteLoopTopAddress;
+  // The guest handler's state lives in the context, reload the static registers from it
+  _mcontext->gregs[REG_RIP] = AbsoluteLoopTopAddressFillSRA;
   // Set our state register to point to our guest thread data
   _mcontext->gregs[REG_R14] = reinterpret_cast<uint64_t>(ThreadState);
 
@@ -249,24 +310,26 @@ bool JITCore::HandleGuestSignal(int Signal, void *info, void *ucontext, GuestSig
     ThreadState->State.State.gregs[X86State::REG_RSP] = NewGuestSP;
   }
 
-  return true;
-}
+  // Like the kernel, the handler starts with a default x87 control word
+  // The interrupted FCW is in the backup and comes back on sigreturn
+  ThreadState->State.State.FCW = 0x37F;
 
-void JITCore::CopyNecessaryDataForCompileThread(CPUBackend *Original) {
-  JITCore *Core = reinterpret_cast<JITCore*>(Original);
-  ThreadSharedData = Core->ThreadSharedData;
+  return true;
 }
 
 bool JITCore::HandleSIGILL(int Signal, void *info, void *ucontext) {
   ucontext_t* _context = (ucontext_t*)ucontext;
   mcontext_t* _mcontext = &_context->uc_mcontext;
 
-  if (_mcontext->gregs[REG_RIP] == ThreadSharedData.SignalHandlerReturnAddress) {
+  if (_mcontext->gregs[REG_RIP] == SignalHandlerReturnAddress) {
     RestoreThreadState(ucontext);
 
     // Ref count our faults
     // We use this to track if it is safe to clear cache
     --SignalHandlerRefCounter;
+
+    // Retirements couldn't be acknowledged under the handler, go back through the safe point for them
+    ThreadState->LookupCache->RequestSync();
     return true;
   }
 
@@ -276,6 +339,9 @@ bool JITCore::HandleSIGILL(int Signal, void *info, void *ucontext) {
     // Ref count our faults
     // We use this to track if it is safe to clear cache
     --SignalHandlerRefCounter;
+
+    // Retirements couldn't be acknowledged under the handler, go back through the safe point for them
+    ThreadState->LookupCache->RequestSync();
     return true;
   }
 
@@ -291,6 +357,7 @@ bool JITCore::HandleSignalPause(int Signal, void *info, void *ucontext) {
 
     // Store our thread state so we can come back to this
     StoreThreadState(Signal, ucontext);
+    SyncStaticRegsFromSignal(ucontext);
 
     // Set the new PC
     _mcontext->gregs[REG_RIP] = ThreadPauseHandlerAddress;
@@ -322,7 +389,9 @@ bool JITCore::HandleSignalPause(int Signal, void *info, void *ucontext) {
     mcontext_t* _mcontext = &_context->uc_mcontext;
 
     // Our thread is stopping
-    // We don't care about anything at this point
+    // Keep the context complete for whoever looks at it after the thread exits
+    SyncStaticRegsFromSignal(ucontext);
+
     // Set the stack to our starting location when we entered the JIT and get out safely
     _mcontext->gregs[REG_RSP] = ThreadState->State.ReturningStackLocation;
 
@@ -339,7 +408,75 @@ bool JITCore::HandleSignalPause(int Signal, void *info, void *ucontext) {
   return false;
 }
 
+void JITCore::SpillStaticRegs() {
+  if (StaticRegisters) {
+    for (size_t i = 0; i < SRA64.size(); ++i) {
+      mov(qword [STATE + offsetof(FEXCore::Core::ThreadState, State.gregs[i])], SRA64[i].cvt64());
+    }
+
+    for (size_t i = 0; i < SRAXMM.size(); ++i) {
+      movups(xword [STATE + offsetof(FEXCore::Core::ThreadState, State.xmm[i][0])], SRAXMM[i]);
+    }
+
+    // Only once everything is stored, a signal part way through still has to read the registers
+    mov(dword [STATE + offsetof(FEXCore::Core::InternalThreadState, Dispatcher.StaticRegsLive)], 0);
+  }
+
+  // Leaving guest code, host C code expects the default x87 control word
+  LoadHostFCW();
+}
+
+void JITCore::FillStaticRegs() {
+  if (StaticRegisters) {
+    for (size_t i = 0; i < SRA64.size(); ++i) {
+      mov(SRA64[i].cvt64(), qword [STATE + offsetof(FEXCore::Core::ThreadState, State.gregs[i])]);
+    }
+
+    for (size_t i = 0; i < SRAXMM.size(); ++i) {
+      movups(SRAXMM[i], xword [STATE + offsetof(FEXCore::Core::ThreadState, State.xmm[i][0])]);
+    }
+
+    mov(dword [STATE + offsetof(FEXCore::Core::InternalThreadState, Dispatcher.StaticRegsLive)], 1);
+  }
+
+  LoadGuestFCW();
+}
+
+void JITCore::LoadHostFCW() {
+  sub(rsp, 16);
+  mov(word [rsp], 0x37F);
+  fldcw(word [rsp]);
+  add(rsp, 16);
+}
+
+void JITCore::LoadGuestFCW() {
+  // The host x87 only gets the guest's rounding and precision control, exceptions stay masked.
+  // Fill is emitted in front of indirect jumps through RAX so that has to survive
+  sub(rsp, 16);
+  mov(qword [rsp], rax);
+  movzx(eax, word [STATE + offsetof(FEXCore::Core::ThreadState, State.FCW)]);
+  or_(eax, 0x3F);
+  mov(word [rsp + 8], ax);
+  fldcw(word [rsp + 8]);
+  mov(rax, qword [rsp]);
+  add(rsp, 16);
+}
+
+void JITCore::HoldCodeForSyscall(Xbyak::Label &Return) {
+  // Under a signal handler or callback there is more guest code further up the stack
+  Label Nested;
+  mov(rax, qword [STATE + offsetof(FEXCore::Core::InternalThreadState, Dispatcher.SignalHandlerRefCounter)]);
+  cmp(dword [rax], 0);
+  jne(Nested);
+  lea(rax, ptr[rip + Return]);
+  mov(qword [STATE + offsetof(FEXCore::Core::InternalThreadState, Dispatcher.HeldCode)], rax);
+  L(Nested);
+}
+
 void JITCore::PushRegs() {
+  // Fallbacks can look at the context and the XMMs are caller saved
+  SpillStaticRegs();
+
   for (auto &Xmm : RAXMM_x) {
     sub(rsp, 16);
     movaps(ptr[rsp], Xmm);
@@ -365,6 +502,8 @@ void JITCore::PopRegs() {
     movaps(RAXMM_x[i - 1], ptr[rsp]);
     add(rsp, 16);
   }
+
+  FillStaticRegs();
 }
 
 void JITCore::Op_Unhandled(FEXCore::IR::IROp_Header *IROp, uint32_t Node) {
@@ -577,21 +716,24 @@ void JITCore::Op_Unhandled(FEXCore::IR::IROp_Header *IROp, uint32_t Node) {
 void JITCore::Op_NoOp(FEXCore::IR::IROp_Header *IROp, uint32_t Node) {
 }
 
-JITCore::JITCore(FEXCore::Context::Context *ctx, FEXCore::Core::InternalThreadState *Thread, CodeBuffer Buffer, bool CompileThread)
-  : CodeGenerator(Buffer.Size, Buffer.Ptr, nullptr)
+JITCore::JITCore(FEXCore::Context::Context *ctx, FEXCore::Core::InternalThreadState *Thread, bool CompileThread)
+  : CodeGenerator(MAX_DISPATCHER_CODE_SIZE, AllocateNewCodeBuffer(MAX_DISPATCHER_CODE_SIZE).Ptr, nullptr)
   , CTX {ctx}
   , ThreadState {Thread}
-  , InitialCodeBuffer {Buffer}
 {
-  ThreadSharedData.SignalHandlerRefCounterPtr = &SignalHandlerRefCounter;
-
-  CurrentCodeBuffer = &InitialCodeBuffer;
+  // Only the dispatcher is emitted here, blocks go in to chunks of the shared code cache
+  DispatcherCodeBuffer = CodeBuffer{getCode<uint8_t*>(), MAX_DISPATCHER_CODE_SIZE};
+  IsCompileThread = CompileThread;
+  StaticRegisters = CTX->Config.StaticRegisterAllocation;
 
   RAPass = Thread->PassManager->GetRAPass();
 
+  // Without static registers their host registers go to the register allocator, they are the tail of RA64 and RAXMM
   RAPass->AllocateRegisterSet(RegisterCount, RegisterClasses);
-  RAPass->AddRegisters(FEXCore::IR::GPRClass, NumGPRs);
-  RAPass->AddRegisters(FEXCore::IR::FPRClass, NumXMMs);
+  RAPass->AddRegisters(FEXCore::IR::GPRClass, StaticRegisters ? NumGPRs - SRA64.size() : NumGPRs);
+  RAPass->AddRegisters(FEXCore::IR::GPRFixedClass, SRA64.size());
+  RAPass->AddRegisters(FEXCore::IR::FPRClass, StaticRegisters ? NumXMMs - SRAXMM.size() : NumXMMs);
+  RAPass->AddRegisters(FEXCore::IR::FPRFixedClass, SRAXMM.size());
   RAPass->AddRegisters(FEXCore::IR::GPRPairClass, NumGPRPairs);
 
   for (uint32_t i = 0; i < NumGPRPairs; ++i) {
@@ -613,6 +755,7 @@ JITCore::JITCore(FEXCore::Context::Context *ctx, FEXCore::Core::InternalThreadSt
   RegisterMoveHandlers();
   RegisterVectorHandlers();
   RegisterEncryptionHandlers();
+  RegisterX87Handlers();
 
   if (!CompileThread) {
     CreateCustomDispatch(Thread);
@@ -640,56 +783,7 @@ JITCore::JITCore(FEXCore::Context::Context *ctx, FEXCore::Core::InternalThreadSt
 }
 
 JITCore::~JITCore() {
-  for (auto CodeBuffer : CodeBuffers) {
-    FreeCodeBuffer(CodeBuffer);
-  }
-  CodeBuffers.clear();
-
-  if (DispatcherCodeBuffer.Ptr) {
-    // Dispatcher may not exist if this is a compile thread
-    FreeCodeBuffer(DispatcherCodeBuffer);
-  }
-  FreeCodeBuffer(InitialCodeBuffer);
-}
-
-void JITCore::ClearCache() {
-  if (*ThreadSharedData.SignalHandlerRefCounterPtr == 0) {
-    if (!CodeBuffers.empty()) {
-      // If we have more than one code buffer we are tracking then walk them and delete
-      // This is a cleanup step
-      for (auto CodeBuffer : CodeBuffers) {
-        FreeCodeBuffer(CodeBuffer);
-      }
-      CodeBuffers.clear();
-
-      // Set the current code buffer to the initial
-      setNewBuffer(InitialCodeBuffer.Ptr, InitialCodeBuffer.Size);
-      CurrentCodeBuffer = &InitialCodeBuffer;
-    }
-
-    if (CurrentCodeBuffer->Size == MAX_CODE_SIZE) {
-      // Rewind to the start of the code cache start
-      reset();
-    }
-    else {
-      FreeCodeBuffer(InitialCodeBuffer);
-
-      // Resize the code buffer and reallocate our code size
-      CurrentCodeBuffer->Size *= 1.5;
-      CurrentCodeBuffer->Size = std::min(CurrentCodeBuffer->Size, MAX_CODE_SIZE);
-
-      InitialCodeBuffer = AllocateNewCodeBuffer(CurrentCodeBuffer->Size);
-      setNewBuffer(InitialCodeBuffer.Ptr, InitialCodeBuffer.Size);
-    }
-  }
-  else {
-    // We have signal handlers that have generated code
-    // This means that we can not safely clear the code at this point in time
-    // Allocate some new code buffers that we can switch over to instead
-    auto NewCodeBuffer = AllocateNewCodeBuffer(JITCore::INITIAL_CODE_SIZE);
-    EmplaceNewCodeBuffer(NewCodeBuffer);
-    setNewBuffer(NewCodeBuffer.Ptr, NewCodeBuffer.Size);
-  }
+  FreeCodeBuffer(DispatcherCodeBuffer);
 }
 
 IR::PhysicalRegister JITCore::GetPhys(uint32_t Node) {
@@ -701,11 +795,15 @@ IR::PhysicalRegister JITCore::GetPhys(uint32_t Node) {
 }
 
 bool JITCore::IsFPR(uint32_t Node) {
-  return RAData->GetNodeRegister(Node).Class == IR::FPRClass.Val;
+  auto Class = RAData->GetNodeRegister(Node).Class;
+
+  return Class == IR::FPRClass.Val || Class == IR::FPRFixedClass.Val;
 }
 
 bool JITCore::IsGPR(uint32_t Node) {
-  return RAData->GetNodeRegister(Node).Class == IR::GPRClass.Val;
+  auto Class = RAData->GetNodeRegister(Node).Class;
+
+  return Class == IR::GPRClass.Val || Class == IR::GPRFixedClass.Val;
 }
 
 template<uint8_t RAType>
@@ -715,6 +813,20 @@ Xbyak::Reg JITCore::GetSrc(uint32_t Node) {
   // Callee Saved
   // rbx, rbp, r12, r13, r14, r15
   auto PhyReg = GetPhys(Node);
+  if (PhyReg.Class == IR::GPRFixedClass.Val) {
+    if (RAType == RA_64)
+      return SRA64[PhyReg.Reg].cvt64();
+    else if (RAType == RA_32)
+      return SRA64[PhyReg.Reg].cvt32();
+    else if (RAType == RA_16)
+      return SRA64[PhyReg.Reg].cvt16();
+    else if (RAType == RA_8)
+      return SRA64[PhyReg.Reg].cvt8();
+  }
+  else if (PhyReg.Class == IR::FPRFixedClass.Val) {
+    return SRAXMM[PhyReg.Reg];
+  }
+
   if (RAType == RA_64)
     return RA64[PhyReg.Reg].cvt64();
   else if (RAType == RA_XMM)
@@ -741,12 +853,29 @@ Xbyak::Reg JITCore::GetSrc<JITCore::RA_8>(uint32_t Node);
 
 Xbyak::Xmm JITCore::GetSrc(uint32_t Node) {
   auto PhyReg = GetPhys(Node);
+  if (PhyReg.Class == IR::FPRFixedClass.Val) {
+    return SRAXMM[PhyReg.Reg];
+  }
   return RAXMM_x[PhyReg.Reg];
 }
 
 template<uint8_t RAType>
 Xbyak::Reg JITCore::GetDst(uint32_t Node) {
   auto PhyReg = GetPhys(Node);
+  if (PhyReg.Class == IR::GPRFixedClass.Val) {
+    if (RAType == RA_64)
+      return SRA64[PhyReg.Reg].cvt64();
+    else if (RAType == RA_32)
+      return SRA64[PhyReg.Reg].cvt32();
+    else if (RAType == RA_16)
+      return SRA64[PhyReg.Reg].cvt16();
+    else if (RAType == RA_8)
+      return SRA64[PhyReg.Reg].cvt8();
+  }
+  else if (PhyReg.Class == IR::FPRFixedClass.Val) {
+    return SRAXMM[PhyReg.Reg];
+  }
+
   if (RAType == RA_64)
     return RA64[PhyReg.Reg].cvt64();
   else if (RAType == RA_XMM)
@@ -788,6 +917,9 @@ std::pair<Xbyak::Reg, Xbyak::Reg> JITCore::GetSrcPair<JITCore::RA_32>(uint32_t N
 
 Xbyak::Xmm JITCore::GetDst(uint32_t Node) {
   auto PhyReg = GetPhys(Node);
+  if (PhyReg.Class == IR::FPRFixedClass.Val) {
+    return SRAXMM[PhyReg.Reg];
+  }
   return RAXMM_x[PhyReg.Reg];
 }
 
@@ -847,9 +979,9 @@ void *JITCore::CompileCode([[maybe_unused]] FEXCore::IR::IRListView<true> const
 
   // Fairly excessive buffer range to make sure we don't overflow
   uint32_t BufferRange = SSACount * 16;
-  if ((getSize() + BufferRange) > CurrentCodeBuffer->Size) {
-    ThreadState->CTX->ClearCodeCache(ThreadState, false);
-  }
+  // Compiles from the dispatcher and compile threads have no guest code on the stack
+  auto Chunk = ThreadState->LookupCache->ReserveCode(BufferRange, SignalHandlerRefCounter == 0);
+  setNewBuffer(Chunk.Ptr, Chunk.Size);
 
 	void *Entry = getCurr<void*>();
   this->IR = IR;
@@ -866,8 +998,8 @@ void *JITCore::CompileCode([[maybe_unused]] FEXCore::IR::IRListView<true> const
     cmp(dword [rax + (offsetof(FEXCore::Context::Context, Config.RunningMode))], 0);
     je(RunBlock);
     // Else we need to pause now
-    mov(rax, ThreadPauseHandlerAddress);
-    jmp(rax);
+    SpillStaticRegs();
+    jmp(qword [STATE + offsetof(FEXCore::Core::InternalThreadState, Dispatcher.ThreadPauseHandler)]);
     ud2();
 
     L(RunBlock);
@@ -1003,6 +1135,7 @@ void *JITCore::CompileCode([[maybe_unused]] FEXCore::IR::IRListView<true> const
   this->IR = nullptr;
 
   ready();
+  ThreadState->LookupCache->CommitCode(getSize());
 
   if (DebugData) {
     DebugData->HostCodeSize = reinterpret_cast<uintptr_t>(Exit) - reinterpret_cast<uintptr_t>(Entry);
@@ -1024,26 +1157,43 @@ static void SleepThread(FEXCore::Context::Context *ctx, FEXCore::Core::InternalT
 
 uint64_t JITCore::ExitFunctionLink(JITCore *core, FEXCore::Core::InternalThreadState *Thread, uint64_t *record) {
   auto GuestRip = record[1];
+  auto LookupCache = Thread->LookupCache.get();
 
-  auto HostCode = Thread->LookupCache->FindBlock(GuestRip);
+  // Don't link to anything that has been erased
+  LookupCache->Sync();
+  auto HostCode = LookupCache->FindBlock(GuestRip);
 
   if (!HostCode) {
     Thread->State.State.rip = GuestRip;
     return core->AbsoluteLoopTopAddress;
   }
 
-  auto LinkerAddress = core->ExitFunctionLinkerAddress;
-  Thread->LookupCache->AddBlockLink(GuestRip, (uintptr_t)record, [record, LinkerAddress]{
-    // undo the link
-    record[0] = LinkerAddress;
-  });
+  // The record is followed by a stub that jumps to this thread's linker, unlinking sends the exit back there
+  // This fails if either block was erased in the meantime, the exit then keeps coming through here
+  LookupCache->AddBlockLink(GuestRip, HostCode, (uintptr_t)record, (uintptr_t)&record[2],
+    [](uintptr_t HostLink, uintptr_t HostCode) {
+      reinterpret_cast<uint64_t*>(HostLink)[0] = HostCode;
+    },
+    [](uintptr_t HostLink, uintptr_t LinkerAddress) {
+      // undo the link
+      reinterpret_cast<uint64_t*>(HostLink)[0] = LinkerAddress;
+    });
+
+  if (LookupCache->NeedsSync()) {
+    // Retired code is waiting on this thread, the loop top acknowledges it before running anything
+    Thread->State.State.rip = GuestRip;
+    return core->AbsoluteLoopTopAddress;
+  }
 
-  record[0] = HostCode;
   return HostCode;
 }
 
+void JITCore::SyncLookupCache(JITCore *core, FEXCore::Core::InternalThreadState *Thread) {
+  // Anything under a signal frame can still return in to retired code
+  Thread->LookupCache->SafePoint(core->SignalHandlerRefCounter == 0);
+}
+
 void JITCore::CreateCustomDispatch(FEXCore::Core::InternalThreadState *Thread) {
-  DispatcherCodeBuffer = AllocateNewCodeBuffer(MAX_DISPATCHER_CODE_SIZE);
   setNewBuffer(DispatcherCodeBuffer.Ptr, DispatcherCodeBuffer.Size);
 
 // Temp registers
@@ -1093,95 +1243,131 @@ void JITCore::CreateCustomDispatch(FEXCore::Core::InternalThreadState *Thread) {
   // regardless of where we were in the stack
   mov(qword [STATE + offsetof(FEXCore::Core::ThreadState, ReturningStackLocation)], rsp);
 
+  Label LoopTopFillSRA;
   Label LoopTop;
+  Label Lookup;
+  Label SyncCache;
   Label FullLookup;
   Label NoBlock;
   Label ThreadPauseHandler{};
 
+  // Static registers are only live from the loop top up to the stop handler
+  // Anything that enters with them spilled goes through here
+  L(LoopTopFillSRA);
+  AbsoluteLoopTopAddressFillSRA = getCurr<uint64_t>();
+  FillStaticRegs();
+
   L(LoopTop);
   AbsoluteLoopTopAddress = getCurr<uint64_t>();
   {
+    // L1 can't be trusted until it has caught up with blocks erased by any thread
+    mov(rax, reinterpret_cast<uint64_t>(CTX->CodeCache->GetEraseCountPointer()));
+    mov(rax, qword [rax]);
+    cmp(rax, qword [STATE + offsetof(FEXCore::Core::InternalThreadState, Dispatcher.L1EraseCount)]);
+    jne(SyncCache);
+
+    L(Lookup);
     // Load our RIP
     mov(rdx, qword [STATE + offsetof(FEXCore::Core::CPUState, rip)]);
 
     // L1 Cache
-    mov(r13, Thread->LookupCache->GetL1Pointer());
+    // rsi is free here, the callee saved registers hold static registers
+    mov(rsi, Thread->LookupCache->GetL1Pointer());
     mov(rax, rdx);
 
     and_(rax, LookupCache::L1_ENTRIES_MASK);
     shl(rax, 4);
-    cmp(qword[r13 + rax + 8], rdx);
+    cmp(qword[rsi + rax + 8], rdx);
     jne(FullLookup);
-    jmp(qword[r13 + rax + 0]);
+    jmp(qword[rsi + rax + 0]);
 
     L(FullLookup);
-    mov(r13, Thread->LookupCache->GetPagePointer());
+    mov(rsi, Thread->LookupCache->GetRootPointer());
 
-    // Full lookup
+    // Full lookup, walks the radix tree in CodeCache.cpp::WalkL2
+    // Addresses outside of the guest address space never have an entry
     mov(rax, rdx);
-    mov(rbx, Thread->LookupCache->GetVirtualMemorySize() - 1);
-    and_(rax, rbx);
-    shr(rax, 12);
+    shr(rax, CodeCache::ROOT_SHIFT);
+    cmp(rax, CodeCache::ROOT_ENTRIES);
+    jae(NoBlock);
 
-    // Load page pointer
-    mov(rdi, qword [r13 + rax * 8]);
+    // Load directory pointer
+    mov(rdi, qword [rsi + rax * 8]);
+    test(rdi, rdi);
+    jz(NoBlock);
 
-    cmp(rdi, 0);
-    je(NoBlock);
+    // Load table pointer
+    mov(rax, rdx);
+    shr(rax, CodeCache::DIRECTORY_SHIFT);
+    and_(rax, CodeCache::TABLE_MASK);
+    mov(rdi, qword [rdi + rax * 8]);
+    test(rdi, rdi);
+    jz(NoBlock);
 
-    mov (rax, rdx);
-    and(rax, 0x0FFF);
+    // Load page pointer
+    mov(rax, rdx);
+    shr(rax, CodeCache::TABLE_SHIFT);
+    and_(rax, CodeCache::TABLE_MASK);
+    mov(rdi, qword [rdi + rax * 8]);
+    test(rdi, rdi);
+    jz(NoBlock);
 
-    shl(rax, (int)log2(sizeof(FEXCore::LookupCache::LookupCacheEntry)));
+    mov (rax, rdx);
+    and_(rax, CodeCache::PAGE_MASK);
 
-    // check for aliasing
-    mov(rcx, qword [rdi + rax + 8]);
-    cmp(rcx, rdx);
-    jne(NoBlock);
+    // Load the offset of the block from the host code base
+    static_assert(sizeof(FEXCore::CodeCache::L2Entry) == 4, "This is expected to be size of 4");
+    movsxd(rax, dword [rdi + rax * 4]);
 
-    // Load the block pointer
-    mov(rax, qword [rdi + rax]);
+    test(rax, rax);
+    jz(NoBlock);
 
-    cmp(rax, 0);
-    je(NoBlock);
+    mov(rcx, Thread->LookupCache->GetHostCodeBase());
+    add(rax, rcx);
 
     // Update L1
-    mov(r13, Thread->LookupCache->GetL1Pointer());
+    mov(rsi, Thread->LookupCache->GetL1Pointer());
     mov(rcx, rdx);
     and_(rcx, LookupCache::L1_ENTRIES_MASK);
     shl(rcx, 1);
-    mov(qword[r13 + rcx*8 + 8], rdx);
-    mov(qword[r13 + rcx*8 + 0], rax);
+    // Host code first, a signal landing in between must not see the new guest address with the old code
+    mov(qword[rsi + rcx*8 + 0], rax);
+    mov(qword[rsi + rcx*8 + 8], rdx);
 
     // Real block if we made it here
     jmp(rax);
   }
 
   {
-    ThreadStopHandlerAddress = getCurr<uint64_t>();
+    ExitFunctionLinkerAddress = getCurr<uint64_t>();
+    SpillStaticRegs();
 
-    add(rsp, 8);
+    // {rdi, rsi, rdx}
+    mov(rdi, (uintptr_t)this);
+    mov(rsi, STATE);
+    mov(rdx, rax); // rax is set at the block end
 
-    pop(r15);
-    pop(r14);
-    pop(r13);
-    pop(r12);
-    pop(rbp);
-    pop(rbx);
+    mov(rax, (uintptr_t)&ExitFunctionLink);
+    call(rax);
 
-    ret();
+    FillStaticRegs();
+    jmp(rax);
   }
 
   {
-    ExitFunctionLinkerAddress = getCurr<uint64_t>();
-    // {rdi, rsi, rdx}
+    L(SyncCache);
+    SpillStaticRegs();
+
+    // {rdi, rsi}
     mov(rdi, (uintptr_t)this);
     mov(rsi, STATE);
-    mov(rdx, rax); // rax is set at the block end
 
-    mov(rax, (uintptr_t)&ExitFunctionLink);
+    mov(rax, (uintptr_t)&SyncLookupCache);
     call(rax);
-    jmp(rax);
+
+    // Anything logged since will be caught by the next block exit, skip straight to the lookup
+    FillStaticRegs();
+    jmp(Lookup);
   }
 
   Label FallbackCore;
@@ -1198,6 +1384,9 @@ void JITCore::CreateCustomDispatch(FEXCore::Core::InternalThreadState *Thread) {
     PtrCast Ptr;
     Ptr.ClassPtr = &FEXCore::Context::Context::CompileBlock;
 
+    // The compiler and anything it invalidates can look at the context
+    SpillStaticRegs();
+
     // {rdi, rsi, rdx}
     mov(rdi, reinterpret_cast<uint64_t>(CTX));
     mov(rsi, STATE);
@@ -1208,8 +1397,7 @@ void JITCore::CreateCustomDispatch(FEXCore::Core::InternalThreadState *Thread) {
     // RAX contains nulptr or block ptr here
     cmp(rax, 0);
     je(FallbackCore);
-    // rdx already contains RIP here
-    jmp(LoopTop);
+    jmp(LoopTopFillSRA);
   }
 
   {
@@ -1217,9 +1405,27 @@ void JITCore::CreateCustomDispatch(FEXCore::Core::InternalThreadState *Thread) {
     ud2();
   }
 
+  {
+    ThreadStopHandlerAddress = getCurr<uint64_t>();
+
+    // Signals can redirect here straight out of guest code
+    LoadHostFCW();
+
+    add(rsp, 8);
+
+    pop(r15);
+    pop(r14);
+    pop(r13);
+    pop(r12);
+    pop(rbp);
+    pop(rbx);
+
+    ret();
+  }
+
   {
     // Signal return handler
-    ThreadSharedData.SignalHandlerReturnAddress = getCurr<uint64_t>();
+    SignalHandlerReturnAddress = getCurr<uint64_t>();
 
     ud2();
   }
@@ -1229,6 +1435,8 @@ void JITCore::CreateCustomDispatch(FEXCore::Core::InternalThreadState *Thread) {
     ThreadPauseHandlerAddress = getCurr<uint64_t>();
     L(ThreadPauseHandler);
 
+    LoadHostFCW();
+
     mov(rdi, reinterpret_cast<uintptr_t>(CTX));
     mov(rsi, STATE);
     mov(rax, reinterpret_cast<uint64_t>(SleepThread));
@@ -1272,7 +1480,7 @@ void JITCore::CreateCustomDispatch(FEXCore::Core::InternalThreadState *Thread) {
     mov(qword [STATE + offsetof(FEXCore::Core::InternalThreadState, State.State.rip)], rsi);
 
     // Back to the loop top now
-    jmp(LoopTop);
+    jmp(LoopTopFillSRA);
   }
 
 #if ENABLE_JITSYMBOLS
@@ -1282,10 +1490,27 @@ void JITCore::CreateCustomDispatch(FEXCore::Core::InternalThreadState *Thread) {
 
   ready();
 
-  setNewBuffer(InitialCodeBuffer.Ptr, InitialCodeBuffer.Size);
+  // Blocks from any thread reach this thread's dispatcher through these
+  Thread->Dispatcher.LoopTop = AbsoluteLoopTopAddress;
+  Thread->Dispatcher.ExitFunctionLinker = ExitFunctionLinkerAddress;
+  Thread->Dispatcher.ThreadStopHandler = ThreadStopHandlerAddress;
+  Thread->Dispatcher.ThreadPauseHandler = ThreadPauseHandlerAddress;
+  Thread->Dispatcher.SignalHandlerReturn = SignalHandlerReturnAddress;
+  Thread->Dispatcher.SignalHandlerRefCounter = &SignalHandlerRefCounter;
 }
 
 FEXCore::CPU::CPUBackend *CreateJITCore(FEXCore::Context::Context *ctx, FEXCore::Core::InternalThreadState *Thread, bool CompileThread) {
-  return new JITCore(ctx, Thread, AllocateNewCodeBuffer(CompileThread ? JITCore::MAX_CODE_SIZE : JITCore::INITIAL_CODE_SIZE), CompileThread);
+  return new JITCore(ctx, Thread, CompileThread);
+}
+
+FEXCore::CodeCache *CreateJITCodeCache() {
+  return new FEXCore::CodeCache(JITCore::INITIAL_CODE_SIZE, JITCore::MAX_CODE_SIZE, JITCore::MAX_CODE_GENERATIONS, true);
+}
+
+JITStaticRegisters GetJITStaticRegisters(FEXCore::Context::Context *CTX) {
+  if (!CTX->Config.StaticRegisterAllocation) {
+    return {0, 0};
+  }
+  return {static_cast<uint32_t>(SRA64.size()), static_cast<uint32_t>(SRAXMM.size())};
 }
 }
@@ -2,6 +2,7 @@
 
 #include "Interface/Core/LookupCache.h"
 #include "Interface/Core/BlockSamplingData.h"
+#include "Interface/Core/CodeCache.h"
 
 #include "Interface/Core/JIT/x86_64/JIT.h"
 #include "Common/MathUtils.h"
@@ -16,6 +17,7 @@ using namespace Xbyak;
 #include <FEXCore/IR/IntrusiveIRList.h>
 #include "Interface/IR/Passes/RegisterAllocationPass.h"
 
+#include <memory>
 #include <tuple>
 
 namespace FEXCore::CPU {
@@ -49,14 +51,24 @@ namespace FEXCore::CPU {
 #define TMP4 rdi
 #define TMP5 rbx
 using namespace Xbyak::util;
-const std::array<Xbyak::Reg, 9> RA64 = { rsi, r8, r9, r10, r11, rbp, r12, r13, r15 };
-const std::array<std::pair<Xbyak::Reg, Xbyak::Reg>, 4> RA64Pair = {{ {rsi, r8}, {r9, r10}, {r11, rbp}, {r12, r13} }};
-const std::array<Xbyak::Reg, 11> RAXMM = { xmm1, xmm2, xmm3, xmm4, xmm5, xmm6, xmm7, xmm8, xmm9, xmm10, xmm11};
-const std::array<Xbyak::Xmm, 11> RAXMM_x = {  xmm1, xmm2, xmm3, xmm4, xmm5, xmm6, xmm7, xmm8, xmm9, xmm10, xmm11};
+
+// Statically mapped guest registers, only with the StaticRegisterAllocation option
+// SRA64[i] holds guest gregs[i], SRAXMM[i] holds guest xmm[i]
+// There aren't enough host registers to map everything, only RAX, RBX and XMM0-1 are mapped
+// Every call out of the JIT spills and fills them, which costs more than it saves in code that calls out often
+// The GPRs are callee saved so only the XMMs are lost over a call, both get spilled anyway to keep the context in sync
+const std::array<Xbyak::Reg, 2> SRA64 = { r12, r13 };
+const std::array<Xbyak::Xmm, 2> SRAXMM = { xmm10, xmm11 };
+
+// The static registers are at the end, the register allocator only gets them when they aren't mapped
+const std::array<Xbyak::Reg, 9> RA64 = { rsi, r8, r9, r10, r11, rbp, r15, r12, r13 };
+const std::array<std::pair<Xbyak::Reg, Xbyak::Reg>, 3> RA64Pair = {{ {rsi, r8}, {r9, r10}, {r11, rbp} }};
+const std::array<Xbyak::Reg, 11> RAXMM = { xmm1, xmm2, xmm3, xmm4, xmm5, xmm6, xmm7, xmm8, xmm9, xmm10, xmm11 };
+const std::array<Xbyak::Xmm, 11> RAXMM_x = { xmm1, xmm2, xmm3, xmm4, xmm5, xmm6, xmm7, xmm8, xmm9, xmm10, xmm11 };
 
 class JITCore final : public CPUBackend, public Xbyak::CodeGenerator {
 public:
-  explicit JITCore(FEXCore::Context::Context *ctx, FEXCore::Core::InternalThreadState *Thread, CodeBuffer Buffer, bool CompileThread);
+  explicit JITCore(FEXCore::Context::Context *ctx, FEXCore::Core::InternalThreadState *Thread, bool CompileThread);
   ~JITCore() override;
   std::string GetName() override { return "JIT"; }
   void *CompileCode(FEXCore::IR::IRListView<true> const *IR, FEXCore::Core::DebugData *DebugData, FEXCore::IR::RegisterAllocationData *RAData) override;
@@ -65,15 +77,14 @@ public:
 
   bool NeedsOpDispatch() override { return true; }
 
-  void ClearCache() override;
-
   static constexpr size_t INITIAL_CODE_SIZE = 1024 * 1024 * 16;
   static constexpr size_t MAX_CODE_SIZE = 1024 * 1024 * 256;
+  // Number of generations the shared code cache fills before it starts retiring the oldest one
+  static constexpr size_t MAX_CODE_GENERATIONS = 4;
 
   bool HandleSIGILL(int Signal, void *info, void *ucontext);
   bool HandleSignalPause(int Signal, void *info, void *ucontext);
   bool HandleGuestSignal(int Signal, void *info, void *ucontext, GuestSigAction *GuestAction, stack_t *GuestStack);
-  void CopyNecessaryDataForCompileThread(CPUBackend *Original) override;
 
 private:
   Label* PendingTargetLabel{};
@@ -85,6 +96,7 @@ private:
   Xbyak::util::Cpu Features{};
 
   bool MemoryDebug = false;
+  bool StaticRegisters{};
 
   /**
    * @name Register Allocation
@@ -128,6 +140,25 @@ private:
   bool IsInlineConstant(const IR::OrderedNodeWrapper& Node, uint64_t* Value = nullptr);
 
   void CreateCustomDispatch(FEXCore::Core::InternalThreadState *Thread);
+
+  /**
+   * @name Static register allocation
+   * @{ */
+  // Writes the statically mapped registers back to the context
+  void SpillStaticRegs();
+  // Reloads the statically mapped registers from the context
+  void FillStaticRegs();
+  // The host x87 control word is the guest's while in guest code and the default everywhere else
+  void LoadHostFCW();
+  void LoadGuestFCW();
+
+  // Publishes Return as the only code the thread needs while it is in a syscall, see LookupCache::SetHeldCode
+  void HoldCodeForSyscall(Xbyak::Label &Return);
+
+  bool IsAddressInJITCode(uint64_t Address, bool IncludeDispatcher = true);
+  // Copies the static registers out of a signal context in to the guest context, if they were live
+  void SyncStaticRegsFromSignal(void *ucontext);
+  /**  @} */
   IR::RegisterAllocationPass *RAPass;
   FEXCore::IR::RegisterAllocationData *RAData;
 
@@ -137,42 +168,27 @@ private:
 
   static constexpr size_t MAX_DISPATCHER_CODE_SIZE = 4096 * 1;
 
-  void EmplaceNewCodeBuffer(CodeBuffer Buffer) {
-    CurrentCodeBuffer = &CodeBuffers.emplace_back(Buffer);
-  }
-
   static uint64_t ExitFunctionLink(JITCore* code, FEXCore::Core::InternalThreadState *Thread, uint64_t *record);
-
-  // This is the initial code buffer that we will fall back to
-  // In a program without signals and code clearing, we will typically
-  // only have this code buffer
-  CodeBuffer InitialCodeBuffer{};
-  // This is the array of /additional/ code buffers that we may need to allocate
-  // Allocation only occurs when we've hit signals and need to clear code cache
-  // For code safety we can't delete code buffers until outside of all signals
-  std::vector<CodeBuffer> CodeBuffers{};
+  // Catches L1 up with the shared erase log, acknowledging retired code when no signal frames are live
+  static void SyncLookupCache(JITCore* code, FEXCore::Core::InternalThreadState *Thread);
 
   // This is the codebuffer that our dispatcher lives in
+  // Blocks are emitted in to chunks of the Context's CodeCache
   CodeBuffer DispatcherCodeBuffer{};
-  // This is the current code buffer that we are tracking
-  CodeBuffer *CurrentCodeBuffer{};
 
   uint64_t AbsoluteLoopTopAddress{};
+  // Same as AbsoluteLoopTopAddress but reloads the static registers from the context first
+  uint64_t AbsoluteLoopTopAddressFillSRA{};
   uint64_t ExitFunctionLinkerAddress{};
   uint64_t ThreadStopHandlerAddress{};
   uint64_t ThreadPauseHandlerAddress{};
 
   uint64_t PauseReturnInstruction{};
 
-  uint32_t SignalHandlerRefCounter{};
-
-  struct CompilerSharedData {
-    uint64_t SignalHandlerReturnAddress{};
+  uint64_t SignalHandlerReturnAddress{};
 
-    uint32_t *SignalHandlerRefCounterPtr{};
-  };
-
-  CompilerSharedData ThreadSharedData;
+  uint32_t SignalHandlerRefCounter{};
+  bool IsCompileThread{};
 
   void StoreThreadState(int Signal, void *ucontext);
   void RestoreThreadState(void *ucontext);
@@ -196,9 +212,14 @@ private:
   void RegisterMoveHandlers();
   void RegisterVectorHandlers();
   void RegisterEncryptionHandlers();
+  void RegisterX87Handlers();
 
   void PushRegs();
   void PopRegs();
+
+  // Moves an F80 value between an XMM register and the host x87 stack, needs a 16 byte slot at [rsp]
+  void X87Push(Xbyak::Xmm Src);
+  void X87Pop(Xbyak::Xmm Dst);
 #define DEF_OP(x) void Op_##x(FEXCore::IR::IROp_Header *IROp, uint32_t Node)
 
   ///< Unhandled handler
@@ -254,7 +275,6 @@ private:
   DEF_OP(Float_ToGPR_U);
   DEF_OP(Float_ToGPR_S);
   DEF_OP(FCmp);
-  DEF_OP(F80Cmp);
 
   ///< Atomic ops
   DEF_OP(CASPair);
@@ -281,9 +301,11 @@ private:
   DEF_OP(Jump);
   DEF_OP(CondJump);
   DEF_OP(Syscall);
+  DEF_OP(SyscallDirect);
   DEF_OP(Thunk);
   DEF_OP(ValidateCode);
   DEF_OP(RemoveCodeEntry);
+  DEF_OP(PromoteCodeEntry);
   DEF_OP(CPUID);
 
   ///< Conversion ops
@@ -306,6 +328,8 @@ private:
   ///< Memory ops
   DEF_OP(LoadContext);
   DEF_OP(StoreContext);
+  DEF_OP(LoadRegister);
+  DEF_OP(StoreRegister);
   DEF_OP(LoadContextIndexed);
   DEF_OP(StoreContextIndexed);
   DEF_OP(SpillRegister);
@@ -424,6 +448,33 @@ private:
   DEF_OP(AESDec);
   DEF_OP(AESDecLast);
   DEF_OP(AESKeyGenAssist);
+
+  ///< X87 ops
+  DEF_OP(F80LoadFCW);
+  DEF_OP(F80Add);
+  DEF_OP(F80Sub);
+  DEF_OP(F80Mul);
+  DEF_OP(F80Div);
+  DEF_OP(F80ATAN);
+  DEF_OP(F80FPREM);
+  DEF_OP(F80FPREM1);
+  DEF_OP(F80SCALE);
+  DEF_OP(F80CVT);
+  DEF_OP(F80CVTInt);
+  DEF_OP(F80CVTTo);
+  DEF_OP(F80CVTToInt);
+  DEF_OP(F80Round);
+  DEF_OP(F80F2XM1);
+  DEF_OP(F80FYL2X);
+  DEF_OP(F80TAN);
+  DEF_OP(F80SQRT);
+  DEF_OP(F80SIN);
+  DEF_OP(F80COS);
+  DEF_OP(F80XTRACT_EXP);
+  DEF_OP(F80XTRACT_SIG);
+  DEF_OP(F80Cmp);
+  DEF_OP(F80BCDLoad);
+  DEF_OP(F80BCDStore);
 #undef DEF_OP
 };
 
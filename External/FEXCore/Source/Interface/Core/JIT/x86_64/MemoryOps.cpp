@@ -128,6 +128,195 @@ DEF_OP(StoreContext) {
   }
 }
 
+DEF_OP(LoadRegister) {
+  auto Op = IROp->C<IR::IROp_LoadRegister>();
+
+  if (Op->Class == IR::GPRClass) {
+    auto regId = (Op->Offset - offsetof(FEXCore::Core::ThreadState, State.gregs[0])) / 8;
+    auto regOffs = Op->Offset & 7;
+
+    LogMan::Throw::A(regId < SRA64.size(), "out of range regId");
+
+    auto reg = SRA64[regId];
+    auto Dst = GetDst<RA_64>(Node);
+
+    switch (Op->Header.Size) {
+      case 1:
+        LogMan::Throw::A(regOffs == 0 || regOffs == 1, "unexpected regOffs");
+        if (regOffs == 0) {
+          movzx(Dst.cvt32(), reg.cvt8());
+        }
+        else {
+          mov(Dst.cvt32(), reg.cvt32());
+          shr(Dst.cvt32(), 8);
+          movzx(Dst.cvt32(), Dst.cvt8());
+        }
+        break;
+
+      case 2:
+        LogMan::Throw::A(regOffs == 0, "unexpected regOffs");
+        movzx(Dst.cvt32(), reg.cvt16());
+        break;
+
+      case 4:
+        LogMan::Throw::A(regOffs == 0, "unexpected regOffs");
+        mov(Dst.cvt32(), reg.cvt32());
+        break;
+
+      case 8:
+        LogMan::Throw::A(regOffs == 0, "unexpected regOffs");
+        if (Dst.getIdx() != reg.getIdx())
+          mov(Dst, reg.cvt64());
+        break;
+
+      default:  LogMan::Msg::A("Unhandled LoadRegister size: %d", Op->Header.Size);
+    }
+  }
+  else if (Op->Class == IR::FPRClass) {
+    auto regId = (Op->Offset - offsetof(FEXCore::Core::ThreadState, State.xmm[0][0])) / 16;
+    auto regOffs = Op->Offset & 15;
+
+    LogMan::Throw::A(regId < SRAXMM.size(), "out of range regId");
+
+    auto guest = SRAXMM[regId];
+    auto host = GetDst(Node);
+
+    // Partial loads zero the rest of the vector like LoadContext does
+    switch (Op->Header.Size) {
+      case 1:
+        pextrb(eax, guest, regOffs);
+        vmovq(host, rax);
+        break;
+
+      case 2:
+        LogMan::Throw::A((regOffs & 1) == 0, "unexpected regOffs");
+        pextrw(eax, guest, regOffs / 2);
+        vmovq(host, rax);
+        break;
+
+      case 4:
+        LogMan::Throw::A((regOffs & 3) == 0, "unexpected regOffs");
+        pextrd(eax, guest, regOffs / 4);
+        vmovd(host, eax);
+        break;
+
+      case 8:
+        LogMan::Throw::A((regOffs & 7) == 0, "unexpected regOffs");
+        pextrq(rax, guest, regOffs / 8);
+        vmovq(host, rax);
+        break;
+
+      case 16:
+        LogMan::Throw::A(regOffs == 0, "unexpected regOffs");
+        if (host.getIdx() != guest.getIdx())
+          movaps(host, guest);
+        break;
+
+      default:  LogMan::Msg::A("Unhandled LoadRegister size: %d", Op->Header.Size);
+    }
+  }
+  else {
+    LogMan::Throw::A(false, "Unhandled Op->Class %d", Op->Class);
+  }
+}
+
+DEF_OP(StoreRegister) {
+  auto Op = IROp->C<IR::IROp_StoreRegister>();
+
+  if (Op->Class == IR::GPRClass) {
+    auto regId = (Op->Offset - offsetof(FEXCore::Core::ThreadState, State.gregs[0])) / 8;
+    auto regOffs = Op->Offset & 7;
+
+    LogMan::Throw::A(regId < SRA64.size(), "out of range regId");
+
+    auto reg = SRA64[regId];
+    auto Src = GetSrc<RA_64>(Op->Value.ID());
+
+    // Partial stores leave the rest of the guest register alone
+    switch (Op->Header.Size) {
+      case 1:
+        LogMan::Throw::A(regOffs == 0 || regOffs == 1, "unexpected regOffs");
+        if (regOffs == 0) {
+          mov(reg.cvt8(), Src.cvt8());
+        }
+        else {
+          movzx(TMP1.cvt32(), Src.cvt8());
+          shl(TMP1.cvt32(), 8);
+          and_(reg.cvt64(), ~0xFF00);
+          or_(reg.cvt64(), TMP1);
+        }
+        break;
+
+      case 2:
+        LogMan::Throw::A(regOffs == 0, "unexpected regOffs");
+        mov(reg.cvt16(), Src.cvt16());
+        break;
+
+      case 4:
+        LogMan::Throw::A(regOffs == 0, "unexpected regOffs");
+        // 32bit moves zero the upper half
+        mov(TMP1.cvt32(), Src.cvt32());
+        shr(reg.cvt64(), 32);
+        shl(reg.cvt64(), 32);
+        or_(reg.cvt64(), TMP1);
+        break;
+
+      case 8:
+        LogMan::Throw::A(regOffs == 0, "unexpected regOffs");
+        if (Src.getIdx() != reg.getIdx())
+          mov(reg.cvt64(), Src);
+        break;
+
+      default:  LogMan::Msg::A("Unhandled StoreRegister size: %d", Op->Header.Size);
+    }
+  }
+  else if (Op->Class == IR::FPRClass) {
+    auto regId = (Op->Offset - offsetof(FEXCore::Core::ThreadState, State.xmm[0][0])) / 16;
+    auto regOffs = Op->Offset & 15;
+
+    LogMan::Throw::A(regId < SRAXMM.size(), "out of range regId");
+
+    auto guest = SRAXMM[regId];
+    auto host = GetSrc(Op->Value.ID());
+
+    switch (Op->Header.Size) {
+      case 1:
+        pextrb(eax, host, 0);
+        pinsrb(guest, eax, regOffs);
+        break;
+
+      case 2:
+        LogMan::Throw::A((regOffs & 1) == 0, "unexpected regOffs");
+        pextrw(eax, host, 0);
+        pinsrw(guest, eax, regOffs / 2);
+        break;
+
+      case 4:
+        LogMan::Throw::A((regOffs & 3) == 0, "unexpected regOffs");
+        pextrd(eax, host, 0);
+        pinsrd(guest, eax, regOffs / 4);
+        break;
+
+      case 8:
+        LogMan::Throw::A((regOffs & 7) == 0, "unexpected regOffs");
+        pextrq(rax, host, 0);
+        pinsrq(guest, rax, regOffs / 8);
+        break;
+
+      case 16:
+        LogMan::Throw::A(regOffs == 0, "unexpected regOffs");
+        if (host.getIdx() != guest.getIdx())
+          movaps(guest, host);
+        break;
+
+      default:  LogMan::Msg::A("Unhandled StoreRegister size: %d", Op->Header.Size);
+    }
+  }
+  else {
+    LogMan::Throw::A(false, "Unhandled Op->Class %d", Op->Class);
+  }
+}
+
 DEF_OP(LoadContextIndexed) {
   auto Op = IROp->C<IR::IROp_LoadContextIndexed>();
   size_t size = Op->Size;
@@ -572,8 +761,8 @@ void JITCore::RegisterMemoryHandlers() {
 #define REGISTER_OP(op, x) OpHandlers[FEXCore::IR::IROps::OP_##op] = &JITCore::Op_##x
   REGISTER_OP(LOADCONTEXT,         LoadContext);
   REGISTER_OP(STORECONTEXT,        StoreContext);
-  REGISTER_OP(LOADREGISTER,        Unhandled); // SRA specific, not supported on this backend
-  REGISTER_OP(STOREREGISTER,       Unhandled);
+  REGISTER_OP(LOADREGISTER,        LoadRegister);
+  REGISTER_OP(STOREREGISTER,       StoreRegister);
   REGISTER_OP(LOADCONTEXTINDEXED,  LoadContextIndexed);
   REGISTER_OP(STORECONTEXTINDEXED, StoreContextIndexed);
   REGISTER_OP(SPILLREGISTER,       SpillRegister);
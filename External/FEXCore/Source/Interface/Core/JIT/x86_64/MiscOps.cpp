@@ -33,12 +33,13 @@ DEF_OP(Break) {
     break;
     case 4: { // HLT
       // Time to quit
+      SpillStaticRegs();
+
       // Set our stack to the starting stack location
       mov(rsp, qword [STATE + offsetof(FEXCore::Core::ThreadState, ReturningStackLocation)]);
 
       // Now we need to jump to the thread stop handler
-      mov(TMP1, ThreadStopHandlerAddress);
-      jmp(TMP1);
+      jmp(qword [STATE + offsetof(FEXCore::Core::InternalThreadState, Dispatcher.ThreadStopHandler)]);
       break;
     }
     case 6: // INT3
@@ -49,18 +50,20 @@ DEF_OP(Break) {
           add(rsp, SpillSlots * 16);
         }
         
-        // This jump target needs to be a constant offset here
-        mov(TMP1, ThreadPauseHandlerAddress);
-        jmp(TMP1);
+        // The debugger reads the guest state from the context
+        SpillStaticRegs();
+
+        // The block can be running on any thread, the pause handler is that thread's own
+        jmp(qword [STATE + offsetof(FEXCore::Core::InternalThreadState, Dispatcher.ThreadPauseHandler)]);
       }
       else {
         // If we don't have a gdb server attached then....crash?
         // Treat this case like HLT
+        SpillStaticRegs();
         mov(rsp, qword [STATE + offsetof(FEXCore::Core::ThreadState, ReturningStackLocation)]);
 
         // Now we need to jump to the thread stop handler
-        mov(TMP1, ThreadStopHandlerAddress);
-        jmp(TMP1);
+        jmp(qword [STATE + offsetof(FEXCore::Core::InternalThreadState, Dispatcher.ThreadStopHandler)]);
       }
     break;
     }
@@ -104,6 +107,8 @@ DEF_OP(SetRoundingMode) {
 DEF_OP(Print) {
   auto Op = IROp->C<IR::IROp_Print>();
 
+  SpillStaticRegs();
+
   for (auto &Reg : RA64)
     push(Reg);
 
@@ -122,6 +127,8 @@ DEF_OP(Print) {
 
   for (uint32_t i = RA64.size(); i > 0; --i)
     pop(RA64[i - 1]);
+
+  FillStaticRegs();
 }
 
 #undef DEF_OP
@@ -0,0 +1,356 @@
+#include "Interface/Core/JIT/x86_64/JITClass.h"
+#include "Interface/IR/Passes/RegisterAllocationPass.h"
+
+namespace FEXCore::CPU {
+
+// F80 values live in the lower 80 bits of an XMM register with the upper bits zero
+// They get on and off the host x87 stack through a 16 byte slot at the top of the stack
+// Every op leaves the host x87 stack empty again
+// xbyak only encodes the 32bit and 64bit memory forms of fld and fstp, the 80bit forms are emitted directly
+void JITCore::X87Push(Xbyak::Xmm Src) {
+  movups(ptr[rsp], Src);
+  // fld tword [rsp]
+  db(0xDB); db(0x2C); db(0x24);
+}
+
+void JITCore::X87Pop(Xbyak::Xmm Dst) {
+  // fstp only writes 10 bytes, zero the rest of the slot first
+  mov(qword[rsp + 8], 0);
+  // fstp tword [rsp]
+  db(0xDB); db(0x3C); db(0x24);
+  movups(Dst, ptr[rsp]);
+}
+
+#define DEF_OP(x) void JITCore::Op_##x(FEXCore::IR::IROp_Header *IROp, uint32_t Node)
+DEF_OP(F80LoadFCW) {
+  sub(rsp, 16);
+  movzx(eax, GetSrc<RA_16>(IROp->Args[0].ID()));
+  // Guest x87 exceptions aren't supported, keep them all masked on the host
+  or(eax, 0x3F);
+  mov(word[rsp], ax);
+  fldcw(word[rsp]);
+  add(rsp, 16);
+}
+
+#define X87_BINARY_OP(Name, Inst) \
+DEF_OP(Name) { \
+  sub(rsp, 16); \
+  X87Push(GetSrc(IROp->Args[0].ID())); \
+  X87Push(GetSrc(IROp->Args[1].ID())); \
+  Inst(st1, st0); \
+  X87Pop(GetDst(Node)); \
+  add(rsp, 16); \
+}
+
+// st1 = st1 <op> st0, then pop
+X87_BINARY_OP(F80Add, faddp)
+X87_BINARY_OP(F80Sub, fsubp)
+X87_BINARY_OP(F80Mul, fmulp)
+X87_BINARY_OP(F80Div, fdivp)
+#undef X87_BINARY_OP
+
+#define X87_UNARY_OP(Name, Inst) \
+DEF_OP(Name) { \
+  sub(rsp, 16); \
+  X87Push(GetSrc(IROp->Args[0].ID())); \
+  Inst(); \
+  X87Pop(GetDst(Node)); \
+  add(rsp, 16); \
+}
+
+X87_UNARY_OP(F80Round, frndint)
+X87_UNARY_OP(F80F2XM1, f2xm1)
+X87_UNARY_OP(F80SQRT, fsqrt)
+X87_UNARY_OP(F80SIN, fsin)
+X87_UNARY_OP(F80COS, fcos)
+#undef X87_UNARY_OP
+
+DEF_OP(F80TAN) {
+  sub(rsp, 16);
+  X87Push(GetSrc(IROp->Args[0].ID()));
+  fptan();
+  // fptan pushes a 1.0 on top of the result
+  fstp(st0);
+  X87Pop(GetDst(Node));
+  add(rsp, 16);
+}
+
+DEF_OP(F80ATAN) {
+  // st0 = atan(st1 / st0)
+  sub(rsp, 16);
+  X87Push(GetSrc(IROp->Args[0].ID()));
+  X87Push(GetSrc(IROp->Args[1].ID()));
+  fpatan();
+  X87Pop(GetDst(Node));
+  add(rsp, 16);
+}
+
+DEF_OP(F80FYL2X) {
+  // st0 = st1 * log2(st0)
+  sub(rsp, 16);
+  X87Push(GetSrc(IROp->Args[1].ID()));
+  X87Push(GetSrc(IROp->Args[0].ID()));
+  fyl2x();
+  X87Pop(GetDst(Node));
+  add(rsp, 16);
+}
+
+DEF_OP(F80SCALE) {
+  sub(rsp, 16);
+  X87Push(GetSrc(IROp->Args[1].ID()));
+  X87Push(GetSrc(IROp->Args[0].ID()));
+  fscale();
+  // Drop the scale from under the result
+  fstp(st1);
+  X87Pop(GetDst(Node));
+  add(rsp, 16);
+}
+
+DEF_OP(F80FPREM) {
+  sub(rsp, 16);
+  X87Push(GetSrc(IROp->Args[1].ID()));
+  X87Push(GetSrc(IROp->Args[0].ID()));
+
+  // Partial remainder, C2 stays set until the reduction is complete
+  Label Loop;
+  L(Loop);
+  fprem();
+  fnstsw(ax);
+  test(ah, 4);
+  jnz(Loop);
+
+  fstp(st1);
+  X87Pop(GetDst(Node));
+  add(rsp, 16);
+}
+
+DEF_OP(F80FPREM1) {
+  sub(rsp, 16);
+  X87Push(GetSrc(IROp->Args[1].ID()));
+  X87Push(GetSrc(IROp->Args[0].ID()));
+
+  Label Loop;
+  L(Loop);
+  fprem1();
+  fnstsw(ax);
+  test(ah, 4);
+  jnz(Loop);
+
+  fstp(st1);
+  X87Pop(GetDst(Node));
+  add(rsp, 16);
+}
+
+DEF_OP(F80XTRACT_EXP) {
+  sub(rsp, 16);
+  X87Push(GetSrc(IROp->Args[0].ID()));
+  // st0 = significand, st1 = exponent
+  fxtract();
+  fstp(st0);
+  X87Pop(GetDst(Node));
+  add(rsp, 16);
+}
+
+DEF_OP(F80XTRACT_SIG) {
+  sub(rsp, 16);
+  X87Push(GetSrc(IROp->Args[0].ID()));
+  fxtract();
+  fstp(st1);
+  X87Pop(GetDst(Node));
+  add(rsp, 16);
+}
+
+DEF_OP(F80CVT) {
+  uint8_t OpSize = IROp->Size;
+
+  sub(rsp, 16);
+  X87Push(GetSrc(IROp->Args[0].ID()));
+  switch (OpSize) {
+    case 4: {
+      fstp(dword[rsp]);
+      movss(GetDst(Node), dword[rsp]);
+      break;
+    }
+    case 8: {
+      fstp(qword[rsp]);
+      movsd(GetDst(Node), qword[rsp]);
+      break;
+    }
+    default: LogMan::Msg::A("Unhandled size: %d", OpSize);
+  }
+  add(rsp, 16);
+}
+
+DEF_OP(F80CVTInt) {
+  auto Op = IROp->C<IR::IROp_F80CVTInt>();
+  uint8_t OpSize = IROp->Size;
+
+  sub(rsp, 16);
+  X87Push(GetSrc(Op->Header.Args[0].ID()));
+  switch (OpSize) {
+    case 2: {
+      if (Op->Truncate) {
+        fisttp(word[rsp]);
+      }
+      else {
+        fistp(word[rsp]);
+      }
+      movzx(GetDst<RA_64>(Node), word[rsp]);
+      break;
+    }
+    case 4: {
+      if (Op->Truncate) {
+        fisttp(dword[rsp]);
+      }
+      else {
+        fistp(dword[rsp]);
+      }
+      mov(GetDst<RA_32>(Node), dword[rsp]);
+      break;
+    }
+    case 8: {
+      if (Op->Truncate) {
+        fisttp(qword[rsp]);
+      }
+      else {
+        fistp(qword[rsp]);
+      }
+      mov(GetDst<RA_64>(Node), qword[rsp]);
+      break;
+    }
+    default: LogMan::Msg::A("Unhandled size: %d", OpSize);
+  }
+  add(rsp, 16);
+}
+
+DEF_OP(F80CVTTo) {
+  auto Op = IROp->C<IR::IROp_F80CVTTo>();
+
+  sub(rsp, 16);
+  switch (Op->Size) {
+    case 4: {
+      movss(dword[rsp], GetSrc(Op->Header.Args[0].ID()));
+      fld(dword[rsp]);
+      break;
+    }
+    case 8: {
+      movsd(qword[rsp], GetSrc(Op->Header.Args[0].ID()));
+      fld(qword[rsp]);
+      break;
+    }
+    default: LogMan::Msg::A("Unhandled size: %d", Op->Size);
+  }
+  X87Pop(GetDst(Node));
+  add(rsp, 16);
+}
+
+DEF_OP(F80CVTToInt) {
+  auto Op = IROp->C<IR::IROp_F80CVTToInt>();
+
+  sub(rsp, 16);
+  switch (Op->Size) {
+    case 2: {
+      mov(word[rsp], GetSrc<RA_16>(Op->Header.Args[0].ID()));
+      fild(word[rsp]);
+      break;
+    }
+    case 4: {
+      mov(dword[rsp], GetSrc<RA_32>(Op->Header.Args[0].ID()));
+      fild(dword[rsp]);
+      break;
+    }
+    default: LogMan::Msg::A("Unhandled size: %d", Op->Size);
+  }
+  X87Pop(GetDst(Node));
+  add(rsp, 16);
+}
+
+DEF_OP(F80BCDLoad) {
+  sub(rsp, 16);
+  movups(ptr[rsp], GetSrc(IROp->Args[0].ID()));
+  // fbld tword [rsp]
+  db(0xDF); db(0x24); db(0x24);
+  X87Pop(GetDst(Node));
+  add(rsp, 16);
+}
+
+DEF_OP(F80BCDStore) {
+  sub(rsp, 16);
+  X87Push(GetSrc(IROp->Args[0].ID()));
+  mov(qword[rsp + 8], 0);
+  // fbstp tword [rsp]
+  db(0xDF); db(0x34); db(0x24);
+  movups(GetDst(Node), ptr[rsp]);
+  add(rsp, 16);
+}
+
+DEF_OP(F80Cmp) {
+  auto Op = IROp->C<IR::IROp_F80Cmp>();
+
+  sub(rsp, 16);
+  X87Push(GetSrc(Op->Header.Args[1].ID()));
+  X87Push(GetSrc(Op->Header.Args[0].ID()));
+  // Same flags as ucomisd with st0 on the left
+  fucomip(st0, st1);
+  fstp(st0);
+  // Grab the flags before the stack adjustment overwrites them
+  lahf();
+  add(rsp, 16);
+
+  mov (rdx, 0);
+
+  if (Op->Flags & (1 << IR::FCMP_FLAG_LT)) {
+    sahf();
+    mov(rcx, 0);
+    setb(cl);
+    shl(rcx, IR::FCMP_FLAG_LT);
+    or(rdx, rcx);
+  }
+  if (Op->Flags & (1 << IR::FCMP_FLAG_UNORDERED)) {
+    sahf();
+    mov(rcx, 0);
+    setp(cl);
+    shl(rcx, IR::FCMP_FLAG_UNORDERED);
+    or(rdx, rcx);
+  }
+  if (Op->Flags & (1 << IR::FCMP_FLAG_EQ)) {
+    sahf();
+    mov(rcx, 0);
+    setz(cl);
+    shl(rcx, IR::FCMP_FLAG_EQ);
+    or(rdx, rcx);
+  }
+  mov (GetDst<RA_64>(Node), rdx);
+}
+
+#undef DEF_OP
+void JITCore::RegisterX87Handlers() {
+#define REGISTER_OP(op, x) OpHandlers[FEXCore::IR::IROps::OP_##op] = &JITCore::Op_##x
+  REGISTER_OP(F80LOADFCW,    F80LoadFCW);
+  REGISTER_OP(F80ADD,        F80Add);
+  REGISTER_OP(F80SUB,        F80Sub);
+  REGISTER_OP(F80MUL,        F80Mul);
+  REGISTER_OP(F80DIV,        F80Div);
+  REGISTER_OP(F80ATAN,       F80ATAN);
+  REGISTER_OP(F80FPREM,      F80FPREM);
+  REGISTER_OP(F80FPREM1,     F80FPREM1);
+  REGISTER_OP(F80SCALE,      F80SCALE);
+  REGISTER_OP(F80CVT,        F80CVT);
+  REGISTER_OP(F80CVTINT,     F80CVTInt);
+  REGISTER_OP(F80CVTTO,      F80CVTTo);
+  REGISTER_OP(F80CVTTOINT,   F80CVTToInt);
+  REGISTER_OP(F80ROUND,      F80Round);
+  REGISTER_OP(F80F2XM1,      F80F2XM1);
+  REGISTER_OP(F80FYL2X,      F80FYL2X);
+  REGISTER_OP(F80TAN,        F80TAN);
+  REGISTER_OP(F80SQRT,       F80SQRT);
+  REGISTER_OP(F80SIN,        F80SIN);
+  REGISTER_OP(F80COS,        F80COS);
+  REGISTER_OP(F80XTRACT_EXP, F80XTRACT_EXP);
+  REGISTER_OP(F80XTRACT_SIG, F80XTRACT_SIG);
+  REGISTER_OP(F80CMP,        F80Cmp);
+  REGISTER_OP(F80BCDLOAD,    F80BCDLoad);
+  REGISTER_OP(F80BCDSTORE,   F80BCDStore);
+#undef REGISTER_OP
+}
+}
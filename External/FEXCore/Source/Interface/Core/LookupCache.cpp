@@ -4,69 +4,72 @@
 #include <sys/mman.h>
 
 namespace FEXCore {
-LookupCache::LookupCache(FEXCore::Context::Context *CTX)
-  : ctx {CTX} {
-
-  // Block cache ends up looking like this
-  // PageMemoryMap[VirtualMemoryRegion >> 12]
-  //       |
-  //       v
-  // PageMemory[Memory & (VIRTUAL_PAGE_SIZE - 1)]
-  //       |
-  //       v
-  // Pointer to Code
-  //
-  // Allocate a region of memory that we can use to back our block pointers
-  // We need one pointer per page of virtual memory
-  // At 64GB of virtual memory this will allocate 128MB of virtual memory space
-  PagePointer = reinterpret_cast<uintptr_t>(mmap(nullptr, ctx->Config.VirtualMemSize / 4096 * 8, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0));
-
-  // Allocate our memory backing our pages
-  // We need 32KB per guest page (One pointer per byte)
-  // XXX: We can drop down to 16KB if we store 4byte offsets from the code base
-  // We currently limit to 128MB of real memory for caching for the total cache size.
-  // Can end up being inefficient if we compile a small number of blocks per page
-  PageMemory = reinterpret_cast<uintptr_t>(mmap(nullptr, CODE_SIZE, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0));
-  LogMan::Throw::A(PageMemory != -1ULL, "Failed to allocate page memory");
+LookupCache::LookupCache(FEXCore::CodeCache *Cache, FEXCore::Core::InternalThreadState *Thread)
+  : Cache {Cache}
+  , Thread {Thread} {
 
   // L1 Cache
   L1Pointer = reinterpret_cast<uintptr_t>(mmap(nullptr, L1_SIZE, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0));
   LogMan::Throw::A(L1Pointer != -1ULL, "Failed to allocate L1Pointer");
 
-  VirtualMemSize = ctx->Config.VirtualMemSize;
+  // Nothing logged so far can be in a fresh L1
+  Thread->Dispatcher.L1Pointer = L1Pointer;
+  Thread->Dispatcher.L1EraseCount = Cache->GetEraseCount();
+
+  Cache->Register(this);
 }
 
 LookupCache::~LookupCache() {
-  munmap(reinterpret_cast<void*>(PagePointer), ctx->Config.VirtualMemSize / 4096 * 8);
-  munmap(reinterpret_cast<void*>(PageMemory), CODE_SIZE);
+  Cache->Unregister(this);
   munmap(reinterpret_cast<void*>(L1Pointer), L1_SIZE);
 }
 
-void LookupCache::HintUsedRange(uint64_t Address, uint64_t Size) {
-  // Tell the kernel we will definitely need [Address, Address+Size) mapped for the page pointer
-  // Page Pointer is allocated per page, so shift by page size
-  Address >>= 12;
-  Size >>= 12;
-  madvise(reinterpret_cast<void*>(PagePointer + Address), Size, MADV_WILLNEED);
+void LookupCache::ClearL1() {
+  madvise(reinterpret_cast<void*>(L1Pointer), L1_SIZE, MADV_DONTNEED);
 }
 
-void LookupCache::ClearL2Cache() {
-  // Clear out the page memory
-  madvise(reinterpret_cast<void*>(PagePointer), ctx->Config.VirtualMemSize / 4096 * 8, MADV_DONTNEED);
-  madvise(reinterpret_cast<void*>(PageMemory), CODE_SIZE, MADV_DONTNEED);
-  AllocateOffset = 0;
-}
+void LookupCache::Sync() {
+  auto &Count = Thread->Dispatcher.L1EraseCount;
+  uint64_t Requested = Count & SYNC_REQUESTED;
+  uint64_t Seen = Count & ~SYNC_REQUESTED;
+  uint64_t Target = Cache->GetEraseCount();
 
-void LookupCache::ClearCache() {
-  // Clear L1
-  madvise(reinterpret_cast<void*>(L1Pointer), L1_SIZE, MADV_DONTNEED);
-  // Clear L2
-  ClearL2Cache();
-  // All code is gone, remove links
-  BlockLinks.clear();
-  // All code is gone, clear the block list
-  BlockList.clear();
-}
+  if (Target - Seen > CodeCache::ERASE_LOG_SIZE) {
+    // Too far behind for the log to still hold everything
+    ClearL1();
+  }
+  else {
+    for (uint64_t i = Seen; i != Target; ++i) {
+      uint64_t Address = Cache->GetErasedAddress(i);
+      auto &L1Entry = reinterpret_cast<LookupCacheEntry*>(L1Pointer)[Address & L1_ENTRIES_MASK];
+      if (L1Entry.GuestCode == Address) {
+        L1Entry.GuestCode = 0;
+      }
+    }
 
+    // The log wrapped while it was being read, entries may have been overwritten
+    if (Cache->GetEraseCount() - Seen > CodeCache::ERASE_LOG_SIZE) {
+      ClearL1();
+    }
+  }
+
+  Count = Target | Requested;
 }
 
+void LookupCache::SafePoint(bool CanAcknowledge) {
+  // Read before syncing, every erase from a retirement up to this epoch is then applied to L1 by the ack
+  uint64_t Epoch = Cache->GetEpoch();
+
+  // Guest code writes caught by the SMC handler are invalidated here, on whichever thread gets here first
+  Thread->Dispatcher.L1EraseCount &= ~SYNC_REQUESTED;
+  Thread->CTX->FlushSMCWrites();
+
+  Sync();
+
+  // Under a signal frame or callback this waits for RequestSync once that unwinds
+  if (CanAcknowledge && Active && AckedEpoch != Epoch) {
+    Cache->Acknowledge(this, Epoch);
+    Sync();
+  }
+}
+}
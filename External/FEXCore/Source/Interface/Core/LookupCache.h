@@ -1,212 +1,153 @@
 #pragma once
-#include "Interface/Context/Context.h"
-#include <FEXCore/Utils/LogManager.h>
+#include "Interface/Core/CodeCache.h"
+#include "Interface/Core/InternalThreadState.h"
 
-#include <map>
+#include <algorithm>
+#include <cstdint>
 
 namespace FEXCore {
+/**
+ * @brief A thread's view of the shared CodeCache
+ *
+ * Only the L1 is per thread, everything else goes to the shared cache. The L1 is kept in step with erasures
+ * by applying the shared erase log whenever the thread's dispatcher sees that it has moved.
+ */
 class LookupCache {
 public:
 
-  struct LookupCacheEntry { 
+  struct LookupCacheEntry {
     uintptr_t HostCode;
     uintptr_t GuestCode;
   };
 
-  LookupCache(FEXCore::Context::Context *CTX);
+  LookupCache(FEXCore::CodeCache *Cache, FEXCore::Core::InternalThreadState *Thread);
   ~LookupCache();
 
-  using LookupCacheIter = uintptr_t;
-  uintptr_t End() { return 0; }
-
   uintptr_t FindBlock(uint64_t Address) {
-    auto HostCode = FindCodePointerForAddress(Address);
-    if (HostCode) {
-      return HostCode;
-    } else {
-      auto HostCode = BlockList.find(Address);
-
-      if (HostCode != BlockList.end()) {
-        CacheBlockMapping(Address, HostCode->second);
-        return HostCode->second;
-      } else {
-        return 0;
-      }
-    }
-  }
-
-  void AddBlockMapping(uint64_t Address, void *HostCode) { 
-    auto InsertPoint = BlockList.emplace(Address, (uintptr_t)HostCode);
-    LogMan::Throw::A(InsertPoint.second == true, "Dupplicate block mapping added");
-
-    // no need to update L1 or L2, they will get updated on first lookup
-  }
-
-  void Erase(uint64_t Address) {
-
-    // Sever any links to this block
-    auto lower = BlockLinks.lower_bound({Address, 0});
-    auto upper = BlockLinks.upper_bound({Address, UINTPTR_MAX});
-    for (auto it = lower; it != upper; it = BlockLinks.erase(it)) {
-      it->second();
-    }
-
-    // Remove from BlockList
-    BlockList.erase(Address);
-
     // Do L1
     auto &L1Entry = reinterpret_cast<LookupCacheEntry*>(L1Pointer)[Address & L1_ENTRIES_MASK];
     if (L1Entry.GuestCode == Address) {
-      L1Entry.GuestCode = L1Entry.HostCode = 0;
+      return L1Entry.HostCode;
     }
 
-    // Do full map
-    Address = Address & (VirtualMemSize -1);
-    uint64_t PageOffset = Address & (0x0FFF);
-    Address >>= 12;
-
-    uintptr_t *Pointers = reinterpret_cast<uintptr_t*>(PagePointer);
-    uint64_t LocalPagePointer = Pointers[Address];
-    if (!LocalPagePointer) {
-      // Page for this code didn't even exist, nothing to do
-      return;
+    auto HostCode = Cache->FindBlock(Address);
+    if (HostCode) {
+      // Host code first, a signal landing in between must not see the new guest address with the old code
+      L1Entry.HostCode = HostCode;
+      __atomic_store_n(&L1Entry.GuestCode, Address, __ATOMIC_RELEASE);
     }
-
-    // Page exists, just set the offset to zero
-    auto BlockPointers = reinterpret_cast<LookupCacheEntry*>(LocalPagePointer);
-    BlockPointers[PageOffset].GuestCode = 0;
-    BlockPointers[PageOffset].HostCode = 0;
+    return HostCode;
   }
 
-
-  void AddBlockLink(uint64_t GuestDestination, uintptr_t HostLink, const std::function<void()> &delinker) {
-    BlockLinks.insert({{GuestDestination, HostLink}, delinker});
+  /**
+   * @return The block mapped to the address afterwards, 0 if HostCode is already retired
+   */
+  uintptr_t AddBlockMapping(uint64_t Address, void *HostCode) {
+    return Cache->AddBlockMapping(Address, reinterpret_cast<uintptr_t>(HostCode));
   }
 
-  void ClearCache();
-  void ClearL2Cache();
-
-  void HintUsedRange(uint64_t Address, uint64_t Size);
-
-  uintptr_t GetL1Pointer() { return L1Pointer; }
-  uintptr_t GetPagePointer() { return PagePointer; }
-  uintptr_t GetVirtualMemorySize() const { return VirtualMemSize; }
-
-  constexpr static size_t L1_ENTRIES = 1 * 1024 * 1024; // Must be a power of 2
-  constexpr static size_t L1_ENTRIES_MASK = L1_ENTRIES - 1;
+  void Erase(uint64_t Address) {
+    Cache->Erase(Address);
+  }
 
-private:
-  void CacheBlockMapping(uint64_t Address, uintptr_t HostCode) { 
-    // Do L1
-    auto &L1Entry = reinterpret_cast<LookupCacheEntry*>(L1Pointer)[Address & L1_ENTRIES_MASK];
-    if (L1Entry.GuestCode == Address) {
-      L1Entry.GuestCode = L1Entry.HostCode = 0;
-    }
+  bool AddBlockLink(uint64_t GuestDestination, uintptr_t HostCode, uintptr_t HostLink, uintptr_t LinkerAddress,
+                    CodeCache::BlockLinkerFunc Linker, CodeCache::BlockDelinkerFunc Delinker) {
+    return Cache->AddBlockLink(GuestDestination, HostCode, HostLink, LinkerAddress, Linker, Delinker);
+  }
 
-    // Do ful map
-    auto FullAddress = Address;
-    Address = Address & (VirtualMemSize -1);
-
-    uint64_t PageOffset = Address & (0x0FFF);
-    Address >>= 12;
-    uintptr_t *Pointers = reinterpret_cast<uintptr_t*>(PagePointer);
-    uint64_t LocalPagePointer = Pointers[Address];
-    if (!LocalPagePointer) {
-      // We don't have a page pointer for this address
-      // Allocate one now if we can
-      uintptr_t NewPageBacking = AllocateBackingForPage();
-      if (!NewPageBacking) {
-        // Couldn't allocate, clear L2 and retry
-        ClearL2Cache();
-        CacheBlockMapping(Address, HostCode);
-        return;
-      }
-      Pointers[Address] = NewPageBacking;
-      LocalPagePointer = NewPageBacking;
-    }
+  /**
+   * @brief Whether erasures have been logged that this thread's L1 hasn't seen, or a sync was requested
+   */
+  bool NeedsSync() const {
+    return Thread->Dispatcher.L1EraseCount != Cache->GetEraseCount();
+  }
 
-    // Add the new pointer to the page block
-    auto BlockPointers = reinterpret_cast<LookupCacheEntry*>(LocalPagePointer);
+  /**
+   * @brief Applies the erase log to L1
+   *
+   * A pending RequestSync is kept, only SafePoint handles it
+   */
+  void Sync();
+
+  /**
+   * @brief Sends the thread through SafePoint the next time its dispatcher checks NeedsSync
+   *
+   * Safe to call from a signal handler on the owning thread, as long as it interrupted guest code
+   */
+  void RequestSync() {
+    Thread->Dispatcher.L1EraseCount |= SYNC_REQUESTED;
+  }
 
-    // This silently replaces existing mappings
-    BlockPointers[PageOffset].GuestCode = FullAddress;
-    BlockPointers[PageOffset].HostCode = HostCode;
+  /**
+   * @brief Syncs and acknowledges any retirement if the thread can't be holding on to retired code
+   *
+   * @param CanAcknowledge False while host frames from guest code are still on the stack, like in a signal handler
+   */
+  void SafePoint(bool CanAcknowledge);
+
+  /**
+   * @brief While blocked in a syscall the thread only holds on to HeldCode, 0 once it is back
+   *
+   * Retired code that doesn't contain HeldCode is then reused without waiting for the thread
+   */
+  void SetHeldCode(uintptr_t HeldCode) {
+    __atomic_store_n(&Thread->Dispatcher.HeldCode, HeldCode, __ATOMIC_RELEASE);
   }
 
-  uintptr_t AllocateBackingForPage() {
-    uintptr_t NewBase = AllocateOffset;
-    uintptr_t NewEnd = AllocateOffset + SIZE_PER_PAGE;
+  /**
+   * @brief Marks whether the thread can run code, inactive threads don't hold back reuse
+   */
+  void SetActive(bool Active) {
+    Cache->SetActive(this, Active);
+  }
 
-    if (NewEnd >= CODE_SIZE) {
-      // We ran out of block backing space. Need to clear the block cache and tell the JIT cores to clear their caches as well
-      // Tell whatever is calling this that it needs to do it.
-      return 0;
-    }
+  /**
+   * @brief Gets memory to emit at least MinSize bytes of code in to
+   *
+   * Only the owning thread emits in to it, CommitCode moves past what was used
+   *
+   * @param CanAcknowledge False while host frames from guest code are still on the stack, like in a signal handler
+   */
+  CodeCache::CodeChunk ReserveCode(size_t MinSize, bool CanAcknowledge) {
+    return Cache->ReserveCode(this, MinSize, CanAcknowledge);
+  }
 
-    AllocateOffset = NewEnd;
-    return PageMemory + NewBase;
+  void CommitCode(size_t Size) {
+    // Keep every block aligned
+    ChunkPtr = std::min(ChunkPtr + ((Size + 15) & ~size_t(15)), ChunkEnd);
   }
 
-  uintptr_t FindCodePointerForAddress(uint64_t Address) {
-    
-    // Do L1
-    auto &L1Entry = reinterpret_cast<LookupCacheEntry*>(L1Pointer)[Address & L1_ENTRIES_MASK];
-    if (L1Entry.GuestCode == Address) {
-      return L1Entry.HostCode;
-    }
+  FEXCore::CodeCache *GetCodeCache() { return Cache; }
+  uintptr_t GetL1Pointer() const { return L1Pointer; }
+  uintptr_t GetRootPointer() const { return Cache->GetRootPointer(); }
+  uintptr_t GetHostCodeBase() const { return Cache->GetHostCodeBase(); }
 
-    auto FullAddress = Address;
-    Address = Address & (VirtualMemSize -1);
+  constexpr static size_t L1_ENTRIES = 1 * 1024 * 1024; // Must be a power of 2
+  constexpr static size_t L1_ENTRIES_MASK = L1_ENTRIES - 1;
 
-    uint64_t PageOffset = Address & (0x0FFF);
-    Address >>= 12;
-    uintptr_t *Pointers = reinterpret_cast<uintptr_t*>(PagePointer);
-    uint64_t LocalPagePointer = Pointers[Address];
-    if (!LocalPagePointer) {
-      // We don't have a page pointer for this address
-      return 0;
-    }
+private:
+  friend class CodeCache;
 
-    // Find there pointer for the address in the blocks
-    auto BlockPointers = reinterpret_cast<LookupCacheEntry*>(LocalPagePointer);
+  void ClearL1();
 
-    if (BlockPointers[PageOffset].GuestCode == FullAddress)
-    {
-      L1Entry.GuestCode = FullAddress;
-      return L1Entry.HostCode = BlockPointers[PageOffset].HostCode;
-    }
-    else
-      return 0;
+  uintptr_t GetHeldCode() const {
+    return __atomic_load_n(&Thread->Dispatcher.HeldCode, __ATOMIC_ACQUIRE);
   }
 
-  uintptr_t PagePointer;
-  uintptr_t PageMemory;
+  FEXCore::CodeCache *Cache;
+  FEXCore::Core::InternalThreadState *Thread;
   uintptr_t L1Pointer;
 
-  struct BlockLinkTag {
-    uint64_t GuestDestination;
-    uintptr_t HostLink;
-
-    bool operator <(const BlockLinkTag& other) const {
-      if (GuestDestination < other.GuestDestination)
-        return true;
-      else if (GuestDestination == other.GuestDestination)
-        return HostLink < other.HostLink;
-      else
-        return false;
-    }
-  };
-
-  std::map<BlockLinkTag, std::function<void()>> BlockLinks;
-  std::map<uint64_t, uint64_t> BlockList;
+  // Owned by the CodeCache and only changed with its lock held
+  uint64_t AckedEpoch{};
+  bool Active{};
+  uint8_t *ChunkPtr{};
+  uint8_t *ChunkEnd{};
+  size_t ChunkGeneration{};
+  uint64_t ChunkIncarnation{};
 
-  constexpr static size_t CODE_SIZE = 128 * 1024 * 1024;
-  constexpr static size_t SIZE_PER_PAGE = 4096 * sizeof(LookupCacheEntry);
   constexpr static size_t L1_SIZE = L1_ENTRIES * sizeof(LookupCacheEntry);
-
-  size_t AllocateOffset {};
-
-  FEXCore::Context::Context *ctx;
-  uint64_t VirtualMemSize{};
+  // Set in L1EraseCount so it can't match the shared count, which never gets anywhere near it
+  constexpr static uint64_t SYNC_REQUESTED = 1ULL << 63;
 };
 }
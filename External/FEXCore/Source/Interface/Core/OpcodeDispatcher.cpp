@@ -4801,6 +4801,7 @@ OpDispatchBuilder::OpDispatchBuilder(FEXCore::Context::Context *ctx)
 void OpDispatchBuilder::ResetWorkingList() {
   IREmitter::ResetWorkingList();
   JumpTargets.clear();
+  DeferredFlags.Type = DEFERRED_FLAGS_NONE;
   BlockSetRIP = false;
   DecodeFailure = false;
   ShouldDump = false;
@@ -4809,18 +4810,63 @@ void OpDispatchBuilder::ResetWorkingList() {
 
 template<unsigned BitOffset>
 void OpDispatchBuilder::SetRFLAG(OrderedNode *Value) {
+  CalculateDeferredFlags();
   flagsOp = FLAGS_OP_NONE;
   _StoreFlag(_Bfe(1, 0, Value), BitOffset);
 }
 void OpDispatchBuilder::SetRFLAG(OrderedNode *Value, unsigned BitOffset) {
+  CalculateDeferredFlags();
   flagsOp = FLAGS_OP_NONE;
   _StoreFlag(_Bfe(1, 0, Value), BitOffset);
 }
 
 OrderedNode *OpDispatchBuilder::GetRFLAG(unsigned BitOffset) {
+  CalculateDeferredFlags();
   return _LoadFlag(BitOffset);
 }
 
+bool OpDispatchBuilder::DeferFlags(DeferredFlagsType Type, FEXCore::X86Tables::DecodedOp Op, OrderedNode *Res, OrderedNode *Src1, OrderedNode *Src2, bool UpdateCF) {
+  if (!CTX->Config.LazyFlags || CalculatingDeferredFlags) {
+    return false;
+  }
+
+  if (!UpdateCF) {
+    // CF carries over from whatever set it last
+    CalculateDeferredFlags();
+  }
+
+  // These replace every flag the previous deferred op would have set
+  DeferredFlags = {Type, Op, Res, Src1, Src2, UpdateCF};
+
+  // Same as SetRFLAG, the caller sets this back up for CMP and TEST
+  flagsOp = FLAGS_OP_NONE;
+  return true;
+}
+
+void OpDispatchBuilder::CalculateDeferredFlags() {
+  if (DeferredFlags.Type == DEFERRED_FLAGS_NONE) {
+    return;
+  }
+
+  auto Flags = DeferredFlags;
+  DeferredFlags.Type = DEFERRED_FLAGS_NONE;
+
+  CalculatingDeferredFlags = true;
+  switch (Flags.Type) {
+    case DEFERRED_FLAGS_ADD:
+      GenerateFlags_ADD(Flags.Op, Flags.Res, Flags.Src1, Flags.Src2, Flags.UpdateCF);
+      break;
+    case DEFERRED_FLAGS_SUB:
+      GenerateFlags_SUB(Flags.Op, Flags.Res, Flags.Src1, Flags.Src2, Flags.UpdateCF);
+      break;
+    case DEFERRED_FLAGS_LOGICAL:
+      GenerateFlags_Logical(Flags.Op, Flags.Res, Flags.Src1, Flags.Src2);
+      break;
+    default: LogMan::Msg::A("Unknown deferred flags type: %d", Flags.Type); break;
+  }
+  CalculatingDeferredFlags = false;
+}
+
 constexpr std::array<uint32_t, 17> FlagOffsets = {
   FEXCore::X86State::RFLAG_CF_LOC,
   FEXCore::X86State::RFLAG_PF_LOC,
@@ -4854,6 +4900,8 @@ void OpDispatchBuilder::SetPackedRFLAG(bool Lower8, OrderedNode *Src) {
 }
 
 OrderedNode *OpDispatchBuilder::GetPackedRFLAG(bool Lower8) {
+  CalculateDeferredFlags();
+
   OrderedNode *Original = _Constant(2);
   uint8_t NumFlags = FlagOffsets.size();
   if (Lower8) {
@@ -5008,6 +5056,10 @@ void OpDispatchBuilder::GenerateFlags_SBB(FEXCore::X86Tables::DecodedOp Op, Orde
 }
 
 void OpDispatchBuilder::GenerateFlags_SUB(FEXCore::X86Tables::DecodedOp Op, OrderedNode *Res, OrderedNode *Src1, OrderedNode *Src2, bool UpdateCF) {
+  if (DeferFlags(DEFERRED_FLAGS_SUB, Op, Res, Src1, Src2, UpdateCF)) {
+    return;
+  }
+
   // AF
   {
     OrderedNode *AFRes = _Xor(_Xor(Src1, Src2), Res);
@@ -5065,6 +5117,10 @@ void OpDispatchBuilder::GenerateFlags_SUB(FEXCore::X86Tables::DecodedOp Op, Orde
 }
 
 void OpDispatchBuilder::GenerateFlags_ADD(FEXCore::X86Tables::DecodedOp Op, OrderedNode *Res, OrderedNode *Src1, OrderedNode *Src2, bool UpdateCF) {
+  if (DeferFlags(DEFERRED_FLAGS_ADD, Op, Res, Src1, Src2, UpdateCF)) {
+    return;
+  }
+
   // AF
   {
     OrderedNode *AFRes = _Xor(_Xor(Src1, Src2), Res);
@@ -5177,6 +5233,10 @@ void OpDispatchBuilder::GenerateFlags_UMUL(FEXCore::X86Tables::DecodedOp Op, Ord
 }
 
 void OpDispatchBuilder::GenerateFlags_Logical(FEXCore::X86Tables::DecodedOp Op, OrderedNode *Res, OrderedNode *Src1, OrderedNode *Src2) {
+  if (DeferFlags(DEFERRED_FLAGS_LOGICAL, Op, Res, Src1, Src2, true)) {
+    return;
+  }
+
   // AF
   {
     // Undefined
@@ -6286,6 +6346,26 @@ void OpDispatchBuilder::VFCMPOp(OpcodeArgs) {
   StoreResult(FPRClass, Op, Result, -1);
 }
 
+// Converts the bits of an 80bit float constant to the bits of the nearest double
+// Only zero and normal numbers in the double range are handled, which covers the x87 constants
+static constexpr uint64_t X87ConstToDouble(uint64_t Mantissa, uint32_t SignExponent) {
+  uint64_t Sign = static_cast<uint64_t>((SignExponent >> 15) & 1) << 63;
+  if (Mantissa == 0) {
+    return Sign;
+  }
+
+  uint64_t Exponent = (SignExponent & 0x7FFF) - 0x3FFF + 0x3FF;
+  // The explicit integer bit doesn't exist in a double
+  uint64_t Result = Sign | (Exponent << 52) | ((Mantissa & ~(1ULL << 63)) >> 11);
+
+  // Round to nearest even, a carry out of the fraction bumps the exponent as it should
+  uint64_t Remainder = Mantissa & 0x7FF;
+  if (Remainder > 0x400 || (Remainder == 0x400 && (Result & 1))) {
+    ++Result;
+  }
+  return Result;
+}
+
 OrderedNode *OpDispatchBuilder::GetX87Top() {
   // Yes, we are storing 3 bits in a single flag register.
   // Deal with it
@@ -6296,6 +6376,51 @@ void OpDispatchBuilder::SetX87Top(OrderedNode *Value) {
   _StoreContext(GPRClass, 1, offsetof(FEXCore::Core::CPUState, flags) + FEXCore::X86State::X87FLAG_TOP_LOC, Value);
 }
 
+// With X87ReducedPrecision the stack holds 64bit doubles in the lower half of each MM register
+// Ops without a double implementation go through these to work on 80bit floats
+OrderedNode *OpDispatchBuilder::LoadX87StackF80(OrderedNode *Index) {
+  OrderedNode *Value = _LoadContextIndexed(Index, 16, offsetof(FEXCore::Core::CPUState, mm[0][0]), 16, FPRClass);
+  if (CTX->Config.X87ReducedPrecision) {
+    Value = _F80CVTTo(Value, 8);
+  }
+  return Value;
+}
+
+void OpDispatchBuilder::StoreX87StackF80(OrderedNode *Index, OrderedNode *Value) {
+  if (CTX->Config.X87ReducedPrecision) {
+    Value = _F80CVT(Value, 8);
+  }
+  _StoreContextIndexed(Value, Index, 16, offsetof(FEXCore::Core::CPUState, mm[0][0]), 16, FPRClass);
+}
+
+OrderedNode *OpDispatchBuilder::X87Compare(OrderedNode *LHS, OrderedNode *RHS, uint32_t Flags) {
+  if (CTX->Config.X87ReducedPrecision) {
+    return _FCmp(LHS, RHS, 8, Flags);
+  }
+  return _F80Cmp(LHS, RHS, Flags);
+}
+
+OrderedNode *OpDispatchBuilder::X87ConvertToStack(OrderedNode *Src, size_t Size, bool Integer) {
+  if (!CTX->Config.X87ReducedPrecision) {
+    if (Integer) {
+      return _F80CVTToInt(Src, Size);
+    }
+    return _F80CVTTo(Src, Size);
+  }
+
+  if (Integer) {
+    if (Size != 8) {
+      Src = _Sext(Size * 8, Src);
+    }
+    return _Float_FromGPR_S(8, 8, Src);
+  }
+
+  if (Size == 4) {
+    return _Float_FToF(8, 4, Src);
+  }
+  return Src;
+}
+
 template<size_t width>
 void OpDispatchBuilder::FLD(OpcodeArgs) {
 
@@ -6319,9 +6444,12 @@ void OpDispatchBuilder::FLD(OpcodeArgs) {
   }
   OrderedNode *converted = data;
 
-  // Convert to 80bit float
+  // Convert to the stack format
   if (width == 32 || width == 64) {
-      converted = _F80CVTTo(data, width / 8);
+    converted = X87ConvertToStack(data, width / 8, false);
+  }
+  else if (Op->Src[0].TypeNone.Type != 0 && CTX->Config.X87ReducedPrecision) {
+    converted = _F80CVT(data, 8);
   }
 
   auto top = _And(_Sub(orig_top, _Constant(1)), mask);
@@ -6342,13 +6470,13 @@ void OpDispatchBuilder::FBLD(OpcodeArgs) {
   // Read from memory
   OrderedNode *data = LoadSource_WithOpSize(FPRClass, Op, Op->Src[0], 16, Op->Flags, -1);
   OrderedNode *converted = _F80BCDLoad(data);
-  _StoreContextIndexed(converted, top, 16, offsetof(FEXCore::Core::CPUState, mm[0][0]), 16, FPRClass);
+  StoreX87StackF80(top, converted);
 }
 
 void OpDispatchBuilder::FBSTP(OpcodeArgs) {
 
   auto orig_top = GetX87Top();
-  auto data = _LoadContextIndexed(orig_top, 16, offsetof(FEXCore::Core::CPUState, mm[0][0]), 16, FPRClass);
+  auto data = LoadX87StackF80(orig_top);
 
   OrderedNode *converted = _F80BCDStore(data);
 
@@ -6365,10 +6493,16 @@ void OpDispatchBuilder::FLD_Const(OpcodeArgs) {
   auto top = _And(_Sub(orig_top, _Constant(1)), _Constant(7));
   SetX87Top(top);
 
-  auto low = _Constant(Lower);
-  auto high = _Constant(Upper);
-  OrderedNode *data = _VCastFromGPR(16, 8, low);
-  data = _VInsGPR(16, 8, data, high, 1);
+  OrderedNode *data{};
+  if (CTX->Config.X87ReducedPrecision) {
+    data = _VCastFromGPR(16, 8, _Constant(X87ConstToDouble(Lower, Upper)));
+  }
+  else {
+    auto low = _Constant(Lower);
+    auto high = _Constant(Upper);
+    data = _VCastFromGPR(16, 8, low);
+    data = _VInsGPR(16, 8, data, high, 1);
+  }
   // Write to ST[TOP]
   _StoreContextIndexed(data, top, 16, offsetof(FEXCore::Core::CPUState, mm[0][0]), 16, FPRClass);
 }
@@ -6391,6 +6525,12 @@ void OpDispatchBuilder::FILD(OpcodeArgs) {
   if (read_width != 8)
     data = _Sext(read_width * 8, data);
 
+  if (CTX->Config.X87ReducedPrecision) {
+    // Write to ST[TOP]
+    _StoreContextIndexed(_Float_FromGPR_S(8, 8, data), top, 16, offsetof(FEXCore::Core::CPUState, mm[0][0]), 16, FPRClass);
+    return;
+  }
+
   // Extract sign and make interger absolute
   auto sign = _Select(COND_SLT, data, zero, _Constant(0x8000), zero);
   auto absolute =  _Select(COND_SLT, data, zero, _Sub(zero, data), data);
@@ -6416,7 +6556,17 @@ void OpDispatchBuilder::FST(OpcodeArgs) {
 
   auto orig_top = GetX87Top();
   auto data = _LoadContextIndexed(orig_top, 16, offsetof(FEXCore::Core::CPUState, mm[0][0]), 16, FPRClass);
-  if (width == 80) {
+  if (CTX->Config.X87ReducedPrecision) {
+    OrderedNode *result = data;
+    if (width == 80) {
+      result = _F80CVTTo(data, 8);
+    }
+    else if (width == 32) {
+      result = _Float_FToF(4, 8, data);
+    }
+    StoreResult_WithOpSize(FPRClass, Op, Op->Dest, result, width == 80 ? 10 : width / 8, 1);
+  }
+  else if (width == 80) {
     StoreResult_WithOpSize(FPRClass, Op, Op->Dest, data, 10, 1);
   }
   else if (width == 32 || width == 64) {
@@ -6437,7 +6587,25 @@ void OpDispatchBuilder::FIST(OpcodeArgs) {
 
   auto orig_top = GetX87Top();
   OrderedNode *data = _LoadContextIndexed(orig_top, 16, offsetof(FEXCore::Core::CPUState, mm[0][0]), 16, FPRClass);
-  data = _F80CVTInt(data, Truncate, Size);
+  if (CTX->Config.X87ReducedPrecision) {
+    // Out of range values don't saturate to the x87 integer indefinite at the smaller sizes
+    if (Truncate) {
+      data = _Float_ToGPR_ZS(data, 8);
+    }
+    else {
+      // The conversion rounds with the host's SSE rounding mode, borrow it for the FCW's rounding control
+      // Both encode RC the same way, flush to zero is left as it is
+      auto SSERoundingMode = _GetRoundingMode();
+      auto FCW = _LoadContext(2, offsetof(FEXCore::Core::CPUState, FCW), GPRClass);
+      auto X87RoundingMode = _Bfi(4, 2, 0, SSERoundingMode, _Bfe(4, 2, 10, FCW));
+      _SetRoundingMode(X87RoundingMode);
+      data = _Float_ToGPR_S(data, 8);
+      _SetRoundingMode(SSERoundingMode);
+    }
+  }
+  else {
+    data = _F80CVTInt(data, Truncate, Size);
+  }
 
   StoreResult_WithOpSize(GPRClass, Op, Op->Dest, data, Size, 1);
 
@@ -6463,12 +6631,11 @@ void OpDispatchBuilder::FADD(OpcodeArgs) {
     if (width == 16 || width == 32 || width == 64) {
       if (Integer) {
         arg = LoadSource(GPRClass, Op, Op->Src[0], Op->Flags, -1);
-        b = _F80CVTToInt(arg, width / 8);
       }
       else {
         arg = LoadSource(FPRClass, Op, Op->Src[0], Op->Flags, -1);
-        b = _F80CVTTo(arg, width / 8);
       }
+      b = X87ConvertToStack(arg, width / 8, Integer);
     }
   } else {
     // Implicit arg
@@ -6481,7 +6648,13 @@ void OpDispatchBuilder::FADD(OpcodeArgs) {
   }
 
   auto a = _LoadContextIndexed(top, 16, offsetof(FEXCore::Core::CPUState, mm[0][0]), 16, FPRClass);
-  auto result = _F80Add(a, b);
+  OrderedNode *result{};
+  if (CTX->Config.X87ReducedPrecision) {
+    result = _VFAdd(a, b, 8, 8);
+  }
+  else {
+    result = _F80Add(a, b);
+  }
 
   if ((Op->TableInfo->Flags & X86Tables::InstFlags::FLAGS_POP) != 0) {
     top = _And(_Add(top, _Constant(1)), mask);
@@ -6508,12 +6681,11 @@ void OpDispatchBuilder::FMUL(OpcodeArgs) {
     if (width == 16 || width == 32 || width == 64) {
       if (Integer) {
         arg = LoadSource(GPRClass, Op, Op->Src[0], Op->Flags, -1);
-        b = _F80CVTToInt(arg, width / 8);
       }
       else {
         arg = LoadSource(FPRClass, Op, Op->Src[0], Op->Flags, -1);
-        b = _F80CVTTo(arg, width / 8);
       }
+      b = X87ConvertToStack(arg, width / 8, Integer);
     }
   } else {
     // Implicit arg
@@ -6528,7 +6700,13 @@ void OpDispatchBuilder::FMUL(OpcodeArgs) {
 
   auto a = _LoadContextIndexed(top, 16, offsetof(FEXCore::Core::CPUState, mm[0][0]), 16, FPRClass);
 
-  auto result = _F80Mul(a, b);
+  OrderedNode *result{};
+  if (CTX->Config.X87ReducedPrecision) {
+    result = _VFMul(a, b, 8, 8);
+  }
+  else {
+    result = _F80Mul(a, b);
+  }
 
   if ((Op->TableInfo->Flags & X86Tables::InstFlags::FLAGS_POP) != 0) {
     top = _And(_Add(top, _Constant(1)), mask);
@@ -6555,12 +6733,11 @@ void OpDispatchBuilder::FDIV(OpcodeArgs) {
     if (width == 16 || width == 32 || width == 64) {
       if (Integer) {
         arg = LoadSource(GPRClass, Op, Op->Src[0], Op->Flags, -1);
-        b = _F80CVTToInt(arg, width / 8);
       }
       else {
         arg = LoadSource(FPRClass, Op, Op->Src[0], Op->Flags, -1);
-        b = _F80CVTTo(arg, width / 8);
       }
+      b = X87ConvertToStack(arg, width / 8, Integer);
     }
   } else {
     // Implicit arg
@@ -6576,7 +6753,15 @@ void OpDispatchBuilder::FDIV(OpcodeArgs) {
   auto a = _LoadContextIndexed(top, 16, offsetof(FEXCore::Core::CPUState, mm[0][0]), 16, FPRClass);
 
   OrderedNode *result{};
-  if (reverse) {
+  if (CTX->Config.X87ReducedPrecision) {
+    if (reverse) {
+      result = _VFDiv(b, a, 8, 8);
+    }
+    else {
+      result = _VFDiv(a, b, 8, 8);
+    }
+  }
+  else if (reverse) {
     result = _F80Div(b, a);
   }
   else {
@@ -6608,12 +6793,11 @@ void OpDispatchBuilder::FSUB(OpcodeArgs) {
     if (width == 16 || width == 32 || width == 64) {
       if (Integer) {
         arg = LoadSource(GPRClass, Op, Op->Src[0], Op->Flags, -1);
-        b = _F80CVTToInt(arg, width / 8);
       }
       else {
         arg = LoadSource(FPRClass, Op, Op->Src[0], Op->Flags, -1);
-        b = _F80CVTTo(arg, width / 8);
       }
+      b = X87ConvertToStack(arg, width / 8, Integer);
     }
   } else {
     // Implicit arg
@@ -6628,7 +6812,15 @@ void OpDispatchBuilder::FSUB(OpcodeArgs) {
   auto a = _LoadContextIndexed(top, 16, offsetof(FEXCore::Core::CPUState, mm[0][0]), 16, FPRClass);
 
   OrderedNode *result{};
-  if (reverse) {
+  if (CTX->Config.X87ReducedPrecision) {
+    if (reverse) {
+      result = _VFSub(b, a, 8, 8);
+    }
+    else {
+      result = _VFSub(a, b, 8, 8);
+    }
+  }
+  else if (reverse) {
     result = _F80Sub(b, a);
   }
   else {
@@ -6649,10 +6841,16 @@ void OpDispatchBuilder::FCHS(OpcodeArgs) {
   auto top = GetX87Top();
   auto a = _LoadContextIndexed(top, 16, offsetof(FEXCore::Core::CPUState, mm[0][0]), 16, FPRClass);
 
-  auto low = _Constant(0);
-  auto high = _Constant(0b1'000'0000'0000'0000);
-  OrderedNode *data = _VCastFromGPR(16, 8, low);
-  data = _VInsGPR(16, 8, data, high, 1);
+  OrderedNode *data{};
+  if (CTX->Config.X87ReducedPrecision) {
+    data = _VCastFromGPR(16, 8, _Constant(0x8000'0000'0000'0000));
+  }
+  else {
+    auto low = _Constant(0);
+    auto high = _Constant(0b1'000'0000'0000'0000);
+    data = _VCastFromGPR(16, 8, low);
+    data = _VInsGPR(16, 8, data, high, 1);
+  }
 
   auto result = _VXor(a, data, 16, 1);
 
@@ -6665,10 +6863,16 @@ void OpDispatchBuilder::FABS(OpcodeArgs) {
   auto top = GetX87Top();
   auto a = _LoadContextIndexed(top, 16, offsetof(FEXCore::Core::CPUState, mm[0][0]), 16, FPRClass);
 
-  auto low = _Constant(~0ULL);
-  auto high = _Constant(0b0'111'1111'1111'1111);
-  OrderedNode *data = _VCastFromGPR(16, 8, low);
-  data = _VInsGPR(16, 8, data, high, 1);
+  OrderedNode *data{};
+  if (CTX->Config.X87ReducedPrecision) {
+    data = _VCastFromGPR(16, 8, _Constant(0x7FFF'FFFF'FFFF'FFFF));
+  }
+  else {
+    auto low = _Constant(~0ULL);
+    auto high = _Constant(0b0'111'1111'1111'1111);
+    data = _VCastFromGPR(16, 8, low);
+    data = _VInsGPR(16, 8, data, high, 1);
+  }
 
   auto result = _VAnd(a, data, 16, 1);
 
@@ -6681,10 +6885,11 @@ void OpDispatchBuilder::FTST(OpcodeArgs) {
   auto top = GetX87Top();
   auto a = _LoadContextIndexed(top, 16, offsetof(FEXCore::Core::CPUState, mm[0][0]), 16, FPRClass);
 
+  // Zero is all zero bits in both stack formats
   auto low = _Constant(0);
   OrderedNode *data = _VCastFromGPR(16, 8, low);
 
-  OrderedNode *Res = _F80Cmp(a, data,
+  OrderedNode *Res = X87Compare(a, data,
     (1 << FCMP_FLAG_EQ) |
     (1 << FCMP_FLAG_LT) |
     (1 << FCMP_FLAG_UNORDERED));
@@ -6704,12 +6909,12 @@ void OpDispatchBuilder::FTST(OpcodeArgs) {
 void OpDispatchBuilder::FRNDINT(OpcodeArgs) {
 
   auto top = GetX87Top();
-  auto a = _LoadContextIndexed(top, 16, offsetof(FEXCore::Core::CPUState, mm[0][0]), 16, FPRClass);
+  auto a = LoadX87StackF80(top);
 
   auto result = _F80Round(a);
 
   // Write to ST[TOP]
-  _StoreContextIndexed(result, top, 16, offsetof(FEXCore::Core::CPUState, mm[0][0]), 16, FPRClass);
+  StoreX87StackF80(top, result);
 }
 
 void OpDispatchBuilder::FXTRACT(OpcodeArgs) {
@@ -6718,14 +6923,14 @@ void OpDispatchBuilder::FXTRACT(OpcodeArgs) {
   auto top = _And(_Sub(orig_top, _Constant(1)), _Constant(7));
   SetX87Top(top);
 
-  auto a = _LoadContextIndexed(orig_top, 16, offsetof(FEXCore::Core::CPUState, mm[0][0]), 16, FPRClass);
+  auto a = LoadX87StackF80(orig_top);
 
   auto exp = _F80XTRACT_EXP(a);
   auto sig = _F80XTRACT_SIG(a);
 
   // Write to ST[TOP]
-  _StoreContextIndexed(exp, orig_top, 16, offsetof(FEXCore::Core::CPUState, mm[0][0]), 16, FPRClass);
-  _StoreContextIndexed(sig, top, 16, offsetof(FEXCore::Core::CPUState, mm[0][0]), 16, FPRClass);
+  StoreX87StackF80(orig_top, exp);
+  StoreX87StackF80(top, sig);
 }
 
 void OpDispatchBuilder::FNINIT(OpcodeArgs) {
@@ -6751,12 +6956,11 @@ void OpDispatchBuilder::FCOMI(OpcodeArgs) {
     if (width == 16 || width == 32 || width == 64) {
       if (Integer) {
         arg = LoadSource(GPRClass, Op, Op->Src[0], Op->Flags, -1);
-        b = _F80CVTToInt(arg, width / 8);
       }
       else {
         arg = LoadSource(FPRClass, Op, Op->Src[0], Op->Flags, -1);
-        b = _F80CVTTo(arg, width / 8);
       }
+      b = X87ConvertToStack(arg, width / 8, Integer);
     }
   } else {
     // Implicit arg
@@ -6767,7 +6971,7 @@ void OpDispatchBuilder::FCOMI(OpcodeArgs) {
 
   auto a = _LoadContextIndexed(top, 16, offsetof(FEXCore::Core::CPUState, mm[0][0]), 16, FPRClass);
 
-  OrderedNode *Res = _F80Cmp(a, b,
+  OrderedNode *Res = X87Compare(a, b,
     (1 << FCMP_FLAG_EQ) |
     (1 << FCMP_FLAG_LT) |
     (1 << FCMP_FLAG_UNORDERED));
@@ -6846,14 +7050,22 @@ template<FEXCore::IR::IROps IROp>
 void OpDispatchBuilder::X87UnaryOp(OpcodeArgs) {
 
   auto top = GetX87Top();
-  auto a = _LoadContextIndexed(top, 16, offsetof(FEXCore::Core::CPUState, mm[0][0]), 16, FPRClass);
+
+  if (IROp == IR::OP_F80SQRT && CTX->Config.X87ReducedPrecision) {
+    auto a = _LoadContextIndexed(top, 16, offsetof(FEXCore::Core::CPUState, mm[0][0]), 16, FPRClass);
+    // Write to ST[TOP]
+    _StoreContextIndexed(_VFSqrt(a, 8, 8), top, 16, offsetof(FEXCore::Core::CPUState, mm[0][0]), 16, FPRClass);
+    return;
+  }
+
+  auto a = LoadX87StackF80(top);
 
   auto result = _F80Round(a);
   // Overwrite the op
   result.first->Header.Op = IROp;
 
   // Write to ST[TOP]
-  _StoreContextIndexed(result, top, 16, offsetof(FEXCore::Core::CPUState, mm[0][0]), 16, FPRClass);
+  StoreX87StackF80(top, result);
 }
 
 template<FEXCore::IR::IROps IROp>
@@ -6863,8 +7075,8 @@ void OpDispatchBuilder::X87BinaryOp(OpcodeArgs) {
   auto mask = _Constant(7);
   OrderedNode *st1 = _And(_Add(top, _Constant(1)), mask);
 
-  auto a = _LoadContextIndexed(top, 16, offsetof(FEXCore::Core::CPUState, mm[0][0]), 16, FPRClass);
-  st1 = _LoadContextIndexed(st1, 16, offsetof(FEXCore::Core::CPUState, mm[0][0]), 16, FPRClass);
+  auto a = LoadX87StackF80(top);
+  st1 = LoadX87StackF80(st1);
 
   auto result = _F80Add(a, st1);
   // Overwrite the op
@@ -6876,7 +7088,7 @@ void OpDispatchBuilder::X87BinaryOp(OpcodeArgs) {
   }
 
   // Write to ST[TOP]
-  _StoreContextIndexed(result, top, 16, offsetof(FEXCore::Core::CPUState, mm[0][0]), 16, FPRClass);
+  StoreX87StackF80(top, result);
 }
 
 template<bool Inc>
@@ -6898,14 +7110,14 @@ void OpDispatchBuilder::X87SinCos(OpcodeArgs) {
   auto top = _And(_Sub(orig_top, _Constant(1)), _Constant(7));
   SetX87Top(top);
 
-  auto a = _LoadContextIndexed(orig_top, 16, offsetof(FEXCore::Core::CPUState, mm[0][0]), 16, FPRClass);
+  auto a = LoadX87StackF80(orig_top);
 
   auto sin = _F80SIN(a);
   auto cos = _F80COS(a);
 
   // Write to ST[TOP]
-  _StoreContextIndexed(sin, orig_top, 16, offsetof(FEXCore::Core::CPUState, mm[0][0]), 16, FPRClass);
-  _StoreContextIndexed(cos, top, 16, offsetof(FEXCore::Core::CPUState, mm[0][0]), 16, FPRClass);
+  StoreX87StackF80(orig_top, sin);
+  StoreX87StackF80(top, cos);
 }
 
 void OpDispatchBuilder::X87FYL2X(OpcodeArgs) {
@@ -6915,8 +7127,8 @@ void OpDispatchBuilder::X87FYL2X(OpcodeArgs) {
   auto top = _And(_Add(orig_top, _Constant(1)), _Constant(7));
   SetX87Top(top);
 
-  OrderedNode *st0 = _LoadContextIndexed(orig_top, 16, offsetof(FEXCore::Core::CPUState, mm[0][0]), 16, FPRClass);
-  OrderedNode *st1 = _LoadContextIndexed(top, 16, offsetof(FEXCore::Core::CPUState, mm[0][0]), 16, FPRClass);
+  OrderedNode *st0 = LoadX87StackF80(orig_top);
+  OrderedNode *st1 = LoadX87StackF80(top);
 
   if (Plus1) {
     auto low = _Constant(0x8000'0000'0000'0000);
@@ -6929,7 +7141,7 @@ void OpDispatchBuilder::X87FYL2X(OpcodeArgs) {
   auto result = _F80FYL2X(st0, st1);
 
   // Write to ST[TOP]
-  _StoreContextIndexed(result, top, 16, offsetof(FEXCore::Core::CPUState, mm[0][0]), 16, FPRClass);
+  StoreX87StackF80(top, result);
 }
 
 void OpDispatchBuilder::X87TAN(OpcodeArgs) {
@@ -6938,7 +7150,7 @@ void OpDispatchBuilder::X87TAN(OpcodeArgs) {
   auto top = _And(_Sub(orig_top, _Constant(1)), _Constant(7));
   SetX87Top(top);
 
-  auto a = _LoadContextIndexed(orig_top, 16, offsetof(FEXCore::Core::CPUState, mm[0][0]), 16, FPRClass);
+  auto a = LoadX87StackF80(orig_top);
 
   auto result = _F80TAN(a);
 
@@ -6948,8 +7160,8 @@ void OpDispatchBuilder::X87TAN(OpcodeArgs) {
   data = _VInsGPR(16, 8, data, high, 1);
 
   // Write to ST[TOP]
-  _StoreContextIndexed(result, orig_top, 16, offsetof(FEXCore::Core::CPUState, mm[0][0]), 16, FPRClass);
-  _StoreContextIndexed(data, top, 16, offsetof(FEXCore::Core::CPUState, mm[0][0]), 16, FPRClass);
+  StoreX87StackF80(orig_top, result);
+  StoreX87StackF80(top, data);
 }
 
 void OpDispatchBuilder::X87ATAN(OpcodeArgs) {
@@ -6958,13 +7170,13 @@ void OpDispatchBuilder::X87ATAN(OpcodeArgs) {
   auto top = _And(_Add(orig_top, _Constant(1)), _Constant(7));
   SetX87Top(top);
 
-  auto a = _LoadContextIndexed(orig_top, 16, offsetof(FEXCore::Core::CPUState, mm[0][0]), 16, FPRClass);
-  OrderedNode *st1 = _LoadContextIndexed(top, 16, offsetof(FEXCore::Core::CPUState, mm[0][0]), 16, FPRClass);
+  auto a = LoadX87StackF80(orig_top);
+  OrderedNode *st1 = LoadX87StackF80(top);
 
   auto result = _F80ATAN(st1, a);
 
   // Write to ST[TOP]
-  _StoreContextIndexed(result, top, 16, offsetof(FEXCore::Core::CPUState, mm[0][0]), 16, FPRClass);
+  StoreX87StackF80(top, result);
 }
 
 void OpDispatchBuilder::X87LDENV(OpcodeArgs) {
@@ -7206,14 +7418,14 @@ void OpDispatchBuilder::X87FNSAVE(OpcodeArgs) {
   auto SevenConst = _Constant(7);
   auto TenConst = _Constant(10);
   for (int i = 0; i < 7; ++i) {
-    auto data = _LoadContextIndexed(Top, 16, offsetof(FEXCore::Core::CPUState, mm[0][0]), 16, FPRClass);
+    auto data = LoadX87StackF80(Top);
     _StoreMem(FPRClass, 16, ST0Location, data, 1);
     ST0Location = _Add(ST0Location, TenConst);
     Top = _And(_Add(Top, OneConst), SevenConst);
   }
 
   // The final st(7) needs a bit of special handling here
-  auto data = _LoadContextIndexed(Top, 16, offsetof(FEXCore::Core::CPUState, mm[0][0]), 16, FPRClass);
+  auto data = LoadX87StackF80(Top);
   // ST7 broken in to two parts
   // Lower 64bits [63:0]
   // upper 16 bits [79:64]
@@ -7264,7 +7476,7 @@ void OpDispatchBuilder::X87FRSTOR(OpcodeArgs) {
     // Mask off the top bits
     Reg = _VAnd(16, 16, Reg, Mask);
 
-    _StoreContextIndexed(Reg, Top, 16, offsetof(FEXCore::Core::CPUState, mm[0][0]), 16, FPRClass);
+    StoreX87StackF80(Top, Reg);
 
     ST0Location = _Add(ST0Location, TenConst);
     Top = _And(_Add(Top, OneConst), SevenConst);
@@ -7279,12 +7491,12 @@ void OpDispatchBuilder::X87FRSTOR(OpcodeArgs) {
   ST0Location = _Add(ST0Location, _Constant(8));
   OrderedNode *RegHigh = _LoadMem(FPRClass, 2, ST0Location, 1);
   Reg = _VInsElement(16, 2, 4, 0, Reg, RegHigh);
-  _StoreContextIndexed(Reg, Top, 16, offsetof(FEXCore::Core::CPUState, mm[0][0]), 16, FPRClass);
+  StoreX87StackF80(Top, Reg);
 }
 
 void OpDispatchBuilder::X87FXAM(OpcodeArgs) {
   auto top = GetX87Top();
-  auto a = _LoadContextIndexed(top, 16, offsetof(FEXCore::Core::CPUState, mm[0][0]), 16, FPRClass);
+  auto a = LoadX87StackF80(top);
   OrderedNode *Result = _VExtractToGPR(16, 8, a, 1);
 
   // Extract the sign bit
@@ -7477,6 +7689,7 @@ void OpDispatchBuilder::FXSaveOp(OpcodeArgs) {
   // MXCSR_MASK: Mask for writes to the MXCSR register
   // If OSFXSR bit in CR4 is not set than FXSAVE /may/ not save the XMM registers
   // This is implementation dependent
+  // The MM registers are saved as is so MMX state survives, with X87ReducedPrecision the x87 registers stay as doubles
   for (unsigned i = 0; i < 8; ++i) {
     OrderedNode *MMReg = _LoadContext(16, offsetof(FEXCore::Core::CPUState, mm[i]), FPRClass);
     OrderedNode *MemLocation = _Add(Mem, _Constant(i * 16 + 32));
@@ -100,6 +100,49 @@ public:
     return false;
   }
 
+  // Deferred flags need to be in the context before anything leaves the current IR block
+  IRPair<IROp_Jump> _Jump() {
+    CalculateDeferredFlags();
+    return IREmitter::_Jump();
+  }
+  IRPair<IROp_Jump> _Jump(OrderedNode *ssa0) {
+    CalculateDeferredFlags();
+    return IREmitter::_Jump(ssa0);
+  }
+  IRPair<IROp_CondJump> _CondJump(OrderedNode *ssa0, CondClassType cond = {COND_NEQ}) {
+    CalculateDeferredFlags();
+    return IREmitter::_CondJump(ssa0, cond);
+  }
+  IRPair<IROp_CondJump> _CondJump(OrderedNode *ssa0, OrderedNode *ssa1, OrderedNode *ssa2, CondClassType cond = {COND_NEQ}) {
+    CalculateDeferredFlags();
+    return IREmitter::_CondJump(ssa0, ssa1, ssa2, cond);
+  }
+  IRPair<IROp_CondJump> _CondJump(OrderedNode *ssa0, OrderedNode *ssa1, OrderedNode *ssa2, OrderedNode *ssa3, CondClassType Cond, uint8_t CompareSize) {
+    CalculateDeferredFlags();
+    return IREmitter::_CondJump(ssa0, ssa1, ssa2, ssa3, Cond, CompareSize);
+  }
+  IRPair<IROp_ExitFunction> _ExitFunction(OrderedNode *ssa0) {
+    CalculateDeferredFlags();
+    return IREmitter::_ExitFunction(ssa0);
+  }
+  IRPair<IROp_Break> _Break(uint8_t Reason, uint8_t Literal) {
+    CalculateDeferredFlags();
+    return IREmitter::_Break(Reason, Literal);
+  }
+  IRPair<IROp_Syscall> _Syscall(OrderedNode *ssa0, OrderedNode *ssa1, OrderedNode *ssa2, OrderedNode *ssa3, OrderedNode *ssa4, OrderedNode *ssa5, OrderedNode *ssa6) {
+    // The syscall handler can copy the whole CPU state, clone for example
+    CalculateDeferredFlags();
+    return IREmitter::_Syscall(ssa0, ssa1, ssa2, ssa3, ssa4, ssa5, ssa6);
+  }
+  IRPair<IROp_SignalReturn> _SignalReturn() {
+    CalculateDeferredFlags();
+    return IREmitter::_SignalReturn();
+  }
+  IRPair<IROp_CallbackReturn> _CallbackReturn() {
+    CalculateDeferredFlags();
+    return IREmitter::_CallbackReturn();
+  }
+
   OpDispatchBuilder(FEXCore::Context::Context *ctx);
 
   void ResetWorkingList();
@@ -498,6 +541,30 @@ private:
 
   OrderedNode *SelectCC(uint8_t OP, OrderedNode *TrueValue, OrderedNode *FalseValue);
 
+  // Lazy flags
+  // ADD, SUB and logical ops only record their operands, the flags are calculated once something reads or partially
+  // writes them or the IR block is left. Flags overwritten in the same block are never emitted.
+  enum DeferredFlagsType {
+    DEFERRED_FLAGS_NONE,
+    DEFERRED_FLAGS_ADD,
+    DEFERRED_FLAGS_SUB,
+    DEFERRED_FLAGS_LOGICAL,
+  };
+
+  struct {
+    DeferredFlagsType Type;
+    FEXCore::X86Tables::DecodedOp Op;
+    OrderedNode *Res;
+    OrderedNode *Src1;
+    OrderedNode *Src2;
+    bool UpdateCF;
+  } DeferredFlags{};
+  bool CalculatingDeferredFlags{};
+
+  // Returns true if the flags were deferred instead of calculated
+  bool DeferFlags(DeferredFlagsType Type, FEXCore::X86Tables::DecodedOp Op, OrderedNode *Res, OrderedNode *Src1, OrderedNode *Src2, bool UpdateCF);
+  void CalculateDeferredFlags();
+
   void GenerateFlags_ADC(FEXCore::X86Tables::DecodedOp Op, OrderedNode *Res, OrderedNode *Src1, OrderedNode *Src2, OrderedNode *CF);
   void GenerateFlags_SBB(FEXCore::X86Tables::DecodedOp Op, OrderedNode *Res, OrderedNode *Src1, OrderedNode *Src2, OrderedNode *CF);
   void GenerateFlags_SUB(FEXCore::X86Tables::DecodedOp Op, OrderedNode *Res, OrderedNode *Src1, OrderedNode *Src2, bool UpdateCF = true);
@@ -518,6 +585,11 @@ private:
 
   OrderedNode * GetX87Top();
   void SetX87Top(OrderedNode *Value);
+  OrderedNode *LoadX87StackF80(OrderedNode *Index);
+  void StoreX87StackF80(OrderedNode *Index, OrderedNode *Value);
+  // Converts a float or integer memory operand to the format of the x87 stack
+  OrderedNode *X87ConvertToStack(OrderedNode *Src, size_t Size, bool Integer);
+  OrderedNode *X87Compare(OrderedNode *LHS, OrderedNode *RHS, uint32_t Flags);
 
   bool DestIsLockedMem(FEXCore::X86Tables::DecodedOp Op) {
     return Op->Dest.TypeNone.Type !=FEXCore::X86Tables::DecodedOperand::TYPE_GPR && (Op->Flags & FEXCore::X86Tables::DecodeFlags::FLAG_LOCK);
@@ -0,0 +1,36 @@
+#include "Interface/Core/SharedIRCache.h"
+
+#include <mutex>
+
+namespace FEXCore {
+  bool SharedIRCache::Find(uint64_t GuestRIP, Entry *Result) {
+    std::shared_lock lk(CacheMutex);
+    auto it = Entries.find(GuestRIP);
+    if (it == Entries.end()) {
+      return false;
+    }
+
+    *Result = it->second;
+    return true;
+  }
+
+  void SharedIRCache::Insert(uint64_t GuestRIP, Entry const &NewEntry) {
+    std::unique_lock lk(CacheMutex);
+    Entries.try_emplace(GuestRIP, NewEntry);
+  }
+
+  void SharedIRCache::Erase(uint64_t GuestRIP) {
+    std::unique_lock lk(CacheMutex);
+    Entries.erase(GuestRIP);
+  }
+
+  void SharedIRCache::Clear() {
+    std::unique_lock lk(CacheMutex);
+    Entries.clear();
+  }
+
+  size_t SharedIRCache::Size() {
+    std::shared_lock lk(CacheMutex);
+    return Entries.size();
+  }
+}
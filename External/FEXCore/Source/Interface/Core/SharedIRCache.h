@@ -0,0 +1,48 @@
+#pragma once
+#include <FEXCore/Debug/InternalThreadState.h>
+#include <FEXCore/IR/IntrusiveIRList.h>
+#include <FEXCore/IR/RegisterAllocationData.h>
+
+#include <memory>
+#include <shared_mutex>
+#include <stdint.h>
+#include <unordered_map>
+
+namespace FEXCore {
+/**
+ * @brief Process wide cache of post-pass IR and register allocation data
+ *
+ * Every guest thread keeps its own thread local IRLists/RALists for lock free lookups,
+ * on a local miss the thread checks this cache before running the frontend and pass manager.
+ * This means a freshly spawned thread only needs to run the backend for code another thread has already seen.
+ *
+ * Host code and DebugData remain per thread since the backends emit thread specific dispatcher addresses in to blocks.
+ */
+class SharedIRCache final {
+public:
+  struct Entry {
+    std::shared_ptr<FEXCore::IR::IRListView<true>> IR;
+    std::shared_ptr<FEXCore::IR::RegisterAllocationData> RAData;
+    uint64_t GuestCodeSize;
+    uint64_t GuestInstructionCount;
+
+    std::vector<FEXCore::Core::DebugDataGuestRange> GuestRanges;
+    uint64_t GuestCodeHash;
+    uint64_t InvalidationCount;
+  };
+
+  bool Find(uint64_t GuestRIP, Entry *Result);
+
+  // If the entry already exists then the existing one is kept
+  void Insert(uint64_t GuestRIP, Entry const &NewEntry);
+
+  void Erase(uint64_t GuestRIP);
+  void Clear();
+
+  size_t Size();
+
+private:
+  std::shared_mutex CacheMutex;
+  std::unordered_map<uint64_t, Entry> Entries;
+};
+}
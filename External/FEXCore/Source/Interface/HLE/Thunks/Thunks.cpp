@@ -105,6 +105,11 @@ namespace FEXCore {
             }
         }
 
+        void RegisterThunk(const char *Name, ThunkedFunction *Fn) {
+            std::unique_lock lk(ThunksMutex);
+            Thunks[Name] = Fn;
+        }
+
         void RegisterTLSState(FEXCore::Core::InternalThreadState *Thread) {
             ::Thread = Thread;
         }
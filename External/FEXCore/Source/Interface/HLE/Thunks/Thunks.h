@@ -10,6 +10,7 @@ namespace FEXCore {
     class ThunkHandler {
     public:
         virtual ThunkedFunction* LookupThunk(const char *name) = 0;
+        virtual void RegisterThunk(const char *name, ThunkedFunction *Fn) = 0;
         virtual void RegisterTLSState(FEXCore::Core::InternalThreadState *Thread) = 0;
         virtual ~ThunkHandler() { }
 
@@ -6,28 +6,43 @@
 
 namespace FEXCore::IR {
 
-void PassManager::AddDefaultPasses(bool InlineConstants, bool StaticRegisterAllocation) {
+void PassManager::AddDefaultPasses(bool InlineConstants, uint32_t StaticGPRs, uint32_t StaticFPRs, bool FirstTier) {
+  bool StaticRegisterAllocation = StaticGPRs != 0 || StaticFPRs != 0;
   FEXCore::Config::Value<bool> DisablePasses{FEXCore::Config::CONFIG_DEBUG_DISABLE_OPTIMIZATION_PASSES, false};
+  FEXCore::Config::Value<bool> ValueNumbering{FEXCore::Config::CONFIG_VALUE_NUMBERING, true};
 
-  if (!DisablePasses()) {
+  if (FirstTier && !DisablePasses()) {
+    // First tier of tiered compilation, only do the cheap cleanup
+    // Hot code gets recompiled with the full pass list
+    InsertPass(CreatePassDeadCodeElimination());
+
+    // only do SRA if enabled and JIT
+    if (InlineConstants && StaticRegisterAllocation)
+      InsertPass(CreateStaticRegisterAllocationPass(StaticGPRs, StaticFPRs));
+  }
+  else if (!DisablePasses()) {
     InsertPass(CreateContextLoadStoreElimination());
     InsertPass(CreateDeadStoreElimination());
     InsertPass(CreatePassDeadCodeElimination());
     InsertPass(CreateConstProp(InlineConstants));
 
-    ////// InsertPass(CreateDeadFlagCalculationEliminination());
+    InsertPass(CreateDeadFlagCalculationEliminination());
+    if (ValueNumbering()) {
+      InsertPass(CreateGlobalValueNumbering());
+    }
+    InsertPass(CreateLoopInvariantCodeMotion());
 
     InsertPass(CreateSyscallOptimization());
     InsertPass(CreatePassDeadCodeElimination());
 
     // only do SRA if enabled and JIT
     if (InlineConstants && StaticRegisterAllocation)
-      InsertPass(CreateStaticRegisterAllocationPass());
+      InsertPass(CreateStaticRegisterAllocationPass(StaticGPRs, StaticFPRs));
   }
   else {
     // only do SRA if enabled and JIT
     if (InlineConstants && StaticRegisterAllocation)
-      InsertPass(CreateStaticRegisterAllocationPass());
+      InsertPass(CreateStaticRegisterAllocationPass(StaticGPRs, StaticFPRs));
   }
 
   CompactionPass = CreateIRCompaction();
@@ -44,8 +59,8 @@ void PassManager::AddDefaultValidationPasses() {
 #endif
 }
 
-void PassManager::InsertRegisterAllocationPass(bool OptimizeSRA) {
-    RAPass = IR::CreateRegisterAllocationPass(CompactionPass, OptimizeSRA);
+void PassManager::InsertRegisterAllocationPass(bool OptimizeSRA, bool LinearScan) {
+    RAPass = IR::CreateRegisterAllocationPass(CompactionPass, OptimizeSRA, LinearScan);
     InsertPass(RAPass);
 }
 
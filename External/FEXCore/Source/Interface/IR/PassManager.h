@@ -33,14 +33,15 @@ protected:
 class PassManager final {
   friend class SyscallOptimization;
 public:
-  void AddDefaultPasses(bool InlineConstants, bool StaticRegisterAllocation);
+  // StaticGPRs and StaticFPRs are the number of guest registers the backend statically allocates, zero for none
+  void AddDefaultPasses(bool InlineConstants, uint32_t StaticGPRs, uint32_t StaticFPRs, bool FirstTier = false);
   void AddDefaultValidationPasses();
   void InsertPass(Pass *Pass) {
     Pass->RegisterPassManager(this);
     Passes.emplace_back(Pass);
   }
 
-  void InsertRegisterAllocationPass(bool OptimizeSRA);
+  void InsertRegisterAllocationPass(bool OptimizeSRA, bool LinearScan);
 
   bool Run(IREmitter *IREmit);
 
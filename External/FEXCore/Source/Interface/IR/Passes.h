@@ -1,5 +1,7 @@
 #pragma once
 
+#include <stdint.h>
+
 namespace FEXCore::IR {
 class Pass;
 class RegisterAllocationPass;
@@ -10,10 +12,12 @@ FEXCore::IR::Pass* CreateContextLoadStoreElimination();
 FEXCore::IR::Pass* CreateSyscallOptimization();
 FEXCore::IR::Pass* CreateDeadFlagCalculationEliminination();
 FEXCore::IR::Pass* CreateDeadStoreElimination();
+FEXCore::IR::Pass* CreateGlobalValueNumbering();
+FEXCore::IR::Pass* CreateLoopInvariantCodeMotion();
 FEXCore::IR::Pass* CreatePassDeadCodeElimination();
 FEXCore::IR::Pass* CreateIRCompaction();
-FEXCore::IR::RegisterAllocationPass* CreateRegisterAllocationPass(FEXCore::IR::Pass* CompactionPass, bool OptimizeSRA);
-FEXCore::IR::Pass* CreateStaticRegisterAllocationPass();
+FEXCore::IR::RegisterAllocationPass* CreateRegisterAllocationPass(FEXCore::IR::Pass* CompactionPass, bool OptimizeSRA, bool LinearScan);
+FEXCore::IR::Pass* CreateStaticRegisterAllocationPass(uint32_t NumGPRs, uint32_t NumFPRs);
 
 namespace Validation {
 FEXCore::IR::Pass* CreateIRValidation();
@@ -0,0 +1,203 @@
+#include "Interface/IR/PassManager.h"
+#include "Interface/IR/Passes/IRAnalysis.h"
+#include "Interface/Core/OpcodeDispatcher.h"
+
+#include <cstring>
+#include <unordered_map>
+#include <vector>
+
+namespace FEXCore::IR {
+
+class GlobalValueNumbering final : public FEXCore::IR::Pass {
+public:
+  bool Run(IREmitter *IREmit) override;
+};
+
+namespace {
+  // Ops are allocated zeroed so two ops compute the same value if their bytes match
+  // This covers the op, its size, its arguments and any immediates
+  struct OpHash {
+    size_t operator()(IROp_Header const *IROp) const {
+      auto Data = reinterpret_cast<uint8_t const*>(IROp);
+      size_t Size = IR::GetSize(IROp->Op);
+      uint64_t Hash = 0xcbf29ce484222325ULL;
+      for (size_t i = 0; i < Size; ++i) {
+        Hash = (Hash ^ Data[i]) * 0x100000001b3ULL;
+      }
+      return Hash;
+    }
+  };
+
+  struct OpEqual {
+    bool operator()(IROp_Header const *LHS, IROp_Header const *RHS) const {
+      return LHS->Op == RHS->Op &&
+        memcmp(LHS, RHS, IR::GetSize(LHS->Op)) == 0;
+    }
+  };
+
+  bool IsValueNumberable(IROp_Header const *IROp, bool RoundingModeChanges) {
+    switch (IROp->Op) {
+      // Inline constants never make it to the backend as values
+      // Merging them lets the ops using them match
+      case OP_INLINECONSTANT:
+        return true;
+
+      // Constants are pooled per block by ConstProp, sharing them across blocks only raises register pressure
+      case OP_CONSTANT:
+      // Reads state that other ops can change
+      case OP_LOADREGISTER:
+      case OP_LOADCONTEXT:
+      case OP_LOADCONTEXTINDEXED:
+      case OP_LOADFLAG:
+      case OP_LOADMEM:
+      case OP_LOADMEMTSO:
+      case OP_VLOADMEMELEMENT:
+      case OP_FILLREGISTER:
+      case OP_GETROUNDINGMODE:
+      case OP_CYCLECOUNTER:
+      case OP_CPUID:
+      // Reads the host flags of the op right before it
+      case OP_GETHOSTFLAG:
+      // These exist for the RA and PHI handling
+      case OP_MOV:
+      case OP_PHI:
+      case OP_PHIVALUE:
+        return false;
+      default:
+        break;
+    }
+
+    if (!IROp->HasDest || IR::HasSideEffects(IROp->Op)) {
+      return false;
+    }
+
+    if (RoundingModeChanges && IsRoundingModeDependent(IROp)) {
+      return false;
+    }
+
+    return true;
+  }
+}
+
+/**
+ * @brief Removes ops that compute a value already computed by an op that dominates them
+ *
+ * Blocks are visited in a preorder walk of the dominator tree with a scoped table of available values.
+ * Values from a dominating block stay available in every block it dominates, values from sibling blocks never are.
+ * A duplicate has all of its later uses pointed at the first op, DCE cleans up anything that becomes unused.
+ */
+bool GlobalValueNumbering::Run(IREmitter *IREmit) {
+  bool Changed = false;
+  auto CurrentIR = IREmit->ViewIR();
+
+  bool RoundingModeChanges = false;
+
+  for (auto [BlockNode, BlockIROp] : CurrentIR.GetBlocks()) {
+    for (auto [CodeNode, IROp] : CurrentIR.GetCode(BlockNode)) {
+      RoundingModeChanges |= ChangesRoundingMode(IROp);
+    }
+  }
+
+  ControlFlowGraph CFG(&CurrentIR);
+  auto &Blocks = CFG.GetBlocks();
+
+  if (Blocks.empty()) {
+    return false;
+  }
+
+  std::vector<uint32_t> Roots;
+  for (size_t i = 0; i < Blocks.size(); ++i) {
+    if (i == 0 || !CFG.IsReachable(i)) {
+      // Unreachable blocks only get numbered locally
+      Roots.emplace_back(i);
+    }
+  }
+
+  // Walk the dominator tree
+  struct AvailableValue {
+    OrderedNode *Node;
+    uint32_t Block;
+  };
+  std::unordered_map<IROp_Header const*, AvailableValue, OpHash, OpEqual> Available;
+  std::vector<IROp_Header const*> ScopeLog;
+  std::vector<OrderedNode*> Replacements(CurrentIR.GetSSACount());
+  std::vector<OrderedNode*> Removed;
+
+  auto NumberBlock = [&](uint32_t Block) {
+    for (auto [CodeNode, IROp] : CurrentIR.GetCode(Blocks[Block].Node)) {
+      // Point arguments at the value they duplicate first so users of duplicates match as well
+      uint8_t NumArgs = IR::GetArgs(IROp->Op);
+      for (uint8_t i = 0; i < NumArgs; ++i) {
+        if (IROp->Args[i].IsInvalid()) continue;
+
+        auto Replacement = Replacements[IROp->Args[i].ID()];
+        if (Replacement) {
+          IREmit->ReplaceNodeArgument(CodeNode, i, Replacement);
+          Changed = true;
+        }
+      }
+
+      if (!IsValueNumberable(IROp, RoundingModeChanges)) {
+        continue;
+      }
+
+      auto [it, Inserted] = Available.try_emplace(IROp, AvailableValue{CodeNode, Block});
+      if (Inserted) {
+        ScopeLog.emplace_back(IROp);
+      }
+      else if (it->second.Block <= Block) {
+        // Values must be defined in an earlier block than their uses, a dominator can still be placed after
+        Replacements[CurrentIR.GetID(CodeNode)] = it->second.Node;
+        Removed.emplace_back(CodeNode);
+      }
+    }
+  };
+
+  struct DominatorWalk {
+    uint32_t Block;
+    size_t NextChild;
+    size_t ScopeBegin;
+  };
+  std::vector<DominatorWalk> Stack;
+
+  for (auto Root : Roots) {
+    NumberBlock(Root);
+    Stack.emplace_back(DominatorWalk{Root, 0, 0});
+
+    while (!Stack.empty()) {
+      auto &Walk = Stack.back();
+      auto &Children = Blocks[Walk.Block].DominatorChildren;
+
+      if (Walk.NextChild < Children.size()) {
+        uint32_t Child = Children[Walk.NextChild++];
+        size_t ScopeBegin = ScopeLog.size();
+        NumberBlock(Child);
+        Stack.emplace_back(DominatorWalk{Child, 0, ScopeBegin});
+      }
+      else {
+        // Values from this block aren't available to its siblings
+        while (ScopeLog.size() > Walk.ScopeBegin) {
+          Available.erase(ScopeLog.back());
+          ScopeLog.pop_back();
+        }
+        Stack.pop_back();
+      }
+    }
+  }
+
+  for (auto CodeNode : Removed) {
+    // Uses the walk couldn't reach keep the duplicate alive
+    if (CodeNode->GetUses() == 0) {
+      IREmit->Remove(CodeNode);
+      Changed = true;
+    }
+  }
+
+  return Changed;
+}
+
+FEXCore::IR::Pass* CreateGlobalValueNumbering() {
+  return new GlobalValueNumbering{};
+}
+
+}
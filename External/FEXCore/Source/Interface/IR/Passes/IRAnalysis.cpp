@@ -0,0 +1,179 @@
+#include "Interface/IR/Passes/IRAnalysis.h"
+
+#include <FEXCore/Utils/LogManager.h>
+
+namespace FEXCore::IR {
+  ControlFlowGraph::ControlFlowGraph(IRListView<false> *IR) {
+    for (auto [BlockNode, BlockIROp] : IR->GetBlocks()) {
+      BlockIDToIndex[IR->GetID(BlockNode)] = Blocks.size();
+      Blocks.emplace_back(BlockInfo{BlockNode, {}, {}, {}, INVALID_BLOCK, INVALID_BLOCK});
+    }
+
+    // Gather the edges from the op ending each block
+    for (size_t i = 0; i < Blocks.size(); ++i) {
+      auto CodeBlock = IR->GetOp<IROp_CodeBlock>(Blocks[i].Node);
+      auto IROp = IR->GetNode(IR->GetNode(CodeBlock->Last)->Header.Previous)->Op(IR->GetData());
+
+      auto AddEdge = [&](OrderedNodeWrapper Target) {
+        uint32_t TargetIndex = GetBlockIndex(Target.ID());
+        LogMan::Throw::A(TargetIndex != INVALID_BLOCK, "Branch to a block outside of the IR?");
+        Blocks[i].Successors.emplace_back(TargetIndex);
+        Blocks[TargetIndex].Predecessors.emplace_back(i);
+      };
+
+      if (IROp->Op == OP_JUMP) {
+        AddEdge(IROp->Args[0]);
+      }
+      else if (IROp->Op == OP_CONDJUMP) {
+        auto Op = IROp->C<IR::IROp_CondJump>();
+        AddEdge(Op->TrueBlock);
+        AddEdge(Op->FalseBlock);
+      }
+    }
+
+    if (!Blocks.empty()) {
+      CalculateDominators();
+    }
+  }
+
+  void ControlFlowGraph::CalculateDominators() {
+    // Reverse post order from the entry block
+    std::vector<uint32_t> PostOrder;
+    {
+      std::vector<bool> Visited(Blocks.size());
+      std::vector<std::pair<uint32_t, size_t>> Stack;
+      Stack.emplace_back(0, 0);
+      Visited[0] = true;
+
+      while (!Stack.empty()) {
+        auto &[Block, NextSuccessor] = Stack.back();
+        if (NextSuccessor < Blocks[Block].Successors.size()) {
+          uint32_t Successor = Blocks[Block].Successors[NextSuccessor++];
+          if (!Visited[Successor]) {
+            Visited[Successor] = true;
+            Stack.emplace_back(Successor, 0);
+          }
+        }
+        else {
+          PostOrder.emplace_back(Block);
+          Stack.pop_back();
+        }
+      }
+    }
+
+    for (size_t i = 0; i < PostOrder.size(); ++i) {
+      Blocks[PostOrder[PostOrder.size() - i - 1]].RPONumber = i;
+    }
+
+    auto Intersect = [&](uint32_t LHS, uint32_t RHS) {
+      while (LHS != RHS) {
+        while (Blocks[LHS].RPONumber > Blocks[RHS].RPONumber) {
+          LHS = Blocks[LHS].ImmediateDominator;
+        }
+        while (Blocks[RHS].RPONumber > Blocks[LHS].RPONumber) {
+          RHS = Blocks[RHS].ImmediateDominator;
+        }
+      }
+      return LHS;
+    };
+
+    Blocks[0].ImmediateDominator = 0;
+    bool Updated = true;
+    while (Updated) {
+      Updated = false;
+
+      for (auto it = PostOrder.rbegin(); it != PostOrder.rend(); ++it) {
+        uint32_t Block = *it;
+        if (Block == 0) {
+          continue;
+        }
+
+        uint32_t NewDominator = INVALID_BLOCK;
+        for (auto Predecessor : Blocks[Block].Predecessors) {
+          if (Blocks[Predecessor].ImmediateDominator == INVALID_BLOCK) {
+            // Not processed yet or unreachable
+            continue;
+          }
+
+          NewDominator = NewDominator == INVALID_BLOCK ? Predecessor : Intersect(Predecessor, NewDominator);
+        }
+
+        if (Blocks[Block].ImmediateDominator != NewDominator) {
+          Blocks[Block].ImmediateDominator = NewDominator;
+          Updated = true;
+        }
+      }
+    }
+
+    for (size_t i = 1; i < Blocks.size(); ++i) {
+      if (IsReachable(i)) {
+        Blocks[Blocks[i].ImmediateDominator].DominatorChildren.emplace_back(i);
+      }
+    }
+  }
+
+  bool ControlFlowGraph::Dominates(uint32_t Dominator, uint32_t Block) const {
+    if (!IsReachable(Block)) {
+      return false;
+    }
+
+    // Walk up the dominator tree, the entry dominates itself
+    while (Block != Dominator && Block != 0) {
+      Block = Blocks[Block].ImmediateDominator;
+    }
+
+    return Block == Dominator;
+  }
+
+  bool ChangesRoundingMode(IROp_Header const *IROp) {
+    return IROp->Op == OP_SETROUNDINGMODE ||
+           IROp->Op == OP_F80LOADFCW;
+  }
+
+  bool IsRoundingModeDependent(IROp_Header const *IROp) {
+    switch (IROp->Op) {
+      case OP_FLOAT_TOGPR_U:
+      case OP_FLOAT_TOGPR_S:
+      case OP_FLOAT_FROMGPR_U:
+      case OP_FLOAT_FROMGPR_S:
+      case OP_FLOAT_FTOF:
+      case OP_VECTOR_UTOF:
+      case OP_VECTOR_STOF:
+      case OP_VECTOR_FTOU:
+      case OP_VECTOR_FTOS:
+      case OP_VECTOR_FTOF:
+      case OP_VFADD:
+      case OP_VFADDP:
+      case OP_VFSUB:
+      case OP_VFMUL:
+      case OP_VFDIV:
+      case OP_VFRECP:
+      case OP_VFSQRT:
+      case OP_VFRSQRT:
+      case OP_F80ADD:
+      case OP_F80SUB:
+      case OP_F80MUL:
+      case OP_F80DIV:
+      case OP_F80ATAN:
+      case OP_F80FPREM:
+      case OP_F80FPREM1:
+      case OP_F80SCALE:
+      case OP_F80CVT:
+      case OP_F80CVTINT:
+      case OP_F80CVTTO:
+      case OP_F80CVTTOINT:
+      case OP_F80ROUND:
+      case OP_F80F2XM1:
+      case OP_F80FYL2X:
+      case OP_F80TAN:
+      case OP_F80SQRT:
+      case OP_F80SIN:
+      case OP_F80COS:
+      case OP_F80BCDLOAD:
+      case OP_F80BCDSTORE:
+        return true;
+      default:
+        return false;
+    }
+  }
+}
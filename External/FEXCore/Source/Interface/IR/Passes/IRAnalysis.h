@@ -0,0 +1,62 @@
+#pragma once
+
+#include <FEXCore/IR/IR.h>
+#include <FEXCore/IR/IntrusiveIRList.h>
+
+#include <stdint.h>
+#include <unordered_map>
+#include <vector>
+
+namespace FEXCore::IR {
+  /**
+   * @brief Blocks, edges and dominators of an IR region
+   *
+   * Blocks are indexed in the order they are laid out, the first block is the entry
+   * Dominators are calculated with the iterative algorithm from "A Simple, Fast Dominance Algorithm" by Cooper, Harvey and Kennedy
+   */
+  class ControlFlowGraph final {
+    public:
+      static constexpr uint32_t INVALID_BLOCK = ~0U;
+
+      struct BlockInfo {
+        OrderedNode *Node;
+        std::vector<uint32_t> Successors;
+        std::vector<uint32_t> Predecessors;
+        std::vector<uint32_t> DominatorChildren;
+        // INVALID_BLOCK if the block can't be reached from the entry
+        uint32_t ImmediateDominator;
+        uint32_t RPONumber;
+      };
+
+      explicit ControlFlowGraph(IRListView<false> *IR);
+
+      std::vector<BlockInfo> const &GetBlocks() const { return Blocks; }
+
+      uint32_t GetBlockIndex(uint32_t BlockID) const {
+        auto it = BlockIDToIndex.find(BlockID);
+        return it == BlockIDToIndex.end() ? INVALID_BLOCK : it->second;
+      }
+
+      bool IsReachable(uint32_t Block) const {
+        return Blocks[Block].ImmediateDominator != INVALID_BLOCK;
+      }
+
+      bool Dominates(uint32_t Dominator, uint32_t Block) const;
+
+    private:
+      void CalculateDominators();
+
+      std::vector<BlockInfo> Blocks;
+      std::unordered_map<uint32_t, uint32_t> BlockIDToIndex;
+  };
+
+  /**
+   * @brief Op writes the MXCSR rounding mode or the x87 control word
+   */
+  bool ChangesRoundingMode(IROp_Header const *IROp);
+
+  /**
+   * @brief Op result depends on the MXCSR rounding mode or the x87 control word
+   */
+  bool IsRoundingModeDependent(IROp_Header const *IROp);
+}
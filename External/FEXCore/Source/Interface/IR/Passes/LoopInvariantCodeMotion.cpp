@@ -0,0 +1,334 @@
+#include "Interface/IR/PassManager.h"
+#include "Interface/IR/Passes/IRAnalysis.h"
+#include "Interface/Core/OpcodeDispatcher.h"
+
+#include <FEXCore/Core/CoreState.h>
+
+#include <algorithm>
+#include <vector>
+
+namespace FEXCore::IR {
+
+class LoopInvariantCodeMotion final : public FEXCore::IR::Pass {
+public:
+  bool Run(IREmitter *IREmit) override;
+};
+
+namespace {
+  // Values living across blocks can't be spilled by the RA, so only hoist a handful per region
+  // InlineConstants don't take a register and are always hoisted
+  constexpr uint32_t MAX_HOISTED_GPRS = 3;
+  constexpr uint32_t MAX_HOISTED_FPRS = 2;
+
+  struct Loop {
+    uint32_t Header;
+    std::vector<uint32_t> Body;
+  };
+
+  struct ContextRange {
+    uint32_t Offset;
+    uint32_t Size;
+  };
+
+  bool Overlaps(ContextRange const &LHS, ContextRange const &RHS) {
+    return LHS.Offset < (RHS.Offset + RHS.Size) &&
+           RHS.Offset < (LHS.Offset + LHS.Size);
+  }
+
+  // Gathers the context state written by an op
+  // Returns false if the op can write anywhere in the context
+  bool GetContextWrites(IROp_Header const *IROp, std::vector<ContextRange> *Writes) {
+    switch (IROp->Op) {
+      case OP_STORECONTEXT: {
+        auto Op = IROp->C<IR::IROp_StoreContext>();
+        Writes->emplace_back(ContextRange{Op->Offset, IROp->Size});
+        return true;
+      }
+      case OP_STOREREGISTER: {
+        auto Op = IROp->C<IR::IROp_StoreRegister>();
+        Writes->emplace_back(ContextRange{Op->Offset, IROp->Size});
+        return true;
+      }
+      case OP_STOREFLAG: {
+        auto Op = IROp->C<IR::IROp_StoreFlag>();
+        Writes->emplace_back(ContextRange{static_cast<uint32_t>(offsetof(FEXCore::Core::CPUState, flags[0])) + Op->Flag, 1});
+        return true;
+      }
+      case OP_INVALIDATEFLAGS:
+        Writes->emplace_back(ContextRange{static_cast<uint32_t>(offsetof(FEXCore::Core::CPUState, flags[0])), sizeof(FEXCore::Core::CPUState::flags)});
+        return true;
+
+      // Only touch guest memory or control flow
+      case OP_STOREMEM:
+      case OP_STOREMEMTSO:
+      case OP_VSTOREMEMELEMENT:
+      case OP_CAS:
+      case OP_CASPAIR:
+      case OP_ATOMICADD:
+      case OP_ATOMICSUB:
+      case OP_ATOMICAND:
+      case OP_ATOMICOR:
+      case OP_ATOMICXOR:
+      case OP_ATOMICSWAP:
+      case OP_ATOMICFETCHADD:
+      case OP_ATOMICFETCHSUB:
+      case OP_ATOMICFETCHAND:
+      case OP_ATOMICFETCHOR:
+      case OP_ATOMICFETCHXOR:
+      case OP_FENCE:
+      case OP_PRINT:
+      case OP_BEGINBLOCK:
+      case OP_ENDBLOCK:
+      case OP_JUMP:
+      case OP_CONDJUMP:
+      case OP_EXITFUNCTION:
+        return true;
+
+      default:
+        // Syscalls, thunks and anything else with unknown side effects can change all of the state
+        return !IR::HasSideEffects(IROp->Op);
+    }
+  }
+
+  bool IsHoistable(IROp_Header const *IROp, bool RoundingModeChanges) {
+    switch (IROp->Op) {
+      case OP_INLINECONSTANT:
+      case OP_CONSTANT:
+        return true;
+
+      // Hoisting would raise the fault on paths that never executed the op
+      case OP_DIV:
+      case OP_UDIV:
+      case OP_REM:
+      case OP_UREM:
+      case OP_LDIV:
+      case OP_LUDIV:
+      case OP_LREM:
+      case OP_LUREM:
+      // Context loads are checked against the loop's stores separately
+      case OP_LOADCONTEXT:
+      // Reads state that other ops can change
+      case OP_LOADREGISTER:
+      case OP_LOADCONTEXTINDEXED:
+      case OP_LOADFLAG:
+      case OP_LOADMEM:
+      case OP_LOADMEMTSO:
+      case OP_VLOADMEMELEMENT:
+      case OP_FILLREGISTER:
+      case OP_GETROUNDINGMODE:
+      case OP_CYCLECOUNTER:
+      case OP_CPUID:
+      // Reads the host flags of the op right before it
+      case OP_GETHOSTFLAG:
+      // These exist for the RA and PHI handling
+      case OP_MOV:
+      case OP_PHI:
+      case OP_PHIVALUE:
+        return false;
+      default:
+        break;
+    }
+
+    if (!IROp->HasDest || IR::HasSideEffects(IROp->Op)) {
+      return false;
+    }
+
+    if (RoundingModeChanges && IsRoundingModeDependent(IROp)) {
+      return false;
+    }
+
+    return true;
+  }
+}
+
+/**
+ * @brief Moves ops computing the same value on every iteration of a loop in to the block entering the loop
+ *
+ * Loops are found from back edges, a branch to a block that dominates the branching block.
+ * A loop is only handled if its header has a single preheader, which is the only entry to the loop, branches only to the header and is laid out before the loop.
+ * Candidates are pure ops, constants and context loads of state the loop never writes, whose arguments are all defined outside of the loop.
+ */
+bool LoopInvariantCodeMotion::Run(IREmitter *IREmit) {
+  bool Changed = false;
+  auto CurrentIR = IREmit->ViewIR();
+  uintptr_t ListBegin = CurrentIR.GetListData();
+
+  ControlFlowGraph CFG(&CurrentIR);
+  auto &Blocks = CFG.GetBlocks();
+
+  // Loops need at least a preheader and a header
+  if (Blocks.size() < 2) {
+    return false;
+  }
+
+  // Find the loops, back edges to the same header share a loop
+  std::vector<Loop> Loops;
+  for (uint32_t Header = 0; Header < Blocks.size(); ++Header) {
+    std::vector<bool> InLoop(Blocks.size());
+    std::vector<uint32_t> Worklist;
+
+    for (auto Predecessor : Blocks[Header].Predecessors) {
+      if (CFG.Dominates(Header, Predecessor)) {
+        Worklist.emplace_back(Predecessor);
+      }
+    }
+
+    if (Worklist.empty()) {
+      continue;
+    }
+
+    Loop NewLoop{Header, {Header}};
+    InLoop[Header] = true;
+    while (!Worklist.empty()) {
+      uint32_t Block = Worklist.back();
+      Worklist.pop_back();
+
+      if (InLoop[Block]) {
+        continue;
+      }
+
+      InLoop[Block] = true;
+      NewLoop.Body.emplace_back(Block);
+      for (auto Predecessor : Blocks[Block].Predecessors) {
+        Worklist.emplace_back(Predecessor);
+      }
+    }
+
+    std::sort(NewLoop.Body.begin(), NewLoop.Body.end());
+    Loops.emplace_back(std::move(NewLoop));
+  }
+
+  // Inner loops first so their invariants can keep moving out through the outer loops
+  std::stable_sort(Loops.begin(), Loops.end(), [](Loop const &LHS, Loop const &RHS) {
+    return LHS.Body.size() < RHS.Body.size();
+  });
+
+  // Block each value is currently defined in
+  std::vector<uint32_t> DefBlock(CurrentIR.GetSSACount(), ControlFlowGraph::INVALID_BLOCK);
+  for (uint32_t Block = 0; Block < Blocks.size(); ++Block) {
+    for (auto [CodeNode, IROp] : CurrentIR.GetCode(Blocks[Block].Node)) {
+      DefBlock[CurrentIR.GetID(CodeNode)] = Block;
+    }
+  }
+
+  uint32_t HoistedGPRs = 0;
+  uint32_t HoistedFPRs = 0;
+
+  for (auto &CurrentLoop : Loops) {
+    // Find the preheader
+    uint32_t Preheader = ControlFlowGraph::INVALID_BLOCK;
+    bool ValidPreheader = true;
+    for (auto Predecessor : Blocks[CurrentLoop.Header].Predecessors) {
+      if (std::binary_search(CurrentLoop.Body.begin(), CurrentLoop.Body.end(), Predecessor)) {
+        continue;
+      }
+
+      ValidPreheader &= Preheader == ControlFlowGraph::INVALID_BLOCK;
+      Preheader = Predecessor;
+    }
+
+    if (!ValidPreheader ||
+        Preheader == ControlFlowGraph::INVALID_BLOCK ||
+        !CFG.IsReachable(Preheader) ||
+        Blocks[Preheader].Successors.size() != 1 ||
+        // Hoisted values have to be laid out before all of their uses
+        Preheader > CurrentLoop.Body.front()) {
+      continue;
+    }
+
+    std::vector<bool> InLoop(Blocks.size());
+    std::vector<ContextRange> ContextWrites;
+    bool WritesAllContext = false;
+    bool RoundingModeChanges = false;
+
+    for (auto Block : CurrentLoop.Body) {
+      InLoop[Block] = true;
+      for (auto [CodeNode, IROp] : CurrentIR.GetCode(Blocks[Block].Node)) {
+        WritesAllContext |= !GetContextWrites(IROp, &ContextWrites);
+        RoundingModeChanges |= ChangesRoundingMode(IROp);
+      }
+    }
+
+    auto IsInvariantLoad = [&](IROp_Header const *IROp) {
+      if (IROp->Op != OP_LOADCONTEXT || WritesAllContext) {
+        return false;
+      }
+
+      auto Op = IROp->C<IR::IROp_LoadContext>();
+      ContextRange Range{Op->Offset, IROp->Size};
+      return std::none_of(ContextWrites.begin(), ContextWrites.end(), [&Range](ContextRange const &Write) {
+        return Overlaps(Range, Write);
+      });
+    };
+
+    // Blocks are walked in layout order so arguments are always seen before their uses
+    std::vector<OrderedNode*> Hoisted;
+    for (auto Block : CurrentLoop.Body) {
+      for (auto [CodeNode, IROp] : CurrentIR.GetCode(Blocks[Block].Node)) {
+        // Dead ops are left for DCE
+        if (CodeNode->GetUses() == 0) {
+          continue;
+        }
+
+        if (!IsHoistable(IROp, RoundingModeChanges) && !IsInvariantLoad(IROp)) {
+          continue;
+        }
+
+        bool Invariant = true;
+        uint8_t NumArgs = IR::GetArgs(IROp->Op);
+        for (uint8_t i = 0; i < NumArgs; ++i) {
+          if (IROp->Args[i].IsInvalid()) continue;
+
+          uint32_t ArgBlock = DefBlock[IROp->Args[i].ID()];
+          if (ArgBlock != ControlFlowGraph::INVALID_BLOCK && InLoop[ArgBlock]) {
+            Invariant = false;
+            break;
+          }
+        }
+
+        if (!Invariant) {
+          continue;
+        }
+
+        if (IROp->Op != OP_INLINECONSTANT) {
+          auto Class = IROp->Op == OP_LOADCONTEXT ? IROp->C<IR::IROp_LoadContext>()->Class : IR::GetRegClass(IROp->Op);
+          if (Class == FPRClass) {
+            if (HoistedFPRs == MAX_HOISTED_FPRS) continue;
+            ++HoistedFPRs;
+          }
+          else {
+            uint32_t Count = Class == GPRPairClass ? 2 : 1;
+            if ((HoistedGPRs + Count) > MAX_HOISTED_GPRS) continue;
+            HoistedGPRs += Count;
+          }
+        }
+
+        DefBlock[CurrentIR.GetID(CodeNode)] = Preheader;
+        Hoisted.emplace_back(CodeNode);
+      }
+    }
+
+    if (Hoisted.empty()) {
+      continue;
+    }
+
+    // Move the ops in front of the jump in to the header
+    auto CodeBlock = CurrentIR.GetOp<IROp_CodeBlock>(Blocks[Preheader].Node);
+    auto Terminator = CurrentIR.GetNode(CurrentIR.GetNode(CodeBlock->Last)->Header.Previous);
+
+    for (auto CodeNode : Hoisted) {
+      CodeNode->Unlink(ListBegin);
+      Terminator->prepend(ListBegin, CodeNode);
+    }
+
+    Changed = true;
+  }
+
+  return Changed;
+}
+
+FEXCore::IR::Pass* CreateLoopInvariantCodeMotion() {
+  return new LoopInvariantCodeMotion{};
+}
+
+}
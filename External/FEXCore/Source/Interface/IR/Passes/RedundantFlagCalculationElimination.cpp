@@ -1,6 +1,9 @@
 #include "Interface/IR/PassManager.h"
 #include "Interface/Core/OpcodeDispatcher.h"
 
+#include <unordered_map>
+#include <vector>
+
 namespace FEXCore::IR {
 
 class DeadFlagCalculationEliminination final : public FEXCore::IR::Pass {
@@ -8,45 +11,169 @@ public:
   bool Run(IREmitter *IREmit) override;
 };
 
+struct FlagLivenessInfo {
+  // Flags read before they are written in the block
+  uint64_t Use { 0 };
+  // Flags written before they are read in the block
+  uint64_t Def { 0 };
+
+  uint64_t LiveIn { 0 };
+  uint64_t LiveOut { 0 };
+
+  // Blocks this block can branch to inside of the IR region
+  std::vector<OrderedNode*> Successors;
+  // Block leaves the IR region, everything is live at the end of it
+  bool ExitsRegion { false };
+};
+
+constexpr uint64_t AllFlags = ~0ULL;
+
+static bool ReadsAllFlags(IROp_Header const *IROp) {
+  switch (IROp->Op) {
+    // These leave the JIT and whatever runs next can look at any flag
+    case OP_EXITFUNCTION:
+    case OP_BREAK:
+    case OP_SIGNALRETURN:
+    case OP_CALLBACKRETURN:
+    case OP_SYSCALL:
+    case OP_SYSCALLDIRECT:
+    case OP_THUNK:
+      return true;
+    case OP_LOADCONTEXT: {
+      // Nothing emits these for the flags today but be safe if something starts to
+      auto Op = IROp->C<IR::IROp_LoadContext>();
+      constexpr auto FlagsBegin = offsetof(FEXCore::Core::CPUState, flags[0]);
+      constexpr auto FlagsEnd = FlagsBegin + sizeof(FEXCore::Core::CPUState::flags);
+      return Op->Offset < FlagsEnd && (Op->Offset + IROp->Size) > FlagsBegin;
+    }
+    default:
+      return false;
+  }
+}
+
 /**
- * @brief (UNSAFE) This pass removes flag calculations that will otherwise be unused INSIDE of that block
+ * @brief This pass removes flag stores that are overwritten before anything can read them
  *
- * Compilers don't really do any form of cross-block flag allocation like they do RA with GPRs.
- * This ends up with them recalculating flags across blocks regardless of if it is actually possible to reuse the flags.
- * This is an additional burden in x86 that most instructions change flags when called, so it is easier to recalculate anyway.
- *
- * This is unsafe since handwritten code can easily break this assumption.
- * This may be more interesting with full function level recompilation since flags definitely won't be used across function boundaries.
+ * Flag liveness is computed across every block in the IR region, with multiblock this includes loops.
+ * Flags are only assumed to be live where the region can be left, an ExitFunction, a syscall, a thunk or a break.
+ * Hand written assembly that carries flags across a branch keeps working since the branch target reads them.
  *
+ * First pass computes the flags read and written per block and the successors of each block.
+ * Second pass iterates the liveness to a fixed point, walking the blocks backwards to converge faster.
+ * Third pass walks each block backwards from its live out set and removes stores to dead flags.
  */
 bool DeadFlagCalculationEliminination::Run(IREmitter *IREmit) {
-  std::array<OrderedNode*, 32> LastValidFlagStores{};
+  std::unordered_map<OrderedNode*, FlagLivenessInfo> InfoMap;
+  std::vector<OrderedNode*> Blocks;
 
   bool Changed = false;
   auto CurrentIR = IREmit->ViewIR();
 
-  for (auto [BlockNode, BlockHeader] : CurrentIR.GetBlocks()) {
+  // Pass 1
+  // Compute the per block use/def sets and the control flow
+  for (auto [BlockNode, BlockIROp] : CurrentIR.GetBlocks()) {
+    auto &BlockInfo = InfoMap[BlockNode];
+    Blocks.emplace_back(BlockNode);
+
     for (auto [CodeNode, IROp] : CurrentIR.GetCode(BlockNode)) {
       if (IROp->Op == OP_STOREFLAG) {
-        auto Op = IROp->CW<IR::IROp_StoreFlag>();
-        // Set this node as the last one valid for this flag
-        LastValidFlagStores[Op->Flag] = CodeNode;
+        auto Op = IROp->C<IR::IROp_StoreFlag>();
+        BlockInfo.Def |= 1ULL << Op->Flag;
+      }
+      else if (IROp->Op == OP_INVALIDATEFLAGS) {
+        auto Op = IROp->C<IR::IROp_InvalidateFlags>();
+        BlockInfo.Def |= Op->Flags;
       }
       else if (IROp->Op == OP_LOADFLAG) {
-        auto Op = IROp->CW<IR::IROp_LoadFlag>();
-        LastValidFlagStores[Op->Flag] = nullptr;
+        auto Op = IROp->C<IR::IROp_LoadFlag>();
+        BlockInfo.Use |= (1ULL << Op->Flag) & ~BlockInfo.Def;
       }
+      else if (ReadsAllFlags(IROp)) {
+        BlockInfo.Use |= ~BlockInfo.Def;
+      }
+    }
+
+    auto CodeBlock = BlockIROp->C<IROp_CodeBlock>();
+    auto IROp = CurrentIR.GetNode(CurrentIR.GetNode(CodeBlock->Last)->Header.Previous)->Op(CurrentIR.GetData());
+
+    if (IROp->Op == OP_JUMP) {
+      auto Op = IROp->C<IR::IROp_Jump>();
+      BlockInfo.Successors.emplace_back(CurrentIR.GetNode(Op->Header.Args[0]));
+    }
+    else if (IROp->Op == OP_CONDJUMP) {
+      auto Op = IROp->C<IR::IROp_CondJump>();
+      BlockInfo.Successors.emplace_back(CurrentIR.GetNode(Op->TrueBlock));
+      BlockInfo.Successors.emplace_back(CurrentIR.GetNode(Op->FalseBlock));
     }
+    else {
+      // Anything else that ends a block leaves the region
+      BlockInfo.ExitsRegion = true;
+    }
+  }
 
-    // If any flags are stored but not loaded by the end of the block, then erase them
-    for (auto &Flag : LastValidFlagStores) {
-      if (Flag != nullptr) {
-        IREmit->Remove(Flag);
-        Changed = true;
+  // Pass 2
+  // Live sets only ever grow so this terminates
+  bool Updated = true;
+  while (Updated) {
+    Updated = false;
+
+    for (auto it = Blocks.rbegin(); it != Blocks.rend(); ++it) {
+      auto &BlockInfo = InfoMap[*it];
+
+      uint64_t LiveOut = BlockInfo.ExitsRegion ? AllFlags : 0;
+      for (auto Successor : BlockInfo.Successors) {
+        LiveOut |= InfoMap[Successor].LiveIn;
+      }
+
+      uint64_t LiveIn = BlockInfo.Use | (LiveOut & ~BlockInfo.Def);
+
+      if (LiveIn != BlockInfo.LiveIn || LiveOut != BlockInfo.LiveOut) {
+        BlockInfo.LiveIn = LiveIn;
+        BlockInfo.LiveOut = LiveOut;
+        Updated = true;
       }
     }
+  }
+
+  // Pass 3
+  // Remove the dead stores
+  std::vector<OrderedNode*> BlockCode;
+  for (auto BlockNode : Blocks) {
+    // The IR iterators can't go backwards
+    BlockCode.clear();
+    for (auto [CodeNode, IROp] : CurrentIR.GetCode(BlockNode)) {
+      BlockCode.emplace_back(CodeNode);
+    }
+
+    uint64_t Live = InfoMap[BlockNode].LiveOut;
 
-    LastValidFlagStores.fill(nullptr);
+    for (auto it = BlockCode.rbegin(); it != BlockCode.rend(); ++it) {
+      auto CodeNode = *it;
+      auto IROp = CurrentIR.GetOp<IROp_Header>(CodeNode);
+
+      if (IROp->Op == OP_STOREFLAG) {
+        auto Op = IROp->C<IR::IROp_StoreFlag>();
+        uint64_t Flag = 1ULL << Op->Flag;
+
+        if (!(Live & Flag)) {
+          IREmit->Remove(CodeNode);
+          Changed = true;
+        }
+
+        Live &= ~Flag;
+      }
+      else if (IROp->Op == OP_INVALIDATEFLAGS) {
+        auto Op = IROp->C<IR::IROp_InvalidateFlags>();
+        Live &= ~Op->Flags;
+      }
+      else if (IROp->Op == OP_LOADFLAG) {
+        auto Op = IROp->C<IR::IROp_LoadFlag>();
+        Live |= 1ULL << Op->Flag;
+      }
+      else if (ReadsAllFlags(IROp)) {
+        Live = AllFlags;
+      }
+    }
   }
 
   return Changed;
@@ -3,6 +3,7 @@
 #include "Interface/IR/Passes.h"
 #include "Interface/Core/OpcodeDispatcher.h"
 
+#include <algorithm>
 #include <iterator>
 #include <unordered_set>
 
@@ -17,6 +18,8 @@ namespace {
   constexpr uint32_t DEFAULT_INTERFERENCE_LIST_COUNT = 122;
   constexpr uint32_t DEFAULT_INTERFERENCE_SPAN_COUNT = 30;
   constexpr uint32_t DEFAULT_NODE_COUNT = 8192;
+  // Regions at least this large always use the linear scan allocator
+  constexpr uint32_t LINEAR_SCAN_NODE_COUNT = 4096;
 
   const PhysicalRegister INVALID_REGCLASS = PhysicalRegister::Invalid();
 
@@ -258,6 +261,7 @@ namespace {
     Graph->AllocData.reset();
     Graph->AllocData.reset((FEXCore::IR::RegisterAllocationData*)malloc(FEXCore::IR::RegisterAllocationData::Size(NodeCount)));
     memset(&Graph->AllocData->Map[0], INVALID_REGCLASS.Raw, NodeCount);
+    Graph->AllocData->MapCount = NodeCount;
     Graph->NodeCount = NodeCount;
   }
 
@@ -355,6 +359,14 @@ namespace {
     return FEXCore::IR::InvalidClass;
   };
 
+  // Pairs overlap GPRs so they are checked against each other
+  uint32_t GetInterferenceClass(PhysicalRegister PhyReg) {
+    if (PhyReg.Class == FEXCore::IR::GPRPairClass.Val)
+      return FEXCore::IR::GPRClass.Val;
+    else
+      return (uint32_t)PhyReg.Class;
+  }
+
   // Walk the IR and set the node classes
   void FindNodeClasses(RegisterGraph *Graph, FEXCore::IR::IRListView<false> *IR) {
     for (auto [CodeNode, IROp] : IR->GetAllCode()) {
@@ -371,7 +383,7 @@ namespace {
 namespace FEXCore::IR {
   class ConstrainedRAPass final : public RegisterAllocationPass {
     public:
-      ConstrainedRAPass(FEXCore::IR::Pass* _CompactionPass, bool OptimizeSRA);
+      ConstrainedRAPass(FEXCore::IR::Pass* _CompactionPass, bool OptimizeSRA, bool LinearScan);
       ~ConstrainedRAPass();
       bool Run(IREmitter *IREmit) override;
 
@@ -400,6 +412,8 @@ namespace FEXCore::IR {
       RegisterGraph *Graph;
       FEXCore::IR::Pass* CompactionPass;
       bool OptimizeSRA;
+      bool LinearScan;
+      bool UseLinearScan;
 
       void SpillOne(FEXCore::IR::IREmitter *IREmit);
 
@@ -419,6 +433,21 @@ namespace FEXCore::IR {
       void CalculatePredecessors(FEXCore::IR::IRListView<false> *IR);
       void RecursiveLiveRangeExpansion(FEXCore::IR::IRListView<false> *IR, uint32_t Node, uint32_t DefiningBlockID, LiveRange *LiveRange, const std::unordered_set<uint32_t> &Predecessors, std::unordered_set<uint32_t> &VisitedPredecessors);
 
+      /**
+       * @name Linear scan allocation
+       * @{ */
+      // Pairs of {Node, UsingBlockID} for values used outside of their block
+      std::vector<std::pair<uint32_t, uint32_t>> GlobalUses;
+      // Indexed by block ID, holds the last node walked through the block
+      std::vector<uint32_t> BlockVisited;
+      std::vector<uint32_t> BlockWorklist;
+      std::vector<uint32_t> IntervalOrder;
+      std::vector<uint32_t> ActiveIntervals;
+
+      void ExpandGlobalLiveRanges(FEXCore::IR::IRListView<false> *IR);
+      void AllocateVirtualRegistersLinearScan();
+      /**  @} */
+
       FEXCore::IR::AllNodesIterator FindFirstUse(FEXCore::IR::IREmitter *IREmit, FEXCore::IR::OrderedNode* Node, FEXCore::IR::AllNodesIterator Begin, FEXCore::IR::AllNodesIterator End);
       FEXCore::IR::AllNodesIterator FindLastUseBefore(FEXCore::IR::IREmitter *IREmit, FEXCore::IR::OrderedNode* Node, FEXCore::IR::AllNodesIterator Begin, FEXCore::IR::AllNodesIterator End);
 
@@ -428,8 +457,8 @@ namespace FEXCore::IR {
       bool RunAllocateVirtualRegisters(IREmitter *IREmit);
   };
 
-  ConstrainedRAPass::ConstrainedRAPass(FEXCore::IR::Pass* _CompactionPass, bool _OptimizeSRA)
-    : CompactionPass {_CompactionPass}, OptimizeSRA(_OptimizeSRA) {
+  ConstrainedRAPass::ConstrainedRAPass(FEXCore::IR::Pass* _CompactionPass, bool _OptimizeSRA, bool _LinearScan)
+    : CompactionPass {_CompactionPass}, OptimizeSRA(_OptimizeSRA), LinearScan(_LinearScan) {
   }
 
   ConstrainedRAPass::~ConstrainedRAPass() {
@@ -553,7 +582,12 @@ namespace FEXCore::IR {
             LiveRanges[ArgNode].RematCost = -1;
 
             // Include any blocks this value passes through in the live range
-            RecursiveLiveRangeExpansion(IR, ArgNode, ArgNodeBlockID, &LiveRanges[ArgNode], Graph->BlockPredecessors[BlockNodeID], Graph->VisitedNodePredecessors[ArgNode]);
+            if (UseLinearScan) {
+              GlobalUses.emplace_back(ArgNode, BlockNodeID);
+            }
+            else {
+              RecursiveLiveRangeExpansion(IR, ArgNode, ArgNodeBlockID, &LiveRanges[ArgNode], Graph->BlockPredecessors[BlockNodeID], Graph->VisitedNodePredecessors[ArgNode]);
+            }
           }
         }
 
@@ -577,6 +611,71 @@ namespace FEXCore::IR {
         }
       }
     }
+
+    if (UseLinearScan) {
+      ExpandGlobalLiveRanges(IR);
+    }
+  }
+
+  void ConstrainedRAPass::ExpandGlobalLiveRanges(FEXCore::IR::IRListView<false> *IR) {
+    auto GetCodeBlock = [IR](uint32_t BlockID) {
+      auto [_, IROp] = *IR->at(BlockID);
+      auto Op = IROp->C<IROp_CodeBlock>();
+      LogMan::Throw::A(Op->Header.Op == OP_CODEBLOCK, "Block not defined by codeblock?");
+      return Op;
+    };
+
+    // Group the uses by value so each value walks the blocks once
+    // Blocks are stamped with the value walking them so the visited set never needs clearing
+    std::sort(GlobalUses.begin(), GlobalUses.end());
+    BlockVisited.assign(IR->GetSSACount(), 0);
+
+    for (size_t i = 0; i < GlobalUses.size();) {
+      uint32_t Node = GlobalUses[i].first;
+      uint32_t DefiningBlockID = Graph->Nodes[Node].Head.BlockID;
+      LiveRange *NodeLiveRange = &LiveRanges[Node];
+
+      // The value is live in to every block that uses it
+      BlockWorklist.clear();
+      for (; i < GlobalUses.size() && GlobalUses[i].first == Node; ++i) {
+        uint32_t BlockID = GlobalUses[i].second;
+        if (BlockVisited[BlockID] != Node) {
+          BlockVisited[BlockID] = Node;
+          NodeLiveRange->Begin = std::min(NodeLiveRange->Begin, GetCodeBlock(BlockID)->Begin.ID());
+          BlockWorklist.emplace_back(BlockID);
+        }
+      }
+
+      // And live through every block between those and the definition
+      while (!BlockWorklist.empty()) {
+        uint32_t BlockID = BlockWorklist.back();
+        BlockWorklist.pop_back();
+
+        auto Predecessors = Graph->BlockPredecessors.find(BlockID);
+        if (Predecessors == Graph->BlockPredecessors.end()) {
+          continue;
+        }
+
+        for (auto PredecessorID : Predecessors->second) {
+          auto Op = GetCodeBlock(PredecessorID);
+          NodeLiveRange->End = std::max(NodeLiveRange->End, Op->Last.ID());
+
+          if (PredecessorID == DefiningBlockID) {
+            // Only live out of the defining block
+            continue;
+          }
+
+          NodeLiveRange->Begin = std::min(NodeLiveRange->Begin, Op->Begin.ID());
+
+          if (BlockVisited[PredecessorID] != Node) {
+            BlockVisited[PredecessorID] = Node;
+            BlockWorklist.emplace_back(PredecessorID);
+          }
+        }
+      }
+    }
+
+    GlobalUses.clear();
   }
 
   void ConstrainedRAPass::OptimizeStaticRegisters(FEXCore::IR::IRListView<false> *IR) {
@@ -887,20 +986,13 @@ namespace FEXCore::IR {
 
     // Now that we have all the live ranges calculated we need to add them to our interference graph
 
-    auto GetClass = [](PhysicalRegister PhyReg) {
-      if (PhyReg.Class == IR::GPRPairClass.Val)
-        return IR::GPRClass.Val;
-      else
-        return (uint32_t)PhyReg.Class;
-    };
-
     SpanStart.resize(NodeCount);
     SpanEnd.resize(NodeCount);
     for (uint32_t i = 0; i < NodeCount; ++i) {
       if (LiveRanges[i].Begin != ~0U) {
         LogMan::Throw::A(LiveRanges[i].Begin < LiveRanges[i].End , "Span must Begin before Ending");
 
-        auto Class = GetClass(Graph->AllocData->Map[i]);
+        auto Class = GetInterferenceClass(Graph->AllocData->Map[i]);
         SpanStart[LiveRanges[i].Begin].Append(INFO_MAKE(i, Class));
         SpanEnd[LiveRanges[i].End]    .Append(INFO_MAKE(i, Class));
       }
@@ -1012,6 +1104,82 @@ namespace FEXCore::IR {
     }
   }
 
+  void ConstrainedRAPass::AllocateVirtualRegistersLinearScan() {
+    // Visit the live ranges in the order they begin, ties in node order
+    IntervalOrder.clear();
+    for (uint32_t i = 0; i < LiveRanges.size(); ++i) {
+      if (LiveRanges[i].Begin != ~0U &&
+          Graph->AllocData->Map[i] != INVALID_REGCLASS) {
+        LogMan::Throw::A(LiveRanges[i].Begin < LiveRanges[i].End , "Span must Begin before Ending");
+        IntervalOrder.emplace_back(i);
+      }
+    }
+
+    std::sort(IntervalOrder.begin(), IntervalOrder.end(), [this](uint32_t LHS, uint32_t RHS) {
+      if (LiveRanges[LHS].Begin != LiveRanges[RHS].Begin)
+        return LiveRanges[LHS].Begin < LiveRanges[RHS].Begin;
+      return LHS < RHS;
+    });
+
+    ActiveIntervals.clear();
+    for (auto Node : IntervalOrder) {
+      auto LiveRange = &LiveRanges[Node];
+
+      // Expire end intervals first
+      ActiveIntervals.erase(std::remove_if(ActiveIntervals.begin(), ActiveIntervals.end(), [&](uint32_t ActiveNode) {
+        return LiveRanges[ActiveNode].End <= LiveRange->Begin;
+      }), ActiveIntervals.end());
+
+      auto &CurrentRegAndClass = Graph->AllocData->Map[Node];
+      FEXCore::IR::RegisterClassType RegClass = FEXCore::IR::RegisterClassType{CurrentRegAndClass.Class};
+      uint32_t InterferenceClass = GetInterferenceClass(CurrentRegAndClass);
+      auto RegAndClass = INVALID_REGCLASS;
+
+      if (Graph->Nodes[Node].Head.PhiPartner) {
+        LogMan::Msg::A("Phi nodes not supported");
+      }
+
+      if (!LiveRange->PrefferedRegister.IsInvalid()) {
+        RegAndClass = LiveRange->PrefferedRegister;
+      } else {
+        uint32_t RegisterConflicts = 0;
+        for (auto ActiveNode : ActiveIntervals) {
+          auto ActiveRegAndClass = Graph->AllocData->Map[ActiveNode];
+          if (GetInterferenceClass(ActiveRegAndClass) == InterferenceClass) {
+            RegisterConflicts |= GetConflicts(Graph, ActiveRegAndClass, {RegClass});
+          }
+        }
+
+        RegisterConflicts = (~RegisterConflicts) & Graph->Set.Classes[RegClass].CountMask;
+
+        int Reg = ffs(RegisterConflicts);
+        if (Reg != 0) {
+          RegAndClass = PhysicalRegister({RegClass}, Reg-1);
+        }
+      }
+
+      // If we failed to find a register then hand SpillOne the ranges in the way and mark allocation as failed
+      if (RegAndClass.IsInvalid()) {
+        RegisterNode *CurrentNode = &Graph->Nodes[Node];
+        for (auto ActiveNode : ActiveIntervals) {
+          if (GetInterferenceClass(Graph->AllocData->Map[ActiveNode]) == InterferenceClass) {
+            CurrentNode->Interferences.Append(ActiveNode);
+          }
+        }
+
+        CurrentRegAndClass = IR::PhysicalRegister(RegClass, INVALID_REG);
+        HadFullRA = false;
+        SpillPointId = Node;
+
+        // Must spill and restart
+        return;
+      }
+
+      CurrentRegAndClass = RegAndClass;
+      ActiveIntervals.emplace_back(Node);
+    }
+  }
+
   FEXCore::IR::AllNodesIterator ConstrainedRAPass::FindFirstUse(FEXCore::IR::IREmitter *IREmit, FEXCore::IR::OrderedNode* Node, FEXCore::IR::AllNodesIterator Begin, FEXCore::IR::AllNodesIterator End) {
     using namespace FEXCore::IR;
     uint32_t SearchID = IREmit->ViewIR().GetID(Node);
@@ -1462,16 +1630,22 @@ namespace FEXCore::IR {
     if (OptimizeSRA)
       OptimizeStaticRegisters(&IR);
 
-    // Linear forward scan based interference calculation is faster for smaller blocks
-    // Smarter block based interference calculation is faster for larger blocks
-    /*if (SSACount >= 2048) {
-      CalculateBlockInterferences(&IR);
-      CalculateBlockNodeInterference(&IR);
+    if (UseLinearScan) {
+      // No interference graph, registers are picked from the ranges live at each point
+      AllocateVirtualRegistersLinearScan();
     }
-    else*/ {
-      CalculateNodeInterference(&IR);
+    else {
+      // Linear forward scan based interference calculation is faster for smaller blocks
+      // Smarter block based interference calculation is faster for larger blocks
+      /*if (SSACount >= 2048) {
+        CalculateBlockInterferences(&IR);
+        CalculateBlockNodeInterference(&IR);
+      }
+      else*/ {
+        CalculateNodeInterference(&IR);
+      }
+      AllocateVirtualRegisters();
     }
-    AllocateVirtualRegisters();
 
     return Changed;
   }
@@ -1507,6 +1681,9 @@ namespace FEXCore::IR {
 
     CalculatePredecessors(&IR);
 
+    // The interference graph gets expensive in huge regions
+    UseLinearScan = LinearScan || IR.GetSSACount() >= LINEAR_SCAN_NODE_COUNT;
+
     while (1) {
       HadFullRA = true;
 
@@ -1528,7 +1705,7 @@ namespace FEXCore::IR {
     return Changed;
   }
 
-  FEXCore::IR::RegisterAllocationPass* CreateRegisterAllocationPass(FEXCore::IR::Pass* CompactionPass, bool OptimizeSRA) {
-    return new ConstrainedRAPass{CompactionPass, OptimizeSRA};
+  FEXCore::IR::RegisterAllocationPass* CreateRegisterAllocationPass(FEXCore::IR::Pass* CompactionPass, bool OptimizeSRA, bool LinearScan) {
+    return new ConstrainedRAPass{CompactionPass, OptimizeSRA, LinearScan};
   }
 }
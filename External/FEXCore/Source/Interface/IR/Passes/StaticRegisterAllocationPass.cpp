@@ -5,10 +5,17 @@ namespace FEXCore::IR {
 
 class StaticRegisterAllocationPass final : public FEXCore::IR::Pass {
 public:
+  StaticRegisterAllocationPass(uint32_t NumGPRs, uint32_t NumFPRs)
+    : NumGPRs {NumGPRs}, NumFPRs {NumFPRs} {}
   bool Run(IREmitter *IREmit) override;
+
+private:
+  // Guest registers [0, Num) are mapped, the backend decides how many it has room for
+  uint32_t NumGPRs;
+  uint32_t NumFPRs;
 };
 
-bool IsStaticAllocGpr(uint32_t Offset, RegisterClassType Class) {
+bool IsStaticAllocGpr(uint32_t Offset, RegisterClassType Class, uint32_t NumGPRs) {
   bool rv = false;
   auto begin = offsetof(FEXCore::Core::ThreadState, State.gregs[0]);
   auto end = offsetof(FEXCore::Core::ThreadState, State.gregs[17]);
@@ -17,13 +24,13 @@ bool IsStaticAllocGpr(uint32_t Offset, RegisterClassType Class) {
     auto reg = (Offset - begin) / 8;
     LogMan::Throw::A(Class == IR::GPRClass, "unexpected Class %d", Class);
 
-    rv = reg < 16; // 0..15 -> 16 in total
+    rv = reg < NumGPRs;
   }
 
   return rv;
 }
 
-bool IsStaticAllocFpr(uint32_t Offset, RegisterClassType Class, bool AllowGpr) {
+bool IsStaticAllocFpr(uint32_t Offset, RegisterClassType Class, bool AllowGpr, uint32_t NumFPRs) {
   bool rv = false;
   auto begin = offsetof(FEXCore::Core::ThreadState, State.xmm[0][0]);
   auto end = offsetof(FEXCore::Core::ThreadState, State.xmm[17][0]);
@@ -32,7 +39,7 @@ bool IsStaticAllocFpr(uint32_t Offset, RegisterClassType Class, bool AllowGpr) {
     auto reg = (Offset - begin)/16;
     LogMan::Throw::A(Class == IR::FPRClass || (AllowGpr && Class == IR::GPRClass), "unexpected Class %d, AllowGpr %d", Class, AllowGpr);
 
-    rv = reg < 16; // 0..15 -> 16 in total
+    rv = reg < NumFPRs;
   }
 
   return rv;
@@ -51,9 +58,9 @@ bool StaticRegisterAllocationPass::Run(IREmitter *IREmit) {
         if (IROp->Op == OP_LOADCONTEXT) {
             auto Op = IROp->CW<IR::IROp_LoadContext>();
 
-            if (IsStaticAllocGpr(Op->Offset, Op->Class) || IsStaticAllocFpr(Op->Offset, Op->Class, true)) {
+            if (IsStaticAllocGpr(Op->Offset, Op->Class, NumGPRs) || IsStaticAllocFpr(Op->Offset, Op->Class, true, NumFPRs)) {
               auto GeneralClass = Op->Class;
-              if (IsStaticAllocFpr(Op->Offset, GeneralClass, true) && GeneralClass == GPRClass) {
+              if (IsStaticAllocFpr(Op->Offset, GeneralClass, true, NumFPRs) && GeneralClass == GPRClass) {
                 GeneralClass = FPRClass;
               }
               auto StaticClass = GeneralClass == GPRClass ? GPRFixedClass : FPRFixedClass;
@@ -66,11 +73,11 @@ bool StaticRegisterAllocationPass::Run(IREmitter *IREmit) {
         } if (IROp->Op == OP_STORECONTEXT) {
             auto Op = IROp->CW<IR::IROp_StoreContext>();
 
-            if (IsStaticAllocGpr(Op->Offset, Op->Class) || IsStaticAllocFpr(Op->Offset, Op->Class, true)) {
+            if (IsStaticAllocGpr(Op->Offset, Op->Class, NumGPRs) || IsStaticAllocFpr(Op->Offset, Op->Class, true, NumFPRs)) {
               auto val = IREmit->UnwrapNode(Op->Value);
 
               auto GeneralClass = Op->Class;
-              if (IsStaticAllocFpr(Op->Offset, GeneralClass, true) && GeneralClass == GPRClass) {
+              if (IsStaticAllocFpr(Op->Offset, GeneralClass, true, NumFPRs) && GeneralClass == GPRClass) {
                 val = IREmit->_VCastFromGPR(Op->Header.Size, Op->Header.Size, val);
                 GeneralClass = FPRClass;
               }
@@ -87,8 +94,8 @@ bool StaticRegisterAllocationPass::Run(IREmitter *IREmit) {
   return true;
 }
 
-FEXCore::IR::Pass* CreateStaticRegisterAllocationPass() {
-  return new StaticRegisterAllocationPass{};
+FEXCore::IR::Pass* CreateStaticRegisterAllocationPass(uint32_t NumGPRs, uint32_t NumFPRs) {
+  return new StaticRegisterAllocationPass{NumGPRs, NumFPRs};
 }
 
 }
@@ -5,6 +5,8 @@
 #include <FEXCore/HLE/SyscallHandler.h>
 #include <FEXCore/Utils/LogManager.h>
 
+#include <array>
+
 namespace FEXCore::IR {
 
 class SyscallOptimization final : public FEXCore::IR::Pass {
@@ -24,8 +26,21 @@ bool SyscallOptimization::Run(IREmitter *IREmit) {
       uint64_t Constant;
       if (IREmit->IsValueConstant(IROp->Args[0], &Constant)) {
         auto SyscallDef = Manager->SyscallHandler->GetSyscallABI(Constant);
-        // XXX: Once we have the ability to do real function calls then we can call directly in to the syscall handler
-        if (SyscallDef.NumArgs < FEXCore::HLE::SyscallArguments::MAX_ARGS) {
+        if (SyscallDef.HostHandler && SyscallDef.NumArgs < FEXCore::HLE::SyscallArguments::MAX_ARGS) {
+          // Call the handler directly and skip the lookup in HandleSyscall
+          // The syscall number isn't passed, the handler's arguments start at Arg1
+          std::array<OrderedNode*, FEXCore::HLE::SyscallArguments::MAX_ARGS - 1> Args;
+          for (uint8_t Arg = 0; Arg < Args.size(); ++Arg) {
+            Args[Arg] = Arg < SyscallDef.NumArgs ? CurrentIR.GetNode(IROp->Args[Arg + 1]) : IREmit->Invalid();
+          }
+
+          IREmit->SetWriteCursor(CodeNode);
+          auto Direct = IREmit->_SyscallDirect(Args[0], Args[1], Args[2], Args[3], Args[4], Args[5],
+            reinterpret_cast<uintptr_t>(SyscallDef.HostHandler));
+          IREmit->ReplaceAllUsesWith(CodeNode, Direct);
+          Changed = true;
+        }
+        else if (SyscallDef.NumArgs < FEXCore::HLE::SyscallArguments::MAX_ARGS) {
           // If the number of args are less than what the IR op supports then we can remove arg usage
           // We need +1 since we are still passing in syscall number here
           for (uint8_t Arg = (SyscallDef.NumArgs + 1); Arg < FEXCore::HLE::SyscallArguments::MAX_ARGS; ++Arg) {
@@ -34,6 +34,18 @@ namespace FEXCore::Config {
     CONFIG_INTERPRETER_INSTALLED,
     CONFIG_APP_FILENAME,
     CONFIG_DEBUG_DISABLE_OPTIMIZATION_PASSES,
+    CONFIG_AOTIR_CACHE,
+    CONFIG_BACKGROUND_PRECOMPILE,
+    CONFIG_SPECULATIVE_COMPILE,
+    CONFIG_TIERED_COMPILE,
+    CONFIG_SMC_PAGE_PROTECT,
+    CONFIG_LAZY_FLAGS,
+    CONFIG_LINEAR_SCAN_RA,
+    CONFIG_X87_REDUCED_PRECISION,
+    CONFIG_VDSO,
+    CONFIG_COMPILE_THREADS,
+    CONFIG_VALUE_NUMBERING,
+    CONFIG_STATIC_REGISTER_ALLOCATION,
   };
 
   enum ConfigCore {
@@ -76,9 +76,6 @@ class LLVMCore;
       DispatchPtr(Thread);
     }
 
-    virtual void ClearCache() {}
-    virtual void CopyNecessaryDataForCompileThread(CPUBackend *Original) {}
-
     using AsmDispatch = __attribute__((naked)) void(*)(FEXCore::Core::InternalThreadState *Thread);
     using JITCallback = __attribute__((naked)) void(*)(FEXCore::Core::InternalThreadState *Thread, uint64_t RIP);
 
@@ -1,6 +1,7 @@
 #pragma once
 #include <cstdint>
 #include <functional>
+#include <utility>
 #include <vector>
 
 namespace FEXCore {
@@ -50,6 +51,15 @@ public:
    */
   virtual void MapMemoryRegion() {}
 
+  /**
+   * @brief Gets the guest memory regions the loader mapped readable
+   *
+   * @param Regions Start and length of each region
+   *
+   * Background compiles only decode guest code from memory that the core knows to be readable
+   */
+  virtual void GetReadableRegions(std::vector<std::pair<uint64_t, uint64_t>> *Regions) {}
+
   /**
    * @brief Memory writer function for loading code in to guest memory
    *
@@ -229,4 +229,58 @@ namespace FEXCore::Context {
   void SetSignalDelegator(FEXCore::Context::Context *CTX, FEXCore::SignalDelegator *SignalDelegation);
   void SetSyscallHandler(FEXCore::Context::Context *CTX, FEXCore::HLE::SyscallHandler *Handler);
   FEXCore::CPUID::FunctionResults RunCPUIDFunction(FEXCore::Context::Context *CTX, uint32_t Function, uint32_t Leaf);
+
+  /**
+   * @brief Invalidates compiled code that was decoded from a guest memory range
+   *
+   * Every thread's caches are updated. Frontends need to call this after unmapping, replacing
+   * or changing the protection of guest memory.
+   *
+   * @param Start Start of the guest range
+   * @param Length Length of the guest range in bytes
+   */
+  void InvalidateGuestCodeRange(FEXCore::Context::Context *CTX, uint64_t Start, uint64_t Length);
+
+  /**
+   * @brief Makes guest pages that are write protected for SMC detection writable again
+   *
+   * The kernel returns EFAULT instead of faulting when a syscall writes to one of them. Frontends need to call
+   * this for syscall output buffers, or after a syscall failed with EFAULT before retrying it. The blocks on
+   * the pages are invalidated as if the guest had written to them.
+   *
+   * @param Start Start of the guest range
+   * @param Length Length of the guest range in bytes
+   *
+   * @return true if any page in the range was write protected
+   */
+  bool UnprotectSMCPages(FEXCore::Context::Context *CTX, FEXCore::Core::InternalThreadState *Thread, uint64_t Start, uint64_t Length);
+
+  /**
+   * @brief Same as above for every page write protected for SMC detection
+   */
+  bool UnprotectSMCPages(FEXCore::Context::Context *CTX, FEXCore::Core::InternalThreadState *Thread);
+
+  /**
+   * @brief Tells the core that a guest memory range can be read
+   *
+   * Background compiles only decode guest code that is known to be readable. Frontends need to call this after
+   * mapping guest memory or changing its protection to something that includes PROT_READ.
+   */
+  void AddReadableGuestRange(FEXCore::Context::Context *CTX, uint64_t Start, uint64_t Length);
+
+  /**
+   * @brief Tells the core that a guest memory range is about to stop being readable
+   *
+   * Frontends need to call this before unmapping, replacing or changing the protection of guest memory.
+   * Waits for background compiles that are decoding from the range.
+   */
+  void RemoveReadableGuestRange(FEXCore::Context::Context *CTX, uint64_t Start, uint64_t Length);
+
+  /**
+   * @brief Lets guest code call a host function with the thunk opcode, 0F 3F followed by the name
+   *
+   * The function gets the guest's RDI, which is usually a pointer to its arguments and return value.
+   * Must be called after InitCore and before any guest code using the thunk is compiled.
+   */
+  void RegisterHostThunk(FEXCore::Context::Context *CTX, const char *Name, void (*Function)(void *ArgsRv));
 }
@@ -11,7 +11,6 @@
 
 namespace FEXCore {
   class LookupCache;
-  class CompileService;
 }
 
 namespace FEXCore::Context {
@@ -40,6 +39,11 @@ namespace FEXCore::Core {
     uint32_t SSAId;
   };
 
+  struct DebugDataGuestRange {
+    uint64_t GuestCodeStart;
+    uint64_t GuestCodeSize;
+  };
+
   /**
    * @brief Contains debug data for a block of code for later debugger analysis
    *
@@ -52,6 +56,9 @@ namespace FEXCore::Core {
     uint64_t TimeSpentInCode; ///< How long this code has spent time running
     uint64_t RunCount; ///< Number of times this block of code has been run
     std::vector<DebugDataSubblock> Subblocks;
+    std::vector<DebugDataGuestRange> GuestRanges; ///< Guest code the block was decoded from
+    uint64_t GuestCodeHash; ///< Hash of the guest code in GuestRanges at the time the block was decoded
+    uint64_t InvalidationCount; ///< How many code invalidations had happened when GuestCodeHash last matched the guest code
   };
 
   enum SignalEvent {
@@ -65,6 +72,27 @@ namespace FEXCore::Core {
     FEXCore::Core::ThreadState State;
 
     FEXCore::Context::Context *CTX;
+
+    /**
+     * @brief Per thread entry points and lookups for code shared between threads
+     *
+     * Blocks can be compiled on one thread and run on any other, so they read these through the state register
+     * instead of baking in anything thread specific. Each is entered with static registers in whatever state the
+     * backend's blocks leave them in
+     */
+    struct {
+      uintptr_t L1Pointer;
+      uint64_t L1EraseCount; ///< How much of the shared erase log L1 has seen
+      uintptr_t LoopTop;
+      uintptr_t ExitFunctionLinker;
+      uintptr_t ThreadStopHandler;
+      uintptr_t ThreadPauseHandler;
+      uintptr_t SignalHandlerReturn;
+      uint32_t *SignalHandlerRefCounter;
+      uint32_t StaticRegsLive; ///< Set while the backend's static registers are newer than the context
+      uintptr_t HeldCode; ///< While blocked in a syscall, the only backend code the thread returns to. 0 otherwise
+    } Dispatcher{};
+
     std::atomic<SignalEvent> SignalReason {SignalEvent::SIGNALEVENT_NONE};
 
     std::thread ExecutionThread;
@@ -76,8 +104,9 @@ namespace FEXCore::Core {
     std::unique_ptr<FEXCore::CPU::CPUBackend> CPUBackend;
     std::unique_ptr<FEXCore::LookupCache> LookupCache;
 
-    std::unordered_map<uint64_t, std::unique_ptr<FEXCore::IR::IRListView<true>>> IRLists;
-    std::unordered_map<uint64_t, std::unique_ptr<FEXCore::IR::RegisterAllocationData, FEXCore::IR::RegisterAllocationDataDeleter>> RALists;
+    // IR and RA data can be shared with other threads through the Context's SharedIRCache
+    std::unordered_map<uint64_t, std::shared_ptr<FEXCore::IR::IRListView<true>>> IRLists;
+    std::unordered_map<uint64_t, std::shared_ptr<FEXCore::IR::RegisterAllocationData>> RALists;
     std::unordered_map<uint64_t, std::unique_ptr<FEXCore::Core::DebugData>> DebugData;
 
     std::unique_ptr<FEXCore::Frontend::Decoder> FrontendDecoder;
@@ -88,8 +117,9 @@ namespace FEXCore::Core {
     int StatusCode{};
     FEXCore::Context::ExitReason ExitReason {FEXCore::Context::ExitReason::EXIT_WAITING};
     uint32_t CompileBlockReentrantRefCount{};
-    std::shared_ptr<FEXCore::CompileService> CompileService;
     bool IsCompileService{false};
+    // Generates the instrumented first tier when tiered compilation is enabled
+    bool FirstTierCompiler{false};
   };
   static_assert(offsetof(InternalThreadState, State) == 0, "InternalThreadState must have State be the first object");
   static_assert(std::is_standard_layout<InternalThreadState>::value, "This needs to be standard layout");
@@ -23,6 +23,9 @@ namespace FEXCore::HLE {
     // If the syscall has a return then it should be stored in the ABI specific syscall register
     // Linux = RAX
     bool HasReturn;
+    // Handler that can be called directly with (Thread, Args...) in host ABI registers
+    // nullptr means the syscall has to go through HandleSyscall
+    void *HostHandler;
   };
 
   enum class SyscallOSABI {
@@ -85,6 +85,17 @@ public:
     }
   }
 
+  // Rebuilds a view from raw IR and list data, used when loading serialized IR
+  IRListView(void const *Data, size_t _DataSize, void const *List, size_t _ListSize) {
+    static_assert(Copy, "Serialized IR needs to be copied in to its own storage");
+    DataSize = _DataSize;
+    ListSize = _ListSize;
+    IRData = malloc(DataSize + ListSize);
+    ListData = reinterpret_cast<void*>(reinterpret_cast<uintptr_t>(IRData) + DataSize);
+    memcpy(IRData, Data, DataSize);
+    memcpy(ListData, List, ListSize);
+  }
+
   IRListView<true>(IRListView<true> *Old) {
     DataSize = Old->DataSize;
     ListSize = Old->ListSize;
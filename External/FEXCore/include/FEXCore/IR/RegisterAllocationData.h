@@ -37,12 +37,14 @@ struct RegisterAllocationDataDeleter {
 class RegisterAllocationData {
   public:
     uint32_t SpillSlotCount {};
+    uint32_t MapCount {};
     PhysicalRegister Map[0];
 
     PhysicalRegister GetNodeRegister(uint32_t Node) const {
       return Map[Node];
     }
     uint32_t SpillSlots() const { return SpillSlotCount; }
+    size_t Size() const { return Size(MapCount); }
 
     static size_t Size(uint32_t NodeCount) {
       return sizeof(RegisterAllocationData) + NodeCount * sizeof(Map[0]);
@@ -0,0 +1,75 @@
+#!/usr/bin/env python3
+# Counts the IR ops in FEX_DUMPIR output to see what the optimization passes removed
+#
+# ir_op_count.py <dump>
+#   Compares the IR before and after the passes
+# ir_op_count.py <dump> <dump>
+#   Compares the IR after the passes between two runs, eg from two builds or
+#   with and without value numbering:
+#     FEX_DUMPIR=<with> FEXLoader <app>
+#     FEX_DUMPIR=<without> FEX_VALUENUMBERING=0 FEXLoader <app>
+#
+# <dump> is the directory given to FEX_DUMPIR or a file holding captured stdout/stderr dumps
+import os
+import re
+import sys
+from collections import Counter
+
+# %ssa5 i64 = Add ..., %ssa5(GPR3) i64 = Add ... or (%ssa7 i0) Break ...
+OP_LINE = re.compile(r"^\s*(?:%ssa\d+(?:\([^)]*\))? i\S+ = |\(%ssa\d+ i\S+\) )(\w+)")
+HEADER_LINE = re.compile(r"^IR-(pre|post) 0x[0-9a-fA-F]+:")
+
+def count_file(path, counts):
+    stage = None
+    with open(path, "r") as f:
+        for line in f:
+            header = HEADER_LINE.match(line)
+            if header:
+                stage = header.group(1)
+                continue
+            if stage is None:
+                continue
+            op = OP_LINE.match(line)
+            if op:
+                counts[stage][op.group(1)] += 1
+
+def count_dump(path):
+    counts = {"pre": Counter(), "post": Counter()}
+    if os.path.isdir(path):
+        for name in sorted(os.listdir(path)):
+            if name.endswith(".ir"):
+                count_file(os.path.join(path, name), counts)
+    else:
+        count_file(path, counts)
+    return counts
+
+# Ops that don't turn in to host code
+IGNORED_OPS = {"IRHeader", "CodeBlock", "BeginBlock", "EndBlock", "InlineConstant", "InlineEntrypointOffset"}
+
+def report(before_name, before, after_name, after):
+    ops = sorted((set(before) | set(after)) - IGNORED_OPS, key=lambda op: (after[op] - before[op], op))
+
+    print("%-24s %10s %10s %10s" % ("Op", before_name, after_name, "Delta"))
+    for op in ops:
+        if before[op] != after[op]:
+            print("%-24s %10d %10d %+10d" % (op, before[op], after[op], after[op] - before[op]))
+
+    before_total = sum(before[op] for op in ops)
+    after_total = sum(after[op] for op in ops)
+    print("%-24s %10d %10d %+10d" % ("Total", before_total, after_total, after_total - before_total))
+    if before_total:
+        print("%.2f%% of the ops were removed" % (100.0 * (before_total - after_total) / before_total))
+
+def main():
+    if len(sys.argv) == 2:
+        counts = count_dump(sys.argv[1])
+        report("Pre", counts["pre"], "Post", counts["post"])
+    elif len(sys.argv) == 3:
+        first = count_dump(sys.argv[1])
+        second = count_dump(sys.argv[2])
+        report("First", first["post"], "Second", second["post"])
+    else:
+        sys.exit("Usage: %s <dump> [<dump>]" % sys.argv[0])
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,96 @@
+#!/usr/bin/env python3
+# Runs the x87 ASM tests with and without --x87-reduced-precision and reports what changes
+#
+# x87_conformance_report.py <build dir> [TestHarnessRunner args...]
+#   Runner args default to "-c irjit -n 500"
+#
+# The asm_files target needs to be built first so the test binaries exist, the x87_conformance target does both
+# Exits with 1 if any test gives different results with the option, stack register format changes are expected
+# MM registers hold doubles in reduced precision mode so their mismatches are reported apart from
+# the GPR results, which the tests get from the 32bit and 64bit memory forms of the instructions
+import glob
+import os
+import re
+import subprocess
+import sys
+
+# RAX: 0x0000000000000001 != 0x0000000000000002 (Expected)
+MISMATCH_LINE = re.compile(r"^(\w+): (0x[0-9a-fA-F]+) != (0x[0-9a-fA-F]+)")
+
+def run_test(runner, args, test_bin, reduced):
+    run_args = [runner] + args
+    if reduced:
+        run_args.append("--x87-reduced-precision")
+    run_args += [test_bin, test_bin[:-len(".bin")] + ".config.bin"]
+
+    try:
+        result = subprocess.run(run_args, stdout=subprocess.PIPE, stderr=subprocess.STDOUT, timeout=60)
+    except subprocess.TimeoutExpired:
+        return "timeout", []
+
+    mismatches = []
+    for line in result.stdout.decode("utf-8", "replace").splitlines():
+        match = MISMATCH_LINE.match(line.strip())
+        if match:
+            mismatches.append(match.groups())
+
+    return "pass" if result.returncode == 0 else "fail", mismatches
+
+def main():
+    if len(sys.argv) < 2:
+        print("usage: %s <build dir> [TestHarnessRunner args...]" % sys.argv[0])
+        sys.exit(1)
+
+    build_dir = sys.argv[1]
+    args = sys.argv[2:] if len(sys.argv) > 2 else ["-c", "irjit", "-n", "500"]
+    runner = os.path.join(build_dir, "Bin", "TestHarnessRunner")
+
+    tests = sorted(glob.glob(os.path.join(build_dir, "unittests", "ASM", "X87*", "*.asm.bin")))
+    if not tests:
+        print("No x87 test binaries found in %s, build the asm_files target first" % build_dir)
+        sys.exit(1)
+
+    both_pass = []
+    reduced_only_fail = []
+    default_fail = []
+    register_only = []
+
+    for test_bin in tests:
+        name = os.path.relpath(test_bin, os.path.join(build_dir, "unittests", "ASM"))[:-len(".bin")]
+        default_result, _ = run_test(runner, args, test_bin, False)
+        reduced_result, mismatches = run_test(runner, args, test_bin, True)
+
+        if default_result != "pass":
+            default_fail.append((name, default_result, reduced_result))
+        elif reduced_result == "pass":
+            both_pass.append(name)
+        elif mismatches and all(reg.startswith("MM") for reg, _, _ in mismatches):
+            register_only.append((name, mismatches))
+        else:
+            reduced_only_fail.append((name, reduced_result, mismatches))
+
+    print("x87 conformance with --x87-reduced-precision (%s)" % " ".join(args))
+    print("  %d tests, %d identical, %d differ only in the MM register format, %d differ in results, %d fail without the option" %
+        (len(tests), len(both_pass), len(register_only), len(reduced_only_fail), len(default_fail)))
+
+    if reduced_only_fail:
+        print("\nResult differences:")
+        for name, result, mismatches in reduced_only_fail:
+            print("  %s (%s)" % (name, result))
+            for reg, got, expected in mismatches:
+                print("    %s: %s, expected %s" % (reg, got, expected))
+
+    if register_only:
+        print("\nStack register format only:")
+        for name, mismatches in register_only:
+            print("  %s: %s" % (name, ", ".join(sorted(set(reg for reg, _, _ in mismatches)))))
+
+    if default_fail:
+        print("\nFailing without the option, not compared:")
+        for name, default_result, reduced_result in default_fail:
+            print("  %s (%s, reduced %s)" % (name, default_result, reduced_result))
+
+    return 1 if reduced_only_fail else 0
+
+if __name__ == "__main__":
+    sys.exit(main())
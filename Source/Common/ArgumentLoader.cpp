@@ -72,6 +72,71 @@ namespace FEX::ArgLoader {
         .help("Checks code for modification before execution. Slow.")
         .set_default(false);
 
+      CPUGroup.add_option("--aot-ir-cache")
+        .dest("AOTIRCache")
+        .action("store_true")
+        .help("Loads and saves generated IR in an on-disk cache keyed by the application")
+        .set_default(false);
+
+      CPUGroup.add_option("--background-precompile")
+        .dest("BackgroundPrecompile")
+        .action("store_true")
+        .help("Keeps precompiling cached entries in the background while the application starts")
+        .set_default(false);
+
+      CPUGroup.add_option("--speculative-compile")
+        .dest("SpeculativeCompile")
+        .action("store_true")
+        .help("Generates IR for branch targets on the compile threads ahead of execution")
+        .set_default(false);
+
+      CPUGroup.add_option("--tiered-compile")
+        .dest("TieredCompile")
+        .action("store_true")
+        .help("Compiles blocks with a quick first tier and recompiles hot entries with the full pipeline in the background")
+        .set_default(false);
+
+      CPUGroup.add_option("--smc-page-protect")
+        .dest("SMCPageProtect")
+        .action("store_true")
+        .help("Detect self modifying code by write protecting guest code pages instead of checking every instruction")
+        .set_default(false);
+
+      CPUGroup.add_option("--lazy-flags")
+        .dest("LazyFlags")
+        .action("store_true")
+        .help("Only calculate x86 flags when they are read or the block is left")
+        .set_default(false);
+
+      CPUGroup.add_option("--linear-scan-ra")
+        .dest("LinearScanRA")
+        .action("store_true")
+        .help("Use the linear scan register allocator for all code")
+        .set_default(false);
+
+      CPUGroup.add_option("--x87-reduced-precision")
+        .dest("X87ReducedPrecision")
+        .action("store_true")
+        .help("Keep x87 stack values as 64bit doubles. Faster but loses the 80bit precision")
+        .set_default(false);
+
+      CPUGroup.add_option("--compile-threads")
+        .dest("CompileThreads")
+        .help("Maximum number of compile threads, started as they are needed. 0 uses one per host CPU")
+        .set_default(0);
+
+      CPUGroup.add_option("--no-value-numbering")
+        .dest("ValueNumbering")
+        .action("store_false")
+        .help("Skips the global value numbering pass, to compare the IR with and without it")
+        .set_default(true);
+
+      CPUGroup.add_option("--static-register-allocation")
+        .dest("StaticRegisterAllocation")
+        .action("store_true")
+        .help("Keep RAX, RBX and XMM0-1 in host registers on the x86-64 JIT. The Arm64 JIT always does this")
+        .set_default(false);
+
       CPUGroup.add_option("--unsafe-no-tso")
         .dest("TSOEnabled")
         .action("store_false")
@@ -104,6 +169,12 @@ namespace FEX::ArgLoader {
         .dest("ThunkLibs")
         .help("Folder to find the host-side thunking libs");
 
+      EmulationGroup.add_option("--vdso")
+        .dest("VDSO")
+        .action("store_true")
+        .help("Provides an emulated vDSO to 64bit guests")
+        .set_default(false);
+
       EmulationGroup.add_option("-E", "--env")
         .dest("Env")
         .help("Adds an environment variable")
@@ -220,6 +291,10 @@ namespace FEX::ArgLoader {
         bool SMCChecks = Options.get("SMCChecks");
         Set(FEXCore::Config::ConfigOption::CONFIG_SMC_CHECKS, std::to_string(SMCChecks));
       }
+      if (Options.is_set_by_user("AOTIRCache")) {
+        bool AOTIRCache = Options.get("AOTIRCache");
+        Set(FEXCore::Config::ConfigOption::CONFIG_AOTIR_CACHE, std::to_string(AOTIRCache));
+      }
       if (Options.is_set_by_user("AbiLocalFlags")) {
         bool AbiLocalFlags = Options.get("AbiLocalFlags");
         Set(FEXCore::Config::ConfigOption::CONFIG_ABI_LOCAL_FLAGS, std::to_string(AbiLocalFlags));
@@ -228,6 +303,46 @@ namespace FEX::ArgLoader {
         bool AbiNoPF = Options.get("AbiNoPF");
         Set(FEXCore::Config::ConfigOption::CONFIG_ABI_NO_PF, std::to_string(AbiNoPF));
       }
+      if (Options.is_set_by_user("BackgroundPrecompile")) {
+        bool BackgroundPrecompile = Options.get("BackgroundPrecompile");
+        Set(FEXCore::Config::ConfigOption::CONFIG_BACKGROUND_PRECOMPILE, std::to_string(BackgroundPrecompile));
+      }
+      if (Options.is_set_by_user("SpeculativeCompile")) {
+        bool SpeculativeCompile = Options.get("SpeculativeCompile");
+        Set(FEXCore::Config::ConfigOption::CONFIG_SPECULATIVE_COMPILE, std::to_string(SpeculativeCompile));
+      }
+      if (Options.is_set_by_user("TieredCompile")) {
+        bool TieredCompile = Options.get("TieredCompile");
+        Set(FEXCore::Config::ConfigOption::CONFIG_TIERED_COMPILE, std::to_string(TieredCompile));
+      }
+      if (Options.is_set_by_user("SMCPageProtect")) {
+        bool SMCPageProtect = Options.get("SMCPageProtect");
+        Set(FEXCore::Config::ConfigOption::CONFIG_SMC_PAGE_PROTECT, std::to_string(SMCPageProtect));
+      }
+      if (Options.is_set_by_user("LazyFlags")) {
+        bool LazyFlags = Options.get("LazyFlags");
+        Set(FEXCore::Config::ConfigOption::CONFIG_LAZY_FLAGS, std::to_string(LazyFlags));
+      }
+      if (Options.is_set_by_user("LinearScanRA")) {
+        bool LinearScanRA = Options.get("LinearScanRA");
+        Set(FEXCore::Config::ConfigOption::CONFIG_LINEAR_SCAN_RA, std::to_string(LinearScanRA));
+      }
+      if (Options.is_set_by_user("X87ReducedPrecision")) {
+        bool X87ReducedPrecision = Options.get("X87ReducedPrecision");
+        Set(FEXCore::Config::ConfigOption::CONFIG_X87_REDUCED_PRECISION, std::to_string(X87ReducedPrecision));
+      }
+      if (Options.is_set_by_user("CompileThreads")) {
+        uint32_t CompileThreads = Options.get("CompileThreads");
+        Set(FEXCore::Config::ConfigOption::CONFIG_COMPILE_THREADS, std::to_string(CompileThreads));
+      }
+      if (Options.is_set_by_user("ValueNumbering")) {
+        bool ValueNumbering = Options.get("ValueNumbering");
+        Set(FEXCore::Config::ConfigOption::CONFIG_VALUE_NUMBERING, std::to_string(ValueNumbering));
+      }
+      if (Options.is_set_by_user("StaticRegisterAllocation")) {
+        bool StaticRegisterAllocation = Options.get("StaticRegisterAllocation");
+        Set(FEXCore::Config::ConfigOption::CONFIG_STATIC_REGISTER_ALLOCATION, std::to_string(StaticRegisterAllocation));
+      }
     }
 
     {
@@ -241,6 +356,11 @@ namespace FEX::ArgLoader {
         Set(FEXCore::Config::ConfigOption::CONFIG_THUNKLIBSPATH, Option);
       }
 
+      if (Options.is_set_by_user("VDSO")) {
+        bool VDSO = Options.get("VDSO");
+        Set(FEXCore::Config::ConfigOption::CONFIG_VDSO, std::to_string(VDSO));
+      }
+
       if (Options.is_set_by_user("Env")) {
         for (auto iter = Options.all("Env").begin(); iter != Options.all("Env").end(); ++iter) {
           Set(FEXCore::Config::ConfigOption::CONFIG_ENVIRONMENT, *iter);
@@ -188,6 +188,18 @@ namespace FEX::Config {
     {FEXCore::Config::ConfigOption::CONFIG_ABI_LOCAL_FLAGS,    "ABILocalFlags"},
     {FEXCore::Config::ConfigOption::CONFIG_ABI_NO_PF,          "ABINoPF"},
     {FEXCore::Config::ConfigOption::CONFIG_DEBUG_DISABLE_OPTIMIZATION_PASSES, "O0"},
+    {FEXCore::Config::ConfigOption::CONFIG_AOTIR_CACHE,        "AOTIRCache"},
+    {FEXCore::Config::ConfigOption::CONFIG_BACKGROUND_PRECOMPILE, "BackgroundPrecompile"},
+    {FEXCore::Config::ConfigOption::CONFIG_SPECULATIVE_COMPILE, "SpeculativeCompile"},
+    {FEXCore::Config::ConfigOption::CONFIG_TIERED_COMPILE,     "TieredCompile"},
+    {FEXCore::Config::ConfigOption::CONFIG_SMC_PAGE_PROTECT,   "SMCPageProtect"},
+    {FEXCore::Config::ConfigOption::CONFIG_LAZY_FLAGS,         "LazyFlags"},
+    {FEXCore::Config::ConfigOption::CONFIG_LINEAR_SCAN_RA,     "LinearScanRA"},
+    {FEXCore::Config::ConfigOption::CONFIG_X87_REDUCED_PRECISION, "X87ReducedPrecision"},
+    {FEXCore::Config::ConfigOption::CONFIG_VDSO,               "VDSO"},
+    {FEXCore::Config::ConfigOption::CONFIG_COMPILE_THREADS,    "CompileThreads"},
+    {FEXCore::Config::ConfigOption::CONFIG_VALUE_NUMBERING,    "ValueNumbering"},
+    {FEXCore::Config::ConfigOption::CONFIG_STATIC_REGISTER_ALLOCATION, "StaticRegisterAllocation"},
   }};
 
 
@@ -235,6 +247,18 @@ namespace FEX::Config {
     {"ABILocalFlags", FEXCore::Config::ConfigOption::CONFIG_ABI_LOCAL_FLAGS},
     {"AbiNoPF",       FEXCore::Config::ConfigOption::CONFIG_ABI_NO_PF},
     {"O0",            FEXCore::Config::ConfigOption::CONFIG_DEBUG_DISABLE_OPTIMIZATION_PASSES},
+    {"AOTIRCache",    FEXCore::Config::ConfigOption::CONFIG_AOTIR_CACHE},
+    {"BackgroundPrecompile", FEXCore::Config::ConfigOption::CONFIG_BACKGROUND_PRECOMPILE},
+    {"SpeculativeCompile", FEXCore::Config::ConfigOption::CONFIG_SPECULATIVE_COMPILE},
+    {"TieredCompile", FEXCore::Config::ConfigOption::CONFIG_TIERED_COMPILE},
+    {"SMCPageProtect", FEXCore::Config::ConfigOption::CONFIG_SMC_PAGE_PROTECT},
+    {"LazyFlags",     FEXCore::Config::ConfigOption::CONFIG_LAZY_FLAGS},
+    {"LinearScanRA",  FEXCore::Config::ConfigOption::CONFIG_LINEAR_SCAN_RA},
+    {"X87ReducedPrecision", FEXCore::Config::ConfigOption::CONFIG_X87_REDUCED_PRECISION},
+    {"VDSO",          FEXCore::Config::ConfigOption::CONFIG_VDSO},
+    {"CompileThreads", FEXCore::Config::ConfigOption::CONFIG_COMPILE_THREADS},
+    {"ValueNumbering", FEXCore::Config::ConfigOption::CONFIG_VALUE_NUMBERING},
+    {"StaticRegisterAllocation", FEXCore::Config::ConfigOption::CONFIG_STATIC_REGISTER_ALLOCATION},
   }};
 
   void OptionMapper::MapNameToOption(const char *ConfigName, const char *ConfigString) {
@@ -307,7 +331,7 @@ namespace FEX::Config {
       }
     };
 
-    static const std::array<std::pair<std::string, FEXCore::Config::ConfigOption>, 18> ConfigLookup = {{
+    static const std::array<std::pair<std::string, FEXCore::Config::ConfigOption>, 28> ConfigLookup = {{
       {"FEX_CORE",          FEXCore::Config::ConfigOption::CONFIG_DEFAULTCORE},
       {"FEX_MAXINST",       FEXCore::Config::ConfigOption::CONFIG_MAXBLOCKINST},
       {"FEX_SINGLESTEP",    FEXCore::Config::ConfigOption::CONFIG_SINGLESTEP},
@@ -326,6 +350,18 @@ namespace FEX::Config {
       {"FEX_ABINOPF",       FEXCore::Config::ConfigOption::CONFIG_ABI_NO_PF},
       {"FEX_BREAK",         FEXCore::Config::ConfigOption::CONFIG_BREAK_ON_FRONTEND},
       {"FEX_DUMP_GPRS",     FEXCore::Config::ConfigOption::CONFIG_DUMP_GPRS},
+      {"FEX_AOTIRCACHE",    FEXCore::Config::ConfigOption::CONFIG_AOTIR_CACHE},
+      {"FEX_BACKGROUNDPRECOMPILE", FEXCore::Config::ConfigOption::CONFIG_BACKGROUND_PRECOMPILE},
+      {"FEX_SPECULATIVECOMPILE", FEXCore::Config::ConfigOption::CONFIG_SPECULATIVE_COMPILE},
+      {"FEX_TIEREDCOMPILE", FEXCore::Config::ConfigOption::CONFIG_TIERED_COMPILE},
+      {"FEX_SMCPAGEPROTECT", FEXCore::Config::ConfigOption::CONFIG_SMC_PAGE_PROTECT},
+      {"FEX_LAZYFLAGS",     FEXCore::Config::ConfigOption::CONFIG_LAZY_FLAGS},
+      {"FEX_LINEARSCANRA",  FEXCore::Config::ConfigOption::CONFIG_LINEAR_SCAN_RA},
+      {"FEX_X87REDUCEDPRECISION", FEXCore::Config::ConfigOption::CONFIG_X87_REDUCED_PRECISION},
+      {"FEX_VDSO",          FEXCore::Config::ConfigOption::CONFIG_VDSO},
+      {"FEX_COMPILETHREADS", FEXCore::Config::ConfigOption::CONFIG_COMPILE_THREADS},
+      {"FEX_VALUENUMBERING", FEXCore::Config::ConfigOption::CONFIG_VALUE_NUMBERING},
+      {"FEX_STATICREGISTERALLOCATION", FEXCore::Config::ConfigOption::CONFIG_STATIC_REGISTER_ALLOCATION},
     }};
 
     std::optional<std::string_view> Value;
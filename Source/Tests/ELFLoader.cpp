@@ -4,6 +4,7 @@
 #include "HarnessHelpers.h"
 #include "Tests/LinuxSyscalls/Syscalls.h"
 #include "Tests/LinuxSyscalls/SignalDelegator.h"
+#include "Tests/LinuxSyscalls/x64/VDSO.h"
 
 #include <FEXCore/Config/Config.h>
 #include <FEXCore/Core/CodeLoader.h>
@@ -206,6 +207,7 @@ int main(int argc, char **argv, char **const envp) {
   FEXCore::Config::Value<bool> SMCChecksConfig{FEXCore::Config::CONFIG_SMC_CHECKS, false};
   FEXCore::Config::Value<bool> ABILocalFlags{FEXCore::Config::CONFIG_ABI_LOCAL_FLAGS, false};
   FEXCore::Config::Value<bool> AbiNoPF{FEXCore::Config::CONFIG_ABI_NO_PF, false};
+  FEXCore::Config::Value<bool> VDSOConfig{FEXCore::Config::CONFIG_VDSO, false};
 
   ::SilentLog = SilentLog();
 
@@ -241,6 +243,12 @@ int main(int argc, char **argv, char **const envp) {
     return -1;
   }
 
+  uint64_t VDSOBase{};
+  if (VDSOConfig() && Loader.Is64BitMode()) {
+    VDSOBase = FEX::HLE::x64::LoadVDSO();
+    Loader.SetVDSOBase(VDSOBase);
+  }
+
   FEXCore::Context::InitializeStaticTables(Loader.Is64BitMode() ? FEXCore::Context::MODE_64BIT : FEXCore::Context::MODE_32BIT);
   auto CTX = FEXCore::Context::CreateNewContext();
   FEXCore::Context::InitializeContext(CTX);
@@ -275,6 +283,11 @@ int main(int argc, char **argv, char **const envp) {
   FEXCore::Context::SetSyscallHandler(CTX, SyscallHandler.get());
   FEXCore::Context::InitCore(CTX, &Loader);
 
+  // Without the image there is nothing in guest memory that can reach the thunks
+  if (VDSOBase) {
+    FEX::HLE::x64::RegisterVDSOThunks(CTX);
+  }
+
   FEXCore::Context::ExitReason ShutdownReason = FEXCore::Context::ExitReason::EXIT_SHUTDOWN;
 
   // There might already be an exit handler, leave it installed
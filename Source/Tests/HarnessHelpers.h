@@ -351,7 +351,25 @@ namespace FEX::HarnessHelper {
 
     uint64_t SetupStack() override {
       if (Config.Is64BitMode()) {
-        return reinterpret_cast<uint64_t>(mmap(nullptr, STACK_SIZE, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0)) + STACK_SIZE;
+        uint64_t Top = reinterpret_cast<uint64_t>(mmap(nullptr, STACK_SIZE, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0)) + STACK_SIZE;
+        if (!VDSOBase) {
+          return Top;
+        }
+
+        // Start the stack the way the kernel does, with no arguments or environment
+        // The auxv only carries AT_SYSINFO_EHDR so tests can find the vDSO
+        const uint64_t InitialStack[] = {
+          0, // argc
+          0, // argv terminator
+          0, // envp terminator
+          33, VDSOBase, // AT_SYSINFO_EHDR
+          0, 0, // AT_NULL
+        };
+        uint64_t StackPointer = AlignDown(Top - sizeof(InitialStack), 16);
+        memcpy(reinterpret_cast<void*>(StackPointer), InitialStack, sizeof(InitialStack));
+        AuxvBase = StackPointer + 3 * sizeof(uint64_t);
+        AuxvSize = 4 * sizeof(uint64_t);
+        return StackPointer;
       }
       else {
         uint64_t Result = reinterpret_cast<uint64_t>(mmap(reinterpret_cast<void*>(STACK_OFFSET), STACK_SIZE, PROT_READ | PROT_WRITE, MAP_FIXED_NOREPLACE | MAP_PRIVATE | MAP_ANONYMOUS, -1, 0));
@@ -405,6 +423,7 @@ namespace FEX::HarnessHelper {
       Code_start_page = reinterpret_cast<uint64_t>(DoMMap(Code_start_page, Length));
       mprotect(reinterpret_cast<void*>(Code_start_page), Length, PROT_READ | PROT_WRITE | PROT_EXEC);
       RIP = Code_start_page;
+      CodeLength = Length;
 
       // Map the memory regions the test file asks for
       for (auto& [region, size] : Config.GetMemoryRegions()) {
@@ -412,6 +431,11 @@ namespace FEX::HarnessHelper {
       }
     }
 
+    void GetReadableRegions(std::vector<std::pair<uint64_t, uint64_t>> *Regions) override {
+      // Tests only run code out of the file
+      Regions->emplace_back(Code_start_page, CodeLength);
+    }
+
     void LoadMemory() override {
       // Memory base here starts at the start location we passed back with GetLayout()
       // This will write at [CODE_START_RANGE + 0, RawFile.size() )
@@ -427,12 +451,25 @@ namespace FEX::HarnessHelper {
 
     bool Is64BitMode() const { return Config.Is64BitMode(); }
 
+    void GetAuxv(uint64_t& addr, uint64_t& size) override {
+      addr = AuxvBase;
+      size = AuxvSize;
+    }
+
+    void SetVDSOBase(uint64_t Base) {
+      VDSOBase = Base;
+    }
+
   private:
     constexpr static uint64_t STACK_SIZE = PAGE_SIZE;
     constexpr static uint64_t STACK_OFFSET = 0xc000'0000;
     // Zero is special case to know when we are done
     uint64_t Code_start_page = 0x1'0000;
     uint64_t RIP {};
+    uint64_t CodeLength {};
+    uint64_t VDSOBase {};
+    uint64_t AuxvBase {};
+    uint64_t AuxvSize {};
 
     std::vector<char> RawFile;
     ConfigLoader Config;
@@ -703,15 +740,20 @@ public:
   }
 
   void MapMemoryRegion() override {
-    auto DoMMap = [](uint64_t Address, size_t Size, bool FixedNoReplace) -> void* {
+    auto DoMMap = [this](uint64_t Address, size_t Size, bool FixedNoReplace) -> void* {
       void *Result = mmap(reinterpret_cast<void*>(Address), Size, PROT_READ | PROT_WRITE, (FixedNoReplace ? MAP_FIXED_NOREPLACE : MAP_FIXED) | MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
       LogMan::Throw::A(Result != (void*)~0ULL, "Couldn't mmap");
+      MappedRegions.emplace_back(reinterpret_cast<uint64_t>(Result), Size);
       return Result;
     };
 
     DB.MapMemoryRegions(DoMMap);
   }
 
+  void GetReadableRegions(std::vector<std::pair<uint64_t, uint64_t>> *Regions) override {
+    *Regions = MappedRegions;
+  }
+
   void LoadMemory() override {
     auto ELFLoaderWrapper = [&](void const *Data, uint64_t Addr, uint64_t Size) -> void {
       memcpy(reinterpret_cast<void*>(Addr), Data, Size);
@@ -741,6 +783,14 @@ public:
 
   bool Is64BitMode() const { return File.GetMode() == ::ELFLoader::ELFContainer::MODE_64BIT; }
 
+  void SetVDSOBase(uint64_t Base) {
+    for (auto &Aux : AuxVariables) {
+      if (Aux.key == 33) { // AT_SYSINFO_EHDR
+        Aux.val = Base;
+      }
+    }
+  }
+
   ::ELFLoader::ELFContainer::BRKInfo GetBRKInfo() const {
     auto Info = File.GetBRKInfo();
     Info.Base += DB.GetElfBase();
@@ -750,6 +800,7 @@ public:
 private:
   ::ELFLoader::ELFContainer File;
   ::ELFLoader::ELFSymbolDatabase DB;
+  std::vector<std::pair<uint64_t, uint64_t>> MappedRegions;
 
   std::vector<std::string> Args;
   std::vector<std::string> EnvironmentVariables;
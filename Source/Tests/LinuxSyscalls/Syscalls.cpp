@@ -5,7 +5,10 @@
 #include "Tests/LinuxSyscalls/x64/Syscalls.h"
 #include "Tests/LinuxSyscalls/x32/Syscalls.h"
 
+#include <FEXCore/Core/Context.h>
 #include <FEXCore/Core/X86Enums.h>
+#include <FEXCore/Debug/InternalThreadState.h>
+#include <errno.h>
 #include <fcntl.h>
 #include <limits.h>
 #include <linux/futex.h>
@@ -125,6 +128,31 @@ uint32_t SyscallHandler::CalculateHostKernelVersion() {
 }
 
 uint64_t SyscallHandler::HandleSyscall(FEXCore::Core::InternalThreadState *Thread, FEXCore::HLE::SyscallArguments *Args) {
+  if (!SMCPageProtect()) {
+    return InvokeSyscall(Thread, Args);
+  }
+
+  // Guest pages with code on them are read only, the kernel fails a syscall that writes to one with EFAULT
+  // Any argument could be an output buffer, the page it starts on is made writable before the syscall. Some syscalls
+  // have already done their work when the store fails, wait4 has reaped the child and recvmsg has dropped the datagram
+  auto &Def = Definitions[Args->Argument[0]];
+  for (uint8_t i = 1; i <= Def.NumArgs && i < FEXCore::HLE::SyscallArguments::MAX_ARGS; ++i) {
+    FEXCore::Context::UnprotectSMCPages(Thread->CTX, Thread, Args->Argument[i], 1);
+  }
+
+  uint64_t Result = InvokeSyscall(Thread, Args);
+
+  // Buffers that continue on to a protected page, or that are pointed to from a struct, still fail
+  // Everything is made writable and the syscall is run again. Reads and the like fail before anything is consumed, the
+  // small output arguments where that isn't true were made writable above
+  if (Result == -EFAULT && FEXCore::Context::UnprotectSMCPages(Thread->CTX, Thread)) {
+    Result = InvokeSyscall(Thread, Args);
+  }
+
+  return Result;
+}
+
+uint64_t SyscallHandler::InvokeSyscall(FEXCore::Core::InternalThreadState *Thread, FEXCore::HLE::SyscallArguments *Args) {
   auto &Def = Definitions[Args->Argument[0]];
   uint64_t Result{};
   switch (Def.NumArgs) {
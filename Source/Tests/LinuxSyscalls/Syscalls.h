@@ -85,7 +85,18 @@ public:
 
   FEXCore::HLE::SyscallABI GetSyscallABI(uint64_t Syscall) override {
     auto &Def = Definitions.at(Syscall);
-    return {Def.NumArgs, true};
+#ifdef DEBUG_STRACE
+    // Tracing happens in HandleSyscall
+    return {Def.NumArgs, true, nullptr};
+#else
+    if (SMCPageProtect()) {
+      // HandleSyscall makes protected guest code pages writable for the syscall
+      return {Def.NumArgs, true, nullptr};
+    }
+
+    // Missing syscalls take the syscall number instead of their arguments
+    return {Def.NumArgs, true, Def.NumArgs <= 6 ? Def.Ptr : nullptr};
+#endif
   }
 
   uint64_t HandleBRK(FEXCore::Core::InternalThreadState *Thread, void *Addr);
@@ -101,6 +112,7 @@ public:
   FEXCore::Config::Value<std::string> RootFSPath{FEXCore::Config::CONFIG_ROOTFSPATH, ""};
   FEXCore::Config::Value<uint64_t> ThreadsConfig{FEXCore::Config::CONFIG_EMULATED_CPU_CORES, 1};
   FEXCore::Config::Value<bool> Is64BitMode{FEXCore::Config::CONFIG_IS64BIT_MODE, 0};
+  FEXCore::Config::Value<bool> SMCPageProtect{FEXCore::Config::CONFIG_SMC_PAGE_PROTECT, false};
 
   uint32_t GetHostKernelVersion() const { return HostKernelVersion; }
 
@@ -126,6 +138,8 @@ private:
 
   FEX::HLE::SignalDelegator *SignalDelegation;
 
+  uint64_t InvokeSyscall(FEXCore::Core::InternalThreadState *Thread, FEXCore::HLE::SyscallArguments *Args);
+
   std::mutex FutexMutex;
   std::mutex SyscallMutex;
   FEXCore::CodeLoader *LocalLoader{};
@@ -146,6 +160,11 @@ uint64_t HandleSyscall(SyscallHandler *Handler, FEXCore::Core::InternalThreadSta
 #define SYSCALL_ERRNO() do { if (Result == -1) return -errno; return Result; } while(0)
 #define SYSCALL_ERRNO_NULL() do { if (Result == 0) return -errno; return Result; } while(0)
 
+// For handlers that already return -errno on failure
+static inline bool HasSyscallError(uint64_t Result) {
+  return Result > -4096ULL;
+}
+
 extern FEX::HLE::SyscallHandler *_SyscallHandler;
 
 #ifdef DEBUG_STRACE
@@ -1,5 +1,7 @@
 #include "Tests/LinuxSyscalls/Syscalls.h"
 #include "Tests/LinuxSyscalls/x32/Syscalls.h"
+#include <FEXCore/Core/Context.h>
+#include <FEXCore/Debug/InternalThreadState.h>
 
 #include <bitset>
 #include <map>
@@ -12,28 +14,80 @@ namespace FEX::HLE::x32 {
 
   void RegisterMemory() {
     REGISTER_SYSCALL_IMPL_X32(mmap, [](FEXCore::Core::InternalThreadState *Thread, uint32_t addr, uint32_t length, int prot, int flags, int fd, int32_t offset) -> uint64_t {
-      return (uint64_t)static_cast<FEX::HLE::x32::x32SyscallHandler*>(FEX::HLE::_SyscallHandler)->GetAllocator()->
+      if (flags & MAP_FIXED) {
+        FEXCore::Context::RemoveReadableGuestRange(Thread->CTX, addr, length);
+      }
+
+      uint64_t Result = (uint64_t)static_cast<FEX::HLE::x32::x32SyscallHandler*>(FEX::HLE::_SyscallHandler)->GetAllocator()->
         mmap(reinterpret_cast<void*>(addr), length, prot,flags, fd, offset);
+      if (!FEX::HLE::HasSyscallError(Result) && (flags & MAP_FIXED)) {
+        // Anything that was mapped here before is gone
+        FEXCore::Context::InvalidateGuestCodeRange(Thread->CTX, Result, length);
+      }
+
+      if (!FEX::HLE::HasSyscallError(Result) && (prot & PROT_READ)) {
+        FEXCore::Context::AddReadableGuestRange(Thread->CTX, Result, length);
+      }
+      return Result;
     });
 
     REGISTER_SYSCALL_IMPL_X32(mmap2, [](FEXCore::Core::InternalThreadState *Thread, uint32_t addr, uint32_t length, int prot, int flags, int fd, uint32_t pgoffset) -> uint64_t {
-      return (uint64_t)static_cast<FEX::HLE::x32::x32SyscallHandler*>(FEX::HLE::_SyscallHandler)->GetAllocator()->
+      if (flags & MAP_FIXED) {
+        FEXCore::Context::RemoveReadableGuestRange(Thread->CTX, addr, length);
+      }
+
+      uint64_t Result = (uint64_t)static_cast<FEX::HLE::x32::x32SyscallHandler*>(FEX::HLE::_SyscallHandler)->GetAllocator()->
         mmap(reinterpret_cast<void*>(addr), length, prot,flags, fd, (uint64_t)pgoffset * 0x1000);
+      if (!FEX::HLE::HasSyscallError(Result) && (flags & MAP_FIXED)) {
+        FEXCore::Context::InvalidateGuestCodeRange(Thread->CTX, Result, length);
+      }
+
+      if (!FEX::HLE::HasSyscallError(Result) && (prot & PROT_READ)) {
+        FEXCore::Context::AddReadableGuestRange(Thread->CTX, Result, length);
+      }
+      return Result;
     });
 
     REGISTER_SYSCALL_IMPL_X32(munmap, [](FEXCore::Core::InternalThreadState *Thread, void *addr, size_t length) -> uint64_t {
-      return static_cast<FEX::HLE::x32::x32SyscallHandler*>(FEX::HLE::_SyscallHandler)->GetAllocator()->
+      FEXCore::Context::RemoveReadableGuestRange(Thread->CTX, reinterpret_cast<uint64_t>(addr), length);
+      uint64_t Result = static_cast<FEX::HLE::x32::x32SyscallHandler*>(FEX::HLE::_SyscallHandler)->GetAllocator()->
         munmap(addr, length);
+      if (!FEX::HLE::HasSyscallError(Result)) {
+        FEXCore::Context::InvalidateGuestCodeRange(Thread->CTX, reinterpret_cast<uint64_t>(addr), length);
+      }
+      return Result;
     });
 
     REGISTER_SYSCALL_IMPL_X32(mprotect, [](FEXCore::Core::InternalThreadState *Thread, void *addr, uint32_t len, int prot) -> uint64_t {
+      FEXCore::Context::RemoveReadableGuestRange(Thread->CTX, reinterpret_cast<uint64_t>(addr), len);
       uint64_t Result = ::mprotect(addr, len, prot);
+      if (Result != -1) {
+        // Catches code written under W^X and drops any write protection SMC detection had on the range
+        FEXCore::Context::InvalidateGuestCodeRange(Thread->CTX, reinterpret_cast<uint64_t>(addr), len);
+
+        if (prot & PROT_READ) {
+          FEXCore::Context::AddReadableGuestRange(Thread->CTX, reinterpret_cast<uint64_t>(addr), len);
+        }
+      }
       SYSCALL_ERRNO();
     });
 
     REGISTER_SYSCALL_IMPL_X32(mremap, [](FEXCore::Core::InternalThreadState *Thread, void *old_address, size_t old_size, size_t new_size, int flags, void *new_address) -> uint64_t {
-      return reinterpret_cast<uint64_t>(static_cast<FEX::HLE::x32::x32SyscallHandler*>(FEX::HLE::_SyscallHandler)->GetAllocator()->
+      // The protection of the new mapping isn't known here, it only becomes readable again through mprotect
+      FEXCore::Context::RemoveReadableGuestRange(Thread->CTX, reinterpret_cast<uint64_t>(old_address), old_size);
+      if (flags & MREMAP_FIXED) {
+        FEXCore::Context::RemoveReadableGuestRange(Thread->CTX, reinterpret_cast<uint64_t>(new_address), new_size);
+      }
+
+      uint64_t Result = reinterpret_cast<uint64_t>(static_cast<FEX::HLE::x32::x32SyscallHandler*>(FEX::HLE::_SyscallHandler)->GetAllocator()->
         mremap(old_address, old_size, new_size, flags, new_address));
+      if (!FEX::HLE::HasSyscallError(Result)) {
+        FEXCore::Context::InvalidateGuestCodeRange(Thread->CTX, reinterpret_cast<uint64_t>(old_address), old_size);
+        if (Result != reinterpret_cast<uint64_t>(old_address)) {
+          FEXCore::Context::InvalidateGuestCodeRange(Thread->CTX, Result, new_size);
+        }
+      }
+      return Result;
     });
 
     REGISTER_SYSCALL_IMPL_X32(mlockall, [](FEXCore::Core::InternalThreadState *Thread, int flags) -> uint64_t {
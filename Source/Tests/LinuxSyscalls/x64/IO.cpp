@@ -1,11 +1,135 @@
 #include "Tests/LinuxSyscalls/Syscalls.h"
 #include "Tests/LinuxSyscalls/x64/Syscalls.h"
 
+#include <FEXCore/Utils/LogManager.h>
+
+#include <algorithm>
+#include <array>
 #include <linux/aio_abi.h>
+#include <linux/io_uring.h>
 #include <sys/syscall.h>
 #include <unistd.h>
+#include <vector>
 
 namespace FEX::HLE::x64 {
+namespace {
+  // The subset of the io_uring uapi needed for restrictions
+  // Mirrored here since the build headers can be as old as 5.4, which predates all of it
+  // Only io_uring_params is taken from <linux/io_uring.h>
+  namespace IOUring {
+    constexpr uint32_t SETUP_R_DISABLED = 1U << 6;
+
+    constexpr uint32_t REGISTER_PROBE = 8;
+    constexpr uint32_t REGISTER_RESTRICTIONS = 11;
+    constexpr uint32_t REGISTER_ENABLE_RINGS = 12;
+
+    constexpr uint16_t RESTRICTION_REGISTER_OP = 0;
+    constexpr uint16_t RESTRICTION_SQE_OP = 1;
+    constexpr uint16_t RESTRICTION_SQE_FLAGS_ALLOWED = 2;
+
+    // These take guest paths that the kernel would resolve against the host filesystem instead of the rootfs
+    constexpr std::array<uint8_t, 10> PathSQEOps = {
+      18, // IORING_OP_OPENAT
+      21, // IORING_OP_STATX
+      28, // IORING_OP_OPENAT2
+      35, // IORING_OP_RENAMEAT
+      36, // IORING_OP_UNLINKAT
+      37, // IORING_OP_MKDIRAT
+      38, // IORING_OP_SYMLINKAT
+      39, // IORING_OP_LINKAT
+      42, // IORING_OP_SETXATTR
+      44, // IORING_OP_GETXATTR
+    };
+
+    // register_op is a u8, newer kernels are nowhere near this
+    constexpr uint32_t MAX_REGISTER_OPS = 64;
+
+    struct ProbeOp {
+      uint8_t op;
+      uint8_t resv;
+      uint16_t flags;
+      uint32_t resv2;
+    };
+
+    struct Probe {
+      uint8_t last_op;
+      uint8_t ops_len;
+      uint16_t resv;
+      uint32_t resv2[3];
+      // Followed by the ProbeOps
+    };
+
+    struct Restriction {
+      uint16_t opcode;
+      // register_op, sqe_op or sqe_flags depending on opcode
+      uint8_t Value;
+      uint8_t resv;
+      uint32_t resv2[3];
+    };
+
+    static_assert(sizeof(ProbeOp) == 8, "Doesn't match the kernel");
+    static_assert(sizeof(Probe) == 16, "Doesn't match the kernel");
+    static_assert(sizeof(Restriction) == 16, "Doesn't match the kernel");
+  }
+
+  /**
+   * @brief Has the kernel fail path based SQEs with -EACCES, then enables the ring
+   *
+   * The ring needs to have been set up with IORING_SETUP_R_DISABLED. Restrictions apply to io_uring_register as
+   * well so every register op the kernel knows is allowed. SQPOLL rings are covered too since the kernel checks them.
+   *
+   * @return false if the restrictions couldn't be registered, the ring is still disabled then
+   */
+  bool RestrictPathSQEs(int fd) {
+    // The kernel fails the whole list if it has an op it doesn't know
+    // SQE ops can be probed, restrictions are newer than probing so it is always there when they are
+    constexpr size_t MaxProbeOps = 256;
+    std::vector<uint8_t> ProbeData(sizeof(IOUring::Probe) + MaxProbeOps * sizeof(IOUring::ProbeOp));
+    auto Probe = reinterpret_cast<IOUring::Probe*>(ProbeData.data());
+    if (::syscall(SYS_io_uring_register, fd, IOUring::REGISTER_PROBE, Probe, MaxProbeOps) != 0) {
+      return false;
+    }
+
+    std::vector<IOUring::Restriction> Restrictions;
+    for (uint32_t Op = 0; Op <= Probe->last_op; ++Op) {
+      if (std::find(IOUring::PathSQEOps.begin(), IOUring::PathSQEOps.end(), Op) == IOUring::PathSQEOps.end()) {
+        IOUring::Restriction Restriction{};
+        Restriction.opcode = IOUring::RESTRICTION_SQE_OP;
+        Restriction.Value = Op;
+        Restrictions.emplace_back(Restriction);
+      }
+    }
+
+    IOUring::Restriction Flags{};
+    Flags.opcode = IOUring::RESTRICTION_SQE_FLAGS_ALLOWED;
+    Flags.Value = 0xFF;
+    Restrictions.emplace_back(Flags);
+
+    // Register ops can't be probed, drop the newest ones until the kernel knows all of them
+    // A failed registration leaves nothing behind so it can be tried again
+    size_t NumSQERestrictions = Restrictions.size();
+    for (uint32_t LastRegisterOp = IOUring::MAX_REGISTER_OPS; LastRegisterOp > IOUring::REGISTER_ENABLE_RINGS; --LastRegisterOp) {
+      Restrictions.resize(NumSQERestrictions);
+      for (uint32_t Op = 0; Op < LastRegisterOp; ++Op) {
+        IOUring::Restriction Restriction{};
+        Restriction.opcode = IOUring::RESTRICTION_REGISTER_OP;
+        Restriction.Value = Op;
+        Restrictions.emplace_back(Restriction);
+      }
+
+      if (::syscall(SYS_io_uring_register, fd, IOUring::REGISTER_RESTRICTIONS, Restrictions.data(), Restrictions.size()) == 0) {
+        return ::syscall(SYS_io_uring_register, fd, IOUring::REGISTER_ENABLE_RINGS, nullptr, 0) == 0;
+      }
+
+      if (errno != EINVAL) {
+        return false;
+      }
+    }
+
+    return false;
+  }
+}
+
   void RegisterIO() {
     REGISTER_SYSCALL_IMPL_X64(io_getevents, [](FEXCore::Core::InternalThreadState *Thread, aio_context_t ctx_id, long min_nr, long nr, struct io_event *events, struct timespec *timeout) -> uint64_t {
       uint64_t Result = ::syscall(SYS_io_getevents, ctx_id, min_nr, nr, events, timeout);
@@ -16,5 +140,62 @@ namespace FEX::HLE::x64 {
       uint64_t Result = ::syscall(SYS_io_pgetevents, ctx_id, min_nr, nr, events, timeout);
       SYSCALL_ERRNO();
     });
+
+    // The rings are mapped by the guest with a regular mmap of the ring fd, which lands at the same address on the host
+    // SQE, CQE and ring header layouts don't depend on the architecture so the guest and kernel share the rings directly
+    // Known gap: IORING_OP_EPOLL_CTL takes a host epoll_event
+    REGISTER_SYSCALL_IMPL_X64(io_uring_setup, [](FEXCore::Core::InternalThreadState *Thread, unsigned int entries, struct io_uring_params *params) -> uint64_t {
+      if (FEX::HLE::_SyscallHandler->RootFSPath().empty() || !params) {
+        uint64_t Result = ::syscall(SYS_io_uring_setup, entries, params);
+        SYSCALL_ERRNO();
+      }
+
+      // Path based SQEs would skip the rootfs, start the ring disabled so they can be restricted before the guest uses it
+      // A guest that asks for a disabled ring registers its own restrictions, there can only be one set
+      uint32_t GuestFlags = params->flags;
+      bool Restrict = !(GuestFlags & IOUring::SETUP_R_DISABLED);
+      if (Restrict) {
+        params->flags |= IOUring::SETUP_R_DISABLED;
+      }
+
+      int Result = ::syscall(SYS_io_uring_setup, entries, params);
+      params->flags = GuestFlags;
+
+      if (Result == -1 && errno == EINVAL && Restrict) {
+        // Older than 5.10, there are no restrictions
+        Result = ::syscall(SYS_io_uring_setup, entries, params);
+        Restrict = false;
+      }
+
+      if (Result == -1) {
+        return -errno;
+      }
+
+      if (Restrict && !RestrictPathSQEs(Result)) {
+        // Still usable, just without the path checks
+        if (::syscall(SYS_io_uring_register, Result, IOUring::REGISTER_ENABLE_RINGS, nullptr, 0) != 0) {
+          int Error = errno;
+          close(Result);
+          return -Error;
+        }
+        Restrict = false;
+      }
+
+      if (!Restrict) {
+        LogMan::Msg::I("io_uring: path based operations on this ring resolve against the host filesystem, not the rootfs");
+      }
+
+      return Result;
+    });
+
+    REGISTER_SYSCALL_IMPL_X64(io_uring_enter, [](FEXCore::Core::InternalThreadState *Thread, unsigned int fd, unsigned int to_submit, unsigned int min_complete, unsigned int flags, const void *argp, size_t argsz) -> uint64_t {
+      uint64_t Result = ::syscall(SYS_io_uring_enter, fd, to_submit, min_complete, flags, argp, argsz);
+      SYSCALL_ERRNO();
+    });
+
+    REGISTER_SYSCALL_IMPL_X64(io_uring_register, [](FEXCore::Core::InternalThreadState *Thread, unsigned int fd, unsigned int opcode, void *arg, unsigned int nr_args) -> uint64_t {
+      uint64_t Result = ::syscall(SYS_io_uring_register, fd, opcode, arg, nr_args);
+      SYSCALL_ERRNO();
+    });
   }
 }
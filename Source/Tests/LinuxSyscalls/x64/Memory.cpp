@@ -1,6 +1,7 @@
 #include "Tests/LinuxSyscalls/Syscalls.h"
 #include "Tests/LinuxSyscalls/x64/Syscalls.h"
 #include <FEXCore/Core/Context.h>
+#include <FEXCore/Debug/InternalThreadState.h>
 
 #include <sys/mman.h>
 #include <sys/shm.h>
@@ -8,22 +9,59 @@
 namespace FEX::HLE::x64 {
   void RegisterMemory() {
     REGISTER_SYSCALL_IMPL_X64(munmap, [](FEXCore::Core::InternalThreadState *Thread, void *addr, size_t length) -> uint64_t {
+      FEXCore::Context::RemoveReadableGuestRange(Thread->CTX, reinterpret_cast<uint64_t>(addr), length);
       uint64_t Result = ::munmap(addr, length);
+      if (Result != -1) {
+        FEXCore::Context::InvalidateGuestCodeRange(Thread->CTX, reinterpret_cast<uint64_t>(addr), length);
+      }
       SYSCALL_ERRNO();
     });
 
     REGISTER_SYSCALL_IMPL_X64(mmap, [](FEXCore::Core::InternalThreadState *Thread, void *addr, size_t length, int prot, int flags, int fd, off_t offset) -> uint64_t {
+      if (flags & MAP_FIXED) {
+        FEXCore::Context::RemoveReadableGuestRange(Thread->CTX, reinterpret_cast<uint64_t>(addr), length);
+      }
+
       uint64_t Result = reinterpret_cast<uint64_t>(::mmap(addr, length, prot, flags, fd, offset));
+      if (Result != -1 && (flags & MAP_FIXED)) {
+        // Anything that was mapped here before is gone
+        FEXCore::Context::InvalidateGuestCodeRange(Thread->CTX, Result, length);
+      }
+
+      if (Result != -1 && (prot & PROT_READ)) {
+        FEXCore::Context::AddReadableGuestRange(Thread->CTX, Result, length);
+      }
       SYSCALL_ERRNO();
     });
 
     REGISTER_SYSCALL_IMPL_X64(mremap, [](FEXCore::Core::InternalThreadState *Thread, void *old_address, size_t old_size, size_t new_size, int flags, void *new_address) -> uint64_t {
+      // The protection of the new mapping isn't known here, it only becomes readable again through mprotect
+      FEXCore::Context::RemoveReadableGuestRange(Thread->CTX, reinterpret_cast<uint64_t>(old_address), old_size);
+      if (flags & MREMAP_FIXED) {
+        FEXCore::Context::RemoveReadableGuestRange(Thread->CTX, reinterpret_cast<uint64_t>(new_address), new_size);
+      }
+
       uint64_t Result = reinterpret_cast<uint64_t>(::mremap(old_address, old_size, new_size, flags, new_address));
+      if (Result != -1) {
+        FEXCore::Context::InvalidateGuestCodeRange(Thread->CTX, reinterpret_cast<uint64_t>(old_address), old_size);
+        if (Result != reinterpret_cast<uint64_t>(old_address)) {
+          FEXCore::Context::InvalidateGuestCodeRange(Thread->CTX, Result, new_size);
+        }
+      }
       SYSCALL_ERRNO();
     });
 
     REGISTER_SYSCALL_IMPL_X64(mprotect, [](FEXCore::Core::InternalThreadState *Thread, void *addr, size_t len, int prot) -> uint64_t {
+      FEXCore::Context::RemoveReadableGuestRange(Thread->CTX, reinterpret_cast<uint64_t>(addr), len);
       uint64_t Result = ::mprotect(addr, len, prot);
+      if (Result != -1) {
+        // Catches code written under W^X and drops any write protection SMC detection had on the range
+        FEXCore::Context::InvalidateGuestCodeRange(Thread->CTX, reinterpret_cast<uint64_t>(addr), len);
+
+        if (prot & PROT_READ) {
+          FEXCore::Context::AddReadableGuestRange(Thread->CTX, reinterpret_cast<uint64_t>(addr), len);
+        }
+      }
       SYSCALL_ERRNO();
     });
 
@@ -335,6 +335,9 @@ enum Syscalls {
   SYSCALL_x64_statx = 332,
   SYSCALL_x64_io_pgetevents = 333,
   SYSCALL_x64_rseq = 334,
+  SYSCALL_x64_io_uring_setup = 425,
+  SYSCALL_x64_io_uring_enter = 426,
+  SYSCALL_x64_io_uring_register = 427,
 
   SYSCALL_MAX             = 512,
 };
@@ -332,4 +332,7 @@
 { 331, "pkey_free"},
 { 332, "statx"},
 { 333, "io_pgetevents"},
-{ 334, "rseq"},
\ No newline at end of file
+{ 334, "rseq"},
+{ 425, "io_uring_setup"},
+{ 426, "io_uring_enter"},
+{ 427, "io_uring_register"},
\ No newline at end of file
@@ -0,0 +1,319 @@
+#include "Common/MathUtils.h"
+#include "Tests/LinuxSyscalls/Syscalls.h"
+#include "Tests/LinuxSyscalls/x64/VDSO.h"
+
+#include <FEXCore/Core/Context.h>
+#include <FEXCore/Utils/LogManager.h>
+
+#include <array>
+#include <cstring>
+#include <elf.h>
+#include <errno.h>
+#include <sched.h>
+#include <string>
+#include <sys/mman.h>
+#include <sys/time.h>
+#include <time.h>
+
+namespace FEX::HLE::x64 {
+namespace {
+  // The guest stub packs its arguments in to this on its stack, the host function fills in the return value
+  struct VDSOArgs {
+    uint64_t Args[3];
+    uint64_t Rv;
+  };
+
+  // The host side goes through the host libc, which uses the host's vDSO where it has one
+  // Return values follow the kernel's -errno convention like the real vDSO
+  template<typename T>
+  uint64_t ToKernelResult(T Result) {
+    if (Result == -1) {
+      return -errno;
+    }
+    return Result;
+  }
+
+  void ClockGettime(void *ArgsRv) {
+    auto Args = reinterpret_cast<VDSOArgs*>(ArgsRv);
+    Args->Rv = ToKernelResult(::clock_gettime(Args->Args[0], reinterpret_cast<struct timespec*>(Args->Args[1])));
+  }
+
+  void Gettimeofday(void *ArgsRv) {
+    auto Args = reinterpret_cast<VDSOArgs*>(ArgsRv);
+    Args->Rv = ToKernelResult(::gettimeofday(reinterpret_cast<struct timeval*>(Args->Args[0]), reinterpret_cast<struct timezone*>(Args->Args[1])));
+  }
+
+  void Time(void *ArgsRv) {
+    auto Args = reinterpret_cast<VDSOArgs*>(ArgsRv);
+    Args->Rv = ToKernelResult(::time(reinterpret_cast<time_t*>(Args->Args[0])));
+  }
+
+  void Getcpu(void *ArgsRv) {
+    auto Args = reinterpret_cast<VDSOArgs*>(ArgsRv);
+    auto cpu = reinterpret_cast<unsigned*>(Args->Args[0]);
+    auto node = reinterpret_cast<unsigned*>(Args->Args[1]);
+    // tcache is ignored
+    int Result = sched_getcpu();
+    if (Result != -1) {
+      if (cpu) {
+        // Same as the getcpu syscall, don't return a number over our number of emulated cores
+        *cpu = Result % FEX::HLE::_SyscallHandler->ThreadsConfig();
+      }
+
+      if (node) {
+        // Just claim we are part of node zero
+        *node = 0;
+      }
+      Result = 0;
+    }
+    Args->Rv = ToKernelResult(Result);
+  }
+
+  void ClockGetres(void *ArgsRv) {
+    auto Args = reinterpret_cast<VDSOArgs*>(ArgsRv);
+    Args->Rv = ToKernelResult(::clock_getres(Args->Args[0], reinterpret_cast<struct timespec*>(Args->Args[1])));
+  }
+
+  struct VDSOSymbol {
+    const char *Name;
+    // The kernel also exports each function as a weak alias without the prefix
+    const char *Alias;
+    const char *Thunk;
+    void (*Function)(void *ArgsRv);
+  };
+
+  constexpr std::array<VDSOSymbol, 5> Symbols = {{
+    {"__vdso_clock_gettime", "clock_gettime", "fex:vdso_clock_gettime", &ClockGettime},
+    {"__vdso_gettimeofday",  "gettimeofday",  "fex:vdso_gettimeofday",  &Gettimeofday},
+    {"__vdso_time",          "time",          "fex:vdso_time",          &Time},
+    {"__vdso_getcpu",        "getcpu",        "fex:vdso_getcpu",        &Getcpu},
+    {"__vdso_clock_getres",  "clock_getres",  "fex:vdso_clock_getres",  &ClockGetres},
+  }};
+
+  constexpr char SOName[] = "linux-vdso.so.1";
+  constexpr char VersionName[] = "LINUX_2.6";
+
+  // Index 1 is the base version definition, every symbol is in LINUX_2.6
+  constexpr uint16_t SymbolVersion = 2;
+
+  // Symbol 0 is the undefined symbol, then a name and alias for each function
+  constexpr size_t NumSymbols = 1 + Symbols.size() * 2;
+
+  constexpr size_t NumDynamic = 10;
+
+  // Every function takes at most three arguments, they go in a VDSOArgs on the stack
+  // The thunk opcode hands RDI to the host function then returns like a ret, so the stub calls it
+  constexpr uint8_t StubCode[] = {
+    0x48, 0x83, 0xEC, 0x20,             // sub rsp, 0x20
+    0x48, 0x89, 0x3C, 0x24,             // mov [rsp], rdi
+    0x48, 0x89, 0x74, 0x24, 0x08,       // mov [rsp + 0x8], rsi
+    0x48, 0x89, 0x54, 0x24, 0x10,       // mov [rsp + 0x10], rdx
+    0x48, 0x89, 0xE7,                   // mov rdi, rsp
+    0xE8, 0x0A, 0x00, 0x00, 0x00,       // call thunk
+    0x48, 0x8B, 0x44, 0x24, 0x18,       // mov rax, [rsp + 0x18]
+    0x48, 0x83, 0xC4, 0x20,             // add rsp, 0x20
+    0xC3,                               // ret
+                                        // thunk:
+    0x0F, 0x3F,                         // Followed by the thunk name
+  };
+  static_assert(sizeof(VDSOArgs) == 0x20, "Stubs need updating");
+  constexpr size_t StubAlign = 16;
+
+  size_t StubSize(VDSOSymbol const &Symbol) {
+    return sizeof(StubCode) + strlen(Symbol.Thunk) + 1;
+  }
+
+  constexpr size_t ImageSize = 4096;
+
+  uint32_t ElfHash(const char *Name) {
+    uint32_t Hash{};
+    for (; *Name; ++Name) {
+      Hash = (Hash << 4) + static_cast<uint8_t>(*Name);
+      uint32_t High = Hash & 0xF000'0000;
+      if (High) {
+        Hash ^= High >> 24;
+      }
+      Hash &= ~High;
+    }
+    return Hash;
+  }
+}
+
+uint64_t LoadVDSO() {
+  void *Ptr = mmap(nullptr, ImageSize, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+  if (Ptr == MAP_FAILED) {
+    LogMan::Msg::E("Couldn't map the vDSO");
+    return 0;
+  }
+
+  // The image is linked at the address it is mapped at
+  // This keeps the guest's load bias at zero so nothing in the read only dynamic section gets relocated
+  uint8_t *Image = reinterpret_cast<uint8_t*>(Ptr);
+  uint64_t Base = reinterpret_cast<uint64_t>(Ptr);
+
+  std::string DynStr(1, '\0');
+  auto AddString = [&DynStr](const char *String) -> uint32_t {
+    uint32_t Offset = DynStr.size();
+    DynStr.append(String);
+    DynStr.push_back('\0');
+    return Offset;
+  };
+
+  uint32_t SONameString = AddString(SOName);
+  uint32_t VersionString = AddString(VersionName);
+  std::array<uint32_t, NumSymbols> SymbolStrings{};
+  for (size_t i = 0; i < Symbols.size(); ++i) {
+    SymbolStrings[1 + i * 2] = AddString(Symbols[i].Name);
+    SymbolStrings[2 + i * 2] = AddString(Symbols[i].Alias);
+  }
+
+  // Lay out the image
+  size_t Offset{};
+  auto Allocate = [&Offset](size_t Size, size_t Align) -> size_t {
+    Offset = AlignUp(Offset, Align);
+    size_t Result = Offset;
+    Offset += Size;
+    return Result;
+  };
+
+  // Hash table is nbucket, nchain, buckets then chains
+  constexpr size_t NumBuckets = NumSymbols;
+  constexpr size_t HashWords = 2 + NumBuckets + NumSymbols;
+
+  size_t EhdrOffset = Allocate(sizeof(Elf64_Ehdr), 8);
+  size_t PhdrOffset = Allocate(sizeof(Elf64_Phdr) * 2, 8);
+  size_t DynamicOffset = Allocate(sizeof(Elf64_Dyn) * NumDynamic, 8);
+  size_t HashOffset = Allocate(sizeof(uint32_t) * HashWords, 8);
+  size_t SymOffset = Allocate(sizeof(Elf64_Sym) * NumSymbols, 8);
+  size_t VerSymOffset = Allocate(sizeof(uint16_t) * NumSymbols, 2);
+  size_t VerDefOffset = Allocate((sizeof(Elf64_Verdef) + sizeof(Elf64_Verdaux)) * 2, 4);
+  size_t StrOffset = Allocate(DynStr.size(), 1);
+  std::array<size_t, Symbols.size()> StubOffsets{};
+  for (size_t i = 0; i < Symbols.size(); ++i) {
+    StubOffsets[i] = Allocate(StubSize(Symbols[i]), StubAlign);
+  }
+
+  LogMan::Throw::A(Offset <= ImageSize, "vDSO image is larger than its mapping");
+
+  // ELF and program headers
+  Elf64_Ehdr Ehdr{};
+  memcpy(Ehdr.e_ident, ELFMAG, SELFMAG);
+  Ehdr.e_ident[EI_CLASS] = ELFCLASS64;
+  Ehdr.e_ident[EI_DATA] = ELFDATA2LSB;
+  Ehdr.e_ident[EI_VERSION] = EV_CURRENT;
+  Ehdr.e_ident[EI_OSABI] = ELFOSABI_SYSV;
+  Ehdr.e_type = ET_DYN;
+  Ehdr.e_machine = EM_X86_64;
+  Ehdr.e_version = EV_CURRENT;
+  Ehdr.e_phoff = PhdrOffset;
+  Ehdr.e_ehsize = sizeof(Elf64_Ehdr);
+  Ehdr.e_phentsize = sizeof(Elf64_Phdr);
+  Ehdr.e_phnum = 2;
+  Ehdr.e_shstrndx = SHN_UNDEF;
+  memcpy(Image + EhdrOffset, &Ehdr, sizeof(Ehdr));
+
+  std::array<Elf64_Phdr, 2> Phdrs{};
+  Phdrs[0].p_type = PT_LOAD;
+  Phdrs[0].p_flags = PF_R | PF_X;
+  Phdrs[0].p_offset = 0;
+  Phdrs[0].p_vaddr = Base;
+  Phdrs[0].p_paddr = Base;
+  Phdrs[0].p_filesz = Offset;
+  Phdrs[0].p_memsz = Offset;
+  Phdrs[0].p_align = ImageSize;
+
+  Phdrs[1].p_type = PT_DYNAMIC;
+  Phdrs[1].p_flags = PF_R;
+  Phdrs[1].p_offset = DynamicOffset;
+  Phdrs[1].p_vaddr = Base + DynamicOffset;
+  Phdrs[1].p_paddr = Base + DynamicOffset;
+  Phdrs[1].p_filesz = sizeof(Elf64_Dyn) * NumDynamic;
+  Phdrs[1].p_memsz = sizeof(Elf64_Dyn) * NumDynamic;
+  Phdrs[1].p_align = 8;
+  memcpy(Image + PhdrOffset, Phdrs.data(), sizeof(Phdrs));
+
+  // Dynamic section
+  std::array<Elf64_Dyn, NumDynamic> Dynamic = {{
+    {DT_HASH,       {Base + HashOffset}},
+    {DT_STRTAB,     {Base + StrOffset}},
+    {DT_SYMTAB,     {Base + SymOffset}},
+    {DT_STRSZ,      {DynStr.size()}},
+    {DT_SYMENT,     {sizeof(Elf64_Sym)}},
+    {DT_VERSYM,     {Base + VerSymOffset}},
+    {DT_VERDEF,     {Base + VerDefOffset}},
+    {DT_VERDEFNUM,  {2}},
+    {DT_SONAME,     {SONameString}},
+    {DT_NULL,       {0}},
+  }};
+  memcpy(Image + DynamicOffset, Dynamic.data(), sizeof(Dynamic));
+
+  // Symbols and their versions
+  std::array<Elf64_Sym, NumSymbols> Syms{};
+  std::array<uint16_t, NumSymbols> VerSyms{};
+  for (size_t i = 1; i < NumSymbols; ++i) {
+    size_t Function = (i - 1) / 2;
+    bool IsAlias = ((i - 1) & 1) != 0;
+    Syms[i].st_name = SymbolStrings[i];
+    Syms[i].st_info = ELF64_ST_INFO(IsAlias ? STB_WEAK : STB_GLOBAL, STT_FUNC);
+    Syms[i].st_other = STV_DEFAULT;
+    Syms[i].st_shndx = SHN_ABS;
+    Syms[i].st_value = Base + StubOffsets[Function];
+    Syms[i].st_size = StubSize(Symbols[Function]);
+    VerSyms[i] = SymbolVersion;
+  }
+  memcpy(Image + SymOffset, Syms.data(), sizeof(Syms));
+  memcpy(Image + VerSymOffset, VerSyms.data(), sizeof(VerSyms));
+
+  std::array<uint32_t, HashWords> Hash{};
+  uint32_t *Buckets = &Hash[2];
+  uint32_t *Chains = &Hash[2 + NumBuckets];
+  Hash[0] = NumBuckets;
+  Hash[1] = NumSymbols;
+  for (size_t i = 1; i < NumSymbols; ++i) {
+    uint32_t Bucket = ElfHash(&DynStr[SymbolStrings[i]]) % NumBuckets;
+    Chains[i] = Buckets[Bucket];
+    Buckets[Bucket] = i;
+  }
+  memcpy(Image + HashOffset, Hash.data(), sizeof(Hash));
+
+  // Version definitions, the base definition names the library
+  auto WriteVerDef = [&](size_t DefOffset, uint16_t Flags, uint16_t Index, uint32_t NameString, bool Last) {
+    Elf64_Verdef Def{};
+    Def.vd_version = VER_DEF_CURRENT;
+    Def.vd_flags = Flags;
+    Def.vd_ndx = Index;
+    Def.vd_cnt = 1;
+    Def.vd_hash = ElfHash(&DynStr[NameString]);
+    Def.vd_aux = sizeof(Elf64_Verdef);
+    Def.vd_next = Last ? 0 : sizeof(Elf64_Verdef) + sizeof(Elf64_Verdaux);
+
+    Elf64_Verdaux Aux{};
+    Aux.vda_name = NameString;
+    Aux.vda_next = 0;
+
+    memcpy(Image + DefOffset, &Def, sizeof(Def));
+    memcpy(Image + DefOffset + sizeof(Def), &Aux, sizeof(Aux));
+  };
+  WriteVerDef(VerDefOffset, VER_FLG_BASE, 1, SONameString, false);
+  WriteVerDef(VerDefOffset + sizeof(Elf64_Verdef) + sizeof(Elf64_Verdaux), 0, SymbolVersion, VersionString, true);
+
+  memcpy(Image + StrOffset, DynStr.data(), DynStr.size());
+
+  // The stubs call straight in to the host with a thunk, no syscall is emulated
+  for (size_t i = 0; i < Symbols.size(); ++i) {
+    uint8_t *Stub = Image + StubOffsets[i];
+    memcpy(Stub, StubCode, sizeof(StubCode));
+    memcpy(Stub + sizeof(StubCode), Symbols[i].Thunk, strlen(Symbols[i].Thunk) + 1);
+  }
+
+  mprotect(Ptr, ImageSize, PROT_READ | PROT_EXEC);
+
+  return Base;
+}
+
+void RegisterVDSOThunks(FEXCore::Context::Context *CTX) {
+  for (auto &Symbol : Symbols) {
+    FEXCore::Context::RegisterHostThunk(CTX, Symbol.Thunk, Symbol.Function);
+  }
+}
+}
@@ -0,0 +1,26 @@
+#pragma once
+
+#include <cstdint>
+
+namespace FEXCore::Context {
+  struct Context;
+}
+
+namespace FEX::HLE::x64 {
+  /**
+   * @brief Maps an emulated vDSO image in to guest memory
+   *
+   * Exports the same functions as the x86-64 kernel vDSO. Each one is a thunk to a host function
+   * that calls the host libc, and through it the host's vDSO
+   *
+   * @return The guest address of the ELF header for AT_SYSINFO_EHDR, 0 if it couldn't be mapped
+   */
+  uint64_t LoadVDSO();
+
+  /**
+   * @brief Registers the host side of the vDSO thunks, after InitCore and before the guest runs
+   *
+   * Only call this when LoadVDSO returned a mapped image
+   */
+  void RegisterVDSOThunks(FEXCore::Context::Context *CTX);
+}
@@ -4,6 +4,7 @@
 #include "HarnessHelpers.h"
 #include "Tests/LinuxSyscalls/Syscalls.h"
 #include "Tests/LinuxSyscalls/SignalDelegator.h"
+#include "Tests/LinuxSyscalls/x64/VDSO.h"
 
 #include <FEXCore/Config/Config.h>
 #include <FEXCore/Core/CodeLoader.h>
@@ -74,6 +75,7 @@ int main(int argc, char **argv, char **const envp) {
   FEXCore::Config::Value<bool> SMCChecksConfig{FEXCore::Config::CONFIG_SMC_CHECKS, false};
   FEXCore::Config::Value<bool> ABILocalFlags{FEXCore::Config::CONFIG_ABI_LOCAL_FLAGS, false};
   FEXCore::Config::Value<bool> AbiNoPF{FEXCore::Config::CONFIG_ABI_NO_PF, false};
+  FEXCore::Config::Value<bool> VDSOConfig{FEXCore::Config::CONFIG_VDSO, false};
 
   auto Args = FEX::ArgLoader::Get();
 
@@ -81,6 +83,12 @@ int main(int argc, char **argv, char **const envp) {
 
   FEX::HarnessHelper::HarnessCodeLoader Loader{Args[0], Args[1].c_str()};
 
+  uint64_t VDSOBase{};
+  if (VDSOConfig() && Loader.Is64BitMode()) {
+    VDSOBase = FEX::HLE::x64::LoadVDSO();
+    Loader.SetVDSOBase(VDSOBase);
+  }
+
   FEXCore::Context::InitializeStaticTables(Loader.Is64BitMode() ? FEXCore::Context::MODE_64BIT : FEXCore::Context::MODE_32BIT);
   auto CTX = FEXCore::Context::CreateNewContext();
 
@@ -121,6 +129,10 @@ int main(int argc, char **argv, char **const envp) {
   if (!Result1)
     return 1;
 
+  if (VDSOBase) {
+    FEX::HLE::x64::RegisterVDSOThunks(CTX);
+  }
+
   FEXCore::Context::RunUntilExit(CTX);
 
   // Just re-use compare state. It also checks against the expected values in config.
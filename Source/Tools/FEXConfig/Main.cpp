@@ -75,6 +75,16 @@ namespace {
     LoadedConfig->Set(FEXCore::Config::ConfigOption::CONFIG_ABI_LOCAL_FLAGS,    "0");
     LoadedConfig->Set(FEXCore::Config::ConfigOption::CONFIG_ABI_NO_PF,          "0");
     LoadedConfig->Set(FEXCore::Config::ConfigOption::CONFIG_DEBUG_DISABLE_OPTIMIZATION_PASSES, "0");
+    LoadedConfig->Set(FEXCore::Config::ConfigOption::CONFIG_AOTIR_CACHE,        "0");
+    LoadedConfig->Set(FEXCore::Config::ConfigOption::CONFIG_BACKGROUND_PRECOMPILE, "0");
+    LoadedConfig->Set(FEXCore::Config::ConfigOption::CONFIG_SPECULATIVE_COMPILE, "0");
+    LoadedConfig->Set(FEXCore::Config::ConfigOption::CONFIG_TIERED_COMPILE,     "0");
+    LoadedConfig->Set(FEXCore::Config::ConfigOption::CONFIG_SMC_PAGE_PROTECT,   "0");
+    LoadedConfig->Set(FEXCore::Config::ConfigOption::CONFIG_LAZY_FLAGS,         "0");
+    LoadedConfig->Set(FEXCore::Config::ConfigOption::CONFIG_LINEAR_SCAN_RA,     "0");
+    LoadedConfig->Set(FEXCore::Config::ConfigOption::CONFIG_X87_REDUCED_PRECISION, "0");
+    LoadedConfig->Set(FEXCore::Config::ConfigOption::CONFIG_VDSO,               "0");
+    LoadedConfig->Set(FEXCore::Config::ConfigOption::CONFIG_COMPILE_THREADS,    "0");
   }
 
   void SaveFile(std::string Filename) {
@@ -102,6 +112,7 @@ namespace {
   void FillCPUConfig() {
     char BlockSize[32]{};
     char EmulatedCPUCores[32]{};
+    char CompileThreads[32]{};
 
     if (ImGui::BeginTabItem("CPU")) {
       ImGui::Text("Core:");
@@ -134,6 +145,78 @@ namespace {
         ConfigChanged = true;
       }
 
+      Value = LoadedConfig->Get(FEXCore::Config::ConfigOption::CONFIG_AOTIR_CACHE);
+      bool AOTIRCache = Value.has_value() && **Value == "1";
+      if (ImGui::Checkbox("AOT IR Cache", &AOTIRCache)) {
+        LoadedConfig->EraseSet(FEXCore::Config::ConfigOption::CONFIG_AOTIR_CACHE, AOTIRCache ? "1" : "0");
+        ConfigChanged = true;
+      }
+
+      Value = LoadedConfig->Get(FEXCore::Config::ConfigOption::CONFIG_BACKGROUND_PRECOMPILE);
+      bool BackgroundPrecompile = Value.has_value() && **Value == "1";
+      if (ImGui::Checkbox("Background Precompile", &BackgroundPrecompile)) {
+        LoadedConfig->EraseSet(FEXCore::Config::ConfigOption::CONFIG_BACKGROUND_PRECOMPILE, BackgroundPrecompile ? "1" : "0");
+        ConfigChanged = true;
+      }
+
+      Value = LoadedConfig->Get(FEXCore::Config::ConfigOption::CONFIG_SPECULATIVE_COMPILE);
+      bool SpeculativeCompile = Value.has_value() && **Value == "1";
+      if (ImGui::Checkbox("Speculative Compile", &SpeculativeCompile)) {
+        LoadedConfig->EraseSet(FEXCore::Config::ConfigOption::CONFIG_SPECULATIVE_COMPILE, SpeculativeCompile ? "1" : "0");
+        ConfigChanged = true;
+      }
+
+      Value = LoadedConfig->Get(FEXCore::Config::ConfigOption::CONFIG_TIERED_COMPILE);
+      bool TieredCompile = Value.has_value() && **Value == "1";
+      if (ImGui::Checkbox("Tiered Compile", &TieredCompile)) {
+        LoadedConfig->EraseSet(FEXCore::Config::ConfigOption::CONFIG_TIERED_COMPILE, TieredCompile ? "1" : "0");
+        ConfigChanged = true;
+      }
+
+      Value = LoadedConfig->Get(FEXCore::Config::ConfigOption::CONFIG_SMC_PAGE_PROTECT);
+      bool SMCPageProtect = Value.has_value() && **Value == "1";
+      if (ImGui::Checkbox("SMC page protection", &SMCPageProtect)) {
+        LoadedConfig->EraseSet(FEXCore::Config::ConfigOption::CONFIG_SMC_PAGE_PROTECT, SMCPageProtect ? "1" : "0");
+        ConfigChanged = true;
+      }
+
+      Value = LoadedConfig->Get(FEXCore::Config::ConfigOption::CONFIG_LAZY_FLAGS);
+      bool LazyFlags = Value.has_value() && **Value == "1";
+      if (ImGui::Checkbox("Lazy flags", &LazyFlags)) {
+        LoadedConfig->EraseSet(FEXCore::Config::ConfigOption::CONFIG_LAZY_FLAGS, LazyFlags ? "1" : "0");
+        ConfigChanged = true;
+      }
+
+      Value = LoadedConfig->Get(FEXCore::Config::ConfigOption::CONFIG_LINEAR_SCAN_RA);
+      bool LinearScanRA = Value.has_value() && **Value == "1";
+      if (ImGui::Checkbox("Linear scan RA", &LinearScanRA)) {
+        LoadedConfig->EraseSet(FEXCore::Config::ConfigOption::CONFIG_LINEAR_SCAN_RA, LinearScanRA ? "1" : "0");
+        ConfigChanged = true;
+      }
+
+      Value = LoadedConfig->Get(FEXCore::Config::ConfigOption::CONFIG_X87_REDUCED_PRECISION);
+      bool X87ReducedPrecision = Value.has_value() && **Value == "1";
+      if (ImGui::Checkbox("Reduced precision x87", &X87ReducedPrecision)) {
+        LoadedConfig->EraseSet(FEXCore::Config::ConfigOption::CONFIG_X87_REDUCED_PRECISION, X87ReducedPrecision ? "1" : "0");
+        ConfigChanged = true;
+      }
+
+      Value = LoadedConfig->Get(FEXCore::Config::ConfigOption::CONFIG_VDSO);
+      bool VDSO = Value.has_value() && **Value == "1";
+      if (ImGui::Checkbox("Emulated vDSO", &VDSO)) {
+        LoadedConfig->EraseSet(FEXCore::Config::ConfigOption::CONFIG_VDSO, VDSO ? "1" : "0");
+        ConfigChanged = true;
+      }
+
+      Value = LoadedConfig->Get(FEXCore::Config::ConfigOption::CONFIG_COMPILE_THREADS);
+      if (Value.has_value() && !(*Value)->empty()) {
+        strncpy(CompileThreads, &(*Value)->at(0), 32);
+      }
+      if (ImGui::InputText("Compile threads:", CompileThreads, 32, ImGuiInputTextFlags_EnterReturnsTrue)) {
+        LoadedConfig->EraseSet(FEXCore::Config::ConfigOption::CONFIG_COMPILE_THREADS, CompileThreads);
+        ConfigChanged = true;
+      }
+
       Value = LoadedConfig->Get(FEXCore::Config::ConfigOption::CONFIG_EMULATED_CPU_CORES);
       if (Value.has_value() && !(*Value)->empty()) {
         strncpy(EmulatedCPUCores, &(*Value)->at(0), 32);
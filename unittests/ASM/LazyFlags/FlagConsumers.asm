@@ -0,0 +1,41 @@
+%ifdef CONFIG
+{
+  "Match": "All",
+  "RegData": {
+    "RAX": "0",
+    "RBX": "0",
+    "RCX": "1",
+    "RDX": "1",
+    "RSI": "1",
+    "RDI": "0x44"
+  }
+}
+%endif
+
+mov rsp, 0xe0000010
+
+mov rax, -1
+mov rbx, 1
+add rax, rbx ; CF = 1
+
+; INC doesn't touch CF
+inc rbx
+
+mov rcx, 0
+adc rcx, 0
+
+; SETcc reads ZF
+xor rdx, rdx
+setz dl
+
+mov rsi, 0
+cmp rbx, 3
+setb sil
+
+; PUSHF reads every flag
+sub rbx, 2
+pushfq
+pop rdi
+and rdi, 0x8D5
+
+hlt
@@ -0,0 +1,25 @@
+%ifdef CONFIG
+{
+  "Match": "All",
+  "RegData": {
+    "RAX": "2",
+    "RBX": "0x10"
+  }
+}
+%endif
+
+mov rax, 1
+cmp rax, 1
+
+; The jump must see the flags from the ADD, not the CMP
+add rax, 1
+jz .bad
+
+mov rbx, 0x10
+jmp .end
+
+.bad:
+mov rbx, 0x20
+
+.end:
+hlt
@@ -0,0 +1,58 @@
+%ifdef CONFIG
+{
+  "RegData": {
+    "RAX": "0x1800",
+    "RBX": "0x1c00",
+    "RCX": "0x2000",
+    "RDX": "0x2400",
+    "RSI": "0x27f4",
+    "RDI": "0x2b7d",
+    "RBP": "0x2d6c",
+    "R8":  "0x2c04",
+    "R9":  "0x26dc",
+    "R10": "0x208e",
+    "R11": "0x1d34",
+    "R12": "0x1ee4",
+    "R13": "0x2490",
+    "R14": "0x2c0d",
+    "R15": "0"
+  }
+}
+%endif
+
+; Keeps every GPR live through a loop so the allocator has to spill
+mov rax, 1
+mov rbx, 2
+mov rcx, 3
+mov rdx, 4
+mov rsi, 5
+mov rdi, 6
+mov rbp, 7
+mov r8, 8
+mov r9, 9
+mov r10, 10
+mov r11, 11
+mov r12, 12
+mov r13, 13
+mov r14, 14
+mov r15, 10
+
+.loop:
+add rax, rbx
+add rbx, rcx
+add rcx, rdx
+add rdx, rsi
+add rsi, rdi
+add rdi, rbp
+add rbp, r8
+add r8, r9
+add r9, r10
+add r10, r11
+add r11, r12
+add r12, r13
+add r13, r14
+add r14, rax
+dec r15
+jnz .loop
+
+hlt
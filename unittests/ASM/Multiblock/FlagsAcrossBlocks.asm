@@ -0,0 +1,43 @@
+%ifdef CONFIG
+{
+  "Match": "All",
+  "RegData": {
+    "RAX": "1",
+    "RBX": "20",
+    "RCX": "0",
+    "RSI": "0",
+    "RDI": "1"
+  }
+}
+%endif
+
+mov rax, 0
+mov rbx, 0
+mov rcx, 10
+
+; The flags from the add are dead, dec overwrites them
+; The flags from dec are carried across the jmp in to the jnz
+loop_top:
+add rbx, 2
+dec rcx
+jmp loop_check
+loop_check:
+jnz loop_top
+
+; CF is set in one block and consumed in the next
+mov rdx, 1
+cmp rdx, 2
+jmp carry
+carry:
+adc rax, 0
+
+; CF is live around the loop since dec doesn't touch it
+stc
+mov rsi, 3
+mov rdi, 0
+loop2_top:
+dec rsi
+jnz loop2_top
+adc rdi, 0
+
+hlt
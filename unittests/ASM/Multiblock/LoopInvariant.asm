@@ -0,0 +1,39 @@
+%ifdef CONFIG
+{
+  "Match": "All",
+  "RegData": {
+    "RAX": "36",
+    "RBX": "0x0a121a222a323a38",
+    "RCX": "0",
+    "RDX": "0xe0000000",
+    "R8":  "0x4142434445464748",
+    "R9":  "0xe0000010",
+    "R10": "4"
+  }
+}
+%endif
+
+mov rdx, 0xe0000000
+mov rax, 0
+mov rbx, 0
+mov rcx, 8
+mov r10, 0
+
+; The constant, the address base and the load of RDX are the same every iteration
+; R10 is only written on some iterations so its load has to stay in the loop
+loop_top:
+mov r8, 0x4142434445464748
+lea r9, [rdx + 0x10]
+mov [r9 + rcx * 8], rcx
+add rax, [r9 + rcx * 8]
+add rbx, r8
+xor rbx, rcx
+
+test rcx, 1
+jz skip
+add r10, 1
+skip:
+dec rcx
+jnz loop_top
+
+hlt
@@ -0,0 +1,32 @@
+%ifdef CONFIG
+{
+  "Match": "All",
+  "RegData": {
+    "RAX": "0x5"
+  }
+}
+%endif
+
+jmp main
+
+patched_op:
+mov eax, 1
+ret
+
+main:
+
+; warm up the cache, this protects the page
+call patched_op
+
+; patch the immediate to 2
+mov byte [rel patched_op + 1], 2
+call patched_op
+mov rbx, rax
+
+; the page gets protected again when patched_op is recompiled
+mov byte [rel patched_op + 1], 3
+call patched_op
+
+add rax, rbx
+
+hlt
@@ -0,0 +1,80 @@
+%ifdef CONFIG
+{
+  "RegData": {
+    "RAX": "0x20",
+    "RBX": "0x1",
+    "RCX": "0x30",
+    "RDX": "0x1"
+  },
+  "MemoryRegions": {
+    "0x100000000": "4096"
+  }
+}
+%endif
+
+; The kernel writes to guest code through read and readv, the pages are write protected once code runs from them
+; read gets the code page directly, readv only through its iovec and to a different page
+; 0x00: pipe fds
+; 0x08: byte written to the pipe
+; 0x10: iovec for readv
+jmp main
+
+patched_op:
+mov rax,-1
+ret
+
+align 4096
+patched_op2:
+mov rax,-1
+ret
+
+main:
+mov rbp, 0x100000000
+
+; warm up the cache
+call patched_op
+call patched_op2
+
+mov rax, 22 ; pipe
+lea rdi, [rbp]
+syscall
+
+mov byte [rbp + 8], 0xC3
+mov rax, 1 ; write
+mov edi, dword [rbp + 4]
+lea rsi, [rbp + 8]
+mov rdx, 1
+syscall
+
+mov rax, 0 ; read
+mov edi, dword [rbp]
+lea rsi, [rel patched_op]
+mov rdx, 1
+syscall
+mov rbx, rax
+
+mov rax, 1 ; write
+mov edi, dword [rbp + 4]
+lea rsi, [rbp + 8]
+mov rdx, 1
+syscall
+
+lea rax, [rel patched_op2]
+mov qword [rbp + 0x10], rax
+mov qword [rbp + 0x18], 1
+mov rax, 19 ; readv
+mov edi, dword [rbp]
+lea rsi, [rbp + 0x10]
+mov rdx, 1
+syscall
+mov r12, rax
+
+mov rax, 48
+call patched_op2
+mov rcx, rax
+
+mov rax, 32
+call patched_op
+mov rdx, r12
+
+hlt
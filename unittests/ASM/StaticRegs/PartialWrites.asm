@@ -0,0 +1,50 @@
+%ifdef CONFIG
+{
+  "RegData": {
+    "RAX": "0x4142434445461149",
+    "RBX": "0x0000000055565723",
+    "RCX": "0x6162636465663333",
+    "RDX": "0x0000000044444444",
+    "XMM0": ["0x4142434411464748", "0x5152535455565758"],
+    "XMM1": ["0x4142434445464748", "0x5152535411115758"],
+    "XMM2": ["0x1111111145464748", "0x5152535455565758"],
+    "XMM3": ["0x4142434445464748", "0x1111111111111111"]
+  },
+  "MemoryRegions": {
+    "0x100000000": "4096"
+  }
+}
+%endif
+
+; RAX, RBX and XMM0-1 are statically allocated on the JIT, RCX, RDX and XMM2-3 are not
+; Partial writes have to leave the rest of the register alone
+mov rax, 0x4142434445464748
+mov rbx, 0x5152535455565758
+mov rcx, 0x6162636465666768
+mov rdx, 0x7172737475767778
+
+mov ah, 0x11
+mov bl, 0x22
+mov cx, 0x3333
+mov edx, 0x44444444
+add ax, 1
+add ebx, 1
+
+mov rsi, 0xe0000000
+mov r8, 0x4142434445464748
+mov [rsi + 8 * 0], r8
+mov r8, 0x5152535455565758
+mov [rsi + 8 * 1], r8
+
+movaps xmm0, [rsi]
+movaps xmm1, [rsi]
+movaps xmm2, [rsi]
+movaps xmm3, [rsi]
+
+mov r8, 0x1111111111111111
+pinsrb xmm0, r8d, 3
+pinsrw xmm1, r8d, 5
+pinsrd xmm2, r8d, 1
+pinsrq xmm3, r8, 1
+
+hlt
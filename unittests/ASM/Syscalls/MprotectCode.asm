@@ -0,0 +1,44 @@
+%ifdef CONFIG
+{
+  "RegData": {
+    "RAX": "0x2",
+    "RBX": "0x1"
+  }
+}
+%endif
+
+; W^X, the code is written while the page is writable and run once it is executable
+mov r15, 0x110000000
+
+%macro protect 1
+mov rax, 10 ; mprotect
+mov rdi, r15
+mov rsi, 4096
+mov rdx, %1
+syscall
+%endmacro
+
+mov rax, 9 ; mmap
+mov rdi, r15
+mov rsi, 4096
+mov rdx, 3 ; PROT_READ | PROT_WRITE
+mov r10, 0x100022 ; MAP_PRIVATE | MAP_ANONYMOUS | MAP_FIXED_NOREPLACE
+mov r8, -1
+mov r9, 0
+syscall
+
+mov byte [r15], 0xB8 ; mov eax, 1
+mov dword [r15 + 1], 1
+mov byte [r15 + 5], 0xC3 ; ret
+protect 5 ; PROT_READ | PROT_EXEC
+call r15
+mov rbx, rax
+
+protect 3 ; PROT_READ | PROT_WRITE
+mov byte [r15], 0xB8 ; mov eax, 2
+mov dword [r15 + 1], 2
+mov byte [r15 + 5], 0xC3 ; ret
+protect 5 ; PROT_READ | PROT_EXEC
+call r15
+
+hlt
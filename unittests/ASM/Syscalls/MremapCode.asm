@@ -0,0 +1,55 @@
+%ifdef CONFIG
+{
+  "RegData": {
+    "RAX": "0x1",
+    "RBX": "0x1",
+    "R12": "0x2"
+  }
+}
+%endif
+
+; mremap moves the first mapping over the second, the code that ran from the second mapping is gone
+mov r14, 0x110000000
+mov r15, 0x110010000
+
+mov rax, 9 ; mmap
+mov rdi, r14
+mov rsi, 4096
+mov rdx, 7 ; PROT_READ | PROT_WRITE | PROT_EXEC
+mov r10, 0x100022 ; MAP_PRIVATE | MAP_ANONYMOUS | MAP_FIXED_NOREPLACE
+mov r8, -1
+mov r9, 0
+syscall
+
+mov byte [r14], 0xB8 ; mov eax, 1
+mov dword [r14 + 1], 1
+mov byte [r14 + 5], 0xC3 ; ret
+call r14
+mov rbx, rax
+
+mov rax, 9 ; mmap
+mov rdi, r15
+mov rsi, 4096
+mov rdx, 7 ; PROT_READ | PROT_WRITE | PROT_EXEC
+mov r10, 0x100022 ; MAP_PRIVATE | MAP_ANONYMOUS | MAP_FIXED_NOREPLACE
+mov r8, -1
+mov r9, 0
+syscall
+
+mov byte [r15], 0xB8 ; mov eax, 2
+mov dword [r15 + 1], 2
+mov byte [r15 + 5], 0xC3 ; ret
+call r15
+mov r12, rax
+
+mov rax, 25 ; mremap
+mov rdi, r14
+mov rsi, 4096
+mov rdx, 4096
+mov r10, 3 ; MREMAP_MAYMOVE | MREMAP_FIXED
+mov r8, r15
+syscall
+
+call r15
+
+hlt
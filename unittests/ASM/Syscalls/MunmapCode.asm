@@ -0,0 +1,47 @@
+%ifdef CONFIG
+{
+  "RegData": {
+    "RAX": "0x2",
+    "RBX": "0x1"
+  }
+}
+%endif
+
+; Code that ran from a mapping that was unmapped has to be compiled again once something new is mapped there
+mov r15, 0x110000000
+
+mov rax, 9 ; mmap
+mov rdi, r15
+mov rsi, 4096
+mov rdx, 7 ; PROT_READ | PROT_WRITE | PROT_EXEC
+mov r10, 0x100022 ; MAP_PRIVATE | MAP_ANONYMOUS | MAP_FIXED_NOREPLACE
+mov r8, -1
+mov r9, 0
+syscall
+
+mov byte [r15], 0xB8 ; mov eax, 1
+mov dword [r15 + 1], 1
+mov byte [r15 + 5], 0xC3 ; ret
+call r15
+mov rbx, rax
+
+mov rax, 11 ; munmap
+mov rdi, r15
+mov rsi, 4096
+syscall
+
+mov rax, 9 ; mmap
+mov rdi, r15
+mov rsi, 4096
+mov rdx, 7 ; PROT_READ | PROT_WRITE | PROT_EXEC
+mov r10, 0x100022 ; MAP_PRIVATE | MAP_ANONYMOUS | MAP_FIXED_NOREPLACE
+mov r8, -1
+mov r9, 0
+syscall
+
+mov byte [r15], 0xB8 ; mov eax, 2
+mov dword [r15 + 1], 2
+mov byte [r15 + 5], 0xC3 ; ret
+call r15
+
+hlt
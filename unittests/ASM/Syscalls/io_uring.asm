@@ -0,0 +1,147 @@
+%ifdef CONFIG
+{
+  "RegData": {
+    "RAX": "0x1",
+    "RBX": "0x1234",
+    "RCX": "0x0",
+    "RDX": "0x1",
+    "RSI": "0x5678",
+    "RDI": "0x8",
+    "R8":  "0x4142434445464748"
+  },
+  "MemoryRegions": {
+    "0x100000000": "4096"
+  }
+}
+%endif
+
+; io_uring setup, then a NOP and a READV from a pipe through the shared rings
+; 0x000: io_uring_params
+; 0x100: pipe fds
+; 0x108: data written to the pipe
+; 0x110: iovec for the read
+; 0x200: read buffer
+; 0x400: results
+mov rbp, 0x100000000
+
+mov rax, 425 ; io_uring_setup
+mov rdi, 4
+mov rsi, rbp
+syscall
+mov r12, rax
+
+; SQ ring, CQ ring and SQEs
+mov rax, 9 ; mmap
+mov rdi, 0
+mov rsi, 4096
+mov rdx, 3 ; PROT_READ | PROT_WRITE
+mov r10, 0x8001 ; MAP_SHARED | MAP_POPULATE
+mov r8, r12
+mov r9, 0 ; IORING_OFF_SQ_RING
+syscall
+mov r13, rax
+
+mov rax, 9 ; mmap
+mov rdi, 0
+mov rsi, 4096
+mov rdx, 3
+mov r10, 0x8001
+mov r8, r12
+mov r9, 0x8000000 ; IORING_OFF_CQ_RING
+syscall
+mov r15, rax
+
+mov rax, 9 ; mmap
+mov rdi, 0
+mov rsi, 4096
+mov rdx, 3
+mov r10, 0x8001
+mov r8, r12
+mov r9, 0x10000000 ; IORING_OFF_SQES
+syscall
+mov r14, rax
+
+; SQE 0 is a NOP, the mapping starts zeroed
+mov qword [r14 + 32], 0x1234 ; user_data
+mov eax, [rbp + 64] ; sq_off.array
+mov dword [r13 + rax + 0], 0
+mov eax, [rbp + 44] ; sq_off.tail
+mov dword [r13 + rax], 1
+
+mov rax, 426 ; io_uring_enter
+mov rdi, r12
+mov rsi, 1
+mov rdx, 1
+mov r10, 1 ; IORING_ENTER_GETEVENTS
+mov r8, 0
+mov r9, 0
+syscall
+mov [rbp + 0x400], rax
+
+mov eax, [rbp + 100] ; cq_off.cqes
+mov rcx, [r15 + rax + 0] ; user_data
+mov [rbp + 0x408], rcx
+mov ecx, [r15 + rax + 8] ; res
+mov [rbp + 0x410], rcx
+mov eax, [rbp + 80] ; cq_off.head
+mov dword [r15 + rax], 1
+
+; Fill a pipe for the read
+mov rax, 293 ; pipe2
+lea rdi, [rbp + 0x100]
+mov rsi, 0
+syscall
+
+mov rax, 0x4142434445464748
+mov [rbp + 0x108], rax
+mov rax, 1 ; write
+mov edi, [rbp + 0x104]
+lea rsi, [rbp + 0x108]
+mov rdx, 8
+syscall
+
+lea rax, [rbp + 0x200]
+mov [rbp + 0x110], rax
+mov qword [rbp + 0x118], 8
+
+; SQE 1 is a READV of the pipe
+mov byte [r14 + 64], 1 ; IORING_OP_READV
+mov eax, [rbp + 0x100]
+mov dword [r14 + 68], eax ; fd
+mov qword [r14 + 72], 0 ; off
+lea rax, [rbp + 0x110]
+mov qword [r14 + 80], rax ; addr
+mov dword [r14 + 88], 1 ; len
+mov qword [r14 + 96], 0x5678 ; user_data
+mov eax, [rbp + 64] ; sq_off.array
+mov dword [r13 + rax + 4], 1
+mov eax, [rbp + 44] ; sq_off.tail
+mov dword [r13 + rax], 2
+
+mov rax, 426 ; io_uring_enter
+mov rdi, r12
+mov rsi, 1
+mov rdx, 1
+mov r10, 1 ; IORING_ENTER_GETEVENTS
+mov r8, 0
+mov r9, 0
+syscall
+mov [rbp + 0x418], rax
+
+mov eax, [rbp + 100] ; cq_off.cqes
+mov rcx, [r15 + rax + 16] ; user_data
+mov [rbp + 0x420], rcx
+mov ecx, [r15 + rax + 24] ; res
+mov [rbp + 0x428], rcx
+mov eax, [rbp + 80] ; cq_off.head
+mov dword [r15 + rax], 2
+
+mov rax, [rbp + 0x400]
+mov rbx, [rbp + 0x408]
+mov rcx, [rbp + 0x410]
+mov rdx, [rbp + 0x418]
+mov rsi, [rbp + 0x420]
+mov rdi, [rbp + 0x428]
+mov r8,  [rbp + 0x200]
+
+hlt
@@ -0,0 +1,32 @@
+%ifdef CONFIG
+{
+  "Match": "All",
+  "RegData": {
+    "RAX": "0x13880",
+    "RCX": "0",
+    "RDX": "0x4E20"
+  },
+  "MemoryRegions": {
+    "0x100000000": "4096"
+  }
+}
+%endif
+
+mov rsp, 0xe8000000
+
+mov rax, 0
+mov rdx, 0
+mov rcx, 20000
+
+; Runs well past the tier up interval so the loop and function get promoted while running
+loop_top:
+call function
+inc rdx
+dec rcx
+jnz loop_top
+
+hlt
+
+function:
+add rax, 4
+ret
@@ -0,0 +1,29 @@
+%ifdef CONFIG
+{
+  "RegData": {
+    "RBX": "0x4142434445464748",
+    "RDX": "0x3",
+    "RSI": "0x1000",
+    "R8":  "0xFFFFFFFFFFFFFFFF",
+    "R9":  "0x0",
+    "R10": "0x22"
+  }
+}
+%endif
+
+; Six argument syscall with a constant number, the arguments have to survive the call
+mov rax, 9 ; mmap
+mov rdi, 0
+mov rsi, 0x1000
+mov rdx, 3 ; PROT_READ | PROT_WRITE
+mov r10, 0x22 ; MAP_PRIVATE | MAP_ANONYMOUS
+mov r8, -1
+mov r9, 0
+syscall
+
+mov rbx, 0x4142434445464748
+mov [rax], rbx
+mov rbx, 0
+mov rbx, [rax]
+
+hlt
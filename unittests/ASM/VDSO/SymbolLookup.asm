@@ -0,0 +1,218 @@
+%ifdef CONFIG
+{
+  "RegData": {
+    "RAX": "0x0",
+    "RBX": "0x1",
+    "RCX": "0x0",
+    "RDX": "0x1"
+  },
+  "MemoryRegions": {
+    "0x100000000": "4096"
+  }
+}
+%endif
+
+; Finds __vdso_clock_gettime and __vdso_getcpu through AT_SYSINFO_EHDR the way libc does and checks them against the syscalls
+; 0x00: timespec from the vDSO
+; 0x10: timespec from the syscall
+; 0x20: timespec from the vDSO again
+; 0x30: cpu and node from the vDSO
+; 0x38: cpu and node from the syscall
+jmp main
+
+; rdi = name, returns the address of the symbol in rax, 0 if it isn't there
+; r13 = load bias, r14 = symtab, r15 = strtab, r12 = number of symbols
+find_symbol:
+mov r8, 1 ; Symbol 0 is always the undefined symbol
+.sym_loop:
+cmp r8, r12
+jae .not_found
+imul r9, r8, 24
+add r9, r14
+mov esi, dword [r9]
+add rsi, r15
+mov r10, rdi
+.str_loop:
+mov al, byte [rsi]
+cmp al, byte [r10]
+jne .next_sym
+inc rsi
+inc r10
+test al, al
+jnz .str_loop
+mov rax, qword [r9 + 8]
+add rax, r13
+ret
+.next_sym:
+inc r8
+jmp .sym_loop
+.not_found:
+xor eax, eax
+ret
+
+; rax = timespec address, returns the time in nanoseconds in rax
+to_ns:
+imul rdx, qword [rax], 1000000000
+add rdx, qword [rax + 8]
+mov rax, rdx
+ret
+
+clock_gettime_name:
+db '__vdso_clock_gettime', 0
+getcpu_name:
+db '__vdso_getcpu', 0
+
+main:
+mov rbp, 0x100000000
+
+; Skip argc, argv and envp to get to the auxv
+mov rsi, rsp
+mov rax, qword [rsi]
+lea rsi, [rsi + rax * 8 + 16]
+.envp_loop:
+mov rax, qword [rsi]
+add rsi, 8
+test rax, rax
+jnz .envp_loop
+
+.auxv_loop:
+mov rax, qword [rsi]
+cmp rax, 33 ; AT_SYSINFO_EHDR
+je .found_vdso
+test rax, rax
+jz failed
+add rsi, 16
+jmp .auxv_loop
+
+.found_vdso:
+mov rbx, qword [rsi + 8]
+
+; The PT_LOAD at offset zero gives the load bias, PT_DYNAMIC the dynamic section
+mov rsi, qword [rbx + 0x20] ; e_phoff
+add rsi, rbx
+movzx ecx, word [rbx + 0x38] ; e_phnum
+xor r13, r13
+xor r11, r11
+.phdr_loop:
+test ecx, ecx
+jz .phdr_done
+mov eax, dword [rsi]
+cmp eax, 1 ; PT_LOAD
+jne .not_load
+cmp qword [rsi + 0x8], 0 ; p_offset
+jne .next_phdr
+mov r13, rbx
+sub r13, qword [rsi + 0x10]
+jmp .next_phdr
+.not_load:
+cmp eax, 2 ; PT_DYNAMIC
+jne .next_phdr
+mov r11, qword [rsi + 0x10]
+.next_phdr:
+add rsi, 0x38
+dec ecx
+jmp .phdr_loop
+
+.phdr_done:
+test r11, r11
+jz failed
+add r11, r13
+
+; The hash table's nchain is the number of symbols
+xor r12, r12
+xor r14, r14
+xor r15, r15
+.dyn_loop:
+mov rax, qword [r11]
+test rax, rax
+jz .dyn_done
+mov rdx, qword [r11 + 8]
+add rdx, r13
+cmp rax, 4 ; DT_HASH
+jne .not_hash
+mov r12d, dword [rdx + 4]
+.not_hash:
+cmp rax, 5 ; DT_STRTAB
+cmove r15, rdx
+cmp rax, 6 ; DT_SYMTAB
+cmove r14, rdx
+add r11, 16
+jmp .dyn_loop
+
+.dyn_done:
+lea rdi, [rel clock_gettime_name]
+call find_symbol
+test rax, rax
+jz failed
+mov qword [rbp + 0x40], rax
+
+lea rdi, [rel getcpu_name]
+call find_symbol
+test rax, rax
+jz failed
+mov qword [rbp + 0x48], rax
+
+; clock_gettime(CLOCK_MONOTONIC), vDSO then syscall then vDSO, has to be monotonic
+mov rdi, 1
+lea rsi, [rbp]
+call qword [rbp + 0x40]
+mov r12, rax
+
+mov rax, 228 ; clock_gettime
+mov rdi, 1
+lea rsi, [rbp + 0x10]
+syscall
+or r12, rax
+
+mov rdi, 1
+lea rsi, [rbp + 0x20]
+call qword [rbp + 0x40]
+or r12, rax
+
+lea rax, [rbp]
+call to_ns
+mov r13, rax
+lea rax, [rbp + 0x10]
+call to_ns
+mov r14, rax
+lea rax, [rbp + 0x20]
+call to_ns
+mov r15, rax
+
+xor ebx, ebx
+cmp r13, r14
+ja .not_monotonic
+cmp r14, r15
+ja .not_monotonic
+mov ebx, 1
+.not_monotonic:
+
+; getcpu, vDSO then syscall, both have to agree
+lea rdi, [rbp + 0x30]
+lea rsi, [rbp + 0x34]
+xor edx, edx
+call qword [rbp + 0x48]
+mov r13, rax
+
+mov rax, 309 ; getcpu
+lea rdi, [rbp + 0x38]
+lea rsi, [rbp + 0x3C]
+xor edx, edx
+syscall
+or r13, rax
+
+mov rax, qword [rbp + 0x30]
+xor edx, edx
+cmp rax, qword [rbp + 0x38]
+sete dl
+
+mov rax, r12
+mov rcx, r13
+hlt
+
+failed:
+mov rax, -1
+mov rbx, -1
+mov rcx, -1
+mov rdx, -1
+hlt
@@ -0,0 +1,48 @@
+%ifdef CONFIG
+{
+  "RegData": {
+    "MM7": ["0xAAAAAB0000000000", "0x3FFD"],
+    "MM6": ["0xAAAAAAAAAAAAAAAB", "0x3FFD"],
+    "MM5": ["0xAAAAAAAAAAAAAAAA", "0x3FFD"]
+  }
+}
+%endif
+
+; fldcw has to apply the precision control and rounding mode to the following ops
+
+; Single precision, round to nearest
+lea rdx, [rel fcw_single]
+fldcw [rdx]
+fld1
+lea rdx, [rel three]
+fld tword [rdx]
+fdivp st1, st0
+
+; Extended precision, round to nearest
+lea rdx, [rel fcw_extended]
+fldcw [rdx]
+fld1
+lea rdx, [rel three]
+fld tword [rdx]
+fdivp st1, st0
+
+; Extended precision, round down
+lea rdx, [rel fcw_down]
+fldcw [rdx]
+fld1
+lea rdx, [rel three]
+fld tword [rdx]
+fdivp st1, st0
+
+hlt
+
+align 8
+three:
+  dt 3.0
+  dq 0
+fcw_single:
+  dw 0x007F
+fcw_extended:
+  dw 0x037F
+fcw_down:
+  dw 0x077F
@@ -0,0 +1,68 @@
+%ifdef CONFIG
+{
+  "RegData": {
+    "RAX": "0xB7F",
+    "RBX": "0x3",
+    "RCX": "0x37F",
+    "RDX": "0x2"
+  },
+  "MemoryRegions": {
+    "0x100000000": "4096"
+  }
+}
+%endif
+
+; The FCW survives a syscall and a signal handler, the handler runs with the default FCW
+; 0x000: sigaction
+; 0x100: round up FCW
+; 0x108: 2.5
+; 0x110: results
+mov rbp, 0x100000000
+
+lea rax, [rel handler]
+mov [rbp + 0], rax
+mov qword [rbp + 8], 0x04000000 ; SA_RESTORER
+lea rax, [rel restorer]
+mov [rbp + 16], rax
+mov qword [rbp + 24], 0
+
+mov rax, 13 ; rt_sigaction
+mov rdi, 10 ; SIGUSR1
+mov rsi, rbp
+mov rdx, 0
+mov r10, 8
+syscall
+
+mov word [rbp + 0x100], 0x0B7F
+mov rax, 0x4004000000000000 ; 2.5
+mov [rbp + 0x108], rax
+fldcw [rbp + 0x100]
+
+mov rax, 39 ; getpid
+syscall
+
+mov rdi, rax
+mov rax, 62 ; kill
+mov rsi, 10
+syscall
+
+fnstcw [rbp + 0x110]
+fld qword [rbp + 0x108]
+fistp dword [rbp + 0x118]
+
+movzx eax, word [rbp + 0x110]
+mov ebx, [rbp + 0x118]
+movzx ecx, word [rbp + 0x120]
+mov edx, [rbp + 0x128]
+
+hlt
+
+handler:
+fnstcw [rbp + 0x120]
+fld qword [rbp + 0x108]
+fistp dword [rbp + 0x128]
+ret
+
+restorer:
+mov rax, 15 ; rt_sigreturn
+syscall
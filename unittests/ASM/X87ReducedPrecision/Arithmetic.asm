@@ -0,0 +1,87 @@
+%ifdef CONFIG
+{
+  "RegData": {
+    "RAX": "0x3FF8000000000000",
+    "RBX": "0x400921FB54442D18",
+    "RCX": "0xFFFFFFF8",
+    "R8":  "1",
+    "R9":  "0x41000000",
+    "R10": "0x3FD5555555555555",
+    "R11": "0x3FF0000000000000",
+    "R12": "0",
+    "R13": "0x4008000000000000",
+    "R14": "0xC014000000000000"
+  }
+}
+%endif
+
+; Results go through memory so they are the same with either stack format
+lea rdx, [rel data]
+
+; Float and integer memory operands
+fld qword [rdx + 0]
+fadd qword [rdx + 8]
+fmul dword [rdx + 16]
+fisub word [rdx + 20]
+fidiv dword [rdx + 24]
+fstp qword [rdx + 32]
+mov rax, [rdx + 32]
+
+; Constants are rounded to the nearest double
+fldpi
+fstp qword [rdx + 32]
+mov rbx, [rdx + 32]
+
+fild dword [rdx + 28]
+fsqrt
+fchs
+fist dword [rdx + 40]
+mov ecx, [rdx + 40]
+fabs
+
+mov r8, 0
+fld1
+fcomip st0, st1
+setb r8b
+fstp dword [rdx + 40]
+mov r9d, [rdx + 40]
+
+fld1
+fdiv qword [rdx + 48]
+fstp qword [rdx + 32]
+mov r10, [rdx + 32]
+
+; Ops without a double implementation convert to 80bit and back
+fldz
+fsincos
+fstp qword [rdx + 32]
+mov r11, [rdx + 32]
+fstp qword [rdx + 32]
+mov r12, [rdx + 32]
+
+fld tword [rdx + 56]
+fstp qword [rdx + 32]
+mov r13, [rdx + 32]
+
+fild qword [rdx + 72]
+fstp qword [rdx + 32]
+mov r14, [rdx + 32]
+
+hlt
+
+align 8
+data:
+  dq 1.5
+  dq 2.25
+  dd 4.0
+  dw 3
+  dw 0
+  dd 8
+  dd 64
+  dq 0
+  dq 0
+  dq 3.0
+  dt 3.0
+  dw 0
+  dd 0
+  dq -5
@@ -0,0 +1,72 @@
+%ifdef CONFIG
+{
+  "RegData": {
+    "RAX": "0x2",
+    "RBX": "0xFFFFFFFE",
+    "RCX": "0x2",
+    "RSI": "0xFFFFFFFD",
+    "RDI": "0x3",
+    "R8":  "0xFFFFFFFE",
+    "R9":  "0x2",
+    "R10": "0xFFFFFFFE",
+    "R11": "0x1F80"
+  }
+}
+%endif
+
+; FIST rounds with the FCW rounding control, the MXCSR is left alone
+lea rdx, [rel data]
+
+fld qword [rdx + 0]
+fld qword [rdx + 8]
+
+; Nearest
+fldcw [rdx + 16]
+fist dword [rdx + 32]
+mov ebx, [rdx + 32]
+fxch
+fist dword [rdx + 32]
+mov eax, [rdx + 32]
+fxch
+
+; Down
+fldcw [rdx + 18]
+fist dword [rdx + 32]
+mov esi, [rdx + 32]
+fxch
+fist dword [rdx + 32]
+mov ecx, [rdx + 32]
+fxch
+
+; Up
+fldcw [rdx + 20]
+fist dword [rdx + 32]
+mov r8d, [rdx + 32]
+fxch
+fist dword [rdx + 32]
+mov edi, [rdx + 32]
+fxch
+
+; Zero
+fldcw [rdx + 22]
+fist dword [rdx + 32]
+mov r10d, [rdx + 32]
+fxch
+fist dword [rdx + 32]
+mov r9d, [rdx + 32]
+
+stmxcsr [rdx + 32]
+mov r11d, [rdx + 32]
+
+hlt
+
+align 8
+data:
+  dq 2.5
+  dq -2.5
+  dw 0x037F
+  dw 0x077F
+  dw 0x0B7F
+  dw 0x0F7F
+  dq 0
+  dq 0